@@ -0,0 +1,565 @@
+/*!****************************************************************************
+ * @file
+ * HostCore.c
+ *
+ * Virtuelle Zeit, Ereignisquellen und Interruptsteuerung der Host-Simulation.
+ * Die Zeit luft nur durch Bibliotheksaufrufe und durch Sprnge zum
+ * nchsten Ereignis in WFI, HALT und Warteschleifen. Interrupts sind
+ * pegelgesteuert: nach jeder Serviceroutine wird erneut geprft, der
+ * kleinste anstehende Vektor gewinnt. Verschachtelte Interrupts gibt es
+ * wie in der Firmware (alle Vektoren gleiche Prioritt) nicht.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Spannungsausfall bei einem Schreibvorgang
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include "HostCore.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Hchstzahl an Ereignissen ohne Zeitfortschritt                            */
+#define HOSTCORE_FIRE_LIMIT     100000u
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Aktuelle Echtzeit in ns                                                   */
+HostCore_Time ullHostNow;
+
+/*! Frhestes Ereignis in Echtzeit, erzwingt HostCore_Process()               */
+HostCore_Time ullHostDue;
+
+/*! Zhler der Bibliotheksaufrufe                                             */
+uint32_t ulHostCalls;
+
+/*! Nchster Abgleich der direkt gelesenen Register (Schattenregister)        */
+HostCore_Time ullHostSyncAt = HOSTCORE_NEVER;
+
+/*! Zhler der Schreibvorgnge auf Karte (Sektor) und EEPROM (Wort)           */
+uint32_t ulHostWrites;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Angemeldete Ereignisquellen                                               */
+static HostCore_Source* pHostSources;
+
+/*! Anforderungen je Vektor                                                   */
+static bool (*apfnHostPending[HOSTCORE_VEC_NUM])(void);
+
+/*! Abgleich der direkt gelesenen Register                                    */
+static void (*pfnHostSync)(void);
+
+/*! Abstand der Laufzeit zur Echtzeit: Startzeit und Summe der HALT-Phasen    */
+static HostCore_Time ullHostHaltTotal;
+
+/*! Beginn der laufenden HALT-Phase                                           */
+static HostCore_Time ullHostHaltStart;
+
+/*! CPU steht in HALT                                                         */
+static bool bHostHalted;
+
+/*! Interrupts freigegeben (I-Bits der CPU)                                   */
+static bool bHostIrqEnabled;
+
+/*! Serviceroutine luft                                                      */
+static uint8_t ucHostIsrDepth;
+
+/*! Ereignisse werden gerade bearbeitet                                       */
+static bool bHostFiring;
+
+/*! Letzte Abfrage: Schlssel, Aufrufzhler, Wiederholungen, Beginn           */
+static uint32_t ulHostPollKey;
+static uint32_t ulHostPollCalls;
+static uint8_t ucHostPollRepeat;
+static HostCore_Time ullHostPollSince;
+
+/*! Schreibvorgang mit Spannungsausfall (0: keiner) und Behandlung            */
+static uint32_t ulHostCutAt;
+static void (*pfnHostCut)(void);
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Ereigniszeit einer Quelle in Echtzeit bestimmen
+ *
+ * @param[in] pSrc      Quelle
+ * @return    HostCore_Time  Echtzeit oder HOSTCORE_NEVER
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static HostCore_Time HostCore_RealTime(const HostCore_Source* pSrc)
+{
+  if (pSrc->ullNext == HOSTCORE_NEVER)
+  {
+    return HOSTCORE_NEVER;
+  }
+  if (!pSrc->bSysClk)
+  {
+    return pSrc->ullNext;
+  }
+  if (bHostHalted)
+  {
+    return HOSTCORE_NEVER;
+  }
+  return pSrc->ullNext + ullHostHaltTotal;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Alle flligen Ereignisse bearbeiten und das nchste bestimmen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostCore_Fire(void)
+{
+  HostCore_Source* pSrc;
+  HostCore_Time ullNext;
+  HostCore_Time ullAt;
+  uint32_t ulFired = 0;
+  bool bFired;
+  
+  if (bHostFiring)
+  {
+    return;
+  }
+  bHostFiring = true;
+  do
+  {
+    bFired = false;
+    ullNext = HOSTCORE_NEVER;
+    for (pSrc = pHostSources; pSrc != NULL; pSrc = pSrc->pNext)
+    {
+      ullAt = HostCore_RealTime(pSrc);
+      if (ullAt <= ullHostNow)
+      {
+        pSrc->ullNext = HOSTCORE_NEVER;
+        pSrc->pfnFire();
+        bFired = true;
+        if (++ulFired > HOSTCORE_FIRE_LIMIT)
+        {
+          HostCore_Fatal("Ereignisschleife in %s", pSrc->pszName);
+        }
+      }
+      else if (ullAt < ullNext)
+      {
+        ullNext = ullAt;
+      }
+    }
+  } while (bFired);
+  ullHostDue = ullNext;
+  bHostFiring = false;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Vektor mit der hchsten anstehenden Anforderung suchen
+ *
+ * @return    int       Vektor oder -1
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int HostCore_Pending(void)
+{
+  int iVec;
+  
+  for (iVec = 0; iVec < HOSTCORE_VEC_NUM; ++iVec)
+  {
+    if ((apfnHostPending[iVec] != NULL) && apfnHostPending[iVec]())
+    {
+      return iVec;
+    }
+  }
+  return -1;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anstehende Interrupts nacheinander bedienen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostCore_DispatchAll(void)
+{
+  int iVec;
+  
+  while (bHostIrqEnabled && (ucHostIsrDepth == 0)
+    && ((iVec = HostCore_Pending()) >= 0))
+  {
+    /* Eintritt und Rcksprung kosten je einen Schritt    */
+    ullHostNow += HOSTCORE_STEP_NS;
+    ulHostPollKey = 0;
+    HostCore_Sync();
+    ++ucHostIsrDepth;
+    HostVector_Call((uint8_t)iVec);
+    --ucHostIsrDepth;
+    ullHostNow += HOSTCORE_STEP_NS;
+    ulHostPollKey = 0;
+    if (ullHostNow >= ullHostDue)
+    {
+      HostCore_Fire();
+    }
+  }
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Kern zurcksetzen, Interrupts wie nach dem Reset gesperrt
+ *
+ * @param[in] ullStart  Echtzeit beim Start in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Init(HostCore_Time ullStart)
+{
+  ullHostNow = ullStart;
+  ullHostDue = HOSTCORE_NEVER;
+  ullHostSyncAt = HOSTCORE_NEVER;
+  pfnHostSync = NULL;
+  ulHostCalls = 0;
+  ulHostWrites = 0;
+  ulHostCutAt = 0;
+  ullHostHaltTotal = ullStart;
+  bHostHalted = false;
+  bHostIrqEnabled = false;
+  ucHostIsrDepth = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ereignisquelle anmelden
+ *
+ * @param[in] pSrc      Quelle, ullNext wird bernommen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_AddSource(HostCore_Source* pSrc)
+{
+  pSrc->pNext = pHostSources;
+  pHostSources = pSrc;
+  HostCore_Schedule(pSrc, pSrc->ullNext);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung eines Vektors anmelden
+ *
+ * @param[in] pIrq      Vektor und Abfrage
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_AddIrq(const HostCore_Irq* pIrq)
+{
+  apfnHostPending[pIrq->ucVector] = pIrq->pfnPending;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abgleich fr Register setzen, die die Firmware ohne Bibliotheksaufruf
+ * liest. Die Funktion setzt ullHostSyncAt auf den nchsten Abgleich.
+ *
+ * @param[in] pfnSync   Abgleich
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_SetSync(void (*pfnSync)(void))
+{
+  pfnHostSync = pfnSync;
+  ullHostSyncAt = ullHostNow;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Direkt gelesene Register abgleichen, falls die Zeit ihren Stand
+ * berholt hat
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Sync(void)
+{
+  if ((pfnHostSync != NULL) && (ullHostNow >= ullHostSyncAt))
+  {
+    pfnHostSync();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchstes Ereignis einer Quelle setzen
+ *
+ * @param[in] pSrc      Quelle
+ * @param[in] ullAt     Zeitpunkt in der Zeitbasis der Quelle
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Schedule(HostCore_Source* pSrc, HostCore_Time ullAt)
+{
+  HostCore_Time ullReal;
+  
+  pSrc->ullNext = ullAt;
+  ullReal = HostCore_RealTime(pSrc);
+  if (ullReal < ullHostDue)
+  {
+    ullHostDue = ullReal;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchstes Ereignis einer Quelle relativ zu jetzt setzen
+ *
+ * @param[in] pSrc      Quelle
+ * @param[in] ullDelay  Abstand in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_ScheduleIn(HostCore_Source* pSrc, HostCore_Time ullDelay)
+{
+  HostCore_Schedule(pSrc,
+    (pSrc->bSysClk ? HostCore_RunTime() : ullHostNow) + ullDelay);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufzeit am Systemtakt abfragen (Echtzeit ohne HALT-Phasen)
+ *
+ * @return    HostCore_Time  Laufzeit in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+HostCore_Time HostCore_RunTime(void)
+{
+  return (bHostHalted ? ullHostHaltStart : ullHostNow) - ullHostHaltTotal;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob die CPU in HALT steht
+ *
+ * @return    bool      true in HALT
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostCore_IsHalted(void)
+{
+  return bHostHalted;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fllige Ereignisse bearbeiten und anstehende Interrupts bedienen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Process(void)
+{
+  HostCore_Fire();
+  HostCore_DispatchAll();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Flag abfragen: Wiederholt die Firmware dieselbe Abfrage ohne anderen
+ * Bibliotheksaufruf dazwischen, springt die Zeit zum nchsten Ereignis.
+ *
+ * @param[in] ulKey     Schlssel der Abfrage (Peripherie und Flag)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Poll(uint32_t ulKey)
+{
+  if ((ulKey == ulHostPollKey) && (ulHostCalls == ulHostPollCalls))
+  {
+    if (++ucHostPollRepeat >= HOSTCORE_POLL_SPIN)
+    {
+      ucHostPollRepeat = 0;
+      if (ullHostDue == HOSTCORE_NEVER)
+      {
+        HostCore_Fatal("Warteschleife ohne Ereignis (%08lX)",
+          (unsigned long)ulKey);
+      }
+      if (ullHostNow - ullHostPollSince >= HOSTCORE_POLL_LIMIT)
+      {
+        HostCore_Fatal("Warteschleife seit %u s (%08lX)",
+          (unsigned)((ullHostNow - ullHostPollSince) / HOSTCORE_S(1)),
+          (unsigned long)ulKey);
+      }
+      if (ullHostDue > ullHostNow)
+      {
+        ullHostNow = ullHostDue - HOSTCORE_STEP_NS;
+      }
+    }
+  }
+  else
+  {
+    if (ulKey != ulHostPollKey)
+    {
+      ullHostPollSince = ullHostNow;
+    }
+    ulHostPollKey = ulKey;
+    ucHostPollRepeat = 0;
+  }
+  HostCore_Step();
+  ulHostPollCalls = ulHostCalls;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anforderung einer Peripherie hat sich gendert: sofort prfen wie nach
+ * dem Registerzugriff auf dem Zielsystem
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Raise(void)
+{
+  ullHostDue = ullHostNow;
+  if (!bHostFiring)
+  {
+    HostCore_Process();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * WFI oder HALT: Interrupts freigeben und bis zum nchsten Interrupt
+ * vorspulen. In HALT stehen alle Quellen am Systemtakt.
+ *
+ * @param[in] bHalt     true fr HALT, false fr WFI
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Wait(bool bHalt)
+{
+  HostCore_Step();
+  bHostIrqEnabled = true;
+  if (bHalt)
+  {
+    bHostHalted = true;
+    ullHostHaltStart = ullHostNow;
+  }
+  
+  HostCore_Fire();
+  while (HostCore_Pending() < 0)
+  {
+    if (ullHostDue == HOSTCORE_NEVER)
+    {
+      HostCore_Fatal("%s ohne Weckquelle", bHalt ? "HALT" : "WFI");
+    }
+    if (ullHostDue > ullHostNow)
+    {
+      ullHostNow = ullHostDue;
+    }
+    HostCore_Fire();
+  }
+  
+  if (bHostHalted)
+  {
+    ullHostHaltTotal += ullHostNow - ullHostHaltStart;
+    bHostHalted = false;
+    ullHostDue = ullHostNow;
+    HostCore_Fire();
+  }
+  HostCore_Sync();
+  HostCore_DispatchAll();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interrupts freigeben oder sperren (rim/sim)
+ *
+ * @param[in] bEnable   true zum Freigeben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_EnableIrq(bool bEnable)
+{
+  bHostIrqEnabled = bEnable;
+  if (bEnable)
+  {
+    HostCore_DispatchAll();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob gerade eine Serviceroutine luft
+ *
+ * @return    bool      true in der Serviceroutine
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostCore_InIsr(void)
+{
+  return ucHostIsrDepth != 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Simulation mit Fehlermeldung beenden
+ *
+ * @param[in] pszFmt    Format wie printf
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_Fatal(const char* pszFmt, ...)
+{
+  va_list args;
+  
+  fprintf(stderr, "HOST %10.6f: ", (double)ullHostNow / 1e9);
+  va_start(args, pszFmt);
+  vfprintf(stderr, pszFmt, args);
+  va_end(args);
+  fputc('\n', stderr);
+  exit(3);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Spannungsausfall whrend eines Schreibvorgangs vorsehen
+ *
+ * @param[in] ulWrite   Nummer des Schreibvorgangs (ulHostWrites), 0: keiner
+ * @param[in] pfnCut    Behandlung, kehrt nicht zurck
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_SetPowerCut(uint32_t ulWrite, void (*pfnCut)(void))
+{
+  ulHostCutAt = ulWrite;
+  pfnHostCut = pfnCut;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Schreibvorgang auf Karte oder EEPROM zhlen
+ *
+ * @return    bool      true, wenn die Versorgung whrend des Vorgangs
+ *                      ausfllt: der Aufrufer schreibt nur einen Teil und
+ *                      ruft HostCore_PowerCut() auf
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostCore_Write(void)
+{
+  return ++ulHostWrites == ulHostCutAt;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Versorgung ausgefallen: Behandlung aufrufen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostCore_PowerCut(void)
+{
+  if (pfnHostCut != NULL)
+  {
+    pfnHostCut();
+  }
+  HostCore_Fatal("Spannungsausfall bei Schreibvorgang %lu",
+    (unsigned long)ulHostWrites);
+}
@@ -0,0 +1,168 @@
+/*!****************************************************************************
+ * @file
+ * HostCore.h
+ *
+ * Kern der Host-Simulation: virtuelle Zeit in Nanosekunden, Ereignisquellen
+ * der Peripheriemodelle, Interruptsperre, WFI/HALT und Aufruf der
+ * Interruptserviceroutinen. Jeder Aufruf der Ersatz-Standardbibliothek
+ * rckt die Zeit um HOSTCORE_STEP_NS vor; wiederholtes Abfragen desselben
+ * Flags springt zum nchsten Ereignis, damit Warteschleifen keine echte
+ * Rechenzeit kosten.
+ * Schreibvorgnge auf Karte und EEPROM werden gezhlt, bei einem gewhlten
+ * fllt die Versorgung aus (Test der Wiederherstellung nach einem Reset).
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Spannungsausfall bei einem Schreibvorgang
+ ******************************************************************************/
+
+#ifndef HOSTCORE_H_
+#define HOSTCORE_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Kein Ereignis geplant                                                     */
+#define HOSTCORE_NEVER          UINT64_MAX
+
+/*! Zeitbedarf eines Bibliotheksaufrufs in ns                                 */
+#define HOSTCORE_STEP_NS        1000u
+
+/*! Gleiche Abfragen in Folge, ab denen zum nchsten Ereignis gesprungen wird */
+#define HOSTCORE_POLL_SPIN      4
+
+/*! Dauer einer Warteschleife, ab der die Firmware als hngend gilt           */
+#define HOSTCORE_POLL_LIMIT     HOSTCORE_S(60)
+
+/*! Umrechnung in die virtuelle Zeit                                          */
+#define HOSTCORE_US(x)          ((HostCore_Time)(x) * 1000u)
+#define HOSTCORE_MS(x)          ((HostCore_Time)(x) * 1000000u)
+#define HOSTCORE_S(x)           ((HostCore_Time)(x) * 1000000000u)
+
+/*! Interruptvektoren der Firmware (Nummer wie in INTERRUPT_HANDLER)          */
+#define HOSTCORE_VEC_RTC        4
+#define HOSTCORE_VEC_EXTIB      6
+#define HOSTCORE_VEC_TIM2       19
+#define HOSTCORE_VEC_USART3_TX  21
+#define HOSTCORE_VEC_USART3_RX  22
+#define HOSTCORE_VEC_TIM1       23
+#define HOSTCORE_VEC_USART1_TX  27
+#define HOSTCORE_VEC_USART1_RX  28
+#define HOSTCORE_VEC_I2C        29
+#define HOSTCORE_VEC_NUM        30
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! Virtuelle Zeit in ns                                                      */
+typedef uint64_t HostCore_Time;
+
+/*!****************************************************************************
+ * @brief
+ * Ereignisquelle eines Modells. Quellen am Systemtakt laufen in der
+ * Laufzeit (ohne HALT-Phasen) und stehen whrend HALT, alle anderen laufen
+ * in der Echtzeit.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostCore_Source {
+  /*! Name fr Fehlermeldungen                            */
+  const char* pszName;
+  
+  /*! Nchstes Ereignis oder HOSTCORE_NEVER               */
+  HostCore_Time ullNext;
+  
+  /*! Behandlung des Ereignisses, darf neu planen         */
+  void (*pfnFire)(void);
+  
+  /*! Quelle am Systemtakt, steht in HALT                 */
+  bool bSysClk;
+  
+  /*! Verkettung der angemeldeten Quellen                 */
+  struct tag_HostCore_Source* pNext;
+} HostCore_Source;
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung einer Peripherie
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostCore_Irq {
+  /*! Vektornummer, kleinere Nummer hat Vorrang           */
+  uint8_t ucVector;
+  
+  /*! Anforderung liegt an (pegelgesteuert)               */
+  bool (*pfnPending)(void);
+} HostCore_Irq;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Aktuelle Echtzeit in ns                                                   */
+extern HostCore_Time ullHostNow;
+
+/*! Frhestes Ereignis in Echtzeit, erzwingt HostCore_Process()               */
+extern HostCore_Time ullHostDue;
+
+/*! Zhler der Bibliotheksaufrufe                                             */
+extern uint32_t ulHostCalls;
+
+/*! Nchster Abgleich der direkt gelesenen Register (Schattenregister)        */
+extern HostCore_Time ullHostSyncAt;
+
+/*! Zhler der Schreibvorgnge auf Karte (Sektor) und EEPROM (Wort)           */
+extern uint32_t ulHostWrites;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void HostCore_Init(HostCore_Time ullStart);
+void HostCore_AddSource(HostCore_Source* pSrc);
+void HostCore_AddIrq(const HostCore_Irq* pIrq);
+void HostCore_SetSync(void (*pfnSync)(void));
+void HostCore_Sync(void);
+void HostCore_Schedule(HostCore_Source* pSrc, HostCore_Time ullAt);
+void HostCore_ScheduleIn(HostCore_Source* pSrc, HostCore_Time ullDelay);
+HostCore_Time HostCore_RunTime(void);
+bool HostCore_IsHalted(void);
+
+void HostCore_Process(void);
+void HostCore_Poll(uint32_t ulKey);
+void HostCore_Raise(void);
+void HostCore_Wait(bool bHalt);
+void HostCore_EnableIrq(bool bEnable);
+bool HostCore_InIsr(void);
+
+void HostCore_Fatal(const char* pszFmt, ...);
+
+/* Spannungsausfall                                                           */
+void HostCore_SetPowerCut(uint32_t ulWrite, void (*pfnCut)(void));
+bool HostCore_Write(void);
+void HostCore_PowerCut(void);
+
+/* Von der Anwendung bereitzustellen: Interruptserviceroutine aufrufen        */
+void HostVector_Call(uint8_t ucVector);
+
+/*!****************************************************************************
+ * @brief
+ * Zeit fr einen Bibliotheksaufruf vorrcken, direkt gelesene Register
+ * abgleichen und fllige Ereignisse bearbeiten. Steht am Anfang jeder
+ * Ersatzfunktion.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static inline void HostCore_Step(void)
+{
+  ullHostNow += HOSTCORE_STEP_NS;
+  ++ulHostCalls;
+  if (ullHostNow >= ullHostSyncAt)
+  {
+    HostCore_Sync();
+  }
+  if (ullHostNow >= ullHostDue)
+  {
+    HostCore_Process();
+  }
+}
+
+#endif /* HOSTCORE_H_ */
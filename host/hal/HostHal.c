@@ -0,0 +1,32 @@
+/*!****************************************************************************
+ * @file
+ * HostHal.c
+ *
+ * Initialisierung aller Peripheriemodelle wie nach einem Reset des
+ * Mikrocontrollers. Die Umgebungsmodelle melden sich danach an.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostHal_Internal.h"
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Peripherie in den Resetzustand versetzen, nach HostCore_Init()
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostHal_Init(void)
+{
+  HostClk_Init();
+  HostGpio_Init();
+  HostRtc_Init();
+  HostTim_Init();
+  HostUsart_Init();
+  HostI2c_Init();
+  HostSpi_Init();
+  HostAdc_Init();
+}
@@ -0,0 +1,152 @@
+/*!****************************************************************************
+ * @file
+ * HostHal.h
+ *
+ * Registerabbilder und Modellschnittstelle der simulierten Peripherie. Die
+ * Firmware sieht nur die Funktionen der Standardbibliothek und die Register,
+ * auf die sie direkt zugreift; die Umgebungsmodelle hngen sich ber die
+ * hier deklarierten Funktionen an Pins, Busse und Schnittstellen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOSTHAL_H_
+#define HOSTHAL_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HostCore.h"
+#include "stm8l15x.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Systemtakt nach CLK_SYSCLKDivConfig(CLK_SYSCLKDiv_1) in Hz                */
+#define HOSTHAL_FSYS            16000000UL
+
+/*! Gre des Daten-EEPROMs in Byte                                           */
+#define HOSTHAL_EEPROM_SIZE     2048
+
+/*! ADC-Kanle 0..27, danach Vrefint und Temperatursensor                     */
+#define HOSTHAL_ADC_VREFINT     28
+#define HOSTHAL_ADC_TEMPSENSOR  29
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! GPIO-Ports                                                                */
+typedef enum tag_HostPort {
+  HostPort_A,
+  HostPort_B,
+  HostPort_C,
+  HostPort_D,
+  HostPort_E,
+  HostPort_F,
+  HostPort_G,
+  HostPort_H,
+  HostPort_I,
+  HostPort_NUM
+} HostPort;
+
+/*! USART-Instanzen                                                           */
+typedef enum tag_HostUsart {
+  HostUsart_1,
+  HostUsart_2,
+  HostUsart_3,
+  HostUsart_NUM
+} HostUsart;
+
+/*! SPI-Instanzen                                                             */
+typedef enum tag_HostSpi {
+  HostSpi_1,
+  HostSpi_2,
+  HostSpi_NUM
+} HostSpi;
+
+/*!****************************************************************************
+ * @brief
+ * Teilnehmer am I2C-Bus. Die Funktionen laufen, wenn das jeweilige Byte
+ * auf dem Bus vollstndig bertragen ist. Ruft eine Funktion
+ * HostI2c_Hold() auf, hlt der Teilnehmer den Bus fest.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostI2c_Slave {
+  /*! 7-Bit-Adresse                                       */
+  uint8_t ucAddr;
+  
+  /*! Zustand des Modells                                 */
+  void* pCtx;
+  
+  /*! Adressbyte nach START, Rckgabe ACK                 */
+  bool (*pfnStart)(const struct tag_HostI2c_Slave* pSlave, bool bRead);
+  
+  /*! Datenbyte vom Master, Rckgabe ACK                  */
+  bool (*pfnWrite)(const struct tag_HostI2c_Slave* pSlave, uint8_t ucByte);
+  
+  /*! Datenbyte an den Master                             */
+  uint8_t (*pfnRead)(const struct tag_HostI2c_Slave* pSlave);
+  
+  /*! STOP auf dem Bus                                    */
+  void (*pfnStop)(const struct tag_HostI2c_Slave* pSlave);
+} HostI2c_Slave;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Registerabbilder fr direkte Zugriffe der Firmware                        */
+extern GPIO_TypeDef asHostGpio[HostPort_NUM];
+extern USART_TypeDef asHostUsart[HostUsart_NUM];
+extern SPI_TypeDef asHostSpi[HostSpi_NUM];
+extern I2C_TypeDef sHostI2c;
+extern RTC_TypeDef sHostRtc;
+extern RST_TypeDef sHostRst;
+extern ADC_TypeDef sHostAdc;
+
+/*! Inhalt des Daten-EEPROMs                                                  */
+extern uint8_t aucHostEeprom[HOSTHAL_EEPROM_SIZE];
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void HostHal_Init(void);
+
+/* Takte                                                                      */
+bool HostClk_IsOn(uint8_t ucPeripheral);
+
+/* GPIO und EXTI                                                              */
+void HostGpio_Drive(HostPort ePort, uint8_t ucPins, bool bHigh);
+void HostGpio_Release(HostPort ePort, uint8_t ucPins);
+bool HostGpio_IsHigh(HostPort ePort, uint8_t ucPin);
+void HostGpio_Watch(HostPort ePort, void (*pfnChange)(void));
+
+/* USART                                                                      */
+void HostUsart_SetSink(HostUsart eUsart, void (*pfnTx)(uint8_t ucByte));
+bool HostUsart_Receive(HostUsart eUsart, uint8_t ucByte);
+HostCore_Time HostUsart_ByteTime(HostUsart eUsart);
+bool HostUsart_IsEnabled(HostUsart eUsart);
+
+/* I2C                                                                        */
+void HostI2c_Attach(const HostI2c_Slave* pSlave);
+void HostI2c_Hold(void);
+
+/* SPI                                                                        */
+void HostSpi_Attach(HostSpi eSpi, uint8_t (*pfnXfer)(uint8_t ucOut));
+
+/* ADC                                                                        */
+void HostAdc_SetSource(uint16_t (*pfnSample)(uint8_t ucChannel));
+
+/* TIM3 mit externem Takt (Anemometer)                                        */
+void HostTim3_SetRate(uint32_t ulMilliHz);
+
+/* RTC                                                                        */
+void HostRtc_Start(uint32_t ulSec, HostCore_Time ullPhase);
+uint32_t HostRtc_GetSeconds(void);
+HostCore_Time HostRtc_GetPhase(void);
+void HostRtc_Date(uint32_t ulDays, uint8_t* pucYear, uint8_t* pucMonth,
+  uint8_t* pucDay);
+
+/* IWDG, RST und Daten-EEPROM                                                 */
+void HostIwdg_SetReset(void (*pfnReset)(void));
+void HostRst_SetCause(uint8_t ucCause);
+void HostFlash_SetBacking(int iFd);
+const uint8_t* HostFlash_Ptr(uint32_t ulAddr);
+
+#endif /* HOSTHAL_H_ */
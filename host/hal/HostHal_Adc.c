@@ -0,0 +1,261 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Adc.c
+ *
+ * Ersatz fr ADC1 der Standardbibliothek im Einzelwandlungsbetrieb. Die
+ * Wandlung des freigegebenen Kanals dauert HOSTADC_CONV_NS, den Messwert
+ * liefert das Umgebungsmodell ber HostAdc_SetSource().
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stddef.h>
+#include "HostHal_Internal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Dauer einer Wandlung in ns (Abtastzeit und 12 Bit bei Teiler 1)           */
+#define HOSTADC_CONV_NS         1000u
+
+/*! Anzahl der Kanalbits in SQR                                               */
+#define HOSTADC_SQR_BITS        32
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Registerabbild                                                            */
+ADC_TypeDef sHostAdc;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Messwertquelle des Umgebungsmodells                                       */
+static uint16_t (*pfnHostAdcSample)(uint8_t ucChannel);
+
+/*! Laufende Wandlung                                                         */
+static HostCore_Source sHostAdcSrc;
+static uint8_t ucHostAdcChannel;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob Registerzugriffe wirken (Peripherietakt an)
+ *
+ * @return    bool      true, wenn der Takt an ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostAdc_Clocked(void)
+{
+  return HostClk_IsOn(CLK_Peripheral_ADC1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ersten freigegebenen Kanal aus SQR1..SQR4 bestimmen
+ *
+ * @return    uint8_t   Kanal 0..29 oder 0xFF, wenn keiner freigegeben ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostAdc_Channel(void)
+{
+  uint8_t ucBit;
+  uint8_t ucReg;
+  uint8_t ucMask;
+  
+  for (ucBit = 0; ucBit < HOSTADC_SQR_BITS; ++ucBit)
+  {
+    /* SQR4: Kanle 0..7, SQR1: 24..27, Vrefint, TS       */
+    ucReg = (uint8_t)(3 - ucBit / 8);
+    ucMask = (uint8_t)(1u << (ucBit % 8));
+    if ((ucBit <= HOSTHAL_ADC_TEMPSENSOR) && (sHostAdc.SQR[ucReg] & ucMask))
+    {
+      return ucBit;
+    }
+  }
+  return 0xFF;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ende der Wandlung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostAdc_Fire(void)
+{
+  uint16_t uiValue = 0;
+  
+  if (pfnHostAdcSample != NULL)
+  {
+    uiValue = pfnHostAdcSample(ucHostAdcChannel);
+  }
+  if (uiValue > 0x0FFF)
+  {
+    uiValue = 0x0FFF;
+  }
+  if (sHostAdc.SR & ADC_FLAG_EOC)
+  {
+    sHostAdc.SR |= ADC_FLAG_OVER;
+  }
+  sHostAdc.DRH = (uint8_t)(uiValue >> 8);
+  sHostAdc.DRL = (uint8_t)uiValue;
+  sHostAdc.SR |= ADC_FLAG_EOC;
+  sHostAdc.CR1 &= (uint8_t)~ADC_CR1_START;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * ADC wie nach dem Reset, die Messwertquelle bleibt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostAdc_Init(void)
+{
+  uint8_t ucIdx;
+  
+  sHostAdcSrc.pszName = "ADC1";
+  sHostAdcSrc.ullNext = HOSTCORE_NEVER;
+  sHostAdcSrc.pfnFire = HostAdc_Fire;
+  sHostAdcSrc.bSysClk = true;
+  HostCore_AddSource(&sHostAdcSrc);
+  sHostAdc.CR1 = ADC_CR1_RESET_VALUE;
+  sHostAdc.CR2 = ADC_CR2_RESET_VALUE;
+  sHostAdc.CR3 = ADC_CR3_RESET_VALUE;
+  sHostAdc.SR = ADC_SR_RESET_VALUE;
+  sHostAdc.DRH = 0;
+  sHostAdc.DRL = 0;
+  for (ucIdx = 0; ucIdx < 4; ++ucIdx)
+  {
+    sHostAdc.SQR[ucIdx] = 0;
+    sHostAdc.TRIGR[ucIdx] = 0;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messwertquelle des Umgebungsmodells setzen
+ *
+ * @param[in] pfnSample Rohwert 0..4095 je Kanal (HOSTHAL_ADC_...)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostAdc_SetSource(uint16_t (*pfnSample)(uint8_t ucChannel))
+{
+  pfnHostAdcSample = pfnSample;
+}
+
+/* Ersatz fr stm8l15x_adc.c                                                  */
+void ADC_Init(ADC_TypeDef* ADCx, ADC_ConversionMode_TypeDef ADC_ConversionMode,
+              ADC_Resolution_TypeDef ADC_Resolution, ADC_Prescaler_TypeDef ADC_Prescaler)
+{
+  HostCore_Step();
+  if (!HostAdc_Clocked())
+  {
+    return;
+  }
+  if ((ADC_ConversionMode != ADC_ConversionMode_Single)
+    || (ADC_Resolution != ADC_Resolution_12Bit))
+  {
+    HostCore_Fatal("ADC: nur 12-Bit-Einzelwandlung nachgebildet");
+  }
+  ADCx->CR1 &= (uint8_t)~(ADC_CR1_CONT | ADC_CR1_RES);
+  ADCx->CR1 |= (uint8_t)((uint8_t)ADC_ConversionMode | (uint8_t)ADC_Resolution);
+  ADCx->CR2 &= (uint8_t)~ADC_CR2_PRESC;
+  ADCx->CR2 |= (uint8_t)ADC_Prescaler;
+}
+
+void ADC_Cmd(ADC_TypeDef* ADCx, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostAdc_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    ADCx->CR1 |= ADC_CR1_ADON;
+  }
+  else
+  {
+    ADCx->CR1 &= (uint8_t)~(ADC_CR1_ADON | ADC_CR1_START);
+    HostCore_Schedule(&sHostAdcSrc, HOSTCORE_NEVER);
+  }
+}
+
+void ADC_ChannelCmd(ADC_TypeDef* ADCx, ADC_Channel_TypeDef ADC_Channels,
+                    FunctionalState NewState)
+{
+  uint8_t ucReg = (uint8_t)((uint16_t)ADC_Channels >> 8);
+  
+  HostCore_Step();
+  if (!HostAdc_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    ADCx->SQR[ucReg] |= (uint8_t)ADC_Channels;
+  }
+  else
+  {
+    ADCx->SQR[ucReg] &= (uint8_t)~(uint8_t)ADC_Channels;
+  }
+}
+
+void ADC_TempSensorCmd(FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostAdc_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    sHostAdc.TRIGR[0] |= ADC_TRIGR1_TSON;
+  }
+  else
+  {
+    sHostAdc.TRIGR[0] &= (uint8_t)~ADC_TRIGR1_TSON;
+  }
+}
+
+void ADC_SoftwareStartConv(ADC_TypeDef* ADCx)
+{
+  HostCore_Step();
+  if (!HostAdc_Clocked() || !(ADCx->CR1 & ADC_CR1_ADON))
+  {
+    return;
+  }
+  ucHostAdcChannel = HostAdc_Channel();
+  if (ucHostAdcChannel == 0xFF)
+  {
+    HostCore_Fatal("ADC: Wandlung ohne Kanal");
+  }
+  ADCx->CR1 |= ADC_CR1_START;
+  HostCore_ScheduleIn(&sHostAdcSrc, HOSTADC_CONV_NS);
+}
+
+FlagStatus ADC_GetFlagStatus(ADC_TypeDef* ADCx, ADC_FLAG_TypeDef ADC_FLAG)
+{
+  HostCore_Poll(0x08000000UL | (uint8_t)ADC_FLAG);
+  if (!HostAdc_Clocked())
+  {
+    return RESET;
+  }
+  return (FlagStatus)((ADCx->SR & (uint8_t)ADC_FLAG) != 0);
+}
+
+uint16_t ADC_GetConversionValue(ADC_TypeDef* ADCx)
+{
+  HostCore_Step();
+  if (!HostAdc_Clocked())
+  {
+    return 0;
+  }
+  ADCx->SR &= (uint8_t)~ADC_FLAG_EOC;
+  return (uint16_t)(((uint16_t)ADCx->DRH << 8) | ADCx->DRL);
+}
@@ -0,0 +1,378 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Clk.c
+ *
+ * Ersatz fr CLK, PWR, RST, IWDG und FLASH der Standardbibliothek. Die
+ * Peripherietakte werden als Bitmaske gefhrt, der IWDG luft in Echtzeit
+ * (auch in HALT) und lst beim Ablauf den Reset der Anwendung aus. Das
+ * Daten-EEPROM liegt in aucHostEeprom und wird auf Wunsch in eine Datei
+ * durchgeschrieben. Ein Spannungsausfall beim Programmieren hinterlsst ein
+ * halb geschriebenes Wort (HostCore_Write()).
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Spannungsausfall beim Programmieren
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <string.h>
+#include <unistd.h>
+#include "HostHal_Internal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Takt des IWDG (LSI) in Hz                                                 */
+#define HOSTIWDG_LSI_HZ         38000u
+
+/*! Dauer eines Programmierzyklus des Daten-EEPROMs                           */
+#define HOSTFLASH_PROG_NS       HOSTCORE_MS(6)
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Resetstatus                                                               */
+RST_TypeDef sHostRst;
+
+/*! Inhalt des Daten-EEPROMs                                                  */
+uint8_t aucHostEeprom[HOSTHAL_EEPROM_SIZE];
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Eingeschaltete Peripherietakte, Bit = Registernummer * 8 + Bit            */
+static uint32_t ulHostClkOn;
+
+/*! IWDG: Vorteiler, Nachladewert, Zugriff, Ablauf                            */
+static bool bHostIwdgOn;
+static uint8_t ucHostIwdgPr;
+static uint8_t ucHostIwdgRlr;
+static bool bHostIwdgAccess;
+static void (*pfnHostIwdgReset)(void);
+static HostCore_Source sHostIwdg;
+
+/*! FLASH: Daten-EEPROM entsperrt, Datei zum Durchschreiben                   */
+static bool bHostFlashUnlocked;
+static int iHostFlashFd = -1;
+static HostCore_Source sHostFlash;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Bitnummer eines Peripherietakts
+ *
+ * @param[in] ucPeripheral  CLK_Peripheral_TypeDef
+ * @return    uint32_t      Bitmaske
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostClk_Mask(uint8_t ucPeripheral)
+{
+  return 1UL << (((ucPeripheral >> 4) * 8) + (ucPeripheral & 0x07));
+}
+
+/*!****************************************************************************
+ * @brief
+ * IWDG abgelaufen: Reset der Anwendung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostIwdg_Fire(void)
+{
+  if (pfnHostIwdgReset == NULL)
+  {
+    HostCore_Fatal("IWDG abgelaufen");
+  }
+  pfnHostIwdgReset();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Programmierzyklus beendet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostFlash_Fire(void)
+{
+}
+
+/*!****************************************************************************
+ * @brief
+ * Adresse im Daten-EEPROM prfen
+ *
+ * @param[in] ulAddr    Adresse
+ * @param[in] uiLen     Lnge
+ * @return    uint16_t  Offset im Abbild
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t HostFlash_Offset(uint32_t ulAddr, uint16_t uiLen)
+{
+  if ((ulAddr < FLASH_DATA_EEPROM_START_PHYSICAL_ADDRESS)
+    || (ulAddr + uiLen > FLASH_DATA_EEPROM_START_PHYSICAL_ADDRESS
+      + HOSTHAL_EEPROM_SIZE))
+  {
+    HostCore_Fatal("FLASH: Adresse %05lX", (unsigned long)ulAddr);
+  }
+  return (uint16_t)(ulAddr - FLASH_DATA_EEPROM_START_PHYSICAL_ADDRESS);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Takte, IWDG und FLASH wie nach dem Reset, Inhalt des EEPROMs bleibt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostClk_Init(void)
+{
+  ulHostClkOn = 0;
+  bHostIwdgOn = false;
+  ucHostIwdgPr = IWDG_Prescaler_4;
+  ucHostIwdgRlr = 0xFF;
+  bHostIwdgAccess = false;
+  sHostIwdg.pszName = "IWDG";
+  sHostIwdg.ullNext = HOSTCORE_NEVER;
+  sHostIwdg.pfnFire = HostIwdg_Fire;
+  sHostIwdg.bSysClk = false;
+  HostCore_AddSource(&sHostIwdg);
+  bHostFlashUnlocked = false;
+  sHostFlash.pszName = "FLASH";
+  sHostFlash.ullNext = HOSTCORE_NEVER;
+  sHostFlash.pfnFire = HostFlash_Fire;
+  sHostFlash.bSysClk = false;
+  HostCore_AddSource(&sHostFlash);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob der Takt einer Peripherie eingeschaltet ist
+ *
+ * @param[in] ucPeripheral  CLK_Peripheral_TypeDef
+ * @return    bool          true, wenn eingeschaltet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostClk_IsOn(uint8_t ucPeripheral)
+{
+  return (ulHostClkOn & HostClk_Mask(ucPeripheral)) != 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Funktion fr den Reset beim Ablauf des IWDG setzen
+ *
+ * @param[in] pfnReset  Reset der Anwendung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostIwdg_SetReset(void (*pfnReset)(void))
+{
+  pfnHostIwdgReset = pfnReset;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Resetursache fr den folgenden Start setzen (RST->SR)
+ *
+ * @param[in] ucCause   RST_FLAG_*
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostRst_SetCause(uint8_t ucCause)
+{
+  sHostRst.SR = ucCause;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datei setzen, in die das Daten-EEPROM durchgeschrieben wird
+ *
+ * @param[in] iFd       Dateideskriptor oder -1
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostFlash_SetBacking(int iFd)
+{
+  iHostFlashFd = iFd;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Adresse im Daten-EEPROM fr direkte Lesezugriffe (NVSTORE_PTR)
+ *
+ * @param[in] ulAddr    Adresse im Adressraum der CPU
+ * @return    const uint8_t*  Zeiger in das Abbild
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const uint8_t* HostFlash_Ptr(uint32_t ulAddr)
+{
+  return &aucHostEeprom[HostFlash_Offset(ulAddr, 0)];
+}
+
+/* Ersatz fr stm8l15x_clk.c                                                  */
+void CLK_PeripheralClockConfig(CLK_Peripheral_TypeDef CLK_Peripheral, FunctionalState NewState)
+{
+  HostCore_Step();
+  HostTim_Sync();
+  if (NewState != DISABLE)
+  {
+    ulHostClkOn |= HostClk_Mask((uint8_t)CLK_Peripheral);
+  }
+  else
+  {
+    ulHostClkOn &= ~HostClk_Mask((uint8_t)CLK_Peripheral);
+  }
+  HostTim_ClockChanged();
+}
+
+void CLK_LSEConfig(CLK_LSE_TypeDef CLK_LSE)
+{
+  (void)CLK_LSE;
+  HostCore_Step();
+}
+
+void CLK_RTCClockConfig(CLK_RTCCLKSource_TypeDef CLK_RTCCLKSource, CLK_RTCCLKDiv_TypeDef CLK_RTCCLKDiv)
+{
+  (void)CLK_RTCCLKSource;
+  (void)CLK_RTCCLKDiv;
+  HostCore_Step();
+}
+
+void CLK_SYSCLKDivConfig(CLK_SYSCLKDiv_TypeDef CLK_SYSCLKDiv)
+{
+  if (CLK_SYSCLKDiv != CLK_SYSCLKDiv_1)
+  {
+    HostCore_Fatal("CLK: nur 16 MHz nachgebildet");
+  }
+  HostCore_Step();
+}
+
+void CLK_SYSCLKSourceConfig(CLK_SYSCLKSource_TypeDef CLK_SYSCLKSource)
+{
+  (void)CLK_SYSCLKSource;
+  HostCore_Step();
+}
+
+/* Ersatz fr stm8l15x_pwr.c                                                  */
+void PWR_UltraLowPowerCmd(FunctionalState NewState)
+{
+  (void)NewState;
+  HostCore_Step();
+}
+
+void PWR_FastWakeUpCmd(FunctionalState NewState)
+{
+  (void)NewState;
+  HostCore_Step();
+}
+
+/* Ersatz fr stm8l15x_iwdg.c                                                 */
+void IWDG_Enable(void)
+{
+  HostCore_Step();
+  bHostIwdgOn = true;
+  IWDG_ReloadCounter();
+}
+
+void IWDG_WriteAccessCmd(IWDG_WriteAccess_TypeDef IWDG_WriteAccess)
+{
+  HostCore_Step();
+  bHostIwdgAccess = (IWDG_WriteAccess == IWDG_WriteAccess_Enable);
+}
+
+void IWDG_SetPrescaler(IWDG_Prescaler_TypeDef IWDG_Prescaler)
+{
+  HostCore_Step();
+  if (bHostIwdgAccess)
+  {
+    ucHostIwdgPr = (uint8_t)IWDG_Prescaler;
+  }
+}
+
+void IWDG_SetReload(uint8_t IWDG_Reload)
+{
+  HostCore_Step();
+  if (bHostIwdgAccess)
+  {
+    ucHostIwdgRlr = IWDG_Reload;
+  }
+}
+
+void IWDG_ReloadCounter(void)
+{
+  HostCore_Step();
+  bHostIwdgAccess = false;
+  if (!bHostIwdgOn)
+  {
+    return;
+  }
+  HostCore_ScheduleIn(&sHostIwdg,
+    ((HostCore_Time)(ucHostIwdgRlr + 1u) * (4u << ucHostIwdgPr)
+      * 1000000000u) / HOSTIWDG_LSI_HZ);
+}
+
+/* Ersatz fr stm8l15x_flash.c                                                */
+void FLASH_Unlock(FLASH_MemType_TypeDef FLASH_MemType)
+{
+  HostCore_Step();
+  if (FLASH_MemType == FLASH_MemType_Data)
+  {
+    bHostFlashUnlocked = true;
+  }
+}
+
+void FLASH_Lock(FLASH_MemType_TypeDef FLASH_MemType)
+{
+  HostCore_Step();
+  if (FLASH_MemType == FLASH_MemType_Data)
+  {
+    bHostFlashUnlocked = false;
+  }
+}
+
+uint8_t FLASH_ReadByte(uint32_t Address)
+{
+  HostCore_Step();
+  return aucHostEeprom[HostFlash_Offset(Address, 1)];
+}
+
+void FLASH_ProgramWord(uint32_t Address, uint32_t Data)
+{
+  uint16_t uiOffs = HostFlash_Offset(Address, 4);
+  uint8_t ucLen;
+  
+  HostCore_Step();
+  if (!bHostFlashUnlocked)
+  {
+    return;
+  }
+  if (sHostFlash.ullNext != HOSTCORE_NEVER)
+  {
+    HostCore_Fatal("FLASH: Programmierung whrend laufendem Zyklus");
+  }
+  
+  /* Bytes in Speicherreihenfolge wie die Bibliothek,     *
+   * bei Spannungsausfall nur die ersten beiden           */
+  ucLen = HostCore_Write() ? 2 : 4;
+  memcpy(&aucHostEeprom[uiOffs], &Data, ucLen);
+  if ((iHostFlashFd >= 0)
+    && (pwrite(iHostFlashFd, &aucHostEeprom[uiOffs], ucLen, uiOffs) != ucLen))
+  {
+    HostCore_Fatal("FLASH: Datei nicht beschreibbar");
+  }
+  if (ucLen != 4)
+  {
+    HostCore_PowerCut();
+  }
+  HostCore_ScheduleIn(&sHostFlash, HOSTFLASH_PROG_NS);
+}
+
+FLASH_Status_TypeDef FLASH_WaitForLastOperation(FLASH_MemType_TypeDef FLASH_MemType)
+{
+  (void)FLASH_MemType;
+  do
+  {
+    HostCore_Poll(0x02000000UL);
+  } while (sHostFlash.ullNext != HOSTCORE_NEVER);
+  return FLASH_Status_Successful_Operation;
+}
@@ -0,0 +1,376 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Gpio.c
+ *
+ * Ersatz fr GPIO und EXTI der Standardbibliothek. Das Eingangsregister
+ * ergibt sich aus den Ausgngen der Firmware, den von Modellen getriebenen
+ * Pegeln und den Pull-ups. Flanken an Eingngen mit Interruptfreigabe
+ * setzen die Port-Anforderung, wenn der Port ber EXTI_SetHalfPortSelection
+ * auf den Port-Interrupt gelegt ist (nur Port B, Vektor EXTIB/G).
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostHal_Internal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Hchstzahl an Beobachtern fr Ausgangsnderungen                          */
+#define HOSTGPIO_WATCH_MAX      12
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! Beobachter fr Ausgangsnderungen eines Ports                             */
+typedef struct tag_HostGpio_Watcher {
+  /*! Port                                                */
+  HostPort ePort;
+  
+  /*! Aufruf nach jeder nderung der Ausgnge             */
+  void (*pfnChange)(void);
+} HostGpio_Watcher;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Registerabbilder der Ports                                                */
+GPIO_TypeDef asHostGpio[HostPort_NUM];
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Von Modellen getriebene Pins und deren Pegel                              */
+static uint8_t aucHostGpioDriven[HostPort_NUM];
+static uint8_t aucHostGpioLevel[HostPort_NUM];
+
+/*! Beobachter                                                                */
+static HostGpio_Watcher asHostGpioWatch[HOSTGPIO_WATCH_MAX];
+static uint8_t ucHostGpioWatchNum;
+
+/*! EXTI: Empfindlichkeit Port B, Auswahl der Porthlften, Anforderung        */
+static uint8_t ucHostExtiTriggerB;
+static uint8_t ucHostExtiHalfB;
+static bool bHostExtiPendingB;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Port-Index aus dem Registerzeiger bestimmen
+ *
+ * @param[in] pGpio     Registerabbild
+ * @return    HostPort  Index
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static HostPort HostGpio_Index(const GPIO_TypeDef* pGpio)
+{
+  if ((pGpio < &asHostGpio[0]) || (pGpio >= &asHostGpio[HostPort_NUM]))
+  {
+    HostCore_Fatal("GPIO: ungltiger Port");
+  }
+  return (HostPort)(pGpio - &asHostGpio[0]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eingangsregister neu bilden, Flanken auswerten und Beobachter rufen
+ *
+ * @param[in] ePort     Port
+ * @param[in] bOutput   Ausgnge oder Richtung wurden gendert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostGpio_Update(HostPort ePort, bool bOutput)
+{
+  GPIO_TypeDef* pGpio = &asHostGpio[ePort];
+  uint8_t ucOld = pGpio->IDR;
+  uint8_t ucIn = (uint8_t)~pGpio->DDR;
+  uint8_t ucNew;
+  uint8_t ucEdge = 0;
+  uint8_t ucIdx;
+  
+  /* Ausgnge, getriebene Eingnge, sonst Pull-up         */
+  ucNew = (uint8_t)((pGpio->ODR & pGpio->DDR)
+    | (ucIn & aucHostGpioDriven[ePort] & aucHostGpioLevel[ePort])
+    | (ucIn & (uint8_t)~aucHostGpioDriven[ePort] & pGpio->CR1));
+  pGpio->IDR = ucNew;
+  
+  if (ePort == HostPort_B)
+  {
+    if ((ucHostExtiTriggerB == EXTI_Trigger_Rising)
+      || (ucHostExtiTriggerB == EXTI_Trigger_Rising_Falling))
+    {
+      ucEdge |= (uint8_t)(ucNew & (uint8_t)~ucOld);
+    }
+    if ((ucHostExtiTriggerB == EXTI_Trigger_Falling)
+      || (ucHostExtiTriggerB == EXTI_Trigger_Rising_Falling))
+    {
+      ucEdge |= (uint8_t)(ucOld & (uint8_t)~ucNew);
+    }
+    ucEdge &= (uint8_t)(ucIn & pGpio->CR2);
+    if ((ucEdge & 0x0F) && (ucHostExtiHalfB & EXTI_HalfPort_B_LSB))
+    {
+      bHostExtiPendingB = true;
+    }
+    if ((ucEdge & 0xF0) && (ucHostExtiHalfB & EXTI_HalfPort_B_MSB))
+    {
+      bHostExtiPendingB = true;
+    }
+    if (bHostExtiPendingB)
+    {
+      HostCore_Raise();
+    }
+  }
+  
+  if (bOutput)
+  {
+    for (ucIdx = 0; ucIdx < ucHostGpioWatchNum; ++ucIdx)
+    {
+      if (asHostGpioWatch[ucIdx].ePort == ePort)
+      {
+        asHostGpioWatch[ucIdx].pfnChange();
+      }
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anforderung des Port-Interrupts B
+ *
+ * @return    bool      true, wenn der Interrupt ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostExti_PendingB(void)
+{
+  return bHostExtiPendingB;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * GPIO und EXTI zurcksetzen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostGpio_Init(void)
+{
+  static const HostCore_Irq sIrq = {HOSTCORE_VEC_EXTIB, HostExti_PendingB};
+  uint8_t ucPort;
+  
+  for (ucPort = 0; ucPort < HostPort_NUM; ++ucPort)
+  {
+    asHostGpio[ucPort].ODR = GPIO_ODR_RESET_VALUE;
+    asHostGpio[ucPort].DDR = GPIO_DDR_RESET_VALUE;
+    asHostGpio[ucPort].CR1 = GPIO_CR1_RESET_VALUE;
+    asHostGpio[ucPort].CR2 = GPIO_CR2_RESET_VALUE;
+    HostGpio_Update((HostPort)ucPort, false);
+  }
+  ucHostExtiTriggerB = EXTI_Trigger_Falling_Low;
+  ucHostExtiHalfB = 0;
+  bHostExtiPendingB = false;
+  HostCore_AddIrq(&sIrq);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pins von auen treiben
+ *
+ * @param[in] ePort     Port
+ * @param[in] ucPins    Pinmaske
+ * @param[in] bHigh     Pegel
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostGpio_Drive(HostPort ePort, uint8_t ucPins, bool bHigh)
+{
+  aucHostGpioDriven[ePort] |= ucPins;
+  if (bHigh)
+  {
+    aucHostGpioLevel[ePort] |= ucPins;
+  }
+  else
+  {
+    aucHostGpioLevel[ePort] &= (uint8_t)~ucPins;
+  }
+  HostGpio_Update(ePort, false);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Von auen getriebene Pins freigeben
+ *
+ * @param[in] ePort     Port
+ * @param[in] ucPins    Pinmaske
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostGpio_Release(HostPort ePort, uint8_t ucPins)
+{
+  aucHostGpioDriven[ePort] &= (uint8_t)~ucPins;
+  HostGpio_Update(ePort, false);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pegel eines Pins abfragen
+ *
+ * @param[in] ePort     Port
+ * @param[in] ucPin     Pinmaske
+ * @return    bool      true bei High
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostGpio_IsHigh(HostPort ePort, uint8_t ucPin)
+{
+  return (asHostGpio[ePort].IDR & ucPin) != 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Beobachter fr Ausgangsnderungen eines Ports anmelden
+ *
+ * @param[in] ePort     Port
+ * @param[in] pfnChange Aufruf nach jeder nderung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostGpio_Watch(HostPort ePort, void (*pfnChange)(void))
+{
+  if (ucHostGpioWatchNum >= HOSTGPIO_WATCH_MAX)
+  {
+    HostCore_Fatal("GPIO: zu viele Beobachter");
+  }
+  asHostGpioWatch[ucHostGpioWatchNum].ePort = ePort;
+  asHostGpioWatch[ucHostGpioWatchNum].pfnChange = pfnChange;
+  ++ucHostGpioWatchNum;
+}
+
+/* Ersatz fr stm8l15x_gpio.c                                                 */
+void GPIO_Init(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin, GPIO_Mode_TypeDef GPIO_Mode)
+{
+  HostCore_Step();
+  GPIOx->CR2 &= (uint8_t)~GPIO_Pin;
+  if ((GPIO_Mode & 0x80) != 0)
+  {
+    if ((GPIO_Mode & 0x10) != 0)
+    {
+      GPIOx->ODR |= GPIO_Pin;
+    }
+    else
+    {
+      GPIOx->ODR &= (uint8_t)~GPIO_Pin;
+    }
+    GPIOx->DDR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->DDR &= (uint8_t)~GPIO_Pin;
+  }
+  if ((GPIO_Mode & 0x40) != 0)
+  {
+    GPIOx->CR1 |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->CR1 &= (uint8_t)~GPIO_Pin;
+  }
+  if ((GPIO_Mode & 0x20) != 0)
+  {
+    GPIOx->CR2 |= GPIO_Pin;
+  }
+  HostGpio_Update(HostGpio_Index(GPIOx), true);
+}
+
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin)
+{
+  HostCore_Step();
+  GPIOx->ODR |= GPIO_Pin;
+  HostGpio_Update(HostGpio_Index(GPIOx), true);
+}
+
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin)
+{
+  HostCore_Step();
+  GPIOx->ODR &= (uint8_t)~GPIO_Pin;
+  HostGpio_Update(HostGpio_Index(GPIOx), true);
+}
+
+void GPIO_ToggleBits(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin)
+{
+  HostCore_Step();
+  GPIOx->ODR ^= GPIO_Pin;
+  HostGpio_Update(HostGpio_Index(GPIOx), true);
+}
+
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, GPIO_Pin_TypeDef GPIO_Pin, BitAction GPIO_BitVal)
+{
+  HostCore_Step();
+  if (GPIO_BitVal != RESET)
+  {
+    GPIOx->ODR |= (uint8_t)GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->ODR &= (uint8_t)~GPIO_Pin;
+  }
+  HostGpio_Update(HostGpio_Index(GPIOx), true);
+}
+
+uint8_t GPIO_ReadInputData(GPIO_TypeDef* GPIOx)
+{
+  HostCore_Poll(0x01000000UL | (uint32_t)HostGpio_Index(GPIOx));
+  return GPIOx->IDR;
+}
+
+BitStatus GPIO_ReadInputDataBit(GPIO_TypeDef* GPIOx, GPIO_Pin_TypeDef GPIO_Pin)
+{
+  HostCore_Poll(0x01000000UL | (uint32_t)HostGpio_Index(GPIOx));
+  return (BitStatus)((GPIOx->IDR & (uint8_t)GPIO_Pin) != 0);
+}
+
+/* Ersatz fr stm8l15x_exti.c                                                 */
+void EXTI_SetPortSensitivity(EXTI_Port_TypeDef EXTI_Port, EXTI_Trigger_TypeDef EXTI_Trigger)
+{
+  HostCore_Step();
+  if (EXTI_Port == EXTI_Port_B)
+  {
+    ucHostExtiTriggerB = (uint8_t)EXTI_Trigger;
+  }
+}
+
+void EXTI_SelectPort(EXTI_Port_TypeDef EXTI_Port)
+{
+  HostCore_Step();
+  if (EXTI_Port != EXTI_Port_B)
+  {
+    HostCore_Fatal("EXTI: nur Port B nachgebildet");
+  }
+}
+
+void EXTI_SetHalfPortSelection(EXTI_HalfPort_TypeDef EXTI_HalfPort, FunctionalState NewState)
+{
+  HostCore_Step();
+  if ((EXTI_HalfPort != EXTI_HalfPort_B_LSB) && (EXTI_HalfPort != EXTI_HalfPort_B_MSB))
+  {
+    HostCore_Fatal("EXTI: nur Port B nachgebildet");
+  }
+  if (NewState != DISABLE)
+  {
+    ucHostExtiHalfB |= (uint8_t)EXTI_HalfPort;
+  }
+  else
+  {
+    ucHostExtiHalfB &= (uint8_t)~EXTI_HalfPort;
+  }
+}
+
+void EXTI_ClearITPendingBit(EXTI_IT_TypeDef EXTI_IT)
+{
+  HostCore_Step();
+  if (EXTI_IT == EXTI_IT_PortB)
+  {
+    bHostExtiPendingB = false;
+  }
+}
@@ -0,0 +1,736 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_I2c.c
+ *
+ * Ersatz fr I2C1 der Standardbibliothek als Master am simulierten Bus.
+ * START, Adressbyte, Datenbytes und STOP laufen mit den Buszeiten ab und
+ * setzen SR1..SR3 wie die Hardware (SB, ADDR, TXE, BTF, RXNE, AF). Ein
+ * empfangenes Byte, das die Firmware nicht abholt, hlt den Bus an (BTF).
+ * Die Teilnehmer hngen sich mit HostI2c_Attach() an. Hlt ein Teilnehmer
+ * den Bus fest, bleiben BUSY und der laufende Vorgang stehen, bis die
+ * Schnittstelle zurckgesetzt wird (SWRST, PE aus).
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stddef.h>
+#include "HostHal_Internal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Maximale Anzahl der Teilnehmer                                            */
+#define HOSTI2C_SLAVES          4
+
+/*! Dauer von START und STOP in ns                                            */
+#define HOSTI2C_COND_NS         HOSTCORE_US(5)
+
+/*! Bits je Byte einschlielich ACK                                           */
+#define HOSTI2C_BITS            9u
+
+/*! Ereignisflags in SR1 (ITEVTEN) und Pufferflags (ITBUFEN)                  */
+#define HOSTI2C_SR1_EVT         (I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF \
+                                 | I2C_SR1_ADD10 | I2C_SR1_STOPF)
+#define HOSTI2C_SR1_BUF         (I2C_SR1_TXE | I2C_SR1_RXNE)
+
+/*! Fehlerflags in SR2 (ITERREN)                                              */
+#define HOSTI2C_SR2_ERR         (I2C_SR2_BERR | I2C_SR2_ARLO | I2C_SR2_AF \
+                                 | I2C_SR2_OVR)
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! Laufender Busvorgang                                                      */
+typedef enum tag_HostI2c_Phase {
+  HostI2c_Phase_NONE,
+  HostI2c_Phase_START,
+  HostI2c_Phase_ADDR,
+  HostI2c_Phase_TX,
+  HostI2c_Phase_RX,
+  HostI2c_Phase_STOP,
+  HostI2c_Phase_HOLD
+} HostI2c_Phase;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Registerabbild                                                            */
+I2C_TypeDef sHostI2c;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Angemeldete Teilnehmer                                                    */
+static const HostI2c_Slave* apHostI2cSlave[HOSTI2C_SLAVES];
+static uint8_t ucHostI2cSlaves;
+
+/*! Laufender Vorgang und dessen Ende                                         */
+static HostI2c_Phase eHostI2cPhase;
+static HostCore_Source sHostI2cSrc;
+
+/*! Dauer eines Bytes nach I2C_Init()                                         */
+static HostCore_Time ullHostI2cByteNs;
+
+/*! Adressierter Teilnehmer und Richtung                                      */
+static const HostI2c_Slave* pHostI2cSlave;
+static bool bHostI2cRead;
+
+/*! Schieberegister, beim Empfang belegt (BTF)                                */
+static uint8_t ucHostI2cShift;
+static bool bHostI2cShiftFull;
+
+/*! Letztes empfangenes Byte wurde mit ACK quittiert                          */
+static bool bHostI2cRxMore;
+
+/*! Teilnehmer hlt den Bus fest (HostI2c_Hold())                             */
+static bool bHostI2cHeld;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob Registerzugriffe wirken (Peripherietakt an)
+ *
+ * @return    bool      true, wenn der Takt an ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostI2c_Clocked(void)
+{
+  return HostClk_IsOn(CLK_Peripheral_I2C1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob die Schnittstelle arbeitet (PE gesetzt, kein SWRST)
+ *
+ * @return    bool      true, wenn eingeschaltet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostI2c_Enabled(void)
+{
+  return HostI2c_Clocked() && (sHostI2c.CR1 & I2C_CR1_PE)
+    && !(sHostI2c.CR2 & I2C_CR2_SWRST);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Busvorgang starten
+ *
+ * @param[in] ePhase    Vorgang
+ * @param[in] ullNs     Dauer in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostI2c_Begin(HostI2c_Phase ePhase, HostCore_Time ullNs)
+{
+  eHostI2cPhase = ePhase;
+  HostCore_ScheduleIn(&sHostI2cSrc, ullNs);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bus ohne STOP freigeben (PE aus, SWRST, DeInit)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostI2c_Release(void)
+{
+  if ((pHostI2cSlave != NULL) && (pHostI2cSlave->pfnStop != NULL))
+  {
+    pHostI2cSlave->pfnStop(pHostI2cSlave);
+  }
+  pHostI2cSlave = NULL;
+  bHostI2cRead = false;
+  bHostI2cShiftFull = false;
+  bHostI2cRxMore = false;
+  bHostI2cHeld = false;
+  eHostI2cPhase = HostI2c_Phase_NONE;
+  HostCore_Schedule(&sHostI2cSrc, HOSTCORE_NEVER);
+  sHostI2c.SR1 = 0;
+  sHostI2c.SR2 = 0;
+  sHostI2c.SR3 = 0;
+  HostCore_Raise();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Angeforderte STOP- bzw. START-Bedingung ausfhren, wenn der Bus ruht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostI2c_Kick(void)
+{
+  if ((eHostI2cPhase != HostI2c_Phase_NONE) || !HostI2c_Enabled())
+  {
+    return;
+  }
+  if ((sHostI2c.CR2 & I2C_CR2_STOP) && (sHostI2c.SR3 & I2C_SR3_MSL))
+  {
+    /* TXE und BTF lscht die STOP-Bedingung beim Senden  */
+    if (!bHostI2cRead)
+    {
+      sHostI2c.SR1 &= (uint8_t)~(I2C_SR1_TXE | I2C_SR1_BTF);
+    }
+    HostI2c_Begin(HostI2c_Phase_STOP, HOSTI2C_COND_NS);
+  }
+  else if ((sHostI2c.CR2 & I2C_CR2_START) && !(sHostI2c.SR3 & I2C_SR3_BUSY))
+  {
+    HostI2c_Begin(HostI2c_Phase_START, HOSTI2C_COND_NS);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchstes Byte empfangen, solange quittiert wurde und kein STOP ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostI2c_NextRx(void)
+{
+  if (bHostI2cRxMore && !bHostI2cShiftFull && !(sHostI2c.CR2 & I2C_CR2_STOP))
+  {
+    HostI2c_Begin(HostI2c_Phase_RX, ullHostI2cByteNs);
+  }
+  else
+  {
+    HostI2c_Kick();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datenregister ins freie Schieberegister bernehmen (Senden)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostI2c_Load(void)
+{
+  if ((eHostI2cPhase != HostI2c_Phase_NONE) || (pHostI2cSlave == NULL)
+    || bHostI2cRead || (sHostI2c.SR1 & (I2C_SR1_TXE | I2C_SR1_ADDR)))
+  {
+    return;
+  }
+  ucHostI2cShift = sHostI2c.DR;
+  sHostI2c.SR1 |= I2C_SR1_TXE;
+  HostI2c_Begin(HostI2c_Phase_TX, ullHostI2cByteNs);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Teilnehmer zur Adresse suchen
+ *
+ * @param[in] ucAddr    7-Bit-Adresse
+ * @return    const HostI2c_Slave*  Teilnehmer oder NULL
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static const HostI2c_Slave* HostI2c_Find(uint8_t ucAddr)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < ucHostI2cSlaves; ++ucIdx)
+  {
+    if (apHostI2cSlave[ucIdx]->ucAddr == ucAddr)
+    {
+      return apHostI2cSlave[ucIdx];
+    }
+  }
+  return NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ende des laufenden Busvorgangs
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostI2c_Fire(void)
+{
+  HostI2c_Phase ePhase = eHostI2cPhase;
+  uint8_t ucByte = 0;
+  bool bAck = false;
+  
+  /* Antwort des Teilnehmers                              */
+  switch (ePhase)
+  {
+    case HostI2c_Phase_ADDR:
+      bAck = (pHostI2cSlave != NULL)
+        && pHostI2cSlave->pfnStart(pHostI2cSlave, bHostI2cRead);
+      break;
+    
+    case HostI2c_Phase_TX:
+      bAck = pHostI2cSlave->pfnWrite(pHostI2cSlave, ucHostI2cShift);
+      break;
+    
+    case HostI2c_Phase_RX:
+      ucByte = pHostI2cSlave->pfnRead(pHostI2cSlave);
+      break;
+    
+    default:
+      ;
+  }
+  if (bHostI2cHeld)
+  {
+    /* Bus festgehalten: Vorgang endet nicht              */
+    eHostI2cPhase = HostI2c_Phase_HOLD;
+    return;
+  }
+  
+  eHostI2cPhase = HostI2c_Phase_NONE;
+  switch (ePhase)
+  {
+    case HostI2c_Phase_START:
+      sHostI2c.CR2 &= (uint8_t)~I2C_CR2_START;
+      sHostI2c.SR1 |= I2C_SR1_SB;
+      sHostI2c.SR3 |= I2C_SR3_MSL | I2C_SR3_BUSY;
+      break;
+    
+    case HostI2c_Phase_ADDR:
+      if (bAck)
+      {
+        sHostI2c.SR1 |= I2C_SR1_ADDR;
+        if (!bHostI2cRead)
+        {
+          sHostI2c.SR1 |= I2C_SR1_TXE;
+          sHostI2c.SR3 |= I2C_SR3_TRA;
+        }
+      }
+      else
+      {
+        pHostI2cSlave = NULL;
+        sHostI2c.SR2 |= I2C_SR2_AF;
+      }
+      HostI2c_Kick();
+      break;
+    
+    case HostI2c_Phase_TX:
+      if (!bAck)
+      {
+        sHostI2c.SR2 |= I2C_SR2_AF;
+      }
+      else if (sHostI2c.SR1 & I2C_SR1_TXE)
+      {
+        sHostI2c.SR1 |= I2C_SR1_BTF;
+      }
+      else
+      {
+        sHostI2c.SR1 &= (uint8_t)~I2C_SR1_TXE;
+        HostI2c_Load();
+      }
+      HostI2c_Kick();
+      break;
+    
+    case HostI2c_Phase_RX:
+      bHostI2cRxMore = (sHostI2c.CR2 & I2C_CR2_ACK) != 0;
+      if (sHostI2c.SR1 & I2C_SR1_RXNE)
+      {
+        ucHostI2cShift = ucByte;
+        bHostI2cShiftFull = true;
+        sHostI2c.SR1 |= I2C_SR1_BTF;
+      }
+      else
+      {
+        sHostI2c.DR = ucByte;
+        sHostI2c.SR1 |= I2C_SR1_RXNE;
+      }
+      HostI2c_NextRx();
+      break;
+    
+    case HostI2c_Phase_STOP:
+      sHostI2c.CR2 &= (uint8_t)~I2C_CR2_STOP;
+      sHostI2c.SR3 = 0;
+      if ((pHostI2cSlave != NULL) && (pHostI2cSlave->pfnStop != NULL))
+      {
+        pHostI2cSlave->pfnStop(pHostI2cSlave);
+      }
+      pHostI2cSlave = NULL;
+      bHostI2cRead = false;
+      bHostI2cShiftFull = false;
+      bHostI2cRxMore = false;
+      HostI2c_Kick();
+      break;
+    
+    default:
+      ;
+  }
+  HostCore_Raise();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung (Ereignis-, Puffer- und Fehlerinterrupt)
+ *
+ * @return    bool      true, wenn der Interrupt ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostI2c_Pending(void)
+{
+  uint8_t ucItr = sHostI2c.ITR;
+  
+  return ((ucItr & I2C_IT_ERR) && (sHostI2c.SR2 & HOSTI2C_SR2_ERR))
+    || ((ucItr & I2C_IT_EVT) && (sHostI2c.SR1 & HOSTI2C_SR1_EVT))
+    || ((ucItr & I2C_IT_EVT) && (ucItr & I2C_IT_BUF)
+      && (sHostI2c.SR1 & HOSTI2C_SR1_BUF));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Register wie nach dem Reset
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostI2c_Reset(void)
+{
+  HostI2c_Release();
+  sHostI2c.CR1 = I2C_CR1_RESET_VALUE;
+  sHostI2c.CR2 = I2C_CR2_RESET_VALUE;
+  sHostI2c.FREQR = 0;
+  sHostI2c.OARL = 0;
+  sHostI2c.OARH = 0;
+  sHostI2c.DR = 0;
+  sHostI2c.ITR = I2C_ITR_RESET_VALUE;
+  sHostI2c.CCRL = 0;
+  sHostI2c.CCRH = 0;
+  sHostI2c.TRISER = 0x02;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Schnittstelle wie nach dem Reset, Teilnehmer bleiben angemeldet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostI2c_Init(void)
+{
+  static const HostCore_Irq sIrq = {HOSTCORE_VEC_I2C, HostI2c_Pending};
+  
+  sHostI2cSrc.pszName = "I2C1";
+  sHostI2cSrc.ullNext = HOSTCORE_NEVER;
+  sHostI2cSrc.pfnFire = HostI2c_Fire;
+  sHostI2cSrc.bSysClk = true;
+  HostCore_AddSource(&sHostI2cSrc);
+  HostCore_AddIrq(&sIrq);
+  ullHostI2cByteNs = HOSTCORE_S(HOSTI2C_BITS) / 100000u;
+  HostI2c_Reset();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Teilnehmer am Bus anmelden
+ *
+ * @param[in] pSlave    Teilnehmer, muss gltig bleiben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostI2c_Attach(const HostI2c_Slave* pSlave)
+{
+  if (ucHostI2cSlaves >= HOSTI2C_SLAVES)
+  {
+    HostCore_Fatal("I2C: zu viele Teilnehmer");
+  }
+  apHostI2cSlave[ucHostI2cSlaves++] = pSlave;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bus festhalten (SCL bzw. SDA low), nur aus einer Funktion des
+ * Teilnehmers. Der laufende Vorgang endet nicht, bis die Firmware die
+ * Schnittstelle zurcksetzt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostI2c_Hold(void)
+{
+  bHostI2cHeld = true;
+}
+
+/* Ersatz fr stm8l15x_i2c.c                                                  */
+void I2C_DeInit(I2C_TypeDef* I2Cx)
+{
+  (void)I2Cx;
+  HostCore_Step();
+  if (HostI2c_Clocked())
+  {
+    HostI2c_Reset();
+  }
+}
+
+void I2C_Init(I2C_TypeDef* I2Cx, uint32_t OutputClockFrequency, uint16_t OwnAddress,
+              I2C_Mode_TypeDef I2C_Mode, I2C_DutyCycle_TypeDef I2C_DutyCycle,
+              I2C_Ack_TypeDef I2C_Ack, I2C_AcknowledgedAddress_TypeDef I2C_AcknowledgedAddress)
+{
+  (void)I2C_DutyCycle;
+  (void)I2C_AcknowledgedAddress;
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if ((I2C_Mode != I2C_Mode_I2C) || (OutputClockFrequency == 0))
+  {
+    HostCore_Fatal("I2C: nur I2C-Modus nachgebildet");
+  }
+  ullHostI2cByteNs = HOSTCORE_S(HOSTI2C_BITS) / OutputClockFrequency;
+  I2Cx->FREQR = (uint8_t)(HOSTHAL_FSYS / 1000000UL);
+  I2Cx->OARL = (uint8_t)OwnAddress;
+  I2Cx->CR2 = (uint8_t)((I2Cx->CR2 & (uint8_t)~I2C_CR2_ACK) | (uint8_t)I2C_Ack);
+}
+
+void I2C_Cmd(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    I2Cx->CR1 |= I2C_CR1_PE;
+    HostI2c_Kick();
+  }
+  else
+  {
+    I2Cx->CR1 &= (uint8_t)~I2C_CR1_PE;
+    I2Cx->CR2 &= (uint8_t)~(I2C_CR2_START | I2C_CR2_STOP);
+    HostI2c_Release();
+  }
+}
+
+void I2C_StretchClockCmd(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    I2Cx->CR1 &= (uint8_t)~I2C_CR1_NOSTRETCH;
+  }
+  else
+  {
+    I2Cx->CR1 |= I2C_CR1_NOSTRETCH;
+  }
+}
+
+void I2C_GenerateSTART(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    I2Cx->CR2 |= I2C_CR2_START;
+    HostI2c_Kick();
+  }
+  else
+  {
+    I2Cx->CR2 &= (uint8_t)~I2C_CR2_START;
+  }
+}
+
+void I2C_GenerateSTOP(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    I2Cx->CR2 |= I2C_CR2_STOP;
+    HostI2c_Kick();
+  }
+  else
+  {
+    I2Cx->CR2 &= (uint8_t)~I2C_CR2_STOP;
+  }
+}
+
+void I2C_SoftwareResetCmd(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    /* SWRST: alle Register zurck, Bus frei              */
+    HostI2c_Reset();
+    I2Cx->CR2 |= I2C_CR2_SWRST;
+  }
+  else
+  {
+    I2Cx->CR2 &= (uint8_t)~I2C_CR2_SWRST;
+  }
+}
+
+void I2C_AcknowledgeConfig(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    I2Cx->CR2 |= I2C_CR2_ACK;
+  }
+  else
+  {
+    I2Cx->CR2 &= (uint8_t)~I2C_CR2_ACK;
+  }
+}
+
+void I2C_ITConfig(I2C_TypeDef* I2Cx, I2C_IT_TypeDef I2C_IT, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    I2Cx->ITR |= (uint8_t)I2C_IT;
+  }
+  else
+  {
+    I2Cx->ITR &= (uint8_t)~(uint8_t)I2C_IT;
+  }
+  HostCore_Raise();
+}
+
+void I2C_Send7bitAddress(I2C_TypeDef* I2Cx, uint8_t Address, I2C_Direction_TypeDef I2C_Direction)
+{
+  HostCore_Step();
+  if (!HostI2c_Enabled())
+  {
+    return;
+  }
+  I2Cx->DR = (uint8_t)((Address & 0xFE) | (uint8_t)I2C_Direction);
+  if (!(I2Cx->SR1 & I2C_SR1_SB))
+  {
+    return;
+  }
+  
+  /* SB lscht das Schreiben des Adressbytes              */
+  I2Cx->SR1 &= (uint8_t)~I2C_SR1_SB;
+  pHostI2cSlave = HostI2c_Find((uint8_t)(Address >> 1));
+  bHostI2cRead = (I2C_Direction == I2C_Direction_Receiver);
+  HostI2c_Begin(HostI2c_Phase_ADDR, ullHostI2cByteNs);
+  HostCore_Raise();
+}
+
+void I2C_SendData(I2C_TypeDef* I2Cx, uint8_t Data)
+{
+  HostCore_Step();
+  if (!HostI2c_Enabled())
+  {
+    return;
+  }
+  I2Cx->DR = Data;
+  I2Cx->SR1 &= (uint8_t)~(I2C_SR1_TXE | I2C_SR1_BTF);
+  HostI2c_Load();
+  HostCore_Raise();
+}
+
+uint8_t I2C_ReceiveData(I2C_TypeDef* I2Cx)
+{
+  uint8_t ucData;
+  
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return 0;
+  }
+  ucData = I2Cx->DR;
+  if (bHostI2cShiftFull)
+  {
+    I2Cx->DR = ucHostI2cShift;
+    bHostI2cShiftFull = false;
+    I2Cx->SR1 &= (uint8_t)~I2C_SR1_BTF;
+  }
+  else
+  {
+    I2Cx->SR1 &= (uint8_t)~I2C_SR1_RXNE;
+  }
+  if (bHostI2cRead && (eHostI2cPhase == HostI2c_Phase_NONE)
+    && (pHostI2cSlave != NULL) && !(I2Cx->SR1 & I2C_SR1_ADDR))
+  {
+    HostI2c_NextRx();
+  }
+  HostCore_Raise();
+  return ucData;
+}
+
+I2C_Event_TypeDef I2C_GetLastEvent(I2C_TypeDef* I2Cx)
+{
+  uint16_t uiEvent;
+  
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return (I2C_Event_TypeDef)0;
+  }
+  if (I2Cx->SR2 & I2C_SR2_AF)
+  {
+    return I2C_EVENT_SLAVE_ACK_FAILURE;
+  }
+  uiEvent = (uint16_t)(((uint16_t)I2Cx->SR3 << 8) | I2Cx->SR1);
+  
+  /* SR1 und SR3 lesen lscht ADDR, Empfang beginnt       */
+  if (I2Cx->SR1 & I2C_SR1_ADDR)
+  {
+    I2Cx->SR1 &= (uint8_t)~I2C_SR1_ADDR;
+    if (bHostI2cRead)
+    {
+      bHostI2cRxMore = true;
+      HostI2c_NextRx();
+    }
+    else
+    {
+      HostI2c_Load();
+    }
+    HostCore_Raise();
+  }
+  return (I2C_Event_TypeDef)uiEvent;
+}
+
+FlagStatus I2C_GetFlagStatus(I2C_TypeDef* I2Cx, I2C_FLAG_TypeDef I2C_FLAG)
+{
+  uint8_t ucReg;
+  
+  HostCore_Poll(0x06000000UL | (uint16_t)I2C_FLAG);
+  if (!HostI2c_Clocked())
+  {
+    return RESET;
+  }
+  switch ((uint16_t)I2C_FLAG >> 8)
+  {
+    case 0x01:
+      ucReg = I2Cx->SR1;
+      break;
+    case 0x02:
+      ucReg = I2Cx->SR2;
+      break;
+    default:
+      ucReg = I2Cx->SR3;
+  }
+  return (FlagStatus)((ucReg & (uint8_t)I2C_FLAG) != 0);
+}
+
+void I2C_ClearFlag(I2C_TypeDef* I2Cx, I2C_FLAG_TypeDef I2C_FLAG)
+{
+  HostCore_Step();
+  if (!HostI2c_Clocked())
+  {
+    return;
+  }
+  I2Cx->SR2 &= (uint8_t)~(uint8_t)I2C_FLAG;
+  HostCore_Raise();
+}
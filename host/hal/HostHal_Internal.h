@@ -0,0 +1,31 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Internal.h
+ *
+ * Initialisierung der einzelnen Peripheriemodelle, nur fr HostHal.c.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOSTHAL_INTERNAL_H_
+#define HOSTHAL_INTERNAL_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void HostGpio_Init(void);
+void HostClk_Init(void);
+void HostRtc_Init(void);
+void HostTim_Init(void);
+void HostUsart_Init(void);
+void HostI2c_Init(void);
+void HostSpi_Init(void);
+void HostAdc_Init(void);
+
+/* Zhler bei nderung der Peripherietakte nachfhren                         */
+void HostTim_Sync(void);
+void HostTim_ClockChanged(void);
+
+#endif /* HOSTHAL_INTERNAL_H_ */
@@ -0,0 +1,553 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Rtc.c
+ *
+ * Ersatz fr die RTC der Standardbibliothek. Der Kalender zhlt Sekunden
+ * seit dem 01.01.2000 in Echtzeit, der Sekundentakt (ck_spre) hat eine
+ * feste Phase: RTC_SetTime und RTC_SetDate ndern nur den Zhlerstand,
+ * nicht die Lage der Sekundengrenzen. Alarm A ist nur mit der Maske "alle
+ * Felder" nachgebildet (jede Sekunde), der Wakeup-Timer nur am ck_spre.
+ * TR, DR und SSR werden vor jedem Bibliotheksaufruf aus der Echtzeit
+ * gebildet, damit direkte Lesezugriffe (LowPower_GetStamp) stimmen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostHal_Internal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Takt des Unterzhlers SSR (SynchPrediv 255)                               */
+#define HOSTRTC_SUB_HZ          256u
+
+/*! Tage vom 01.01.2000 bis zum 01.01.2100                                    */
+#define HOSTRTC_DAYS_MAX        36525u
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Registerabbild                                                            */
+RTC_TypeDef sHostRtc;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Echtzeit der Sekundengrenze, an der der Kalender ulHostRtcBase zeigt      */
+static HostCore_Time ullHostRtcBaseNs;
+static uint32_t ulHostRtcBase;
+
+/*! Wochentag: (Tage seit 2000 + Versatz) % 7 + 1                             */
+static uint8_t ucHostRtcWeekOffs;
+
+/*! Alarm A, Wakeup-Timer, Interruptfreigaben                                 */
+static bool bHostRtcAlarm;
+static bool bHostRtcWakeUp;
+static bool bHostRtcAlarmIe;
+static bool bHostRtcWakeUpIe;
+static uint16_t uiHostRtcWakeUpReload;
+static uint32_t ulHostRtcWakeUpLeft;
+
+/*! Flags ALRAF und WUTF                                                      */
+static uint16_t uiHostRtcFlags;
+
+/*! Sekundentakt                                                              */
+static HostCore_Source sHostRtcTick;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Binrwert in BCD umwandeln
+ *
+ * @param[in] ucBin     Binrwert 0..99
+ * @return    uint8_t   BCD-Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostRtc_Bin2Bcd(uint8_t ucBin)
+{
+  return (uint8_t)(((ucBin / 10) << 4) | (ucBin % 10));
+}
+
+/*!****************************************************************************
+ * @brief
+ * BCD-Wert in Binrwert umwandeln
+ *
+ * @param[in] ucBcd     BCD-Wert
+ * @return    uint8_t   Binrwert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostRtc_Bcd2Bin(uint8_t ucBcd)
+{
+  return (uint8_t)(((ucBcd >> 4) * 10) + (ucBcd & 0x0F));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Tage seit dem 01.01.2000 aus einem Datum
+ *
+ * @param[in] ucYear    Jahr 0..99
+ * @param[in] ucMonth   Monat 1..12
+ * @param[in] ucDay     Tag 1..31
+ * @return    uint32_t  Tage
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostRtc_Days(uint8_t ucYear, uint8_t ucMonth, uint8_t ucDay)
+{
+  static const uint16_t auiStart[12] =
+    {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+  uint32_t ulDays = (uint32_t)ucYear * 365u + (ucYear + 3u) / 4u;
+  
+  ulDays += auiStart[ucMonth - 1] + ucDay - 1u;
+  if (((ucYear & 3) == 0) && (ucMonth > 2))
+  {
+    ++ulDays;
+  }
+  return ulDays;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Kalenderstand in Sekunden seit dem 01.01.2000
+ *
+ * @return    uint32_t  Sekunden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostRtc_Now(void)
+{
+  return ulHostRtcBase
+    + (uint32_t)((ullHostNow - ullHostRtcBaseNs) / HOSTCORE_S(1));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Kalenderstand setzen, die Lage der Sekundengrenzen bleibt
+ *
+ * @param[in] ulSec     Sekunden seit dem 01.01.2000
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostRtc_Set(uint32_t ulSec)
+{
+  ullHostRtcBaseNs += ((ullHostNow - ullHostRtcBaseNs) / HOSTCORE_S(1))
+    * HOSTCORE_S(1);
+  ulHostRtcBase = ulSec;
+  ullHostSyncAt = ullHostNow;
+  HostCore_Sync();
+}
+
+/*!****************************************************************************
+ * @brief
+ * TR, DR und SSR aus der Echtzeit bilden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostRtc_Sync(void)
+{
+  HostCore_Time ullInSec = (ullHostNow - ullHostRtcBaseNs) % HOSTCORE_S(1);
+  uint32_t ulSec = HostRtc_Now();
+  uint32_t ulDays = ulSec / 86400u;
+  uint32_t ulTime = ulSec % 86400u;
+  uint8_t ucSub = (uint8_t)((ullInSec * HOSTRTC_SUB_HZ) / HOSTCORE_S(1));
+  uint8_t ucYear;
+  uint8_t ucMonth;
+  uint8_t ucDay;
+  
+  HostRtc_Date(ulDays, &ucYear, &ucMonth, &ucDay);
+  sHostRtc.TR1 = HostRtc_Bin2Bcd((uint8_t)(ulTime % 60u));
+  sHostRtc.TR2 = HostRtc_Bin2Bcd((uint8_t)((ulTime / 60u) % 60u));
+  sHostRtc.TR3 = HostRtc_Bin2Bcd((uint8_t)(ulTime / 3600u));
+  sHostRtc.DR1 = HostRtc_Bin2Bcd(ucDay);
+  sHostRtc.DR2 = (uint8_t)(HostRtc_Bin2Bcd(ucMonth)
+    | ((((ulDays + ucHostRtcWeekOffs) % 7u) + 1u) << 5));
+  sHostRtc.DR3 = HostRtc_Bin2Bcd(ucYear);
+  sHostRtc.SSRH = 0;
+  sHostRtc.SSRL = (uint8_t)(HOSTRTC_SUB_HZ - 1u - ucSub);
+  
+  /* Nchster Abgleich mit dem nchsten Schritt von SSR   */
+  ullHostSyncAt = ullHostNow - ullInSec
+    + ((HostCore_Time)(ucSub + 1u) * HOSTCORE_S(1) + HOSTRTC_SUB_HZ - 1u)
+      / HOSTRTC_SUB_HZ;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sekundentakt planen, solange Alarm oder Wakeup-Timer laufen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostRtc_Plan(void)
+{
+  HostCore_Time ullNext = HOSTCORE_NEVER;
+  
+  if (bHostRtcAlarm || bHostRtcWakeUp)
+  {
+    ullNext = ullHostNow - ((ullHostNow - ullHostRtcBaseNs) % HOSTCORE_S(1))
+      + HOSTCORE_S(1);
+  }
+  HostCore_Schedule(&sHostRtcTick, ullNext);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sekundengrenze: Alarm A und Wakeup-Timer
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostRtc_Tick(void)
+{
+  if (bHostRtcAlarm)
+  {
+    uiHostRtcFlags |= RTC_FLAG_ALRAF;
+  }
+  if (bHostRtcWakeUp && (--ulHostRtcWakeUpLeft == 0))
+  {
+    uiHostRtcFlags |= RTC_FLAG_WUTF;
+    ulHostRtcWakeUpLeft = (uint32_t)uiHostRtcWakeUpReload + 1u;
+  }
+  HostRtc_Plan();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung der RTC
+ *
+ * @return    bool      true, wenn der Interrupt ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostRtc_Pending(void)
+{
+  return ((uiHostRtcFlags & RTC_FLAG_ALRAF) && bHostRtcAlarmIe)
+    || ((uiHostRtcFlags & RTC_FLAG_WUTF) && bHostRtcWakeUpIe);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * RTC wie nach dem Reset; der Kalender luft weiter (Backup-Domne)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostRtc_Init(void)
+{
+  static const HostCore_Irq sIrq = {HOSTCORE_VEC_RTC, HostRtc_Pending};
+  
+  bHostRtcAlarm = false;
+  bHostRtcWakeUp = false;
+  bHostRtcAlarmIe = false;
+  bHostRtcWakeUpIe = false;
+  uiHostRtcWakeUpReload = 0xFFFF;
+  uiHostRtcFlags = 0;
+  sHostRtcTick.pszName = "RTC";
+  sHostRtcTick.ullNext = HOSTCORE_NEVER;
+  sHostRtcTick.pfnFire = HostRtc_Tick;
+  sHostRtcTick.bSysClk = false;
+  HostCore_AddSource(&sHostRtcTick);
+  HostCore_AddIrq(&sIrq);
+  HostCore_SetSync(HostRtc_Sync);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datum aus den Tagen seit dem 01.01.2000
+ *
+ * @param[in]  ulDays   Tage
+ * @param[out] pucYear  Jahr 0..99
+ * @param[out] pucMonth Monat 1..12
+ * @param[out] pucDay   Tag 1..31
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostRtc_Date(uint32_t ulDays, uint8_t* pucYear, uint8_t* pucMonth,
+  uint8_t* pucDay)
+{
+  uint8_t ucYear = (uint8_t)(ulDays / 366u);
+  uint8_t ucMonth = 1;
+  
+  while (HostRtc_Days((uint8_t)(ucYear + 1), 1, 1) <= ulDays)
+  {
+    ++ucYear;
+  }
+  while ((ucMonth < 12) && (HostRtc_Days(ucYear, (uint8_t)(ucMonth + 1), 1) <= ulDays))
+  {
+    ++ucMonth;
+  }
+  *pucYear = ucYear;
+  *pucMonth = ucMonth;
+  *pucDay = (uint8_t)(ulDays - HostRtc_Days(ucYear, ucMonth, 1) + 1u);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Kalender starten
+ *
+ * @param[in] ulSec     Sekunden seit dem 01.01.2000
+ * @param[in] ullPhase  Seit der letzten Sekundengrenze vergangene Zeit in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostRtc_Start(uint32_t ulSec, HostCore_Time ullPhase)
+{
+  ullHostRtcBaseNs = ullHostNow - ullPhase;
+  ulHostRtcBase = ulSec;
+  
+  /* 01.01.2000 war ein Samstag                           */
+  ucHostRtcWeekOffs = 5;
+  ullHostSyncAt = ullHostNow;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Kalenderstand abfragen
+ *
+ * @return    uint32_t  Sekunden seit dem 01.01.2000
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint32_t HostRtc_GetSeconds(void)
+{
+  return HostRtc_Now();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Seit der letzten Sekundengrenze vergangene Zeit abfragen
+ *
+ * @return    HostCore_Time  Zeit in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+HostCore_Time HostRtc_GetPhase(void)
+{
+  return (ullHostNow - ullHostRtcBaseNs) % HOSTCORE_S(1);
+}
+
+/* Ersatz fr stm8l15x_rtc.c                                                  */
+void RTC_StructInit(RTC_InitTypeDef* RTC_InitStruct)
+{
+  RTC_InitStruct->RTC_HourFormat = RTC_HourFormat_24;
+  RTC_InitStruct->RTC_AsynchPrediv = RTC_APRER_RESET_VALUE;
+  RTC_InitStruct->RTC_SynchPrediv = RTC_SPRERL_RESET_VALUE;
+}
+
+ErrorStatus RTC_Init(RTC_InitTypeDef* RTC_InitStruct)
+{
+  HostCore_Step();
+  if ((RTC_InitStruct->RTC_HourFormat != RTC_HourFormat_24)
+    || (RTC_InitStruct->RTC_AsynchPrediv != RTC_APRER_RESET_VALUE)
+    || (RTC_InitStruct->RTC_SynchPrediv != RTC_SPRERL_RESET_VALUE))
+  {
+    HostCore_Fatal("RTC: nur 24h und Standardteiler nachgebildet");
+  }
+  return SUCCESS;
+}
+
+void RTC_TimeStructInit(RTC_TimeTypeDef* RTC_TimeStruct)
+{
+  RTC_TimeStruct->RTC_H12 = RTC_H12_AM;
+  RTC_TimeStruct->RTC_Hours = 0;
+  RTC_TimeStruct->RTC_Minutes = 0;
+  RTC_TimeStruct->RTC_Seconds = 0;
+}
+
+void RTC_DateStructInit(RTC_DateTypeDef* RTC_DateStruct)
+{
+  RTC_DateStruct->RTC_WeekDay = RTC_Weekday_Monday;
+  RTC_DateStruct->RTC_Date = 1;
+  RTC_DateStruct->RTC_Month = RTC_Month_January;
+  RTC_DateStruct->RTC_Year = 0;
+}
+
+ErrorStatus RTC_SetTime(RTC_Format_TypeDef RTC_Format, RTC_TimeTypeDef* RTC_TimeStruct)
+{
+  uint8_t ucHours = RTC_TimeStruct->RTC_Hours;
+  uint8_t ucMinutes = RTC_TimeStruct->RTC_Minutes;
+  uint8_t ucSeconds = RTC_TimeStruct->RTC_Seconds;
+  uint32_t ulSec;
+  
+  HostCore_Step();
+  if (RTC_Format != RTC_Format_BIN)
+  {
+    ucHours = HostRtc_Bcd2Bin(ucHours);
+    ucMinutes = HostRtc_Bcd2Bin(ucMinutes);
+    ucSeconds = HostRtc_Bcd2Bin(ucSeconds);
+  }
+  if ((ucHours > 23) || (ucMinutes > 59) || (ucSeconds > 59))
+  {
+    return ERROR;
+  }
+  ulSec = HostRtc_Now();
+  HostRtc_Set(ulSec - (ulSec % 86400u)
+    + (uint32_t)ucHours * 3600u + (uint32_t)ucMinutes * 60u + ucSeconds);
+  return SUCCESS;
+}
+
+ErrorStatus RTC_SetDate(RTC_Format_TypeDef RTC_Format, RTC_DateTypeDef* RTC_DateStruct)
+{
+  uint8_t ucMonth = (uint8_t)RTC_DateStruct->RTC_Month;
+  uint8_t ucDay = RTC_DateStruct->RTC_Date;
+  uint8_t ucYear = RTC_DateStruct->RTC_Year;
+  uint32_t ulDays;
+  
+  HostCore_Step();
+  if (RTC_Format != RTC_Format_BIN)
+  {
+    ucDay = HostRtc_Bcd2Bin(ucDay);
+    ucYear = HostRtc_Bcd2Bin(ucYear);
+  }
+  
+  /* Monat wie Bibliothek: 0x10..0x12 auch bei BIN        */
+  if ((RTC_Format != RTC_Format_BIN) || ((ucMonth & 0x10) != 0))
+  {
+    ucMonth = HostRtc_Bcd2Bin(ucMonth);
+  }
+  if ((ucMonth < 1) || (ucMonth > 12) || (ucDay < 1) || (ucDay > 31)
+    || (ucYear > 99))
+  {
+    return ERROR;
+  }
+  ulDays = HostRtc_Days(ucYear, ucMonth, ucDay);
+  ucHostRtcWeekOffs = (uint8_t)((RTC_DateStruct->RTC_WeekDay + 6u
+    - (ulDays % 7u)) % 7u);
+  HostRtc_Set(ulDays * 86400u + (HostRtc_Now() % 86400u));
+  return SUCCESS;
+}
+
+void RTC_GetTime(RTC_Format_TypeDef RTC_Format, RTC_TimeTypeDef* RTC_TimeStruct)
+{
+  HostCore_Step();
+  HostRtc_Sync();
+  RTC_TimeStruct->RTC_H12 = RTC_H12_AM;
+  RTC_TimeStruct->RTC_Hours = sHostRtc.TR3;
+  RTC_TimeStruct->RTC_Minutes = sHostRtc.TR2;
+  RTC_TimeStruct->RTC_Seconds = sHostRtc.TR1;
+  if (RTC_Format == RTC_Format_BIN)
+  {
+    RTC_TimeStruct->RTC_Hours = HostRtc_Bcd2Bin(sHostRtc.TR3);
+    RTC_TimeStruct->RTC_Minutes = HostRtc_Bcd2Bin(sHostRtc.TR2);
+    RTC_TimeStruct->RTC_Seconds = HostRtc_Bcd2Bin(sHostRtc.TR1);
+  }
+}
+
+void RTC_GetDate(RTC_Format_TypeDef RTC_Format, RTC_DateTypeDef* RTC_DateStruct)
+{
+  HostCore_Step();
+  HostRtc_Sync();
+  RTC_DateStruct->RTC_WeekDay = (RTC_Weekday_TypeDef)(sHostRtc.DR2 >> 5);
+  RTC_DateStruct->RTC_Month = (RTC_Month_TypeDef)(sHostRtc.DR2 & 0x1F);
+  RTC_DateStruct->RTC_Date = sHostRtc.DR1;
+  RTC_DateStruct->RTC_Year = sHostRtc.DR3;
+  if (RTC_Format == RTC_Format_BIN)
+  {
+    RTC_DateStruct->RTC_Month =
+      (RTC_Month_TypeDef)HostRtc_Bcd2Bin((uint8_t)(sHostRtc.DR2 & 0x1F));
+    RTC_DateStruct->RTC_Date = HostRtc_Bcd2Bin(sHostRtc.DR1);
+    RTC_DateStruct->RTC_Year = HostRtc_Bcd2Bin(sHostRtc.DR3);
+  }
+}
+
+ErrorStatus RTC_WaitForSynchro(void)
+{
+  HostCore_Step();
+  HostRtc_Sync();
+  return SUCCESS;
+}
+
+void RTC_WakeUpClockConfig(RTC_WakeUpClock_TypeDef RTC_WakeUpClock)
+{
+  HostCore_Step();
+  if (RTC_WakeUpClock != RTC_WakeUpClock_CK_SPRE_16bits)
+  {
+    HostCore_Fatal("RTC: Wakeup nur mit CK_SPRE_16bits nachgebildet");
+  }
+}
+
+void RTC_SetWakeUpCounter(uint16_t RTC_WakeupCounter)
+{
+  HostCore_Step();
+  if (!bHostRtcWakeUp)
+  {
+    uiHostRtcWakeUpReload = RTC_WakeupCounter;
+  }
+}
+
+ErrorStatus RTC_WakeUpCmd(FunctionalState NewState)
+{
+  HostCore_Step();
+  bHostRtcWakeUp = (NewState != DISABLE);
+  ulHostRtcWakeUpLeft = (uint32_t)uiHostRtcWakeUpReload + 1u;
+  HostRtc_Plan();
+  return SUCCESS;
+}
+
+void RTC_AlarmStructInit(RTC_AlarmTypeDef* RTC_AlarmStruct)
+{
+  RTC_AlarmStruct->RTC_AlarmTime.RTC_H12 = RTC_H12_AM;
+  RTC_AlarmStruct->RTC_AlarmTime.RTC_Hours = 0;
+  RTC_AlarmStruct->RTC_AlarmTime.RTC_Minutes = 0;
+  RTC_AlarmStruct->RTC_AlarmTime.RTC_Seconds = 0;
+  RTC_AlarmStruct->RTC_AlarmDateWeekDaySel = RTC_AlarmDateWeekDaySel_Date;
+  RTC_AlarmStruct->RTC_AlarmDateWeekDay = 1;
+  RTC_AlarmStruct->RTC_AlarmMask = RTC_AlarmMask_All;
+}
+
+void RTC_SetAlarm(RTC_Format_TypeDef RTC_Format, RTC_AlarmTypeDef* RTC_AlarmStruct)
+{
+  (void)RTC_Format;
+  HostCore_Step();
+  if (RTC_AlarmStruct->RTC_AlarmMask != RTC_AlarmMask_All)
+  {
+    HostCore_Fatal("RTC: Alarm nur mit RTC_AlarmMask_All nachgebildet");
+  }
+}
+
+ErrorStatus RTC_AlarmSubSecondConfig(uint16_t RTC_AlarmSubSecondValue,
+                                     RTC_AlarmSubSecondMask_TypeDef RTC_AlarmSubSecondMask)
+{
+  (void)RTC_AlarmSubSecondValue;
+  HostCore_Step();
+  if (RTC_AlarmSubSecondMask != RTC_AlarmSubSecondMask_All)
+  {
+    HostCore_Fatal("RTC: Alarm nur ohne Vergleich der Subsekunden nachgebildet");
+  }
+  return SUCCESS;
+}
+
+ErrorStatus RTC_AlarmCmd(FunctionalState NewState)
+{
+  HostCore_Step();
+  bHostRtcAlarm = (NewState != DISABLE);
+  HostRtc_Plan();
+  return SUCCESS;
+}
+
+void RTC_ITConfig(RTC_IT_TypeDef RTC_IT, FunctionalState NewState)
+{
+  HostCore_Step();
+  if ((RTC_IT & RTC_IT_WUT) != 0)
+  {
+    bHostRtcWakeUpIe = (NewState != DISABLE);
+  }
+  if ((RTC_IT & RTC_IT_ALRA) != 0)
+  {
+    bHostRtcAlarmIe = (NewState != DISABLE);
+  }
+  HostCore_Raise();
+}
+
+FlagStatus RTC_GetFlagStatus(RTC_Flag_TypeDef RTC_FLAG)
+{
+  HostCore_Poll(0x03000000UL | (uint16_t)RTC_FLAG);
+  return (FlagStatus)(((uiHostRtcFlags | RTC_FLAG_RSF | RTC_FLAG_INITS)
+    & (uint16_t)RTC_FLAG) != 0);
+}
+
+void RTC_ClearFlag(RTC_Flag_TypeDef RTC_FLAG)
+{
+  HostCore_Step();
+  uiHostRtcFlags &= (uint16_t)~RTC_FLAG;
+}
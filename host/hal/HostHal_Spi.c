@@ -0,0 +1,200 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Spi.c
+ *
+ * Ersatz fr SPI1 und SPI2 der Standardbibliothek als Master. Jedes
+ * geschriebene Byte wird sofort mit dem angeschlossenen Modell getauscht;
+ * TXE und RXNE stehen damit direkt nach SPI_SendData() an. Auf dem
+ * Zielsystem liegt die bertragung (32 s bei Teiler 64) innerhalb der
+ * Wartezeiten in sdmm.c, die Reihenfolge der Flags ist dieselbe.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stddef.h>
+#include "HostHal_Internal.h"
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Registerabbilder                                                          */
+SPI_TypeDef asHostSpi[HostSpi_NUM];
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Angeschlossene Modelle                                                    */
+static uint8_t (*apfnHostSpiXfer[HostSpi_NUM])(uint8_t ucOut);
+
+/*! Empfangsregister (DR liest die Firmware nur ber die Bibliothek)          */
+static uint8_t aucHostSpiRx[HostSpi_NUM];
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Index aus dem Registerzeiger bestimmen
+ *
+ * @param[in] pSpi      Registerabbild
+ * @return    HostSpi   Index
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static HostSpi HostSpi_Index(const SPI_TypeDef* pSpi)
+{
+  if ((pSpi < &asHostSpi[0]) || (pSpi >= &asHostSpi[HostSpi_NUM]))
+  {
+    HostCore_Fatal("SPI: ungltige Schnittstelle");
+  }
+  return (HostSpi)(pSpi - &asHostSpi[0]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob der Peripherietakt eingeschaltet ist
+ *
+ * @param[in] eSpi      Schnittstelle
+ * @return    bool      true, wenn Registerzugriffe wirken
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostSpi_Clocked(HostSpi eSpi)
+{
+  return HostClk_IsOn((eSpi == HostSpi_1) ? CLK_Peripheral_SPI1
+    : CLK_Peripheral_SPI2);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Schnittstellen wie nach dem Reset, Modelle bleiben angeschlossen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostSpi_Init(void)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < HostSpi_NUM; ++ucIdx)
+  {
+    asHostSpi[ucIdx].CR1 = 0;
+    asHostSpi[ucIdx].CR2 = 0;
+    asHostSpi[ucIdx].CR3 = 0;
+    asHostSpi[ucIdx].SR = SPI_FLAG_TXE;
+    asHostSpi[ucIdx].DR = 0;
+    aucHostSpiRx[ucIdx] = 0;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Modell an die Schnittstelle anschlieen
+ *
+ * @param[in] eSpi      Schnittstelle
+ * @param[in] pfnXfer   Byte vom Master annehmen, Antwortbyte liefern
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostSpi_Attach(HostSpi eSpi, uint8_t (*pfnXfer)(uint8_t ucOut))
+{
+  apfnHostSpiXfer[eSpi] = pfnXfer;
+}
+
+/* Ersatz fr stm8l15x_spi.c                                                  */
+void SPI_Init(SPI_TypeDef* SPIx, SPI_FirstBit_TypeDef SPI_FirstBit,
+              SPI_BaudRatePrescaler_TypeDef SPI_BaudRatePrescaler,
+              SPI_Mode_TypeDef SPI_Mode, SPI_CPOL_TypeDef SPI_CPOL,
+              SPI_CPHA_TypeDef SPI_CPHA, SPI_DirectionMode_TypeDef SPI_Data_Direction,
+              SPI_NSS_TypeDef SPI_Slave_Management, uint8_t CRCPolynomial)
+{
+  HostSpi eSpi = HostSpi_Index(SPIx);
+  
+  HostCore_Step();
+  if (!HostSpi_Clocked(eSpi))
+  {
+    return;
+  }
+  if ((SPI_Mode != SPI_Mode_Master)
+    || (SPI_Data_Direction != SPI_Direction_2Lines_FullDuplex))
+  {
+    HostCore_Fatal("SPI: nur Vollduplex-Master nachgebildet");
+  }
+  SPIx->CR1 = (uint8_t)((uint8_t)SPI_FirstBit | (uint8_t)SPI_BaudRatePrescaler
+    | (uint8_t)SPI_CPOL | (uint8_t)SPI_CPHA | (uint8_t)SPI_Mode);
+  SPIx->CR2 = (uint8_t)((uint8_t)SPI_Data_Direction | (uint8_t)SPI_Slave_Management);
+  SPIx->CRCPR = CRCPolynomial;
+}
+
+void SPI_Cmd(SPI_TypeDef* SPIx, FunctionalState NewState)
+{
+  HostSpi eSpi = HostSpi_Index(SPIx);
+  
+  HostCore_Step();
+  if (!HostSpi_Clocked(eSpi))
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    SPIx->CR1 |= SPI_CR1_SPE;
+  }
+  else
+  {
+    SPIx->CR1 &= (uint8_t)~SPI_CR1_SPE;
+  }
+}
+
+void SPI_SendData(SPI_TypeDef* SPIx, uint8_t Data)
+{
+  HostSpi eSpi = HostSpi_Index(SPIx);
+  uint8_t ucIn = 0xFF;
+  
+  HostCore_Step();
+  if (!HostSpi_Clocked(eSpi))
+  {
+    return;
+  }
+  SPIx->DR = Data;
+  if (!(SPIx->CR1 & SPI_CR1_SPE))
+  {
+    return;
+  }
+  if (apfnHostSpiXfer[eSpi] != NULL)
+  {
+    ucIn = apfnHostSpiXfer[eSpi](Data);
+  }
+  if (SPIx->SR & SPI_FLAG_RXNE)
+  {
+    SPIx->SR |= SPI_FLAG_OVR;
+  }
+  else
+  {
+    aucHostSpiRx[eSpi] = ucIn;
+  }
+  SPIx->SR |= SPI_FLAG_TXE | SPI_FLAG_RXNE;
+}
+
+uint8_t SPI_ReceiveData(SPI_TypeDef* SPIx)
+{
+  HostSpi eSpi = HostSpi_Index(SPIx);
+  
+  HostCore_Step();
+  if (!HostSpi_Clocked(eSpi))
+  {
+    return 0;
+  }
+  SPIx->SR &= (uint8_t)~(SPI_FLAG_RXNE | SPI_FLAG_OVR);
+  return aucHostSpiRx[eSpi];
+}
+
+FlagStatus SPI_GetFlagStatus(SPI_TypeDef* SPIx, SPI_FLAG_TypeDef SPI_FLAG)
+{
+  HostSpi eSpi = HostSpi_Index(SPIx);
+  
+  HostCore_Poll(0x07000000UL | ((uint32_t)eSpi << 16) | (uint8_t)SPI_FLAG);
+  if (!HostSpi_Clocked(eSpi))
+  {
+    return RESET;
+  }
+  return (FlagStatus)((SPIx->SR & (uint8_t)SPI_FLAG) != 0);
+}
@@ -0,0 +1,481 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Tim.c
+ *
+ * Ersatz fr TIM1, TIM2 und TIM3 der Standardbibliothek. Die Zhler laufen
+ * am Systemtakt in der Laufzeit (stehen in HALT und bei abgeschaltetem
+ * Peripherietakt) und werden bei jedem Zugriff aus der Zeit nachgefhrt.
+ * TIM3 zhlt die Impulse des Anemometers, deren Rate das Windmodell ber
+ * HostTim3_SetRate() vorgibt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostHal_Internal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Systemtakte je ns: 16 MHz = 2/125                                         */
+#define HOSTTIM_CYC(ullNs)      (((ullNs) * 2u) / 125u)
+#define HOSTTIM_NS(ullCyc)      (((ullCyc) * 125u + 1u) / 2u)
+
+/*! Impulse * 10^12 je mHz und ns                                             */
+#define HOSTTIM3_UNIT           1000000000000ULL
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! Zustand eines Zeitgebers mit internem Takt                                */
+typedef struct tag_HostTim {
+  /*! Peripherietakt (CLK_Peripheral_TypeDef)             */
+  uint8_t ucClk;
+  
+  /*! Systemtakte je Zhlschritt                          */
+  uint32_t ulDiv;
+  
+  /*! Abwrts zhlen                                      */
+  bool bDown;
+  
+  /*! Zhler eingeschaltet (CEN)                          */
+  bool bCen;
+  
+  /*! Zhlerstand und Nachladewert                        */
+  uint16_t uiCnt;
+  uint16_t uiArr;
+  
+  /*! Update-Flag und Interruptfreigabe                   */
+  bool bUif;
+  bool bUie;
+  
+  /*! Laufzeit in Systemtakten, bis zu der uiCnt gilt     */
+  uint64_t ullRef;
+  
+  /*! berlauf                                            */
+  HostCore_Source sSrc;
+} HostTim;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! TIM1 und TIM2                                                             */
+static HostTim sHostTim1;
+static HostTim sHostTim2;
+
+/*! TIM3: Zhler, eingeschaltet, Impulsrate, Rest, Laufzeit des Stands        */
+static uint16_t uiHostTim3Cnt;
+static bool bHostTim3Cen;
+static uint32_t ulHostTim3Rate;
+static uint64_t ullHostTim3Acc;
+static HostCore_Time ullHostTim3Ref;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob der Zeitgeber zhlt
+ *
+ * @param[in] pTim      Zeitgeber
+ * @return    bool      true, wenn CEN gesetzt und der Takt an ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostTim_Running(const HostTim* pTim)
+{
+  return pTim->bCen && HostClk_IsOn(pTim->ucClk);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhlerstand aus der Laufzeit nachfhren, berlufe setzen UIF
+ *
+ * @param[in] pTim      Zeitgeber
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTim_Advance(HostTim* pTim)
+{
+  uint64_t ullNow = HOSTTIM_CYC(HostCore_RunTime());
+  uint64_t ullSteps;
+  uint32_t ulPeriod = (uint32_t)pTim->uiArr + 1u;
+  
+  if (!HostTim_Running(pTim))
+  {
+    pTim->ullRef = ullNow;
+    return;
+  }
+  ullSteps = (ullNow - pTim->ullRef) / pTim->ulDiv;
+  pTim->ullRef += ullSteps * pTim->ulDiv;
+  if (ullSteps == 0)
+  {
+    return;
+  }
+  if (pTim->bDown)
+  {
+    if (ullSteps > pTim->uiCnt)
+    {
+      pTim->bUif = true;
+      pTim->uiCnt = (uint16_t)(pTim->uiArr
+        - ((ullSteps - pTim->uiCnt - 1u) % ulPeriod));
+    }
+    else
+    {
+      pTim->uiCnt = (uint16_t)(pTim->uiCnt - ullSteps);
+    }
+  }
+  else
+  {
+    if (pTim->uiCnt + ullSteps > pTim->uiArr)
+    {
+      pTim->bUif = true;
+      pTim->uiCnt = (uint16_t)((pTim->uiCnt + ullSteps - pTim->uiArr - 1u)
+        % ulPeriod);
+    }
+    else
+    {
+      pTim->uiCnt = (uint16_t)(pTim->uiCnt + ullSteps);
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchsten berlauf planen, nur bei freigegebenem Interrupt
+ *
+ * @param[in] pTim      Zeitgeber
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTim_Plan(HostTim* pTim)
+{
+  uint64_t ullSteps;
+  
+  if (!HostTim_Running(pTim) || !pTim->bUie)
+  {
+    HostCore_Schedule(&pTim->sSrc, HOSTCORE_NEVER);
+    return;
+  }
+  ullSteps = pTim->bDown ? (uint64_t)pTim->uiCnt + 1u
+    : (uint64_t)pTim->uiArr - pTim->uiCnt + 1u;
+  HostCore_Schedule(&pTim->sSrc,
+    HOSTTIM_NS(pTim->ullRef + ullSteps * pTim->ulDiv));
+  HostCore_Raise();
+}
+
+/*!****************************************************************************
+ * @brief
+ * berlauf TIM1
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTim1_Fire(void)
+{
+  HostTim_Advance(&sHostTim1);
+  HostTim_Plan(&sHostTim1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * berlauf TIM2
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTim2_Fire(void)
+{
+  HostTim_Advance(&sHostTim2);
+  HostTim_Plan(&sHostTim2);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung TIM1 (Update)
+ *
+ * @return    bool      true, wenn der Interrupt ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostTim1_Pending(void)
+{
+  return sHostTim1.bUif && sHostTim1.bUie;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung TIM2 (Update)
+ *
+ * @return    bool      true, wenn der Interrupt ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostTim2_Pending(void)
+{
+  return sHostTim2.bUif && sHostTim2.bUie;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Impulse des Anemometers bis jetzt zhlen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTim3_Advance(void)
+{
+  HostCore_Time ullNow = HostCore_RunTime();
+  
+  if (bHostTim3Cen && HostClk_IsOn(CLK_Peripheral_TIM3))
+  {
+    ullHostTim3Acc += (ullNow - ullHostTim3Ref) * ulHostTim3Rate;
+    uiHostTim3Cnt = (uint16_t)(uiHostTim3Cnt + ullHostTim3Acc / HOSTTIM3_UNIT);
+    ullHostTim3Acc %= HOSTTIM3_UNIT;
+  }
+  ullHostTim3Ref = ullNow;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zeitgeber wie nach dem Reset
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostTim_Init(void)
+{
+  static const HostCore_Irq sIrq1 = {HOSTCORE_VEC_TIM1, HostTim1_Pending};
+  static const HostCore_Irq sIrq2 = {HOSTCORE_VEC_TIM2, HostTim2_Pending};
+  
+  sHostTim1.ucClk = CLK_Peripheral_TIM1;
+  sHostTim1.ulDiv = 1;
+  sHostTim1.uiArr = 0xFFFF;
+  sHostTim1.sSrc.pszName = "TIM1";
+  sHostTim1.sSrc.ullNext = HOSTCORE_NEVER;
+  sHostTim1.sSrc.pfnFire = HostTim1_Fire;
+  sHostTim1.sSrc.bSysClk = true;
+  HostCore_AddSource(&sHostTim1.sSrc);
+  HostCore_AddIrq(&sIrq1);
+  
+  sHostTim2.ucClk = CLK_Peripheral_TIM2;
+  sHostTim2.ulDiv = 1;
+  sHostTim2.uiArr = 0xFFFF;
+  sHostTim2.sSrc.pszName = "TIM2";
+  sHostTim2.sSrc.ullNext = HOSTCORE_NEVER;
+  sHostTim2.sSrc.pfnFire = HostTim2_Fire;
+  sHostTim2.sSrc.bSysClk = true;
+  HostCore_AddSource(&sHostTim2.sSrc);
+  HostCore_AddIrq(&sIrq2);
+  
+  uiHostTim3Cnt = 0;
+  bHostTim3Cen = false;
+  ullHostTim3Acc = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhlerstnde vor einer nderung der Peripherietakte nachfhren
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostTim_Sync(void)
+{
+  HostTim_Advance(&sHostTim1);
+  HostTim_Advance(&sHostTim2);
+  HostTim3_Advance();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Peripherietakt gendert: Zhler anhalten oder weiterlaufen lassen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostTim_ClockChanged(void)
+{
+  HostTim_Sync();
+  HostTim_Plan(&sHostTim1);
+  HostTim_Plan(&sHostTim2);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Impulsrate am Eingang von TIM3 setzen
+ *
+ * @param[in] ulMilliHz Impulse je 1000 s
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostTim3_SetRate(uint32_t ulMilliHz)
+{
+  HostTim3_Advance();
+  ulHostTim3Rate = ulMilliHz;
+}
+
+/* Ersatz fr stm8l15x_tim1.c                                                 */
+void TIM1_TimeBaseInit(uint16_t TIM1_Prescaler,
+                       TIM1_CounterMode_TypeDef TIM1_CounterMode,
+                       uint16_t TIM1_Period,
+                       uint8_t TIM1_RepetitionCounter)
+{
+  HostCore_Step();
+  if ((TIM1_CounterMode != TIM1_CounterMode_Up) || (TIM1_RepetitionCounter != 0))
+  {
+    HostCore_Fatal("TIM1: nur aufwrts ohne Wiederholung nachgebildet");
+  }
+  HostTim_Advance(&sHostTim1);
+  sHostTim1.ulDiv = (uint32_t)TIM1_Prescaler + 1u;
+  sHostTim1.uiArr = TIM1_Period;
+  sHostTim1.bDown = false;
+  HostTim_Plan(&sHostTim1);
+}
+
+void TIM1_Cmd(FunctionalState NewState)
+{
+  HostCore_Step();
+  HostTim_Advance(&sHostTim1);
+  sHostTim1.bCen = (NewState != DISABLE);
+  HostTim_Plan(&sHostTim1);
+}
+
+uint16_t TIM1_GetCounter(void)
+{
+  HostCore_Poll(0x04010000UL);
+  HostTim_Advance(&sHostTim1);
+  return sHostTim1.uiCnt;
+}
+
+void TIM1_ITConfig(TIM1_IT_TypeDef TIM1_IT, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (TIM1_IT == TIM1_IT_Update)
+  {
+    HostTim_Advance(&sHostTim1);
+    sHostTim1.bUie = (NewState != DISABLE);
+    HostTim_Plan(&sHostTim1);
+  }
+}
+
+void TIM1_ClearITPendingBit(TIM1_IT_TypeDef TIM1_IT)
+{
+  HostCore_Step();
+  if (TIM1_IT == TIM1_IT_Update)
+  {
+    HostTim_Advance(&sHostTim1);
+    sHostTim1.bUif = false;
+  }
+}
+
+/* Ersatz fr stm8l15x_tim2.c                                                 */
+void TIM2_InternalClockConfig(void)
+{
+  HostCore_Step();
+}
+
+void TIM2_TimeBaseInit(TIM2_Prescaler_TypeDef TIM2_Prescaler,
+                       TIM2_CounterMode_TypeDef TIM2_CounterMode, uint16_t TIM2_Period)
+{
+  HostCore_Step();
+  if ((TIM2_CounterMode != TIM2_CounterMode_Up)
+    && (TIM2_CounterMode != TIM2_CounterMode_Down))
+  {
+    HostCore_Fatal("TIM2: nur aufwrts oder abwrts nachgebildet");
+  }
+  HostTim_Advance(&sHostTim2);
+  sHostTim2.ulDiv = 1UL << TIM2_Prescaler;
+  sHostTim2.uiArr = TIM2_Period;
+  sHostTim2.bDown = (TIM2_CounterMode == TIM2_CounterMode_Down);
+  
+  /* UG: Zhler neu laden, setzt UIF                      */
+  sHostTim2.uiCnt = sHostTim2.bDown ? TIM2_Period : 0;
+  sHostTim2.bUif = true;
+  HostTim_Plan(&sHostTim2);
+}
+
+void TIM2_Cmd(FunctionalState NewState)
+{
+  HostCore_Step();
+  HostTim_Advance(&sHostTim2);
+  sHostTim2.bCen = (NewState != DISABLE);
+  HostTim_Plan(&sHostTim2);
+}
+
+uint16_t TIM2_GetCounter(void)
+{
+  HostCore_Poll(0x04020000UL);
+  HostTim_Advance(&sHostTim2);
+  return sHostTim2.uiCnt;
+}
+
+void TIM2_SetCounter(uint16_t Counter)
+{
+  HostCore_Step();
+  HostTim_Advance(&sHostTim2);
+  sHostTim2.uiCnt = Counter;
+  HostTim_Plan(&sHostTim2);
+}
+
+void TIM2_SetAutoreload(uint16_t Autoreload)
+{
+  HostCore_Step();
+  HostTim_Advance(&sHostTim2);
+  sHostTim2.uiArr = Autoreload;
+  HostTim_Plan(&sHostTim2);
+}
+
+void TIM2_ITConfig(TIM2_IT_TypeDef TIM2_IT, FunctionalState NewState)
+{
+  HostCore_Step();
+  if (TIM2_IT == TIM2_IT_Update)
+  {
+    HostTim_Advance(&sHostTim2);
+    sHostTim2.bUie = (NewState != DISABLE);
+    HostTim_Plan(&sHostTim2);
+  }
+}
+
+void TIM2_ClearFlag(TIM2_FLAG_TypeDef TIM2_FLAG)
+{
+  HostCore_Step();
+  if (TIM2_FLAG == TIM2_FLAG_Update)
+  {
+    HostTim_Advance(&sHostTim2);
+    sHostTim2.bUif = false;
+  }
+}
+
+/* Ersatz fr stm8l15x_tim3.c                                                 */
+void TIM3_TIxExternalClockConfig(TIM3_TIxExternalCLK1Source_TypeDef TIM3_TIxExternalCLKSource,
+                                 TIM3_ICPolarity_TypeDef TIM3_ICPolarity,
+                                 uint8_t ICFilter)
+{
+  (void)TIM3_TIxExternalCLKSource;
+  (void)TIM3_ICPolarity;
+  (void)ICFilter;
+  HostCore_Step();
+}
+
+void TIM3_CounterModeConfig(TIM3_CounterMode_TypeDef TIM3_CounterMode)
+{
+  HostCore_Step();
+  if (TIM3_CounterMode != TIM3_CounterMode_Up)
+  {
+    HostCore_Fatal("TIM3: nur aufwrts nachgebildet");
+  }
+}
+
+void TIM3_Cmd(FunctionalState NewState)
+{
+  HostCore_Step();
+  HostTim3_Advance();
+  bHostTim3Cen = (NewState != DISABLE);
+}
+
+void TIM3_SetCounter(uint16_t Counter)
+{
+  HostCore_Step();
+  HostTim3_Advance();
+  uiHostTim3Cnt = Counter;
+}
+
+uint16_t TIM3_GetCounter(void)
+{
+  HostCore_Poll(0x04030000UL);
+  HostTim3_Advance();
+  return uiHostTim3Cnt;
+}
@@ -0,0 +1,495 @@
+/*!****************************************************************************
+ * @file
+ * HostHal_Usart.c
+ *
+ * Ersatz fr die USART der Standardbibliothek. Sender mit Daten- und
+ * Schieberegister, ein Zeichen dauert 10 Bitzeiten; fertige Zeichen gehen
+ * an die Senke des Modells. Empfangene Zeichen liefert das Modell im
+ * Zeichentakt ber HostUsart_Receive(), ein ungelesenes Zeichen fhrt zu
+ * OR. Ohne Peripherietakt bleiben Registerzugriffe wie auf dem Zielsystem
+ * wirkungslos.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stddef.h>
+#include "HostHal_Internal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Bits je Zeichen (Start, 8 Daten, Stopp)                                   */
+#define HOSTUSART_BITS          10u
+
+/*! Bits in CR2 (Interruptfreigaben, TEN, REN)                                */
+#define HOSTUSART_CR2_TIEN      0x80
+#define HOSTUSART_CR2_TCIEN     0x40
+#define HOSTUSART_CR2_RIEN      0x20
+#define HOSTUSART_CR2_TEN       0x08
+#define HOSTUSART_CR2_REN       0x04
+
+/*! USARTD in CR1: Schnittstelle abgeschaltet                                 */
+#define HOSTUSART_CR1_USARTD    0x20
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! Zustand einer USART neben dem Registerabbild                              */
+typedef struct tag_HostUsart_State {
+  /*! Peripherietakt (CLK_Peripheral_TypeDef)             */
+  uint8_t ucClk;
+  
+  /*! Baudrate                                            */
+  uint32_t ulBaud;
+  
+  /*! Schieberegister belegt, Inhalt                      */
+  bool bShift;
+  uint8_t ucShift;
+  
+  /*! Zeichen im Empfangsregister                         */
+  uint8_t ucRx;
+  
+  /*! Senke fr gesendete Zeichen                         */
+  void (*pfnTx)(uint8_t ucByte);
+  
+  /*! Ende des Zeichens im Schieberegister                */
+  HostCore_Source sSrc;
+} HostUsart_State;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Registerabbilder                                                          */
+USART_TypeDef asHostUsart[HostUsart_NUM];
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Zustnde                                                                  */
+static HostUsart_State asHostUsartState[HostUsart_NUM];
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Index aus dem Registerzeiger bestimmen
+ *
+ * @param[in] pUsart    Registerabbild
+ * @return    HostUsart Index
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static HostUsart HostUsart_Index(const USART_TypeDef* pUsart)
+{
+  if ((pUsart < &asHostUsart[0]) || (pUsart >= &asHostUsart[HostUsart_NUM]))
+  {
+    HostCore_Fatal("USART: ungltige Schnittstelle");
+  }
+  return (HostUsart)(pUsart - &asHostUsart[0]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob der Peripherietakt eingeschaltet ist
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @return    bool      true, wenn Registerzugriffe wirken
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostUsart_Clocked(HostUsart eUsart)
+{
+  return HostClk_IsOn(asHostUsartState[eUsart].ucClk);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob Sender bzw. Empfnger arbeiten
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @param[in] ucEn      HOSTUSART_CR2_TEN oder HOSTUSART_CR2_REN
+ * @return    bool      true, wenn eingeschaltet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostUsart_Active(HostUsart eUsart, uint8_t ucEn)
+{
+  const USART_TypeDef* pUsart = &asHostUsart[eUsart];
+  
+  return HostUsart_Clocked(eUsart) && ((pUsart->CR1 & HOSTUSART_CR1_USARTD) == 0)
+    && ((pUsart->CR2 & ucEn) != 0) && (asHostUsartState[eUsart].ulBaud != 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datenregister ins freie Schieberegister bernehmen
+ *
+ * @param[in] eUsart    Schnittstelle
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostUsart_Load(HostUsart eUsart)
+{
+  USART_TypeDef* pUsart = &asHostUsart[eUsart];
+  HostUsart_State* pState = &asHostUsartState[eUsart];
+  
+  if (pState->bShift || (pUsart->SR & USART_FLAG_TXE)
+    || !HostUsart_Active(eUsart, HOSTUSART_CR2_TEN))
+  {
+    return;
+  }
+  pState->bShift = true;
+  pState->ucShift = pUsart->DR;
+  pUsart->SR |= USART_FLAG_TXE;
+  pUsart->SR &= (uint8_t)~USART_FLAG_TC;
+  HostCore_ScheduleIn(&pState->sSrc, HostUsart_ByteTime(eUsart));
+  HostCore_Raise();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeichen im Schieberegister gesendet
+ *
+ * @param[in] eUsart    Schnittstelle
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostUsart_Shifted(HostUsart eUsart)
+{
+  HostUsart_State* pState = &asHostUsartState[eUsart];
+  
+  pState->bShift = false;
+  if (pState->pfnTx != NULL)
+  {
+    pState->pfnTx(pState->ucShift);
+  }
+  if (asHostUsart[eUsart].SR & USART_FLAG_TXE)
+  {
+    asHostUsart[eUsart].SR |= USART_FLAG_TC;
+  }
+  HostUsart_Load(eUsart);
+}
+
+static void HostUsart1_Fire(void) { HostUsart_Shifted(HostUsart_1); }
+static void HostUsart2_Fire(void) { HostUsart_Shifted(HostUsart_2); }
+static void HostUsart3_Fire(void) { HostUsart_Shifted(HostUsart_3); }
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung des Senders
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @return    bool      true, wenn der Interrupt ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostUsart_TxPending(HostUsart eUsart)
+{
+  const USART_TypeDef* pUsart = &asHostUsart[eUsart];
+  
+  return ((pUsart->CR2 & HOSTUSART_CR2_TIEN) && (pUsart->SR & USART_FLAG_TXE))
+    || ((pUsart->CR2 & HOSTUSART_CR2_TCIEN) && (pUsart->SR & USART_FLAG_TC));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interruptanforderung des Empfngers
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @return    bool      true, wenn der Interrupt ansteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostUsart_RxPending(HostUsart eUsart)
+{
+  const USART_TypeDef* pUsart = &asHostUsart[eUsart];
+  
+  return (pUsart->CR2 & HOSTUSART_CR2_RIEN)
+    && (pUsart->SR & (USART_FLAG_RXNE | USART_FLAG_OR));
+}
+
+static bool HostUsart1_TxPending(void) { return HostUsart_TxPending(HostUsart_1); }
+static bool HostUsart1_RxPending(void) { return HostUsart_RxPending(HostUsart_1); }
+static bool HostUsart3_TxPending(void) { return HostUsart_TxPending(HostUsart_3); }
+static bool HostUsart3_RxPending(void) { return HostUsart_RxPending(HostUsart_3); }
+
+/*!****************************************************************************
+ * @brief
+ * Register wie nach dem Reset
+ *
+ * @param[in] eUsart    Schnittstelle
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostUsart_Reset(HostUsart eUsart)
+{
+  USART_TypeDef* pUsart = &asHostUsart[eUsart];
+  
+  pUsart->SR = USART_FLAG_TXE | USART_FLAG_TC;
+  pUsart->DR = 0;
+  pUsart->BRR1 = 0;
+  pUsart->BRR2 = 0;
+  pUsart->CR1 = 0;
+  pUsart->CR2 = 0;
+  pUsart->CR3 = 0;
+  pUsart->CR4 = 0;
+  pUsart->CR5 = 0;
+  asHostUsartState[eUsart].ulBaud = 0;
+  asHostUsartState[eUsart].bShift = false;
+  HostCore_Schedule(&asHostUsartState[eUsart].sSrc, HOSTCORE_NEVER);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Schnittstellen wie nach dem Reset, Senken bleiben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostUsart_Init(void)
+{
+  static const HostCore_Irq asIrq[] = {
+    {HOSTCORE_VEC_USART1_TX, HostUsart1_TxPending},
+    {HOSTCORE_VEC_USART1_RX, HostUsart1_RxPending},
+    {HOSTCORE_VEC_USART3_TX, HostUsart3_TxPending},
+    {HOSTCORE_VEC_USART3_RX, HostUsart3_RxPending}
+  };
+  static void (* const apfnFire[HostUsart_NUM])(void) =
+    {HostUsart1_Fire, HostUsart2_Fire, HostUsart3_Fire};
+  static const char* const apszName[HostUsart_NUM] =
+    {"USART1", "USART2", "USART3"};
+  static const uint8_t aucClk[HostUsart_NUM] =
+    {CLK_Peripheral_USART1, CLK_Peripheral_USART2, CLK_Peripheral_USART3};
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < HostUsart_NUM; ++ucIdx)
+  {
+    asHostUsartState[ucIdx].ucClk = aucClk[ucIdx];
+    asHostUsartState[ucIdx].sSrc.pszName = apszName[ucIdx];
+    asHostUsartState[ucIdx].sSrc.ullNext = HOSTCORE_NEVER;
+    asHostUsartState[ucIdx].sSrc.pfnFire = apfnFire[ucIdx];
+    asHostUsartState[ucIdx].sSrc.bSysClk = true;
+    HostCore_AddSource(&asHostUsartState[ucIdx].sSrc);
+    HostUsart_Reset((HostUsart)ucIdx);
+  }
+  for (ucIdx = 0; ucIdx < sizeof(asIrq) / sizeof(asIrq[0]); ++ucIdx)
+  {
+    HostCore_AddIrq(&asIrq[ucIdx]);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Senke fr gesendete Zeichen setzen
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @param[in] pfnTx     Aufruf je Zeichen am Ende des Stoppbits
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostUsart_SetSink(HostUsart eUsart, void (*pfnTx)(uint8_t ucByte))
+{
+  asHostUsartState[eUsart].pfnTx = pfnTx;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeichen empfangen (Ende des Stoppbits)
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @param[in] ucByte    Zeichen
+ * @return    bool      false, wenn der Empfnger aus ist oder OR auftrat
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostUsart_Receive(HostUsart eUsart, uint8_t ucByte)
+{
+  USART_TypeDef* pUsart = &asHostUsart[eUsart];
+  
+  if (!HostUsart_Active(eUsart, HOSTUSART_CR2_REN))
+  {
+    return false;
+  }
+  if (pUsart->SR & USART_FLAG_RXNE)
+  {
+    pUsart->SR |= USART_FLAG_OR;
+    HostCore_Raise();
+    return false;
+  }
+  asHostUsartState[eUsart].ucRx = ucByte;
+  pUsart->SR |= USART_FLAG_RXNE;
+  HostCore_Raise();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Dauer eines Zeichens bei der eingestellten Baudrate
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @return    HostCore_Time  Dauer in ns, 9600 Baud vor der Initialisierung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+HostCore_Time HostUsart_ByteTime(HostUsart eUsart)
+{
+  uint32_t ulBaud = asHostUsartState[eUsart].ulBaud;
+  
+  return HOSTCORE_S(HOSTUSART_BITS) / ((ulBaud != 0) ? ulBaud : 9600u);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob der Empfnger Zeichen annimmt
+ *
+ * @param[in] eUsart    Schnittstelle
+ * @return    bool      true, wenn eingeschaltet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostUsart_IsEnabled(HostUsart eUsart)
+{
+  return HostUsart_Active(eUsart, HOSTUSART_CR2_REN);
+}
+
+/* Ersatz fr stm8l15x_usart.c                                                */
+void USART_DeInit(USART_TypeDef* USARTx)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  
+  HostCore_Step();
+  if (HostUsart_Clocked(eUsart))
+  {
+    HostUsart_Reset(eUsart);
+  }
+}
+
+void USART_Init(USART_TypeDef* USARTx, uint32_t BaudRate, USART_WordLength_TypeDef
+                USART_WordLength, USART_StopBits_TypeDef USART_StopBits,
+                USART_Parity_TypeDef USART_Parity,  USART_Mode_TypeDef USART_Mode)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  
+  HostCore_Step();
+  if ((USART_WordLength != USART_WordLength_8b)
+    || (USART_StopBits != USART_StopBits_1) || (USART_Parity != USART_Parity_No))
+  {
+    HostCore_Fatal("USART: nur 8N1 nachgebildet");
+  }
+  if (!HostUsart_Clocked(eUsart))
+  {
+    return;
+  }
+  asHostUsartState[eUsart].ulBaud = BaudRate;
+  USARTx->CR2 &= (uint8_t)~(HOSTUSART_CR2_TEN | HOSTUSART_CR2_REN);
+  USARTx->CR2 |= (uint8_t)USART_Mode;
+  HostUsart_Load(eUsart);
+}
+
+void USART_Cmd(USART_TypeDef* USARTx, FunctionalState NewState)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  
+  HostCore_Step();
+  if (!HostUsart_Clocked(eUsart))
+  {
+    return;
+  }
+  if (NewState != DISABLE)
+  {
+    USARTx->CR1 &= (uint8_t)~HOSTUSART_CR1_USARTD;
+  }
+  else
+  {
+    USARTx->CR1 |= HOSTUSART_CR1_USARTD;
+  }
+  HostUsart_Load(eUsart);
+}
+
+void USART_ITConfig(USART_TypeDef* USARTx, USART_IT_TypeDef USART_IT,
+                    FunctionalState NewState)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  uint8_t ucPos = (uint8_t)(1u << ((uint8_t)USART_IT & 0x0F));
+  volatile uint8_t* pucReg;
+  
+  HostCore_Step();
+  if (!HostUsart_Clocked(eUsart))
+  {
+    return;
+  }
+  
+  /* Register wie in der Bibliothek aus dem Code          */
+  switch ((uint16_t)USART_IT >> 8)
+  {
+    case 0x01:
+      pucReg = &USARTx->CR1;
+      break;
+    case 0x05:
+      pucReg = &USARTx->CR5;
+      break;
+    default:
+      pucReg = &USARTx->CR2;
+  }
+  if (NewState != DISABLE)
+  {
+    *pucReg |= ucPos;
+  }
+  else
+  {
+    *pucReg &= (uint8_t)~ucPos;
+  }
+  HostCore_Raise();
+}
+
+void USART_SendData8(USART_TypeDef* USARTx, uint8_t Data)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  
+  HostCore_Step();
+  if (!HostUsart_Clocked(eUsart))
+  {
+    return;
+  }
+  USARTx->DR = Data;
+  USARTx->SR &= (uint8_t)~(USART_FLAG_TXE | USART_FLAG_TC);
+  HostUsart_Load(eUsart);
+  HostCore_Raise();
+}
+
+uint8_t USART_ReceiveData8(USART_TypeDef* USARTx)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  
+  HostCore_Step();
+  if (!HostUsart_Clocked(eUsart))
+  {
+    return 0;
+  }
+  USARTx->SR &= (uint8_t)~(USART_FLAG_RXNE | USART_FLAG_OR);
+  HostCore_Raise();
+  return asHostUsartState[eUsart].ucRx;
+}
+
+FlagStatus USART_GetFlagStatus(USART_TypeDef* USARTx, USART_FLAG_TypeDef USART_FLAG)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  
+  HostCore_Poll(0x05000000UL | ((uint32_t)eUsart << 16) | (uint16_t)USART_FLAG);
+  if (!HostUsart_Clocked(eUsart) || (USART_FLAG == USART_FLAG_SBK))
+  {
+    return RESET;
+  }
+  return (FlagStatus)((USARTx->SR & (uint8_t)USART_FLAG) != 0);
+}
+
+void USART_ClearFlag(USART_TypeDef* USARTx, USART_FLAG_TypeDef USART_FLAG)
+{
+  HostUsart eUsart = HostUsart_Index(USARTx);
+  
+  HostCore_Step();
+  if (!HostUsart_Clocked(eUsart))
+  {
+    return;
+  }
+  USARTx->SR &= (uint8_t)~((uint8_t)USART_FLAG & (USART_FLAG_TC | USART_FLAG_RXNE));
+  HostCore_Raise();
+}
@@ -0,0 +1,122 @@
+/*!****************************************************************************
+ * @file
+ * HostLibc.c
+ *
+ * printf() und sprintf() mit dem Verhalten der Cosmic-Bibliothek fr den
+ * Host-Build der Firmware, siehe HostLibc.h.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdarg.h>
+#include "HostCore.h"
+#include <string.h>
+#include "HostLibc.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Maximale Lnge eines Formats und einer Ausgabe von printf()               */
+#define HOSTLIBC_FMT_MAX        256
+#define HOSTLIBC_OUT_MAX        1024
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Format des Zielsystems in ein Format des Hosts bersetzen: l und L
+ * entfallen, das Argument wird damit wie auf dem Zielsystem als 32 Bit
+ * (bzw. double) gelesen.
+ *
+ * @param[in]  pszFmt   Format der Firmware
+ * @param[out] pszOut   Format fr die Host-Bibliothek
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostLibc_Format(const char* pszFmt, char* pszOut)
+{
+  char* pszEnd = pszOut + HOSTLIBC_FMT_MAX - 1;
+  bool bSpec = false;
+  
+  for (; *pszFmt != '\0'; ++pszFmt)
+  {
+    if (pszOut >= pszEnd)
+    {
+      HostCore_Fatal("printf: Format zu lang");
+    }
+    if (!bSpec)
+    {
+      bSpec = (*pszFmt == '%');
+    }
+    else if ((*pszFmt == 'l') || (*pszFmt == 'L'))
+    {
+      continue;
+    }
+    else if (strchr("-+ #0123456789.*h", *pszFmt) == NULL)
+    {
+      /* Umwandlungszeichen beendet die Angabe, auch %%   */
+      bSpec = false;
+    }
+    *pszOut++ = *pszFmt;
+  }
+  *pszOut = '\0';
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Ersatz fr printf(), Ausgabe zeichenweise ber putchar() der Firmware.
+ * Die Puffer liegen auf dem Stack, Interruptroutinen drfen ebenfalls
+ * ausgeben.
+ *
+ * @param[in] pszFmt    Format
+ * @return    int       Anzahl der ausgegebenen Zeichen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int HostLibc_Printf(const char* pszFmt, ...)
+{
+  char acFmt[HOSTLIBC_FMT_MAX];
+  char acOut[HOSTLIBC_OUT_MAX];
+  va_list ap;
+  int iLen;
+  int iIdx;
+  
+  HostLibc_Format(pszFmt, acFmt);
+  va_start(ap, pszFmt);
+  iLen = vsnprintf(acOut, sizeof(acOut), acFmt, ap);
+  va_end(ap);
+  if ((iLen < 0) || (iLen >= (int)sizeof(acOut)))
+  {
+    HostCore_Fatal("printf: Ausgabe zu lang");
+  }
+  for (iIdx = 0; iIdx < iLen; ++iIdx)
+  {
+    UART2_Putchar(acOut[iIdx]);
+  }
+  return iLen;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ersatz fr sprintf()
+ *
+ * @param[out] pszBuf   Zielpuffer
+ * @param[in]  pszFmt   Format
+ * @return     int      Anzahl der geschriebenen Zeichen ohne '\0'
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int HostLibc_Sprintf(char* pszBuf, const char* pszFmt, ...)
+{
+  char acFmt[HOSTLIBC_FMT_MAX];
+  va_list ap;
+  int iLen;
+  
+  HostLibc_Format(pszFmt, acFmt);
+  va_start(ap, pszFmt);
+  iLen = vsprintf(pszBuf, acFmt, ap);
+  va_end(ap);
+  return iLen;
+}
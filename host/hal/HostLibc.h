@@ -0,0 +1,37 @@
+/*!****************************************************************************
+ * @file
+ * HostLibc.h
+ *
+ * Wird im Host-Build jeder Quelldatei der Firmware vorangestellt (-include).
+ * Die Ausgabefunktionen verhalten sich wie die Bibliothek des Cosmic-
+ * Compilers: printf() schreibt ber putchar() der Firmware auf USART2, die
+ * Lngenangaben l und L lesen ein 32-Bit-Argument (long hat auf dem
+ * Zielsystem 32 Bit, long double entspricht double).
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOSTLIBC_H_
+#define HOSTLIBC_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Ein- und Ausgabe der Firmware (commlib_uart2.c) statt der Host-Bibliothek */
+#undef putchar
+#undef getchar
+#define putchar                 UART2_Putchar
+#define getchar                 UART2_Getchar
+#define printf                  HostLibc_Printf
+#define sprintf                 HostLibc_Sprintf
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+char UART2_Putchar(char c);
+char UART2_Getchar(void);
+int HostLibc_Printf(const char* pszFmt, ...);
+int HostLibc_Sprintf(char* pszBuf, const char* pszFmt, ...);
+
+#endif /* HOSTLIBC_H_ */
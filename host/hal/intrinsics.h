@@ -0,0 +1,36 @@
+/*!****************************************************************************
+ * @file
+ * intrinsics.h
+ *
+ * Ersatz fr die Compiler-Intrinsics im Host-Build. stm8l15x.h bindet die
+ * Datei im IAR-Zweig ein; Speicherklassen entfallen, Interruptsperre,
+ * WFI und HALT gehen an den Simulationskern.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOST_INTRINSICS_H_
+#define HOST_INTRINSICS_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostCore.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Speicherklassen und Interruptattribut ohne Bedeutung                      */
+#define __far
+#define __near
+#define __tiny
+#define __eeprom
+#define __interrupt
+
+/*! CPU-Befehle                                                               */
+#define __enable_interrupt()    HostCore_EnableIrq(true)
+#define __disable_interrupt()   HostCore_EnableIrq(false)
+#define __no_operation()        HostCore_Step()
+#define __trap()                HostCore_Fatal("TRAP")
+#define __wait_for_interrupt()  HostCore_Wait(false)
+#define __wait_for_event()      HostCore_Wait(false)
+#define __halt()                HostCore_Wait(true)
+
+#endif /* HOST_INTRINSICS_H_ */
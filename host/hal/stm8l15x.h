@@ -0,0 +1,66 @@
+/*!****************************************************************************
+ * @file
+ * stm8l15x.h
+ *
+ * Bauteilheader fr den Host-Build. Bindet den Originalheader im IAR-Zweig
+ * ein (Intrinsics aus host/hal/intrinsics.h) und legt die Peripheriezeiger,
+ * auf die die Firmware direkt zugreift, auf die Registerabbilder der
+ * Simulation. Die Funktionen der Standardbibliothek ersetzt host/hal.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOST_STM8L15X_H_
+#define HOST_STM8L15X_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#ifndef __ICCSTM8__
+#define __ICCSTM8__
+#endif
+#include "../../src/stm8lib/stm8l15x.h"
+#include "HostHal.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Peripheriezeiger auf die Registerabbilder der Simulation                  */
+#undef GPIOA
+#undef GPIOB
+#undef GPIOC
+#undef GPIOD
+#undef GPIOE
+#undef GPIOF
+#undef GPIOG
+#undef GPIOH
+#undef GPIOI
+#undef RTC
+#undef RST
+#undef I2C1
+#undef USART1
+#undef USART2
+#undef USART3
+#undef SPI1
+#undef SPI2
+#undef ADC1
+#define GPIOA                   (&asHostGpio[HostPort_A])
+#define GPIOB                   (&asHostGpio[HostPort_B])
+#define GPIOC                   (&asHostGpio[HostPort_C])
+#define GPIOD                   (&asHostGpio[HostPort_D])
+#define GPIOE                   (&asHostGpio[HostPort_E])
+#define GPIOF                   (&asHostGpio[HostPort_F])
+#define GPIOG                   (&asHostGpio[HostPort_G])
+#define GPIOH                   (&asHostGpio[HostPort_H])
+#define GPIOI                   (&asHostGpio[HostPort_I])
+#define RTC                     (&sHostRtc)
+#define RST                     (&sHostRst)
+#define I2C1                    (&sHostI2c)
+#define USART1                  (&asHostUsart[HostUsart_1])
+#define USART2                  (&asHostUsart[HostUsart_2])
+#define USART3                  (&asHostUsart[HostUsart_3])
+#define SPI1                    (&asHostSpi[HostSpi_1])
+#define SPI2                    (&asHostSpi[HostSpi_2])
+#define ADC1                    (&sHostAdc)
+
+/*! Daten-EEPROM liegt im Abbild der Simulation                               */
+#define NVSTORE_PTR(ulAddr)     HostFlash_Ptr(ulAddr)
+
+#endif /* HOST_STM8L15X_H_ */
@@ -0,0 +1,94 @@
+/*!****************************************************************************
+ * @file
+ * HostSim.c
+ *
+ * Gemeinsame Dienste der Umgebungsmodelle: Uhrzeit der Simulation,
+ * reproduzierbares Rauschen und Meldungen auf stderr.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdarg.h>
+#include "HostSim.h"
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Aktueller Zustand der Umgebung                                            */
+HostEnv_State sHostEnv;
+
+/*! Standort und Startbedingungen                                             */
+HostSim_Config sHostSimCfg;
+
+/*! Zustand der Modelle ber einen Reset hinweg                               */
+HostSim_Persist sHostSimState;
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Uhrzeit der Simulation in ganzen Sekunden
+ *
+ * @return    uint32_t  Sekunden seit dem 01.01.2000 (UTC)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint32_t HostSim_Seconds(void)
+{
+  return sHostSimCfg.ulStart + (uint32_t)(ullHostNow / HOSTCORE_S(1));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Uhrzeit der Simulation mit Bruchteil
+ *
+ * @return    double    Sekunden seit dem 01.01.2000 (UTC)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+double HostSim_Time(void)
+{
+  return (double)sHostSimCfg.ulStart + (double)ullHostNow * 1e-9;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gleichverteiltes Rauschen aus einem linearen Kongruenzgenerator, der
+ * Zustand liegt in sHostSimState und macht Lufe wiederholbar
+ *
+ * @param[in] iAmpl     Amplitude
+ * @return    int16_t   Wert in -iAmpl..iAmpl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int16_t HostSim_Noise(int16_t iAmpl)
+{
+  sHostSimState.ulSeed = sHostSimState.ulSeed * 1103515245UL + 12345UL;
+  return (int16_t)((int32_t)((sHostSimState.ulSeed >> 16) % (2u * iAmpl + 1u))
+    - iAmpl);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Meldung eines Modells mit Uhrzeit auf stderr, entfllt mit --quiet
+ *
+ * @param[in] pszFmt    Format wie printf()
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostSim_Log(const char* pszFmt, ...)
+{
+  uint32_t ulSec = HostSim_Seconds() % 86400UL;
+  va_list ap;
+  
+  if (sHostSimCfg.bQuiet)
+  {
+    return;
+  }
+  fprintf(stderr, "SIM %02lu:%02lu:%02lu ", (unsigned long)(ulSec / 3600u),
+    (unsigned long)((ulSec / 60u) % 60u), (unsigned long)(ulSec % 60u));
+  va_start(ap, pszFmt);
+  vfprintf(stderr, pszFmt, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+}
@@ -0,0 +1,228 @@
+/*!****************************************************************************
+ * @file
+ * HostSim.h
+ *
+ * Umgebungsmodelle der Host-Simulation: Sonne, Wetter, Solarpanel und
+ * Batterie, Antriebe mit Endlagenschaltern, GPS-Empfnger, Bluetooth-Modul,
+ * Sensoren am I2C-Bus und SD-Karte ber einem Abbild. Die Modelle hngen
+ * sich ber HostHal.h an Pins, Busse und Schnittstellen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOSTSIM_H_
+#define HOSTSIM_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "stm8l15x.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Sekunden von 01.01.1970 bis 01.01.2000                                    */
+#define HOSTSIM_EPOCH_2000      946684800UL
+
+/*! Gre des SD-Karten-Abbilds in Sektoren (64 MiB)                          */
+#define HOSTSD_SECTORS          131072UL
+
+/*! I2C-Adressen der Sensoren                                                 */
+#define HOSTSENS_ADDR_BME280    0x76
+#define HOSTSENS_ADDR_QMC5883   0x0D
+#define HOSTSENS_ADDR_MPU6050   0x68
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! Sensoren am I2C-Bus                                                       */
+typedef enum tag_HostSens_Id {
+  HostSens_Id_BME280,
+  HostSens_Id_QMC5883,
+  HostSens_Id_MPU6050,
+  HostSens_Id_NUM
+} HostSens_Id;
+
+/*!****************************************************************************
+ * @brief
+ * Eingespeiste Fehler eines Sensors, jeweils fr die nchsten bertragungen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_HostSens_Fault {
+  /*! Kein Fehler                                         */
+  HostSens_Fault_NONE,
+  
+  /*! Adressbyte nicht quittiert (beide Richtungen)       */
+  HostSens_Fault_NAK,
+  
+  /*! Adressbyte nur beim Lesen nicht quittiert           */
+  HostSens_Fault_NAK_READ,
+  
+  /*! Bus nach dem Adressbyte festgehalten                */
+  HostSens_Fault_STUCK,
+  
+  /*! Gelesene Bytes invertiert                           */
+  HostSens_Fault_CORRUPT
+} HostSens_Fault;
+
+/*!****************************************************************************
+ * @brief
+ * Zhler eines Sensors am I2C-Bus
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostSens_Stats {
+  /*! bertragungen (Adressbytes an den Sensor)           */
+  uint32_t ulTransfers;
+  
+  /*! Bytes einschlielich Adressbyte                     */
+  uint32_t ulBytes;
+  
+  /*! Geschriebene und gelesene Registerinhalte           */
+  uint32_t ulWrites;
+  uint32_t ulReads;
+  
+  /*! Nicht quittierte Adressbytes                        */
+  uint32_t ulNaks;
+} HostSens_Stats;
+
+/*!****************************************************************************
+ * @brief
+ * Vorgegebene Messgren der Sensoren statt Umgebungs- und Antriebsmodell,
+ * ohne Rauschen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostSens_Input {
+  /*! Lufttemperatur C, Luftdruck hPa, Feuchte %         */
+  double dTemp;
+  double dPress;
+  double dHum;
+  
+  /*! Kompassrichtung und Neigung in 0.1                 */
+  int16_t iHeading;
+  int16_t iTilt;
+} HostSens_Input;
+
+/*!****************************************************************************
+ * @brief
+ * Zustand der Umgebung, sekndlich vom Umgebungsmodell gebildet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostEnv_State {
+  /*! Sonnenhhe und -azimut in Grad                      */
+  double dSunElev;
+  double dSunAzim;
+  
+  /*! Lufttemperatur C, Luftdruck hPa, Feuchte %         */
+  double dTemp;
+  double dPress;
+  double dHum;
+  
+  /*! Windgeschwindigkeit in m/s, Herkunft in Grad        */
+  double dWindSpeed;
+  double dWindDir;
+  
+  /*! Ladezustand 0..1, Batterie in mV und mA (Laden > 0) */
+  double dSoC;
+  double dBatVolt;
+  double dBatCurr;
+  
+  /*! Panel in mV und mA                                  */
+  double dPvVolt;
+  double dPvCurr;
+} HostEnv_State;
+
+/*!****************************************************************************
+ * @brief
+ * Standort und Startbedingungen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostSim_Config {
+  /*! Startzeit in Sekunden seit dem 01.01.2000 (UTC)     */
+  uint32_t ulStart;
+  
+  /*! Breite und Lnge in Grad, Hhe in m                 */
+  double dLat;
+  double dLon;
+  double dAlt;
+  
+  /*! Ausrichtung des Turms bei Position 0 in 0.1        */
+  int16_t iHeading;
+  
+  /*! Ausgaben der Modelle unterdrcken                   */
+  bool bQuiet;
+} HostSim_Config;
+
+/*!****************************************************************************
+ * @brief
+ * Zustand der Modelle, der einen Reset der Firmware berdauert (Mechanik,
+ * Batterie, Lesestand der Eingabedateien)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostSim_Persist {
+  /*! Ladezustand 0..1                                    */
+  double dSoC;
+  
+  /*! Neigung des Panels und Drehung des Turms in 0.1    */
+  int16_t iTilt;
+  int16_t iTurn;
+  
+  /*! Lesestand der NMEA-Datei und des AT-Skripts         */
+  long lGpsPos;
+  long lBtPos;
+  
+  /*! Zustand des Rauschgenerators                        */
+  uint32_t ulSeed;
+} HostSim_Persist;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Aktueller Zustand der Umgebung                                            */
+extern HostEnv_State sHostEnv;
+
+/*! Standort und Startbedingungen                                             */
+extern HostSim_Config sHostSimCfg;
+
+/*! Zustand der Modelle ber einen Reset hinweg                               */
+extern HostSim_Persist sHostSimState;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+/* Zeit der Simulation                                                        */
+uint32_t HostSim_Seconds(void);
+double HostSim_Time(void);
+int16_t HostSim_Noise(int16_t iAmpl);
+void HostSim_Log(const char* pszFmt, ...);
+
+/* Umgebung, Panel, Batterie, Anemometer, Windfahne und ADC                   */
+void HostEnv_Init(void);
+
+/* Antriebe und Endlagenschalter                                              */
+void HostMotor_Init(void);
+int16_t HostMotor_GetTilt(void);
+int16_t HostMotor_GetHeading(void);
+bool HostMotor_IsMoving(void);
+
+/* GPS-Empfnger an USART3                                                    */
+void HostGps_Init(FILE* pNmea);
+
+/* Bluetooth-Modul an USART1                                                  */
+void HostBt_Init(FILE* pScript, FILE* pOut);
+
+/* Sensoren am I2C-Bus                                                        */
+void HostSens_Init(void);
+void HostSens_SetInput(const HostSens_Input* pInput);
+void HostSens_SetFault(HostSens_Id eId, HostSens_Fault eFault,
+  uint16_t uiCount);
+const HostSens_Stats* HostSens_GetStats(HostSens_Id eId);
+void HostSens_ClearStats(void);
+
+/* SD-Karte an SPI2                                                           */
+bool HostSd_Init(const char* pszImage);
+bool HostSd_Format(int iFd);
+
+#endif /* HOSTSIM_H_ */
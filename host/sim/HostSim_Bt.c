@@ -0,0 +1,331 @@
+/*!****************************************************************************
+ * @file
+ * HostSim_Bt.c
+ *
+ * Modell des Bluetooth-Moduls an USART1. Das AT-Skript besteht aus Zeilen
+ * "@<Sekunde> <Befehl>": ab der angegebenen Sekunde seit Simulationsstart
+ * meldet das Modul bei eingeschalteter Versorgung (PD3) eine Verbindung
+ * ber PD1 und sendet den Befehl mit '\r'. Zeilen ohne '@' folgen der
+ * vorherigen direkt, '#' leitet Kommentare ein. Antworten der Firmware
+ * gehen in die Ausgabedatei. Wie ein Terminal sendet das Modul den nchsten
+ * Befehl erst nach "OK" oder "ERROR" des vorherigen, hchstens nach
+ * HOSTBT_ANSWER. Ohne fllige Zeile trennt das Modul nach HOSTBT_IDLE die
+ * Verbindung.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Auf die Quittung warten
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdlib.h>
+#include <string.h>
+#include "HostHal.h"
+#include "HostSim.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Versorgung und Verbindungsstatus an Port D                                */
+#define HOSTBT_PWR_PIN          GPIO_Pin_3
+#define HOSTBT_STAT_PIN         GPIO_Pin_1
+
+/*! Zeit vom Verbindungsaufbau bis zum ersten Zeichen. BTHandler_Poll()
+ *  erkennt die Verbindung erst im Sekundentakt und verwirft dabei schon
+ *  empfangene Zeichen, ein Terminal wartet deshalb lnger als 1 s            */
+#define HOSTBT_CONNECT          HOSTCORE_MS(1500)
+
+/*! Mindestabstand zweier Befehle (Auswertung in der Firmware)                */
+#define HOSTBT_GAP              HOSTCORE_MS(300)
+
+/*! Wiederholung, solange der Empfnger der Firmware aus ist                  */
+#define HOSTBT_RETRY            HOSTCORE_MS(10)
+
+/*! Leerlauf bis zum Trennen der Verbindung                                   */
+#define HOSTBT_IDLE             HOSTCORE_S(5)
+
+/*! Hchste Wartezeit auf die Quittung eines Befehls                          */
+#define HOSTBT_ANSWER           HOSTCORE_S(30)
+
+/*! Lnge der lngsten Quittung "ERROR\r"                                     */
+#define HOSTBT_RESULT_MAX       6
+
+/*! Maximale Lnge einer Skriptzeile                                          */
+#define HOSTBT_LINE_MAX         128
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! AT-Skript und Ausgabedatei                                                */
+static FILE* pHostBtScript;
+static FILE* pHostBtOut;
+
+/*! Zustand des Moduls                                                        */
+static HostCore_Source sHostBtSrc;
+static bool bHostBtConnected;
+static HostCore_Time ullHostBtLast;
+
+/*! Nchster Befehl mit Flligkeit                                            */
+static char acHostBtLine[HOSTBT_LINE_MAX];
+static uint8_t ucHostBtLen;
+static uint8_t ucHostBtPos;
+static HostCore_Time ullHostBtDue;
+
+/*! Warten auf die Quittung des zuletzt gesendeten Befehls                    */
+static bool bHostBtWait;
+static HostCore_Time ullHostBtSent;
+
+/*! Anfang der laufenden Antwortzeile                                         */
+static char acHostBtResult[HOSTBT_RESULT_MAX];
+static uint8_t ucHostBtResultLen;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Nchsten Befehl aus dem Skript lesen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBt_Next(void)
+{
+  char acLine[HOSTBT_LINE_MAX];
+  char* pszText;
+  size_t ulLen;
+  
+  ucHostBtLen = 0;
+  ucHostBtPos = 0;
+  ullHostBtDue = HOSTCORE_NEVER;
+  if (pHostBtScript == NULL)
+  {
+    return;
+  }
+  fseek(pHostBtScript, sHostSimState.lBtPos, SEEK_SET);
+  while (fgets(acLine, sizeof(acLine), pHostBtScript) != NULL)
+  {
+    acLine[strcspn(acLine, "\r\n")] = '\0';
+    pszText = acLine;
+    ullHostBtDue = ullHostNow;
+    if (*pszText == '@')
+    {
+      ullHostBtDue = HOSTCORE_S(strtoul(pszText + 1, &pszText, 10));
+      pszText += strspn(pszText, " \t");
+    }
+    if ((*pszText == '\0') || (*pszText == '#'))
+    {
+      ullHostBtDue = HOSTCORE_NEVER;
+      continue;
+    }
+    ulLen = strlen(pszText);
+    memcpy(acHostBtLine, pszText, ulLen);
+    acHostBtLine[ulLen] = '\r';
+    ucHostBtLen = (uint8_t)(ulLen + 1);
+    break;
+  }
+  sHostSimState.lBtPos = ftell(pHostBtScript);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Verbindungsstatus setzen
+ *
+ * @param[in] bConnect  true: verbunden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBt_Connect(bool bConnect)
+{
+  if (bConnect != bHostBtConnected)
+  {
+    HostSim_Log("BT %s", bConnect ? "verbunden" : "getrennt");
+  }
+  bHostBtConnected = bConnect;
+  HostGpio_Drive(HostPort_D, HOSTBT_STAT_PIN, bConnect);
+  ullHostBtLast = ullHostNow;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ablauf des Moduls: verbinden, Zeichen senden, trennen
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Auf die Quittung warten
+ ******************************************************************************/
+static void HostBt_Fire(void)
+{
+  if (!HostGpio_IsHigh(HostPort_D, HOSTBT_PWR_PIN))
+  {
+    return;
+  }
+  if (!bHostBtConnected)
+  {
+    if (ullHostBtDue <= ullHostNow)
+    {
+      HostBt_Connect(true);
+      HostCore_ScheduleIn(&sHostBtSrc, HOSTBT_CONNECT);
+    }
+    else
+    {
+      HostCore_Schedule(&sHostBtSrc, ullHostBtDue);
+    }
+    return;
+  }
+  if ((ullHostBtDue <= ullHostNow) && (ucHostBtPos < ucHostBtLen))
+  {
+    if (bHostBtWait && (ullHostNow - ullHostBtSent < HOSTBT_ANSWER))
+    {
+      HostCore_Schedule(&sHostBtSrc, ullHostBtSent + HOSTBT_ANSWER);
+      return;
+    }
+    if (bHostBtWait)
+    {
+      HostSim_Log("BT keine Quittung");
+      bHostBtWait = false;
+    }
+    if (!HostUsart_IsEnabled(HostUsart_1))
+    {
+      HostCore_ScheduleIn(&sHostBtSrc, HOSTBT_RETRY);
+      return;
+    }
+    if (ucHostBtPos == 0)
+    {
+      HostSim_Log("BT > %.*s", (int)(ucHostBtLen - 1), acHostBtLine);
+    }
+    HostUsart_Receive(HostUsart_1, (uint8_t)acHostBtLine[ucHostBtPos++]);
+    ullHostBtLast = ullHostNow;
+    if (ucHostBtPos < ucHostBtLen)
+    {
+      HostCore_ScheduleIn(&sHostBtSrc, HostUsart_ByteTime(HostUsart_1));
+    }
+    else
+    {
+      bHostBtWait = true;
+      ullHostBtSent = ullHostNow;
+      HostBt_Next();
+      if (ullHostBtDue < ullHostNow + HOSTBT_GAP)
+      {
+        ullHostBtDue = ullHostNow + HOSTBT_GAP;
+      }
+      HostCore_Schedule(&sHostBtSrc, ullHostBtDue);
+    }
+    return;
+  }
+  
+  /* Verbindung halten, solange Befehle bald fllig sind  */
+  if (bHostBtWait && (ullHostNow - ullHostBtSent < HOSTBT_ANSWER))
+  {
+    HostCore_Schedule(&sHostBtSrc, ullHostBtSent + HOSTBT_ANSWER);
+  }
+  else if (ullHostNow - ullHostBtLast >= HOSTBT_IDLE)
+  {
+    HostBt_Connect(false);
+    HostCore_Schedule(&sHostBtSrc, ullHostBtDue);
+  }
+  else if (ullHostBtDue < ullHostBtLast + HOSTBT_IDLE)
+  {
+    HostCore_Schedule(&sHostBtSrc, ullHostBtDue);
+  }
+  else
+  {
+    HostCore_Schedule(&sHostBtSrc, ullHostBtLast + HOSTBT_IDLE);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Versorgung an Port D gendert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBt_Power(void)
+{
+  if (HostGpio_IsHigh(HostPort_D, HOSTBT_PWR_PIN))
+  {
+    if (sHostBtSrc.ullNext == HOSTCORE_NEVER)
+    {
+      HostCore_Schedule(&sHostBtSrc, ullHostNow);
+    }
+  }
+  else if (bHostBtConnected)
+  {
+    HostBt_Connect(false);
+    HostCore_Schedule(&sHostBtSrc, HOSTCORE_NEVER);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeichen der Firmware an das Modul. Nach der Quittung ("OK", "ERROR")
+ * wird der nchste Befehl fllig.
+ *
+ * @param[in] ucByte    Zeichen
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Quittung erkennen
+ ******************************************************************************/
+static void HostBt_Tx(uint8_t ucByte)
+{
+  ullHostBtLast = ullHostNow;
+  if (pHostBtOut != NULL)
+  {
+    fputc(ucByte, pHostBtOut);
+    if (ucByte == '\n')
+    {
+      fflush(pHostBtOut);
+    }
+  }
+  
+  if (ucByte != '\n')
+  {
+    if (ucHostBtResultLen < HOSTBT_RESULT_MAX)
+    {
+      acHostBtResult[ucHostBtResultLen] = (char)ucByte;
+    }
+    if (ucHostBtResultLen < 0xFF)
+    {
+      ++ucHostBtResultLen;
+    }
+    return;
+  }
+  
+  if (bHostBtWait
+    && (((ucHostBtResultLen == 3) && (memcmp(acHostBtResult, "OK\r", 3) == 0))
+      || ((ucHostBtResultLen == 6)
+        && (memcmp(acHostBtResult, "ERROR\r", 6) == 0))))
+  {
+    bHostBtWait = false;
+    if (ullHostBtDue < ullHostNow + HOSTBT_GAP)
+    {
+      ullHostBtDue = ullHostNow + HOSTBT_GAP;
+    }
+    HostCore_Schedule(&sHostBtSrc, ullHostNow);
+  }
+  ucHostBtResultLen = 0;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Bluetooth-Modul anmelden
+ *
+ * @param[in] pScript   AT-Skript oder NULL
+ * @param[in] pOut      Ausgabedatei fr Antworten oder NULL
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostBt_Init(FILE* pScript, FILE* pOut)
+{
+  pHostBtScript = pScript;
+  pHostBtOut = pOut;
+  bHostBtConnected = false;
+  bHostBtWait = false;
+  ucHostBtResultLen = 0;
+  sHostBtSrc.pszName = "BT";
+  sHostBtSrc.ullNext = HOSTCORE_NEVER;
+  sHostBtSrc.pfnFire = HostBt_Fire;
+  sHostBtSrc.bSysClk = false;
+  HostCore_AddSource(&sHostBtSrc);
+  HostUsart_SetSink(HostUsart_1, HostBt_Tx);
+  HostGpio_Watch(HostPort_D, HostBt_Power);
+  HostGpio_Drive(HostPort_D, HOSTBT_STAT_PIN, false);
+  HostBt_Next();
+  HostBt_Power();
+}
@@ -0,0 +1,336 @@
+/*!****************************************************************************
+ * @file
+ * HostSim_Env.c
+ *
+ * Umgebungsmodell: Sonnenstand nach den NOAA-Formeln, Wetter als Summe
+ * langsamer Schwingungen, Einstrahlung auf das nachgefhrte Panel,
+ * Laderegler und Batterie. Das Modell wird sekndlich in Echtzeit
+ * gebildet und liefert die Rohwerte fr ADC und Anemometer.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <math.h>
+#include "HostHal.h"
+#include "HostSim.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Schrittweite des Modells                                                  */
+#define HOSTENV_PERIOD          HOSTCORE_S(1)
+
+/*! Kapazitt der Batterie in mAh (wie die Vorgabe in EnergyCounter)          */
+#define HOSTENV_CAPACITY        7000.0
+
+/*! Kurzschlussstrom des Panels bei 1000 W/m in mA                           */
+#define HOSTENV_PV_ISC          1200.0
+
+/*! Ruhestrom der Station und Zusatzlast von GPS, Bluetooth und Antrieb in mA */
+#define HOSTENV_LOAD_BASE       20.0
+#define HOSTENV_LOAD_GPS        25.0
+#define HOSTENV_LOAD_BT         15.0
+#define HOSTENV_LOAD_MOTOR      350.0
+
+/*! Anemometer: Windgeschwindigkeit je Hz Impulsrate in m/s                   */
+#define HOSTENV_ANEM_MPS_HZ     0.24
+
+/*! Kennlinien der Analogeingnge wie in main.c (mV bzw. mA je 1024 LSB)      */
+#define HOSTENV_UBAT_SLOPE      3724.0
+#define HOSTENV_IBAT_SLOPE      (-4459.0)
+#define HOSTENV_UPV_SLOPE       3767.0
+#define HOSTENV_IPV_SLOPE       4459.0
+#define HOSTENV_ZERO_OFFS       2032.0
+
+/*! ADC-Kanle der Station                                                    */
+#define HOSTENV_CH_IPV          0
+#define HOSTENV_CH_UBAT         1
+#define HOSTENV_CH_UPV          2
+#define HOSTENV_CH_IBAT         3
+#define HOSTENV_CH_VANE         16
+
+/*! Rauschen der ADC-Rohwerte in LSB                                          */
+#define HOSTENV_ADC_NOISE       2
+
+#define HOSTENV_PI              3.14159265358979323846
+#define HOSTENV_RAD(x)          ((x) * HOSTENV_PI / 180.0)
+#define HOSTENV_DEG(x)          ((x) * 180.0 / HOSTENV_PI)
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Mitte der Spannungsbereiche der Windfahne in der Reihenfolge von
+ *  Wind_Direction (N, NNE, ... NNW)                                          */
+static const uint16_t auiHostEnvVane[16] = {
+  2990, 1587, 1793,  340,  380,  265,  748,  516,
+  1140,  977, 2410, 2300, 3569, 3137, 3360, 2680
+};
+
+/*! Sekndliche Neuberechnung                                                 */
+static HostCore_Source sHostEnvSrc;
+static HostCore_Time ullHostEnvAt;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Sonnenhhe und -azimut nach dem NOAA Solar Calculator
+ *
+ * @param[in] dTime     Sekunden seit dem 01.01.2000 (UTC)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostEnv_Sun(double dTime)
+{
+  double dJc = (dTime / 86400.0 - 0.5) / 36525.0;
+  double dL0 = fmod(280.46646 + dJc * (36000.76983 + dJc * 0.0003032), 360.0);
+  double dM = 357.52911 + dJc * (35999.05029 - 0.0001537 * dJc);
+  double dE = 0.016708634 - dJc * (0.000042037 + 0.0000001267 * dJc);
+  double dC = sin(HOSTENV_RAD(dM)) * (1.914602 - dJc * (0.004817
+    + 0.000014 * dJc)) + sin(HOSTENV_RAD(2 * dM)) * (0.019993
+    - 0.000101 * dJc) + sin(HOSTENV_RAD(3 * dM)) * 0.000289;
+  double dOmega = 125.04 - 1934.136 * dJc;
+  double dLambda = dL0 + dC - 0.00569 - 0.00478 * sin(HOSTENV_RAD(dOmega));
+  double dEps = 23.0 + (26.0 + (21.448 - dJc * (46.815 + dJc * (0.00059
+    - dJc * 0.001813))) / 60.0) / 60.0 + 0.00256 * cos(HOSTENV_RAD(dOmega));
+  double dDecl = asin(sin(HOSTENV_RAD(dEps)) * sin(HOSTENV_RAD(dLambda)));
+  double dY = tan(HOSTENV_RAD(dEps) / 2) * tan(HOSTENV_RAD(dEps) / 2);
+  double dEqTime = 4 * HOSTENV_DEG(dY * sin(2 * HOSTENV_RAD(dL0))
+    - 2 * dE * sin(HOSTENV_RAD(dM)) + 4 * dE * dY * sin(HOSTENV_RAD(dM))
+    * cos(2 * HOSTENV_RAD(dL0)) - 0.5 * dY * dY * sin(4 * HOSTENV_RAD(dL0))
+    - 1.25 * dE * dE * sin(2 * HOSTENV_RAD(dM)));
+  double dMinutes = fmod(dTime, 86400.0) / 60.0;
+  double dHa = fmod(dMinutes + dEqTime + 4 * sHostSimCfg.dLon, 1440.0) / 4
+    - 180.0;
+  double dLat = HOSTENV_RAD(sHostSimCfg.dLat);
+  double dZenith = acos(sin(dLat) * sin(dDecl) + cos(dLat) * cos(dDecl)
+    * cos(HOSTENV_RAD(dHa)));
+  double dAzim;
+  
+  dAzim = HOSTENV_DEG(acos((sin(dLat) * cos(dZenith) - sin(dDecl))
+    / (cos(dLat) * sin(dZenith))));
+  if (dHa > 0)
+  {
+    dAzim = fmod(dAzim + 180.0, 360.0);
+  }
+  else
+  {
+    dAzim = fmod(540.0 - dAzim, 360.0);
+  }
+  sHostEnv.dSunElev = 90.0 - HOSTENV_DEG(dZenith);
+  sHostEnv.dSunAzim = dAzim;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wetter als Summe von Tages-, Jahres- und unregelmigen Schwingungen
+ *
+ * @param[in] dTime     Sekunden seit dem 01.01.2000 (UTC)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostEnv_Weather(double dTime)
+{
+  double dDay = dTime / 86400.0;
+  double dLocal = fmod(dDay + sHostSimCfg.dLon / 360.0, 1.0);
+  
+  /* Tagesgang mit Maximum gegen 15 Uhr Ortszeit, Jahresgang mit Maximum
+     Ende Juli                                                            */
+  sHostEnv.dTemp = 10.0 + 9.0 * sin(2 * HOSTENV_PI * (dDay - 120.0) / 365.25)
+    + 5.0 * sin(2 * HOSTENV_PI * (dLocal - 0.375))
+    + 1.5 * sin(2 * HOSTENV_PI * dDay / 3.1);
+  sHostEnv.dPress = 1013.0 - sHostSimCfg.dAlt / 8.3
+    + 8.0 * sin(2 * HOSTENV_PI * dDay / 3.7)
+    + 3.0 * sin(2 * HOSTENV_PI * dDay / 1.3);
+  sHostEnv.dHum = 65.0 - 2.5 * (sHostEnv.dTemp - 10.0)
+    + 10.0 * sin(2 * HOSTENV_PI * dDay / 2.9);
+  if (sHostEnv.dHum < 15.0)
+  {
+    sHostEnv.dHum = 15.0;
+  }
+  if (sHostEnv.dHum > 100.0)
+  {
+    sHostEnv.dHum = 100.0;
+  }
+  sHostEnv.dWindSpeed = 3.0 + 2.0 * sin(2 * HOSTENV_PI * dDay / 0.21)
+    + 1.5 * sin(2 * HOSTENV_PI * dDay / 0.026);
+  if (sHostEnv.dWindSpeed < 0.0)
+  {
+    sHostEnv.dWindSpeed = 0.0;
+  }
+  sHostEnv.dWindDir = fmod(240.0 + 60.0 * sin(2 * HOSTENV_PI * dDay / 0.37)
+    + 360.0, 360.0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Einstrahlung auf das Panel, Laderegler und Batterie fr eine Sekunde
+ *
+ * @param[in] dDay      Tage seit dem 01.01.2000
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostEnv_Power(double dDay)
+{
+  double dElev = HOSTENV_RAD(sHostEnv.dSunElev);
+  double dTilt = HOSTENV_RAD(HostMotor_GetTilt() / 10.0);
+  double dFace = HOSTENV_RAD(HostMotor_GetHeading() / 10.0);
+  double dInc;
+  double dIrr = 0.0;
+  double dLoad = HOSTENV_LOAD_BASE;
+  double dPv;
+  
+  /* Panel 0 = waagrecht, Normale zum Turm geneigt        */
+  dInc = sin(dElev) * cos(dTilt) + cos(dElev) * sin(dTilt)
+    * cos(HOSTENV_RAD(sHostEnv.dSunAzim) - dFace);
+  if ((sHostEnv.dSunElev > 0.0) && (dInc > 0.0))
+  {
+    dIrr = 1000.0 * dInc * pow(sin(dElev), 0.3)
+      * (0.65 + 0.35 * sin(2 * HOSTENV_PI * dDay / 1.7));
+  }
+  if (HostGpio_IsHigh(HostPort_D, GPIO_Pin_2))
+  {
+    dLoad += HOSTENV_LOAD_GPS;
+  }
+  if (HostGpio_IsHigh(HostPort_D, GPIO_Pin_3))
+  {
+    dLoad += HOSTENV_LOAD_BT;
+  }
+  if (HostMotor_IsMoving())
+  {
+    dLoad += HOSTENV_LOAD_MOTOR;
+  }
+  
+  /* Laderegler: volle Batterie nimmt nur die Last ab     */
+  dPv = HOSTENV_PV_ISC * dIrr / 1000.0;
+  if ((sHostSimState.dSoC >= 1.0) && (dPv > dLoad))
+  {
+    dPv = dLoad;
+  }
+  sHostEnv.dBatCurr = dPv - dLoad;
+  sHostSimState.dSoC += sHostEnv.dBatCurr / 3600.0 / HOSTENV_CAPACITY;
+  if (sHostSimState.dSoC > 1.0)
+  {
+    sHostSimState.dSoC = 1.0;
+  }
+  if (sHostSimState.dSoC < 0.0)
+  {
+    sHostSimState.dSoC = 0.0;
+  }
+  sHostEnv.dSoC = sHostSimState.dSoC;
+  sHostEnv.dBatVolt = 11800.0 + 1200.0 * sHostEnv.dSoC
+    + 0.3 * sHostEnv.dBatCurr;
+  sHostEnv.dPvCurr = dPv;
+  if (dPv > 0.0)
+  {
+    sHostEnv.dPvVolt = sHostEnv.dBatVolt + 400.0;
+  }
+  else
+  {
+    sHostEnv.dPvVolt = (dIrr > 0.0) ? 14500.0 + 0.5 * dIrr : 0.0;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sekndliche Neuberechnung der Umgebung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostEnv_Fire(void)
+{
+  double dTime = HostSim_Time();
+  
+  HostEnv_Sun(dTime);
+  HostEnv_Weather(dTime);
+  HostEnv_Power(dTime / 86400.0);
+  HostTim3_SetRate((uint32_t)(sHostEnv.dWindSpeed / HOSTENV_ANEM_MPS_HZ
+    * 1000.0));
+  ullHostEnvAt += HOSTENV_PERIOD;
+  HostCore_Schedule(&sHostEnvSrc, ullHostEnvAt);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Rohwert aus einer Gre und der Kennlinie der Firmware
+ *
+ * @param[in] dValue    Spannung in mV bzw. Strom in mA
+ * @param[in] dSlope    Kennlinie (Wert je 1024 LSB)
+ * @param[in] dZero     Nullpunkt in LSB
+ * @return    uint16_t  Rohwert 0..4095 mit Rauschen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t HostEnv_Raw(double dValue, double dSlope, double dZero)
+{
+  double dRaw = dZero + dValue * 1024.0 / dSlope
+    + HostSim_Noise(HOSTENV_ADC_NOISE);
+  
+  if (dRaw < 0.0)
+  {
+    return 0;
+  }
+  if (dRaw > 4095.0)
+  {
+    return 4095;
+  }
+  return (uint16_t)(dRaw + 0.5);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messwertquelle des ADC
+ *
+ * @param[in] ucChannel Kanal (HOSTHAL_ADC_... fr Vrefint und TS)
+ * @return    uint16_t  Rohwert 0..4095
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t HostEnv_Adc(uint8_t ucChannel)
+{
+  int16_t iDir;
+  
+  switch (ucChannel)
+  {
+    case HOSTENV_CH_IPV:
+      return HostEnv_Raw(sHostEnv.dPvCurr, HOSTENV_IPV_SLOPE,
+        HOSTENV_ZERO_OFFS);
+    case HOSTENV_CH_UBAT:
+      return HostEnv_Raw(sHostEnv.dBatVolt, HOSTENV_UBAT_SLOPE, 0.0);
+    case HOSTENV_CH_UPV:
+      return HostEnv_Raw(sHostEnv.dPvVolt, HOSTENV_UPV_SLOPE, 0.0);
+    case HOSTENV_CH_IBAT:
+      return HostEnv_Raw(sHostEnv.dBatCurr, HOSTENV_IBAT_SLOPE,
+        HOSTENV_ZERO_OFFS);
+    case HOSTENV_CH_VANE:
+      /* main.c: Ausrichtung + 270 - Sektor * 22.5      */
+      iDir = (int16_t)floor((HostMotor_GetHeading() / 10.0 + 270.0
+        - sHostEnv.dWindDir) / 22.5 + 0.5);
+      iDir = (int16_t)(((iDir % 16) + 16) % 16);
+      return (uint16_t)(auiHostEnvVane[iDir] + HostSim_Noise(HOSTENV_ADC_NOISE));
+    case HOSTHAL_ADC_TEMPSENSOR:
+      /* Gehuse 5 K ber der Luft, 2.13 LSB/K ab 0 K     */
+      return (uint16_t)((sHostEnv.dTemp + 5.0 + 273.0) * 32.0 / 15.0);
+    default:
+      return 0;
+  }
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Umgebungsmodell anmelden und fr die Startzeit bilden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostEnv_Init(void)
+{
+  sHostEnvSrc.pszName = "ENV";
+  sHostEnvSrc.ullNext = HOSTCORE_NEVER;
+  sHostEnvSrc.pfnFire = HostEnv_Fire;
+  sHostEnvSrc.bSysClk = false;
+  HostCore_AddSource(&sHostEnvSrc);
+  HostAdc_SetSource(HostEnv_Adc);
+  ullHostEnvAt = ullHostNow;
+  HostEnv_Fire();
+}
@@ -0,0 +1,253 @@
+/*!****************************************************************************
+ * @file
+ * HostSim_Gps.c
+ *
+ * Modell des GPS-Empfngers an USART3. Solange PD2 den Empfnger versorgt,
+ * sendet er sekndlich RMC und GGA zum Standort aus HostSim_Config, nach
+ * dem Einschalten zunchst nur TXT bis zum ersten Fix. Mit einer
+ * NMEA-Datei werden stattdessen deren Zeilen abgespielt; ein Block endet
+ * nach jeder GGA-Zeile.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+#include "HostHal.h"
+#include "HostSim.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Versorgung an Port D                                                      */
+#define HOSTGPS_PWR_PIN         GPIO_Pin_2
+
+/*! Zeit bis zum ersten Fix nach dem Einschalten                              */
+#define HOSTGPS_TTFF            HOSTCORE_S(5)
+
+/*! Gre des Sendepuffers                                                    */
+#define HOSTGPS_BUF_MAX         256
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Abzuspielende NMEA-Datei oder NULL                                        */
+static FILE* pHostGpsNmea;
+
+/*! Sekundentakt und Byteabstand                                              */
+static HostCore_Source sHostGpsSrc;
+
+/*! Einschaltzeitpunkt, HOSTCORE_NEVER bei ausgeschaltetem Empfnger          */
+static HostCore_Time ullHostGpsOn;
+
+/*! Nchste Sekundengrenze                                                    */
+static HostCore_Time ullHostGpsSecond;
+
+/*! Zu sendende Zeichen                                                       */
+static char acHostGpsBuf[HOSTGPS_BUF_MAX];
+static uint16_t uiHostGpsLen;
+static uint16_t uiHostGpsPos;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Satz mit Prfsumme und Zeilenende an den Sendepuffer anhngen
+ *
+ * @param[in] pszBody   Satz ohne '$' und Prfsumme
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostGps_Append(const char* pszBody)
+{
+  uint8_t ucSum = 0;
+  const char* pszChar;
+  
+  for (pszChar = pszBody; *pszChar != '\0'; ++pszChar)
+  {
+    ucSum ^= (uint8_t)*pszChar;
+  }
+  uiHostGpsLen += (uint16_t)snprintf(&acHostGpsBuf[uiHostGpsLen],
+    sizeof(acHostGpsBuf) - uiHostGpsLen, "$%s*%02X\r\n", pszBody, ucSum);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Koordinate im NMEA-Format (Grad und Minuten) mit Halbkugel
+ *
+ * @param[out] pszOut   Ziel, z.B. "4807.0380,N"
+ * @param[in]  dDeg     Koordinate in Grad
+ * @param[in]  iDigits  Stellen der Gradzahl (2 bzw. 3)
+ * @param[in]  pszHemi  Kennbuchstaben fr positiv und negativ
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostGps_Coord(char* pszOut, double dDeg, int iDigits,
+  const char* pszHemi)
+{
+  /* Auf 1/10000 Minute gerundet                          */
+  long lMin = lround(fabs(dDeg) * 600000.0);
+  int iDeg = (int)(lMin / 600000L);
+  
+  lMin %= 600000L;
+  sprintf(pszOut, "%0*d%02ld.%04ld,%c", iDigits, iDeg, lMin / 10000L,
+    lMin % 10000L, pszHemi[(dDeg < 0.0) ? 1 : 0]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * RMC und GGA zum Standort bilden (bzw. TXT vor dem ersten Fix)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostGps_Synth(void)
+{
+  uint32_t ulSec = HostSim_Seconds();
+  uint32_t ulDay = ulSec % 86400UL;
+  uint8_t ucYear;
+  uint8_t ucMonth;
+  uint8_t ucDay;
+  char acLat[16];
+  char acLon[16];
+  char acTime[12];
+  char acBody[HOSTGPS_BUF_MAX / 2];
+  
+  if (ullHostNow - ullHostGpsOn < HOSTGPS_TTFF)
+  {
+    HostGps_Append("GPTXT,01,01,02,ANTSTATUS=OK");
+    return;
+  }
+  HostRtc_Date(ulSec / 86400UL, &ucYear, &ucMonth, &ucDay);
+  HostGps_Coord(acLat, sHostSimCfg.dLat, 2, "NS");
+  HostGps_Coord(acLon, sHostSimCfg.dLon, 3, "EW");
+  sprintf(acTime, "%02u%02u%02u.00", (unsigned)(ulDay / 3600u),
+    (unsigned)((ulDay / 60u) % 60u), (unsigned)(ulDay % 60u));
+  sprintf(acBody, "GPRMC,%s,A,%s,%s,0.0,0.0,%02u%02u%02u,,,A", acTime, acLat,
+    acLon, ucDay, ucMonth, ucYear);
+  HostGps_Append(acBody);
+  sprintf(acBody, "GPGGA,%s,%s,%s,1,08,0.9,%.1f,M,47.0,M,,", acTime, acLat,
+    acLon, sHostSimCfg.dAlt);
+  HostGps_Append(acBody);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchsten Block aus der NMEA-Datei lesen, am Dateiende von vorn
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostGps_Replay(void)
+{
+  char acLine[HOSTGPS_BUF_MAX / 2];
+  size_t ulLen;
+  
+  fseek(pHostGpsNmea, sHostSimState.lGpsPos, SEEK_SET);
+  while (uiHostGpsLen < HOSTGPS_BUF_MAX / 2)
+  {
+    if (fgets(acLine, sizeof(acLine), pHostGpsNmea) == NULL)
+    {
+      rewind(pHostGpsNmea);
+      break;
+    }
+    ulLen = strcspn(acLine, "\r\n");
+    if (ulLen == 0)
+    {
+      continue;
+    }
+    memcpy(&acHostGpsBuf[uiHostGpsLen], acLine, ulLen);
+    uiHostGpsLen += (uint16_t)ulLen;
+    acHostGpsBuf[uiHostGpsLen++] = '\r';
+    acHostGpsBuf[uiHostGpsLen++] = '\n';
+    if (strncmp(&acLine[3], "GGA", 3) == 0)
+    {
+      break;
+    }
+  }
+  sHostSimState.lGpsPos = ftell(pHostGpsNmea);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchstes Zeichen senden oder zur Sekundengrenze einen neuen Block bilden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostGps_Fire(void)
+{
+  if (ullHostGpsOn == HOSTCORE_NEVER)
+  {
+    return;
+  }
+  if (uiHostGpsPos < uiHostGpsLen)
+  {
+    HostUsart_Receive(HostUsart_3, (uint8_t)acHostGpsBuf[uiHostGpsPos++]);
+    HostCore_ScheduleIn(&sHostGpsSrc, HostUsart_ByteTime(HostUsart_3));
+    return;
+  }
+  if (ullHostNow >= ullHostGpsSecond)
+  {
+    uiHostGpsLen = 0;
+    uiHostGpsPos = 0;
+    if (pHostGpsNmea != NULL)
+    {
+      HostGps_Replay();
+    }
+    else
+    {
+      HostGps_Synth();
+    }
+    ullHostGpsSecond += HOSTCORE_S(1);
+    HostCore_ScheduleIn(&sHostGpsSrc, HostUsart_ByteTime(HostUsart_3));
+    return;
+  }
+  HostCore_Schedule(&sHostGpsSrc, ullHostGpsSecond);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Versorgung an Port D gendert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostGps_Power(void)
+{
+  bool bOn = HostGpio_IsHigh(HostPort_D, HOSTGPS_PWR_PIN);
+  
+  if (bOn && (ullHostGpsOn == HOSTCORE_NEVER))
+  {
+    /* Erste Ausgabe eine Sekunde nach dem Einschalten    */
+    ullHostGpsOn = ullHostNow;
+    ullHostGpsSecond = ullHostNow + HOSTCORE_S(1);
+    uiHostGpsLen = 0;
+    uiHostGpsPos = 0;
+    HostCore_Schedule(&sHostGpsSrc, ullHostGpsSecond);
+  }
+  else if (!bOn && (ullHostGpsOn != HOSTCORE_NEVER))
+  {
+    ullHostGpsOn = HOSTCORE_NEVER;
+    HostCore_Schedule(&sHostGpsSrc, HOSTCORE_NEVER);
+  }
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * GPS-Empfnger anmelden
+ *
+ * @param[in] pNmea     Abzuspielende NMEA-Datei oder NULL fr synthetische
+ *                      Stze zum Standort
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostGps_Init(FILE* pNmea)
+{
+  pHostGpsNmea = pNmea;
+  ullHostGpsOn = HOSTCORE_NEVER;
+  sHostGpsSrc.pszName = "GPS";
+  sHostGpsSrc.ullNext = HOSTCORE_NEVER;
+  sHostGpsSrc.pfnFire = HostGps_Fire;
+  sHostGpsSrc.bSysClk = false;
+  HostCore_AddSource(&sHostGpsSrc);
+  HostGpio_Watch(HostPort_D, HostGps_Power);
+  HostGps_Power();
+}
@@ -0,0 +1,179 @@
+/*!****************************************************************************
+ * @file
+ * HostSim_Motor.c
+ *
+ * Modell der beiden Antriebe: Neigung des Panels (Motor 1, PF7/PF6) mit
+ * Endlagenschaltern an PB3 und PB4, Drehung des Turms (Motor 2, PF5/PF4).
+ * Nothalt (PB0) und Taster (PG4) bleiben unbettigt. Die Mechanik luft
+ * mit den Geschwindigkeiten, die motorlib.c je 100 ms annimmt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostHal.h"
+#include "HostSim.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Zeitschritt der Mechanik                                                  */
+#define HOSTMOTOR_PERIOD        HOSTCORE_MS(100)
+
+/*! Geschwindigkeit je Zeitschritt in 0.1 (MOTORLIB_TILT_SPD, _TURN_SPD)     */
+#define HOSTMOTOR_TILT_STEP     30
+#define HOSTMOTOR_TURN_STEP     5
+
+/*! Endlagen der Neigung in 0.1                                              */
+#define HOSTMOTOR_TILT_MIN      0
+#define HOSTMOTOR_TILT_MAX      900
+
+/*! Ausgnge an Port F                                                        */
+#define HOSTMOTOR_TILT_A        GPIO_Pin_7
+#define HOSTMOTOR_TILT_B        GPIO_Pin_6
+#define HOSTMOTOR_TURN_A        GPIO_Pin_5
+#define HOSTMOTOR_TURN_B        GPIO_Pin_4
+
+/*! Endlagenschalter und Nothalt an Port B, Taster an Port G                  */
+#define HOSTMOTOR_LIM_A         GPIO_Pin_3
+#define HOSTMOTOR_LIM_B         GPIO_Pin_4
+#define HOSTMOTOR_STOP          GPIO_Pin_0
+#define HOSTMOTOR_BUTTON        GPIO_Pin_4
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Zeitschritt whrend einer Bewegung                                        */
+static HostCore_Source sHostMotorSrc;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Endlagenschalter aus der Neigung bilden (Schalter liefern High)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMotor_Limits(void)
+{
+  HostGpio_Drive(HostPort_B, HOSTMOTOR_LIM_A,
+    sHostSimState.iTilt >= HOSTMOTOR_TILT_MAX);
+  HostGpio_Drive(HostPort_B, HOSTMOTOR_LIM_B,
+    sHostSimState.iTilt <= HOSTMOTOR_TILT_MIN);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeitschritt der Mechanik
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMotor_Fire(void)
+{
+  if (HostGpio_IsHigh(HostPort_F, HOSTMOTOR_TILT_A))
+  {
+    sHostSimState.iTilt += HOSTMOTOR_TILT_STEP;
+  }
+  if (HostGpio_IsHigh(HostPort_F, HOSTMOTOR_TILT_B))
+  {
+    sHostSimState.iTilt -= HOSTMOTOR_TILT_STEP;
+  }
+  if (sHostSimState.iTilt > HOSTMOTOR_TILT_MAX)
+  {
+    sHostSimState.iTilt = HOSTMOTOR_TILT_MAX;
+  }
+  if (sHostSimState.iTilt < HOSTMOTOR_TILT_MIN)
+  {
+    sHostSimState.iTilt = HOSTMOTOR_TILT_MIN;
+  }
+  if (HostGpio_IsHigh(HostPort_F, HOSTMOTOR_TURN_A))
+  {
+    sHostSimState.iTurn += HOSTMOTOR_TURN_STEP;
+  }
+  if (HostGpio_IsHigh(HostPort_F, HOSTMOTOR_TURN_B))
+  {
+    sHostSimState.iTurn -= HOSTMOTOR_TURN_STEP;
+  }
+  sHostSimState.iTurn %= 3600;
+  HostMotor_Limits();
+  if (HostMotor_IsMoving())
+  {
+    HostCore_ScheduleIn(&sHostMotorSrc, HOSTMOTOR_PERIOD);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ausgnge an Port F gendert: Bewegung beginnt mit dem nchsten Schritt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMotor_Change(void)
+{
+  if (HostMotor_IsMoving() && (sHostMotorSrc.ullNext == HOSTCORE_NEVER))
+  {
+    HostCore_ScheduleIn(&sHostMotorSrc, HOSTMOTOR_PERIOD);
+  }
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Antriebe anmelden und Eingnge der Station treiben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostMotor_Init(void)
+{
+  sHostMotorSrc.pszName = "MOTOR";
+  sHostMotorSrc.ullNext = HOSTCORE_NEVER;
+  sHostMotorSrc.pfnFire = HostMotor_Fire;
+  sHostMotorSrc.bSysClk = false;
+  HostCore_AddSource(&sHostMotorSrc);
+  HostGpio_Watch(HostPort_F, HostMotor_Change);
+  HostGpio_Drive(HostPort_B, HOSTMOTOR_STOP, false);
+  HostGpio_Drive(HostPort_G, HOSTMOTOR_BUTTON, true);
+  HostMotor_Limits();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Neigung des Panels
+ *
+ * @return    int16_t   Neigung in 0.1 (0 = waagrecht)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int16_t HostMotor_GetTilt(void)
+{
+  return sHostSimState.iTilt;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ausrichtung des Turms ber Grund
+ *
+ * @return    int16_t   Azimut in 0.1 (0..3599)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int16_t HostMotor_GetHeading(void)
+{
+  int16_t iHeading = (int16_t)((sHostSimCfg.iHeading + sHostSimState.iTurn)
+    % 3600);
+  
+  return (iHeading < 0) ? (int16_t)(iHeading + 3600) : iHeading;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob ein Antrieb bestromt ist
+ *
+ * @return    bool      true whrend einer Bewegung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostMotor_IsMoving(void)
+{
+  return (asHostGpio[HostPort_F].IDR & (HOSTMOTOR_TILT_A | HOSTMOTOR_TILT_B
+    | HOSTMOTOR_TURN_A | HOSTMOTOR_TURN_B)) != 0;
+}
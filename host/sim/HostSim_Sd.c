@@ -0,0 +1,529 @@
+/*!****************************************************************************
+ * @file
+ * HostSim_Sd.c
+ *
+ * Modell einer SDHC-Karte im SPI-Modus an SPI2 mit Chip-Select an PE7.
+ * Die Sektoren liegen in einer Abbilddatei, die beim ersten Start mit
+ * FAT16 formatiert wird. Nachgebildet sind die Befehle, die sdmm.c
+ * verwendet; Antworten stehen in einer Ausgabeschlange und werden je
+ * getauschtem Byte ausgegeben, bevor das empfangene Byte ausgewertet wird.
+ * Ein Spannungsausfall beim Schreiben hinterlsst einen halben Sektor
+ * (HostCore_Write()).
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Spannungsausfall beim Schreiben
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include "HostHal.h"
+#include "HostSim.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Chip-Select an Port E                                                     */
+#define HOSTSD_CS_PIN           GPIO_Pin_7
+
+/*! Sektorgre                                                               */
+#define HOSTSD_SECTOR           512u
+
+/*! Gre der Ausgabeschlange (Token, Sektor, CRC und Reserve)                */
+#define HOSTSD_OUT_MAX          1024u
+
+/*! Antworten R1                                                              */
+#define HOSTSD_R1_READY         0x00
+#define HOSTSD_R1_IDLE          0x01
+#define HOSTSD_R1_ILLEGAL       0x04
+#define HOSTSD_R1_PARAM         0x40
+
+/*! Datentoken und Datenantwort "accepted"                                    */
+#define HOSTSD_TOKEN_SINGLE     0xFE
+#define HOSTSD_TOKEN_MULTI      0xFC
+#define HOSTSD_TOKEN_STOP       0xFD
+#define HOSTSD_DATA_ACCEPTED    0xE5
+
+/*! Aufbau des FAT16-Dateisystems                                             */
+#define HOSTSD_FAT_RSVD         1u
+#define HOSTSD_FAT_NUM          2u
+#define HOSTSD_FAT_SIZE         128u
+#define HOSTSD_FAT_ROOT         512u
+#define HOSTSD_FAT_CLUSTER      4u
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*! Zustand der Karte zwischen den Befehlen                                   */
+typedef enum tag_HostSd_State {
+  HostSd_State_CMD,
+  HostSd_State_READ_MULTI,
+  HostSd_State_WRITE_TOKEN,
+  HostSd_State_WRITE_DATA
+} HostSd_State;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Abbilddatei                                                               */
+static int iHostSdFd = -1;
+
+/*! Ausgabeschlange                                                           */
+static uint8_t aucHostSdOut[HOSTSD_OUT_MAX];
+static uint16_t uiHostSdHead;
+static uint16_t uiHostSdCount;
+
+/*! Befehlsrahmen                                                             */
+static uint8_t aucHostSdCmd[6];
+static uint8_t ucHostSdCmdLen;
+
+/*! Zustand, Folgebefehl nach CMD55, Karte initialisiert                      */
+static HostSd_State eHostSdState;
+static bool bHostSdApp;
+static bool bHostSdReady;
+
+/*! Laufender Sektor und Schreibpuffer (Daten und CRC)                        */
+static uint32_t ulHostSdSector;
+static bool bHostSdMulti;
+static uint8_t aucHostSdData[HOSTSD_SECTOR + 2];
+static uint16_t uiHostSdDataLen;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Byte an die Ausgabeschlange anhngen
+ *
+ * @param[in] ucByte    Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSd_Push(uint8_t ucByte)
+{
+  if (uiHostSdCount >= HOSTSD_OUT_MAX)
+  {
+    HostCore_Fatal("SD: Ausgabeschlange voll");
+  }
+  aucHostSdOut[(uiHostSdHead + uiHostSdCount) % HOSTSD_OUT_MAX] = ucByte;
+  ++uiHostSdCount;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datenblock mit Token und Prfsumme an die Ausgabeschlange anhngen
+ *
+ * @param[in] pucData   Daten
+ * @param[in] uiLen     Anzahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSd_PushBlock(const uint8_t* pucData, uint16_t uiLen)
+{
+  uint16_t uiIdx;
+  
+  HostSd_Push(0xFF);
+  HostSd_Push(HOSTSD_TOKEN_SINGLE);
+  for (uiIdx = 0; uiIdx < uiLen; ++uiIdx)
+  {
+    HostSd_Push(pucData[uiIdx]);
+  }
+  HostSd_Push(0xFF);
+  HostSd_Push(0xFF);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sektor aus dem Abbild als Datenblock ausgeben
+ *
+ * @param[in] ulSector  Sektor
+ * @return    bool      true, wenn der Sektor gltig ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostSd_ReadSector(uint32_t ulSector)
+{
+  uint8_t aucBuf[HOSTSD_SECTOR];
+  
+  if ((ulSector >= HOSTSD_SECTORS) || (pread(iHostSdFd, aucBuf,
+    HOSTSD_SECTOR, (off_t)ulSector * HOSTSD_SECTOR) != HOSTSD_SECTOR))
+  {
+    return false;
+  }
+  HostSd_PushBlock(aucBuf, HOSTSD_SECTOR);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Empfangenen Datenblock in das Abbild schreiben und quittieren
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Spannungsausfall
+ ******************************************************************************/
+static void HostSd_WriteSector(void)
+{
+  bool bCut = HostCore_Write();
+  ssize_t lLen = bCut ? (HOSTSD_SECTOR / 2) : HOSTSD_SECTOR;
+  
+  /* Bei Spannungsausfall nur die erste Hlfte            */
+  if ((ulHostSdSector >= HOSTSD_SECTORS) || (pwrite(iHostSdFd, aucHostSdData,
+    (size_t)lLen, (off_t)ulHostSdSector * HOSTSD_SECTOR) != lLen))
+  {
+    HostCore_Fatal("SD: Sektor %lu nicht schreibbar",
+      (unsigned long)ulHostSdSector);
+  }
+  if (bCut)
+  {
+    HostCore_PowerCut();
+  }
+  ++ulHostSdSector;
+  
+  /* Datenantwort, danach kurz belegt (DO low)            */
+  HostSd_Push(HOSTSD_DATA_ACCEPTED);
+  HostSd_Push(0x00);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Vollstndigen Befehlsrahmen ausfhren
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSd_Command(void)
+{
+  static const uint8_t aucCsd[16] = {
+    0x40, 0x0E, 0x00, 0x32, 0x5B, 0x59, 0x00, 0x00,
+    (uint8_t)((HOSTSD_SECTORS / 1024u - 1u) >> 8),
+    (uint8_t)(HOSTSD_SECTORS / 1024u - 1u),
+    0x7F, 0x80, 0x0A, 0x40, 0x00, 0x01
+  };
+  uint8_t ucCmd = aucHostSdCmd[0] & 0x3F;
+  uint32_t ulArg = ((uint32_t)aucHostSdCmd[1] << 24)
+    | ((uint32_t)aucHostSdCmd[2] << 16) | ((uint32_t)aucHostSdCmd[3] << 8)
+    | aucHostSdCmd[4];
+  uint8_t ucR1 = bHostSdReady ? HOSTSD_R1_READY : HOSTSD_R1_IDLE;
+  bool bApp = bHostSdApp;
+  
+  bHostSdApp = false;
+  if (ucCmd == 12)
+  {
+    /* STOP_TRANSMISSION: Stopfbyte, dann R1              */
+    uiHostSdCount = 0;
+    eHostSdState = HostSd_State_CMD;
+    HostSd_Push(0xFF);
+    HostSd_Push(ucR1);
+    return;
+  }
+  uiHostSdCount = 0;
+  eHostSdState = HostSd_State_CMD;
+  switch (ucCmd)
+  {
+    case 0:
+      bHostSdReady = false;
+      HostSd_Push(HOSTSD_R1_IDLE);
+      break;
+    
+    case 8:
+      HostSd_Push(ucR1);
+      HostSd_Push(0x00);
+      HostSd_Push(0x00);
+      HostSd_Push((uint8_t)((ulArg >> 8) & 0x0F));
+      HostSd_Push((uint8_t)ulArg);
+      break;
+    
+    case 55:
+      bHostSdApp = true;
+      HostSd_Push(ucR1);
+      break;
+    
+    case 41:
+      if (!bApp)
+      {
+        HostSd_Push((uint8_t)(ucR1 | HOSTSD_R1_ILLEGAL));
+        break;
+      }
+      bHostSdReady = true;
+      HostSd_Push(HOSTSD_R1_READY);
+      break;
+    
+    case 58:
+      /* OCR mit CCS: Blockadressierung                   */
+      HostSd_Push(ucR1);
+      HostSd_Push(bHostSdReady ? 0xC0 : 0x00);
+      HostSd_Push(0xFF);
+      HostSd_Push(0x80);
+      HostSd_Push(0x00);
+      break;
+    
+    case 9:
+      HostSd_Push(ucR1);
+      HostSd_PushBlock(aucCsd, sizeof(aucCsd));
+      break;
+    
+    case 13:
+      HostSd_Push(ucR1);
+      HostSd_Push(0x00);
+      break;
+    
+    case 16:
+    case 23:
+      HostSd_Push(ucR1);
+      break;
+    
+    case 17:
+    case 18:
+      if (!bHostSdReady || (ulArg >= HOSTSD_SECTORS))
+      {
+        HostSd_Push((uint8_t)(ucR1 | HOSTSD_R1_PARAM));
+        break;
+      }
+      HostSd_Push(HOSTSD_R1_READY);
+      HostSd_ReadSector(ulArg);
+      ulHostSdSector = ulArg + 1;
+      if (ucCmd == 18)
+      {
+        eHostSdState = HostSd_State_READ_MULTI;
+      }
+      break;
+    
+    case 24:
+    case 25:
+      if (!bHostSdReady || (ulArg >= HOSTSD_SECTORS))
+      {
+        HostSd_Push((uint8_t)(ucR1 | HOSTSD_R1_PARAM));
+        break;
+      }
+      HostSd_Push(HOSTSD_R1_READY);
+      ulHostSdSector = ulArg;
+      bHostSdMulti = (ucCmd == 25);
+      eHostSdState = HostSd_State_WRITE_TOKEN;
+      break;
+    
+    default:
+      HostSd_Push((uint8_t)(ucR1 | HOSTSD_R1_ILLEGAL));
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Empfangenes Byte auswerten
+ *
+ * @param[in] ucIn      Byte vom Master
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSd_Input(uint8_t ucIn)
+{
+  switch (eHostSdState)
+  {
+    case HostSd_State_WRITE_TOKEN:
+      if ((ucIn == HOSTSD_TOKEN_SINGLE) || (ucIn == HOSTSD_TOKEN_MULTI))
+      {
+        uiHostSdDataLen = 0;
+        eHostSdState = HostSd_State_WRITE_DATA;
+      }
+      else if ((ucIn == HOSTSD_TOKEN_STOP) && bHostSdMulti)
+      {
+        eHostSdState = HostSd_State_CMD;
+        HostSd_Push(0xFF);
+        HostSd_Push(0x00);
+      }
+      return;
+    
+    case HostSd_State_WRITE_DATA:
+      aucHostSdData[uiHostSdDataLen++] = ucIn;
+      if (uiHostSdDataLen >= sizeof(aucHostSdData))
+      {
+        HostSd_WriteSector();
+        eHostSdState = bHostSdMulti ? HostSd_State_WRITE_TOKEN
+          : HostSd_State_CMD;
+      }
+      return;
+    
+    default:
+      ;
+  }
+  
+  /* Befehlsrahmen beginnt mit 01xxxxxx                   */
+  if ((ucHostSdCmdLen == 0) && ((ucIn & 0xC0) != 0x40))
+  {
+    return;
+  }
+  aucHostSdCmd[ucHostSdCmdLen++] = ucIn;
+  if (ucHostSdCmdLen >= sizeof(aucHostSdCmd))
+  {
+    ucHostSdCmdLen = 0;
+    HostSd_Command();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Byte mit dem Master tauschen
+ *
+ * @param[in] ucOut     Byte vom Master
+ * @return    uint8_t   Byte an den Master
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostSd_Xfer(uint8_t ucOut)
+{
+  uint8_t ucIn = 0xFF;
+  
+  if (HostGpio_IsHigh(HostPort_E, HOSTSD_CS_PIN))
+  {
+    /* Nicht ausgewhlt: DO hochohmig, Rahmen verwerfen   */
+    ucHostSdCmdLen = 0;
+    return 0xFF;
+  }
+  if (uiHostSdCount > 0)
+  {
+    ucIn = aucHostSdOut[uiHostSdHead];
+    uiHostSdHead = (uint16_t)((uiHostSdHead + 1) % HOSTSD_OUT_MAX);
+    --uiHostSdCount;
+  }
+  else if ((eHostSdState == HostSd_State_READ_MULTI) && (ucHostSdCmdLen == 0))
+  {
+    /* Nchster Block der Mehrfachlesung                  */
+    if (!HostSd_ReadSector(ulHostSdSector++))
+    {
+      eHostSdState = HostSd_State_CMD;
+    }
+  }
+  HostSd_Input(ucOut);
+  return ucIn;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Little-Endian-Wert in einen Sektor schreiben
+ *
+ * @param[out] pucBuf   Ziel
+ * @param[in]  ulValue  Wert
+ * @param[in]  ucLen    Anzahl Bytes
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSd_PutLe(uint8_t* pucBuf, uint32_t ulValue, uint8_t ucLen)
+{
+  while (ucLen-- > 0)
+  {
+    *pucBuf++ = (uint8_t)ulValue;
+    ulValue >>= 8;
+  }
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Abbild mit FAT16 ohne Partitionstabelle formatieren (64 MiB, 2 KiB je
+ * Cluster, 512 Eintrge im Stammverzeichnis)
+ *
+ * @param[in] iFd       Abbilddatei
+ * @return    bool      true bei Erfolg
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostSd_Format(int iFd)
+{
+  static const uint8_t aucJump[11] = {
+    0xEB, 0x3C, 0x90, 'M', 'S', 'D', 'O', 'S', '5', '.', '0'
+  };
+  uint8_t aucBuf[HOSTSD_SECTOR];
+  uint32_t ulSector;
+  uint32_t ulEnd = HOSTSD_FAT_RSVD + HOSTSD_FAT_NUM * HOSTSD_FAT_SIZE
+    + HOSTSD_FAT_ROOT * 32u / HOSTSD_SECTOR;
+  
+  if (ftruncate(iFd, 0) != 0)
+  {
+    return false;
+  }
+  if (ftruncate(iFd, (off_t)HOSTSD_SECTORS * HOSTSD_SECTOR) != 0)
+  {
+    return false;
+  }
+  
+  /* Bootsektor mit BPB                                   */
+  memset(aucBuf, 0, sizeof(aucBuf));
+  memcpy(aucBuf, aucJump, sizeof(aucJump));
+  HostSd_PutLe(&aucBuf[11], HOSTSD_SECTOR, 2);
+  aucBuf[13] = HOSTSD_FAT_CLUSTER;
+  HostSd_PutLe(&aucBuf[14], HOSTSD_FAT_RSVD, 2);
+  aucBuf[16] = HOSTSD_FAT_NUM;
+  HostSd_PutLe(&aucBuf[17], HOSTSD_FAT_ROOT, 2);
+  aucBuf[21] = 0xF8;
+  HostSd_PutLe(&aucBuf[22], HOSTSD_FAT_SIZE, 2);
+  HostSd_PutLe(&aucBuf[24], 63, 2);
+  HostSd_PutLe(&aucBuf[26], 255, 2);
+  HostSd_PutLe(&aucBuf[32], HOSTSD_SECTORS, 4);
+  aucBuf[36] = 0x80;
+  aucBuf[38] = 0x29;
+  HostSd_PutLe(&aucBuf[39], 0x20261019UL, 4);
+  memcpy(&aucBuf[43], "STATION    FAT16   ", 19);
+  aucBuf[510] = 0x55;
+  aucBuf[511] = 0xAA;
+  if (pwrite(iFd, aucBuf, HOSTSD_SECTOR, 0) != HOSTSD_SECTOR)
+  {
+    return false;
+  }
+  
+  /* Beide FAT mit Medium- und Endkennung                 */
+  memset(aucBuf, 0, sizeof(aucBuf));
+  for (ulSector = HOSTSD_FAT_RSVD; ulSector < ulEnd; ++ulSector)
+  {
+    if (((ulSector - HOSTSD_FAT_RSVD) % HOSTSD_FAT_SIZE == 0)
+      && (ulSector < HOSTSD_FAT_RSVD + HOSTSD_FAT_NUM * HOSTSD_FAT_SIZE))
+    {
+      HostSd_PutLe(aucBuf, 0xFFFFFFF8UL, 4);
+    }
+    else
+    {
+      memset(aucBuf, 0, 4);
+    }
+    if (pwrite(iFd, aucBuf, HOSTSD_SECTOR, (off_t)ulSector * HOSTSD_SECTOR)
+      != HOSTSD_SECTOR)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * SD-Karte anmelden, ein leeres oder neues Abbild wird formatiert
+ *
+ * @param[in] pszImage  Pfad der Abbilddatei
+ * @return    bool      true, wenn das Abbild bereitsteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool HostSd_Init(const char* pszImage)
+{
+  off_t lSize;
+  
+  iHostSdFd = open(pszImage, O_RDWR | O_CREAT, 0644);
+  if (iHostSdFd < 0)
+  {
+    return false;
+  }
+  lSize = lseek(iHostSdFd, 0, SEEK_END);
+  if (lSize == 0)
+  {
+    HostSim_Log("SD: %s wird formatiert", pszImage);
+    if (!HostSd_Format(iHostSdFd))
+    {
+      return false;
+    }
+  }
+  else if (lSize != (off_t)HOSTSD_SECTORS * HOSTSD_SECTOR)
+  {
+    HostCore_Fatal("SD: %s hat nicht %lu Sektoren", pszImage,
+      (unsigned long)HOSTSD_SECTORS);
+  }
+  uiHostSdCount = 0;
+  ucHostSdCmdLen = 0;
+  eHostSdState = HostSd_State_CMD;
+  bHostSdReady = false;
+  HostSpi_Attach(HostSpi_2, HostSd_Xfer);
+  return true;
+}
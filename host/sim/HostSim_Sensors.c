@@ -0,0 +1,1017 @@
+/*!****************************************************************************
+ * @file
+ * HostSim_Sensors.c
+ *
+ * Registermodelle der Sensoren am I2C-Bus: BME280 (Klima), QMC5883
+ * (Kompass) und MPU6050 (Neigung). Ein Schreibzugriff setzt mit dem ersten
+ * Byte den Registerzeiger, weitere Bytes und Lesezugriffe erhhen ihn
+ * (Auto-Inkrement). Messzeiten und Datenbereitschaft werden beim Zugriff
+ * aus der virtuellen Zeit nachgefhrt, die Messwerte kommen aus dem
+ * Umgebungs- und dem Antriebsmodell oder aus HostSens_SetInput(). Jeder
+ * Sensor zhlt bertragungen und Bytes und nimmt eingespeiste Fehler an
+ * (NAK, festgehaltener Bus, verflschte Daten).
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+#include "HostHal.h"
+#include "HostSim.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! BME280: Register                                                          */
+#define HOSTBME_CALIB1          0x88
+#define HOSTBME_CALIB2          0xE1
+#define HOSTBME_ID              0xD0
+#define HOSTBME_RESET           0xE0
+#define HOSTBME_CTRL_HUM        0xF2
+#define HOSTBME_STATUS          0xF3
+#define HOSTBME_CTRL_MEAS       0xF4
+#define HOSTBME_CONFIG          0xF5
+#define HOSTBME_PRESS           0xF7
+#define HOSTBME_TEMP            0xFA
+#define HOSTBME_HUM             0xFD
+
+/*! BME280: Statusbits und Dauer des Kopierens der Kalibrierwerte             */
+#define HOSTBME_MEASURING       0x08
+#define HOSTBME_IM_UPDATE       0x01
+#define HOSTBME_NVM_NS          HOSTCORE_MS(2)
+
+/*! QMC5883: Register und Bits                                                */
+#define HOSTQMC_DATA            0x00
+#define HOSTQMC_STATUS          0x06
+#define HOSTQMC_TEMP            0x07
+#define HOSTQMC_CR1             0x09
+#define HOSTQMC_CR2             0x0A
+#define HOSTQMC_ID              0x0D
+#define HOSTQMC_DRDY            0x01
+#define HOSTQMC_DOR             0x04
+#define HOSTQMC_SOFT_RST        0x80
+#define HOSTQMC_ROL_PNT         0x40
+
+/*! QMC5883: Betrag des Feldes nach der Kalibrierung der Firmware             */
+#define HOSTQMC_FIELD           2000.0
+
+/*! MPU6050: Register und Bits                                                */
+#define HOSTMPU_SMPLRT_DIV      0x19
+#define HOSTMPU_CONFIG          0x1A
+#define HOSTMPU_ACCEL_CONFIG    0x1C
+#define HOSTMPU_INT_STATUS      0x3A
+#define HOSTMPU_ACCEL           0x3B
+#define HOSTMPU_TEMP            0x41
+#define HOSTMPU_PWR_MGMT_1      0x6B
+#define HOSTMPU_WHO_AM_I        0x75
+#define HOSTMPU_SLEEP           0x40
+#define HOSTMPU_RESET           0x80
+#define HOSTMPU_DRDY            0x01
+
+#define HOSTSENS_PI             3.14159265358979323846
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Registermodell eines Sensors
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostSens_Device {
+  /*! Name fr Meldungen                                  */
+  const char* pszName;
+  
+  /*! Registersatz und Registerzeiger                     */
+  uint8_t aucReg[256];
+  uint8_t ucPtr;
+  
+  /*! Nchstes geschriebenes Byte setzt den Zeiger        */
+  bool bSetPtr;
+  
+  /*! Zeitpunkte: Ende der Messung bzw. des Resets,       *
+   *  Beginn der fortlaufenden Messung                    */
+  HostCore_Time ullBusy;
+  HostCore_Time ullStart;
+  
+  /*! Zuletzt bereitgestellte Messung                     */
+  uint32_t ulSample;
+  
+  /*! Zustand vor dem Lesen nachfhren                    */
+  void (*pfnUpdate)(struct tag_HostSens_Device* pDev);
+  
+  /*! Nebenwirkung eines gelesenen Registers              */
+  void (*pfnRead)(struct tag_HostSens_Device* pDev, uint8_t ucReg);
+  
+  /*! Geschriebenes Register bernehmen                   */
+  void (*pfnWrite)(struct tag_HostSens_Device* pDev, uint8_t ucReg,
+    uint8_t ucVal);
+  
+  /*! Nchster Zeiger nach einem Zugriff                  */
+  uint8_t (*pfnNext)(struct tag_HostSens_Device* pDev, uint8_t ucReg);
+  
+  /*! Zhler                                              */
+  HostSens_Stats sStats;
+  
+  /*! Eingespeister Fehler und verbleibende bertragungen */
+  HostSens_Fault eFault;
+  uint16_t uiFaultCnt;
+  
+  /*! Laufende bertragung liefert invertierte Daten      */
+  bool bCorrupt;
+} HostSens_Device;
+
+/*!****************************************************************************
+ * @brief
+ * Kalibrierwerte des BME280
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostBme_Calib {
+  uint16_t uiT1;
+  int16_t iT2;
+  int16_t iT3;
+  uint16_t uiP1;
+  int16_t aiP[8];
+  uint8_t ucH1;
+  int16_t iH2;
+  uint8_t ucH3;
+  int16_t iH4;
+  int16_t iH5;
+  int8_t cH6;
+} HostBme_Calib;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Kalibrierwerte des Modells (Bereich des Datenblatts)                      */
+static const HostBme_Calib sHostBmeCalib = {
+  27504, 26435, -1000,
+  36477, {-10685, 3024, 2855, 140, -7, 15500, -14600, 6000},
+  75, 362, 0, 313, 50, 30
+};
+
+/*! Zustand der Sensoren                                                      */
+static HostSens_Device sHostBme;
+static HostSens_Device sHostQmc;
+static HostSens_Device sHostMpu;
+
+/*! Sensoren nach Kennung                                                     */
+static HostSens_Device* const apHostSens[HostSens_Id_NUM] = {
+  &sHostBme, &sHostQmc, &sHostMpu
+};
+
+/*! Vorgegebene Messgren oder NULL                                          */
+static const HostSens_Input* pHostSensInput;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Messgren aus der Vorgabe bzw. aus Umgebungs- und Antriebsmodell
+ *
+ * @param[out] pInput   Messgren
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSens_GetInput(HostSens_Input* pInput)
+{
+  if (pHostSensInput != NULL)
+  {
+    *pInput = *pHostSensInput;
+    return;
+  }
+  pInput->dTemp = sHostEnv.dTemp;
+  pInput->dPress = sHostEnv.dPress;
+  pInput->dHum = sHostEnv.dHum;
+  pInput->iHeading = HostMotor_GetHeading();
+  pInput->iTilt = HostMotor_GetTilt();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Rauschen der Messwerte, entfllt bei vorgegebenen Messgren
+ *
+ * @param[in] iAmpl     Amplitude
+ * @return    int16_t   Rauschwert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int16_t HostSens_Noise(int16_t iAmpl)
+{
+  return (pHostSensInput != NULL) ? 0 : HostSim_Noise(iAmpl);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeiger nach einem Zugriff fortschalten (einfaches Auto-Inkrement)
+ *
+ * @param[in] pDev      Sensor
+ * @param[in] ucReg     Zugegriffenes Register
+ * @return    uint8_t   Nchstes Register
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostSens_Increment(HostSens_Device* pDev, uint8_t ucReg)
+{
+  (void)pDev;
+  return (uint8_t)(ucReg + 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * 16-Bit-Wert in zwei Register schreiben
+ *
+ * @param[out] pucReg   Erstes Register
+ * @param[in]  iValue   Wert
+ * @param[in]  bMsbFirst true: hherwertiges Byte zuerst
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSens_Put16(uint8_t* pucReg, int16_t iValue, bool bMsbFirst)
+{
+  pucReg[bMsbFirst ? 0 : 1] = (uint8_t)((uint16_t)iValue >> 8);
+  pucReg[bMsbFirst ? 1 : 0] = (uint8_t)iValue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wert auf den Bereich eines 16-Bit-Registers begrenzen
+ *
+ * @param[in] dValue    Wert
+ * @return    int16_t   Gerundeter Registerwert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int16_t HostSens_Sat16(double dValue)
+{
+  if (dValue > 32767.0)
+  {
+    return 32767;
+  }
+  if (dValue < -32768.0)
+  {
+    return -32768;
+  }
+  return (int16_t)floor(dValue + 0.5);
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: Temperatur aus dem Rohwert (Gleitkommaformel des Datenblatts)
+ *
+ * @param[in]  lAdc     Rohwert
+ * @param[out] pdFine   t_fine fr Druck und Feuchte
+ * @return     double   Temperatur in C
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static double HostBme_Temp(int32_t lAdc, double* pdFine)
+{
+  const HostBme_Calib* pCal = &sHostBmeCalib;
+  double dVar1 = (lAdc / 16384.0 - pCal->uiT1 / 1024.0) * pCal->iT2;
+  double dVar2 = (lAdc / 131072.0 - pCal->uiT1 / 8192.0)
+    * (lAdc / 131072.0 - pCal->uiT1 / 8192.0) * pCal->iT3;
+  
+  *pdFine = dVar1 + dVar2;
+  return *pdFine / 5120.0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: Luftdruck aus dem Rohwert
+ *
+ * @param[in] lAdc      Rohwert
+ * @param[in] dFine     t_fine
+ * @return    double    Luftdruck in Pa
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static double HostBme_Press(int32_t lAdc, double dFine)
+{
+  const HostBme_Calib* pCal = &sHostBmeCalib;
+  double dVar1 = dFine / 2.0 - 64000.0;
+  double dVar2 = dVar1 * dVar1 * pCal->aiP[4] / 32768.0;
+  double dP;
+  
+  dVar2 = dVar2 + dVar1 * pCal->aiP[3] * 2.0;
+  dVar2 = dVar2 / 4.0 + pCal->aiP[2] * 65536.0;
+  dVar1 = (pCal->aiP[1] * dVar1 * dVar1 / 524288.0 + pCal->aiP[0] * dVar1)
+    / 524288.0;
+  dVar1 = (1.0 + dVar1 / 32768.0) * pCal->uiP1;
+  dP = 1048576.0 - lAdc;
+  dP = (dP - dVar2 / 4096.0) * 6250.0 / dVar1;
+  dVar1 = pCal->aiP[7] * dP * dP / 2147483648.0;
+  dVar2 = dP * pCal->aiP[6] / 32768.0;
+  return dP + (dVar1 + dVar2 + pCal->aiP[5]) / 16.0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: relative Feuchte aus dem Rohwert
+ *
+ * @param[in] lAdc      Rohwert
+ * @param[in] dFine     t_fine
+ * @return    double    Feuchte in %
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static double HostBme_Hum(int32_t lAdc, double dFine)
+{
+  const HostBme_Calib* pCal = &sHostBmeCalib;
+  double dH = dFine - 76800.0;
+  
+  dH = (lAdc - (pCal->iH4 * 64.0 + pCal->iH5 / 16384.0 * dH))
+    * (pCal->iH2 / 65536.0 * (1.0 + pCal->cH6 / 67108864.0 * dH
+    * (1.0 + pCal->ucH3 / 67108864.0 * dH)));
+  return dH * (1.0 - pCal->ucH1 * dH / 524288.0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: Rohwerte zur Umgebung durch Intervallhalbierung bestimmen
+ *
+ * @param[in] pDev      Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBme_Sample(HostSens_Device* pDev)
+{
+  int32_t lLow = 0;
+  int32_t lHigh = 0xFFFFF;
+  int32_t lMid;
+  int32_t lAdcT;
+  int32_t lAdcP;
+  double dFine;
+  HostSens_Input sIn;
+  
+  HostSens_GetInput(&sIn);
+  while (lLow < lHigh)
+  {
+    lMid = (lLow + lHigh) / 2;
+    if (HostBme_Temp(lMid, &dFine) < sIn.dTemp)
+    {
+      lLow = lMid + 1;
+    }
+    else
+    {
+      lHigh = lMid;
+    }
+  }
+  lAdcT = lLow;
+  HostBme_Temp(lAdcT, &dFine);
+  
+  /* Druck fllt mit steigendem Rohwert                   */
+  lLow = 0;
+  lHigh = 0xFFFFF;
+  while (lLow < lHigh)
+  {
+    lMid = (lLow + lHigh) / 2;
+    if (HostBme_Press(lMid, dFine) > sIn.dPress * 100.0)
+    {
+      lLow = lMid + 1;
+    }
+    else
+    {
+      lHigh = lMid;
+    }
+  }
+  lAdcP = lLow;
+  
+  pDev->aucReg[HOSTBME_PRESS] = (uint8_t)(lAdcP >> 12);
+  pDev->aucReg[HOSTBME_PRESS + 1] = (uint8_t)(lAdcP >> 4);
+  pDev->aucReg[HOSTBME_PRESS + 2] = (uint8_t)(lAdcP << 4);
+  pDev->aucReg[HOSTBME_TEMP] = (uint8_t)(lAdcT >> 12);
+  pDev->aucReg[HOSTBME_TEMP + 1] = (uint8_t)(lAdcT >> 4);
+  pDev->aucReg[HOSTBME_TEMP + 2] = (uint8_t)(lAdcT << 4);
+  
+  lLow = 0;
+  lHigh = 0xFFFF;
+  while (lLow < lHigh)
+  {
+    lMid = (lLow + lHigh) / 2;
+    if (HostBme_Hum(lMid, dFine) < sIn.dHum)
+    {
+      lLow = lMid + 1;
+    }
+    else
+    {
+      lHigh = lMid;
+    }
+  }
+  pDev->aucReg[HOSTBME_HUM] = (uint8_t)(lLow >> 8);
+  pDev->aucReg[HOSTBME_HUM + 1] = (uint8_t)lLow;
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: Registersatz nach dem Reset mit Kalibrierwerten
+ *
+ * @param[in] pDev      Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBme_Reset(HostSens_Device* pDev)
+{
+  const HostBme_Calib* pCal = &sHostBmeCalib;
+  uint8_t* pucCal = &pDev->aucReg[HOSTBME_CALIB1];
+  uint8_t ucIdx;
+  
+  memset(pDev->aucReg, 0, sizeof(pDev->aucReg));
+  HostSens_Put16(&pucCal[0], (int16_t)pCal->uiT1, false);
+  HostSens_Put16(&pucCal[2], pCal->iT2, false);
+  HostSens_Put16(&pucCal[4], pCal->iT3, false);
+  HostSens_Put16(&pucCal[6], (int16_t)pCal->uiP1, false);
+  for (ucIdx = 0; ucIdx < 8; ++ucIdx)
+  {
+    HostSens_Put16(&pucCal[8 + 2 * ucIdx], pCal->aiP[ucIdx], false);
+  }
+  pDev->aucReg[0xA1] = pCal->ucH1;
+  pucCal = &pDev->aucReg[HOSTBME_CALIB2];
+  HostSens_Put16(&pucCal[0], pCal->iH2, false);
+  pucCal[2] = pCal->ucH3;
+  pucCal[3] = (uint8_t)(pCal->iH4 >> 4);
+  pucCal[4] = (uint8_t)((pCal->iH4 & 0x0F) | ((pCal->iH5 & 0x0F) << 4));
+  pucCal[5] = (uint8_t)(pCal->iH5 >> 4);
+  pucCal[6] = (uint8_t)pCal->cH6;
+  pDev->aucReg[HOSTBME_ID] = 0x60;
+  pDev->aucReg[HOSTBME_PRESS] = 0x80;
+  pDev->aucReg[HOSTBME_TEMP] = 0x80;
+  pDev->aucReg[HOSTBME_HUM] = 0x80;
+  pDev->aucReg[HOSTBME_STATUS] = HOSTBME_IM_UPDATE;
+  pDev->ullBusy = ullHostNow + HOSTBME_NVM_NS;
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: Messdauer nach Datenblatt (Maximalwerte)
+ *
+ * @param[in] pDev      Sensor
+ * @return    HostCore_Time Dauer in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static HostCore_Time HostBme_MeasTime(const HostSens_Device* pDev)
+{
+  static const uint8_t aucOsr[8] = {0, 1, 2, 4, 8, 16, 16, 16};
+  uint8_t ucT = aucOsr[(pDev->aucReg[HOSTBME_CTRL_MEAS] >> 5) & 0x07];
+  uint8_t ucP = aucOsr[(pDev->aucReg[HOSTBME_CTRL_MEAS] >> 2) & 0x07];
+  uint8_t ucH = aucOsr[pDev->aucReg[HOSTBME_CTRL_HUM] & 0x07];
+  uint32_t ulUs = 1250u + 2300u * ucT;
+  
+  if (ucP > 0)
+  {
+    ulUs += 2300u * ucP + 575u;
+  }
+  if (ucH > 0)
+  {
+    ulUs += 2300u * ucH + 575u;
+  }
+  return HOSTCORE_US(ulUs);
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: laufende Messung bzw. Reset abschlieen
+ *
+ * @param[in] pDev      Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBme_Update(HostSens_Device* pDev)
+{
+  uint8_t* pucStatus = &pDev->aucReg[HOSTBME_STATUS];
+  
+  if (ullHostNow < pDev->ullBusy)
+  {
+    return;
+  }
+  *pucStatus &= (uint8_t)~HOSTBME_IM_UPDATE;
+  if (*pucStatus & HOSTBME_MEASURING)
+  {
+    *pucStatus &= (uint8_t)~HOSTBME_MEASURING;
+    HostBme_Sample(pDev);
+    if ((pDev->aucReg[HOSTBME_CTRL_MEAS] & 0x03) != 0x03)
+    {
+      /* Forced Mode endet im Sleep Mode                  */
+      pDev->aucReg[HOSTBME_CTRL_MEAS] &= (uint8_t)~0x03;
+    }
+  }
+  if ((pDev->aucReg[HOSTBME_CTRL_MEAS] & 0x03) == 0x03)
+  {
+    /* Normal Mode: nchste Messung ohne t_standby        */
+    *pucStatus |= HOSTBME_MEASURING;
+    pDev->ullBusy = ullHostNow + HostBme_MeasTime(pDev);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: Schreibzugriff
+ *
+ * @param[in] pDev      Sensor
+ * @param[in] ucReg     Register
+ * @param[in] ucVal     Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBme_Write(HostSens_Device* pDev, uint8_t ucReg, uint8_t ucVal)
+{
+  switch (ucReg)
+  {
+    case HOSTBME_RESET:
+      if (ucVal == 0xB6)
+      {
+        HostBme_Reset(pDev);
+      }
+      break;
+    
+    case HOSTBME_CTRL_HUM:
+    case HOSTBME_CONFIG:
+      pDev->aucReg[ucReg] = ucVal;
+      break;
+    
+    case HOSTBME_CTRL_MEAS:
+      HostBme_Update(pDev);
+      pDev->aucReg[ucReg] = ucVal;
+      if (((ucVal & 0x03) != 0) && !(pDev->aucReg[HOSTBME_STATUS]
+        & HOSTBME_MEASURING))
+      {
+        pDev->aucReg[HOSTBME_STATUS] |= HOSTBME_MEASURING;
+        pDev->ullBusy = ullHostNow + HostBme_MeasTime(pDev);
+      }
+      break;
+    
+    default:
+      /* brige Register sind nur lesbar                  */
+      ;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * QMC5883: Registersatz nach dem Reset
+ *
+ * @param[in] pDev      Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostQmc_Reset(HostSens_Device* pDev)
+{
+  memset(pDev->aucReg, 0, sizeof(pDev->aucReg));
+  pDev->aucReg[HOSTQMC_ID] = 0xFF;
+  pDev->ulSample = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * QMC5883: neue Messung bereitstellen, solange der Sensor fortlaufend misst
+ *
+ * @param[in] pDev      Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostQmc_Update(HostSens_Device* pDev)
+{
+  static const uint16_t auiOdr[4] = {10, 50, 100, 200};
+  uint8_t ucCr1 = pDev->aucReg[HOSTQMC_CR1];
+  uint32_t ulSample;
+  double dTheta;
+  HostSens_Input sIn;
+  
+  if ((ucCr1 & 0x03) != 0x01)
+  {
+    return;
+  }
+  ulSample = (uint32_t)((ullHostNow - pDev->ullStart)
+    / (HOSTCORE_S(1) / auiOdr[(ucCr1 >> 2) & 0x03]));
+  if (ulSample <= pDev->ulSample)
+  {
+    return;
+  }
+  pDev->ulSample = ulSample;
+  if (pDev->aucReg[HOSTQMC_STATUS] & HOSTQMC_DRDY)
+  {
+    pDev->aucReg[HOSTQMC_STATUS] |= HOSTQMC_DOR;
+  }
+  pDev->aucReg[HOSTQMC_STATUS] |= HOSTQMC_DRDY;
+  
+  /* Die Firmware bildet 4500 + atan2(fX, fY) * 573 mit fX = (X + 1140)
+     * 0.8921 und fY = (Y + 830) * 0.7746 (0.1)                      */
+  HostSens_GetInput(&sIn);
+  dTheta = (sIn.iHeading - 900) / 573.0;
+  dTheta = atan2(sin(dTheta), cos(dTheta));
+  HostSens_Put16(&pDev->aucReg[HOSTQMC_DATA],
+    HostSens_Sat16(HOSTQMC_FIELD * sin(dTheta) / 0.8921 - 1140.0
+    + HostSens_Noise(2)), false);
+  HostSens_Put16(&pDev->aucReg[HOSTQMC_DATA + 2],
+    HostSens_Sat16(HOSTQMC_FIELD * cos(dTheta) / 0.7746 - 830.0
+    + HostSens_Noise(2)), false);
+  HostSens_Put16(&pDev->aucReg[HOSTQMC_DATA + 4],
+    HostSens_Sat16(-1500.0 + HostSens_Noise(2)), false);
+  
+  /* Temperatur relativ zur Referenz 34.00 C             */
+  HostSens_Put16(&pDev->aucReg[HOSTQMC_TEMP],
+    HostSens_Sat16((sIn.dTemp + 5.0) * 100.0 - 3400.0), false);
+}
+
+/*!****************************************************************************
+ * @brief
+ * QMC5883: Lesen der Daten lscht DRDY und DOR
+ *
+ * @param[in] pDev      Sensor
+ * @param[in] ucReg     Gelesenes Register
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostQmc_Read(HostSens_Device* pDev, uint8_t ucReg)
+{
+  if (ucReg < HOSTQMC_STATUS)
+  {
+    pDev->aucReg[HOSTQMC_STATUS] &= (uint8_t)~(HOSTQMC_DRDY | HOSTQMC_DOR);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * QMC5883: Schreibzugriff
+ *
+ * @param[in] pDev      Sensor
+ * @param[in] ucReg     Register
+ * @param[in] ucVal     Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostQmc_Write(HostSens_Device* pDev, uint8_t ucReg, uint8_t ucVal)
+{
+  if ((ucReg == HOSTQMC_CR2) && (ucVal & HOSTQMC_SOFT_RST))
+  {
+    HostQmc_Reset(pDev);
+    return;
+  }
+  if ((ucReg < HOSTQMC_CR1) || (ucReg > 0x0B))
+  {
+    return;
+  }
+  if ((ucReg == HOSTQMC_CR1) && ((ucVal ^ pDev->aucReg[ucReg]) & 0x0F))
+  {
+    /* Neuer Modus bzw. neue Rate: Messraster beginnt neu */
+    pDev->ullStart = ullHostNow;
+    pDev->ulSample = 0;
+  }
+  pDev->aucReg[ucReg] = ucVal;
+}
+
+/*!****************************************************************************
+ * @brief
+ * QMC5883: Zeiger springt mit ROL_PNT nach dem Status auf X zurck
+ *
+ * @param[in] pDev      Sensor
+ * @param[in] ucReg     Zugegriffenes Register
+ * @return    uint8_t   Nchstes Register
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostQmc_Next(HostSens_Device* pDev, uint8_t ucReg)
+{
+  if ((pDev->aucReg[HOSTQMC_CR2] & HOSTQMC_ROL_PNT)
+    && (ucReg == HOSTQMC_STATUS))
+  {
+    return HOSTQMC_DATA;
+  }
+  return (uint8_t)(ucReg + 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * MPU6050: Registersatz nach dem Reset (Sleep Mode)
+ *
+ * @param[in] pDev      Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMpu_Reset(HostSens_Device* pDev)
+{
+  memset(pDev->aucReg, 0, sizeof(pDev->aucReg));
+  pDev->aucReg[HOSTMPU_PWR_MGMT_1] = HOSTMPU_SLEEP;
+  pDev->aucReg[HOSTMPU_WHO_AM_I] = 0x68;
+  pDev->ulSample = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * MPU6050: neue Messung im Takt der Abtastrate bereitstellen
+ *
+ * @param[in] pDev      Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMpu_Update(HostSens_Device* pDev)
+{
+  uint8_t ucDlpf = pDev->aucReg[HOSTMPU_CONFIG] & 0x07;
+  uint32_t ulRate = ((ucDlpf == 0) || (ucDlpf == 7)) ? 8000u : 1000u;
+  double dScale = 16384.0 / (1u << ((pDev->aucReg[HOSTMPU_ACCEL_CONFIG] >> 3)
+    & 0x03));
+  double dTilt;
+  uint32_t ulSample;
+  HostSens_Input sIn;
+  
+  if (pDev->aucReg[HOSTMPU_PWR_MGMT_1] & HOSTMPU_SLEEP)
+  {
+    return;
+  }
+  ulRate /= (1u + pDev->aucReg[HOSTMPU_SMPLRT_DIV]);
+  ulSample = (uint32_t)((ullHostNow - pDev->ullStart)
+    / (HOSTCORE_S(1) / ulRate));
+  if (ulSample <= pDev->ulSample)
+  {
+    return;
+  }
+  pDev->ulSample = ulSample;
+  pDev->aucReg[HOSTMPU_INT_STATUS] |= HOSTMPU_DRDY;
+  HostSens_GetInput(&sIn);
+  dTilt = sIn.iTilt / 10.0 * HOSTSENS_PI / 180.0;
+  
+  /* Die Firmware bildet die Neigung aus atan2(Z, Y)      */
+  HostSens_Put16(&pDev->aucReg[HOSTMPU_ACCEL],
+    HostSens_Sat16(HostSens_Noise(20)), true);
+  HostSens_Put16(&pDev->aucReg[HOSTMPU_ACCEL + 2],
+    HostSens_Sat16(dScale * cos(dTilt) + HostSens_Noise(20)), true);
+  HostSens_Put16(&pDev->aucReg[HOSTMPU_ACCEL + 4],
+    HostSens_Sat16(dScale * sin(dTilt) + HostSens_Noise(20)), true);
+  HostSens_Put16(&pDev->aucReg[HOSTMPU_TEMP],
+    HostSens_Sat16(((sIn.dTemp + 5.0) * 100.0 - 3500.0) * 3.4 - 521.0),
+    true);
+}
+
+/*!****************************************************************************
+ * @brief
+ * MPU6050: Lesen von INT_STATUS lscht die Anforderung
+ *
+ * @param[in] pDev      Sensor
+ * @param[in] ucReg     Gelesenes Register
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMpu_Read(HostSens_Device* pDev, uint8_t ucReg)
+{
+  if (ucReg == HOSTMPU_INT_STATUS)
+  {
+    pDev->aucReg[HOSTMPU_INT_STATUS] = 0;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * MPU6050: Schreibzugriff
+ *
+ * @param[in] pDev      Sensor
+ * @param[in] ucReg     Register
+ * @param[in] ucVal     Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMpu_Write(HostSens_Device* pDev, uint8_t ucReg, uint8_t ucVal)
+{
+  if (ucReg == HOSTMPU_PWR_MGMT_1)
+  {
+    if (ucVal & HOSTMPU_RESET)
+    {
+      HostMpu_Reset(pDev);
+      return;
+    }
+    if ((pDev->aucReg[ucReg] & HOSTMPU_SLEEP) && !(ucVal & HOSTMPU_SLEEP))
+    {
+      /* Aufwachen: Abtastung beginnt neu                 */
+      pDev->ullStart = ullHostNow;
+      pDev->ulSample = 0;
+    }
+  }
+  if ((ucReg == HOSTMPU_INT_STATUS)
+    || ((ucReg >= HOSTMPU_ACCEL) && (ucReg < HOSTMPU_ACCEL + 14)))
+  {
+    return;
+  }
+  if (ucReg != HOSTMPU_WHO_AM_I)
+  {
+    pDev->aucReg[ucReg] = ucVal;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Adressbyte nach START
+ *
+ * @param[in] pSlave    Teilnehmer
+ * @param[in] bRead     true: Lesezugriff
+ * @return    bool      ACK
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostSens_Start(const HostI2c_Slave* pSlave, bool bRead)
+{
+  HostSens_Device* pDev = (HostSens_Device*)pSlave->pCtx;
+  HostSens_Fault eFault = HostSens_Fault_NONE;
+  
+  ++pDev->sStats.ulTransfers;
+  ++pDev->sStats.ulBytes;
+  if ((pDev->uiFaultCnt > 0)
+    && (bRead || (pDev->eFault != HostSens_Fault_NAK_READ)))
+  {
+    --pDev->uiFaultCnt;
+    eFault = pDev->eFault;
+  }
+  switch (eFault)
+  {
+    case HostSens_Fault_NAK:
+    case HostSens_Fault_NAK_READ:
+      ++pDev->sStats.ulNaks;
+      return false;
+    
+    case HostSens_Fault_STUCK:
+      HostSim_Log("%s hlt den Bus fest", pDev->pszName);
+      HostI2c_Hold();
+      break;
+    
+    default:
+      ;
+  }
+  pDev->bCorrupt = (eFault == HostSens_Fault_CORRUPT);
+  pDev->bSetPtr = !bRead;
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datenbyte vom Master: Registerzeiger bzw. Registerwert
+ *
+ * @param[in] pSlave    Teilnehmer
+ * @param[in] ucByte    Byte
+ * @return    bool      ACK
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostSens_Write(const HostI2c_Slave* pSlave, uint8_t ucByte)
+{
+  HostSens_Device* pDev = (HostSens_Device*)pSlave->pCtx;
+  
+  ++pDev->sStats.ulBytes;
+  if (pDev->bSetPtr)
+  {
+    pDev->ucPtr = ucByte;
+    pDev->bSetPtr = false;
+    return true;
+  }
+  pDev->pfnUpdate(pDev);
+  pDev->pfnWrite(pDev, pDev->ucPtr, ucByte);
+  ++pDev->sStats.ulWrites;
+  pDev->ucPtr = pDev->pfnNext(pDev, pDev->ucPtr);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datenbyte an den Master
+ *
+ * @param[in] pSlave    Teilnehmer
+ * @return    uint8_t   Registerwert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostSens_Read(const HostI2c_Slave* pSlave)
+{
+  HostSens_Device* pDev = (HostSens_Device*)pSlave->pCtx;
+  uint8_t ucReg = pDev->ucPtr;
+  uint8_t ucVal;
+  
+  pDev->pfnUpdate(pDev);
+  ucVal = pDev->aucReg[ucReg];
+  if (pDev->pfnRead != NULL)
+  {
+    pDev->pfnRead(pDev, ucReg);
+  }
+  pDev->ucPtr = pDev->pfnNext(pDev, ucReg);
+  ++pDev->sStats.ulBytes;
+  ++pDev->sStats.ulReads;
+  return pDev->bCorrupt ? (uint8_t)~ucVal : ucVal;
+}
+
+/*!****************************************************************************
+ * @brief
+ * STOP bzw. Freigabe des Busses beendet die bertragung
+ *
+ * @param[in] pSlave    Teilnehmer
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostSens_Stop(const HostI2c_Slave* pSlave)
+{
+  ((HostSens_Device*)pSlave->pCtx)->bCorrupt = false;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Sensoren am I2C-Bus anmelden, Registerstze wie nach dem Einschalten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostSens_Init(void)
+{
+  static const HostI2c_Slave asSlave[3] = {
+    {HOSTSENS_ADDR_BME280, &sHostBme, HostSens_Start, HostSens_Write,
+      HostSens_Read, HostSens_Stop},
+    {HOSTSENS_ADDR_QMC5883, &sHostQmc, HostSens_Start, HostSens_Write,
+      HostSens_Read, HostSens_Stop},
+    {HOSTSENS_ADDR_MPU6050, &sHostMpu, HostSens_Start, HostSens_Write,
+      HostSens_Read, HostSens_Stop}
+  };
+  uint8_t ucIdx;
+  
+  sHostBme.pszName = "BME280";
+  sHostBme.pfnUpdate = HostBme_Update;
+  sHostBme.pfnRead = NULL;
+  sHostBme.pfnWrite = HostBme_Write;
+  sHostBme.pfnNext = HostSens_Increment;
+  HostBme_Reset(&sHostBme);
+  
+  sHostQmc.pszName = "QMC5883";
+  sHostQmc.pfnUpdate = HostQmc_Update;
+  sHostQmc.pfnRead = HostQmc_Read;
+  sHostQmc.pfnWrite = HostQmc_Write;
+  sHostQmc.pfnNext = HostQmc_Next;
+  HostQmc_Reset(&sHostQmc);
+  
+  sHostMpu.pszName = "MPU6050";
+  sHostMpu.pfnUpdate = HostMpu_Update;
+  sHostMpu.pfnRead = HostMpu_Read;
+  sHostMpu.pfnWrite = HostMpu_Write;
+  sHostMpu.pfnNext = HostSens_Increment;
+  HostMpu_Reset(&sHostMpu);
+  
+  for (ucIdx = 0; ucIdx < 3; ++ucIdx)
+  {
+    HostI2c_Attach(&asSlave[ucIdx]);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messgren vorgeben (Skript eines Tests) bzw. mit NULL wieder aus
+ * Umgebungs- und Antriebsmodell bernehmen
+ *
+ * @param[in] pInput    Messgren, mssen gltig bleiben, oder NULL
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostSens_SetInput(const HostSens_Input* pInput)
+{
+  pHostSensInput = pInput;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fehler fr die nchsten bertragungen eines Sensors einspeisen
+ *
+ * @param[in] eId       Sensor
+ * @param[in] eFault    Art des Fehlers
+ * @param[in] uiCount   Anzahl der betroffenen bertragungen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostSens_SetFault(HostSens_Id eId, HostSens_Fault eFault,
+  uint16_t uiCount)
+{
+  apHostSens[eId]->eFault = eFault;
+  apHostSens[eId]->uiFaultCnt = uiCount;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhler eines Sensors abfragen
+ *
+ * @param[in] eId       Sensor
+ * @return    const HostSens_Stats*  Zhler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const HostSens_Stats* HostSens_GetStats(HostSens_Id eId)
+{
+  return &apHostSens[eId]->sStats;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhler aller Sensoren zurcksetzen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostSens_ClearStats(void)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < HostSens_Id_NUM; ++ucIdx)
+  {
+    memset(&apHostSens[ucIdx]->sStats, 0, sizeof(HostSens_Stats));
+  }
+}
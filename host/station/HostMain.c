@@ -0,0 +1,492 @@
+/*!****************************************************************************
+ * @file
+ * HostMain.c
+ *
+ * Host-Station: die unvernderte Firmware luft gegen die simulierte
+ * Peripherie und die Umgebungsmodelle. Die virtuelle Zeit springt in
+ * WFI/HALT zum nchsten Ereignis, sodass ein Tag Betrieb in etwa einer
+ * halben Minute abluft. Konsole (USART2) geht nach stdout, Meldungen der Modelle nach
+ * stderr. Ein Reset durch den IWDG startet das Programm mit dem Zustand
+ * der Modelle neu (execv), wie die Station mit erhaltener RTC und EEPROM.
+ *
+ * Aufruf:
+ *   hoststation [--days N] [--start JJJJ-MM-TT[Thh:mm:ss]] [--image DATEI]
+ *     [--eeprom DATEI] [--nmea DATEI] [--at-in DATEI] [--at-out DATEI]
+ *     [--lat GRAD] [--lon GRAD] [--heading ZEHNTELGRAD] [--quiet]
+ *     [--wdg-abort]
+ *
+ * Rckgabewert: 0 am Ende der Laufzeit, 1 bei falschem Aufruf, 2 bei einem
+ * IWDG-Reset mit --wdg-abort, 3 bei einem Fehler der Simulation.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "HostHal.h"
+#include "HostSim.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Kennung der Zustandsdatei                                                 */
+#define HOSTMAIN_MAGIC          0x48535431UL
+
+/*! Endung der Zustandsdatei am SD-Abbild                                     */
+#define HOSTMAIN_RESUME_EXT     ".rst"
+
+/*! Maximale Lnge eines Dateipfads                                           */
+#define HOSTMAIN_PATH_MAX       256
+
+/*! Maximale Anzahl Argumente beim Neustart                                   */
+#define HOSTMAIN_ARGS_MAX       40
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zustand, der einen IWDG-Reset berdauert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostMain_Resume {
+  /*! HOSTMAIN_MAGIC                                      */
+  uint32_t ulMagic;
+  
+  /*! Echtzeit beim Reset                                 */
+  HostCore_Time ullNow;
+  
+  /*! Kalender der RTC                                    */
+  uint32_t ulRtcSec;
+  HostCore_Time ullRtcPhase;
+  
+  /*! Anzahl bisheriger Resets                            */
+  uint16_t uiResets;
+  
+  /*! Zustand der Modelle und Daten-EEPROM                */
+  HostSim_Persist sPersist;
+  uint8_t aucEeprom[HOSTHAL_EEPROM_SIZE];
+} HostMain_Resume;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+/* Hauptprogramm der Firmware (main.c mit -Dmain=Firmware_Main)               */
+void Firmware_Main(void);
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Aufrufargumente fr den Neustart                                          */
+static int iHostMainArgc;
+static char** ppszHostMainArgv;
+
+/*! Pfade und Optionen                                                        */
+static const char* pszHostMainImage = "station.img";
+static const char* pszHostMainEeprom;
+static const char* pszHostMainNmea;
+static const char* pszHostMainAtIn;
+static const char* pszHostMainAtOut;
+static char acHostMainResume[HOSTMAIN_PATH_MAX];
+static bool bHostMainResume;
+static bool bHostMainWdgAbort;
+
+/*! Laufzeit und Ende der Simulation                                          */
+static double dHostMainDays = 1.0;
+static HostCore_Source sHostMainEnd;
+
+/*! Anzahl bisheriger Resets                                                  */
+static uint16_t uiHostMainResets;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Aufruf beschreiben und beenden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMain_Usage(void)
+{
+  fprintf(stderr, "Aufruf: hoststation [--days N] [--start JJJJ-MM-TT"
+    "[Thh:mm:ss]] [--image DATEI]\n  [--eeprom DATEI] [--nmea DATEI] "
+    "[--at-in DATEI] [--at-out DATEI]\n  [--lat GRAD] [--lon GRAD] "
+    "[--heading ZEHNTELGRAD] [--quiet] [--wdg-abort]\n");
+  exit(1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datum und Uhrzeit in Sekunden seit dem 01.01.2000 umrechnen
+ *
+ * @param[in] pszText   "JJJJ-MM-TT" oder "JJJJ-MM-TTThh:mm:ss" (UTC)
+ * @return    uint32_t  Sekunden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostMain_ParseStart(const char* pszText)
+{
+  static const uint16_t auiDays[12] = {
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+  };
+  unsigned uYear;
+  unsigned uMonth;
+  unsigned uDay;
+  unsigned uHour = 0;
+  unsigned uMin = 0;
+  unsigned uSec = 0;
+  uint32_t ulDays;
+  int iCount;
+  
+  iCount = sscanf(pszText, "%u-%u-%uT%u:%u:%u", &uYear, &uMonth, &uDay,
+    &uHour, &uMin, &uSec);
+  if (((iCount != 3) && (iCount != 6)) || (uYear < 2000) || (uYear > 2099)
+    || (uMonth < 1) || (uMonth > 12) || (uDay < 1) || (uDay > 31)
+    || (uHour > 23) || (uMin > 59) || (uSec > 59))
+  {
+    HostMain_Usage();
+  }
+  uYear -= 2000;
+  ulDays = uYear * 365u + (uYear + 3u) / 4u + auiDays[uMonth - 1] + uDay - 1u;
+  if (((uYear % 4u) == 0) && (uMonth > 2))
+  {
+    ++ulDays;
+  }
+  return ulDays * 86400UL + uHour * 3600UL + uMin * 60UL + uSec;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Aufrufargumente auswerten
+ *
+ * @param[in] iArgc     Anzahl
+ * @param[in] ppszArgv  Argumente
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMain_Args(int iArgc, char** ppszArgv)
+{
+  int iIdx;
+  const char* pszOpt;
+  const char* pszVal;
+  
+  for (iIdx = 1; iIdx < iArgc; ++iIdx)
+  {
+    pszOpt = ppszArgv[iIdx];
+    if (strcmp(pszOpt, "--quiet") == 0)
+    {
+      sHostSimCfg.bQuiet = true;
+      continue;
+    }
+    if (strcmp(pszOpt, "--wdg-abort") == 0)
+    {
+      bHostMainWdgAbort = true;
+      continue;
+    }
+    if (strcmp(pszOpt, "--resume") == 0)
+    {
+      bHostMainResume = true;
+      continue;
+    }
+    if (iIdx + 1 >= iArgc)
+    {
+      HostMain_Usage();
+    }
+    pszVal = ppszArgv[++iIdx];
+    if (strcmp(pszOpt, "--days") == 0)
+    {
+      dHostMainDays = atof(pszVal);
+    }
+    else if (strcmp(pszOpt, "--start") == 0)
+    {
+      sHostSimCfg.ulStart = HostMain_ParseStart(pszVal);
+    }
+    else if (strcmp(pszOpt, "--image") == 0)
+    {
+      pszHostMainImage = pszVal;
+    }
+    else if (strcmp(pszOpt, "--eeprom") == 0)
+    {
+      pszHostMainEeprom = pszVal;
+    }
+    else if (strcmp(pszOpt, "--nmea") == 0)
+    {
+      pszHostMainNmea = pszVal;
+    }
+    else if (strcmp(pszOpt, "--at-in") == 0)
+    {
+      pszHostMainAtIn = pszVal;
+    }
+    else if (strcmp(pszOpt, "--at-out") == 0)
+    {
+      pszHostMainAtOut = pszVal;
+    }
+    else if (strcmp(pszOpt, "--lat") == 0)
+    {
+      sHostSimCfg.dLat = atof(pszVal);
+    }
+    else if (strcmp(pszOpt, "--lon") == 0)
+    {
+      sHostSimCfg.dLon = atof(pszVal);
+    }
+    else if (strcmp(pszOpt, "--heading") == 0)
+    {
+      sHostSimCfg.iHeading = (int16_t)atoi(pszVal);
+    }
+    else
+    {
+      HostMain_Usage();
+    }
+  }
+  if ((dHostMainDays <= 0.0)
+    || (strlen(pszHostMainImage) + sizeof(HOSTMAIN_RESUME_EXT)
+      > sizeof(acHostMainResume)))
+  {
+    HostMain_Usage();
+  }
+  sprintf(acHostMainResume, "%s" HOSTMAIN_RESUME_EXT, pszHostMainImage);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eingabedatei ffnen
+ *
+ * @param[in] pszPath   Pfad oder NULL
+ * @param[in] pszMode   Modus wie fopen
+ * @return    FILE*     Datei oder NULL ohne Pfad
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static FILE* HostMain_Open(const char* pszPath, const char* pszMode)
+{
+  FILE* pFile;
+  
+  if (pszPath == NULL)
+  {
+    return NULL;
+  }
+  pFile = fopen(pszPath, pszMode);
+  if (pFile == NULL)
+  {
+    fprintf(stderr, "%s: kann nicht geffnet werden\n", pszPath);
+    exit(1);
+  }
+  return pFile;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Daten-EEPROM aus der Datei laden und zum Durchschreiben anmelden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMain_Eeprom(void)
+{
+  int iFd;
+  ssize_t lRead;
+  
+  if (pszHostMainEeprom == NULL)
+  {
+    return;
+  }
+  iFd = open(pszHostMainEeprom, O_RDWR | O_CREAT, 0644);
+  if (iFd < 0)
+  {
+    fprintf(stderr, "%s: kann nicht geffnet werden\n", pszHostMainEeprom);
+    exit(1);
+  }
+  
+  /* Neue Datei: gelschtes EEPROM (0x00)                 */
+  lRead = pread(iFd, aucHostEeprom, sizeof(aucHostEeprom), 0);
+  if (lRead < (ssize_t)sizeof(aucHostEeprom))
+  {
+    memset(&aucHostEeprom[(lRead > 0) ? lRead : 0], 0,
+      sizeof(aucHostEeprom) - (size_t)((lRead > 0) ? lRead : 0));
+    if (pwrite(iFd, aucHostEeprom, sizeof(aucHostEeprom), 0)
+      != (ssize_t)sizeof(aucHostEeprom))
+    {
+      fprintf(stderr, "%s: kann nicht geschrieben werden\n",
+        pszHostMainEeprom);
+      exit(1);
+    }
+  }
+  HostFlash_SetBacking(iFd);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zustand nach einem Reset laden
+ *
+ * @param[out] pResume  Zustand
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMain_LoadResume(HostMain_Resume* pResume)
+{
+  int iFd = open(acHostMainResume, O_RDONLY);
+  
+  if ((iFd < 0) || (read(iFd, pResume, sizeof(*pResume))
+    != (ssize_t)sizeof(*pResume)) || (pResume->ulMagic != HOSTMAIN_MAGIC))
+  {
+    fprintf(stderr, "%s: kein gltiger Zustand\n", acHostMainResume);
+    exit(1);
+  }
+  close(iFd);
+  unlink(acHostMainResume);
+}
+
+/*!****************************************************************************
+ * @brief
+ * IWDG abgelaufen: Zustand sichern und das Programm neu starten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMain_Reset(void)
+{
+  static HostMain_Resume sResume;
+  char* apszArgv[HOSTMAIN_ARGS_MAX + 2];
+  int iArgc = 0;
+  int iIdx;
+  int iFd;
+  
+  HostSim_Log("IWDG-Reset");
+  fflush(NULL);
+  if (bHostMainWdgAbort)
+  {
+    fprintf(stderr, "HOST: IWDG-Reset nach %.0f s\n",
+      (double)ullHostNow / 1e9);
+    exit(2);
+  }
+  sResume.ulMagic = HOSTMAIN_MAGIC;
+  sResume.ullNow = ullHostNow;
+  sResume.ulRtcSec = HostRtc_GetSeconds();
+  sResume.ullRtcPhase = HostRtc_GetPhase();
+  sResume.uiResets = (uint16_t)(uiHostMainResets + 1);
+  sResume.sPersist = sHostSimState;
+  memcpy(sResume.aucEeprom, aucHostEeprom, sizeof(sResume.aucEeprom));
+  iFd = open(acHostMainResume, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if ((iFd < 0) || (write(iFd, &sResume, sizeof(sResume))
+    != (ssize_t)sizeof(sResume)))
+  {
+    HostCore_Fatal("%s: Zustand nicht speicherbar", acHostMainResume);
+  }
+  close(iFd);
+  
+  /* Gleiche Argumente, einmal --resume                   */
+  for (iIdx = 0; (iIdx < iHostMainArgc) && (iArgc < HOSTMAIN_ARGS_MAX);
+    ++iIdx)
+  {
+    if (strcmp(ppszHostMainArgv[iIdx], "--resume") != 0)
+    {
+      apszArgv[iArgc++] = ppszHostMainArgv[iIdx];
+    }
+  }
+  apszArgv[iArgc++] = "--resume";
+  apszArgv[iArgc] = NULL;
+  execv("/proc/self/exe", apszArgv);
+  HostCore_Fatal("Neustart fehlgeschlagen");
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ende der Laufzeit
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMain_End(void)
+{
+  HostSim_Log("Ende nach %.2f Tagen, %u Resets, SoC %.2f",
+    (double)ullHostNow / HOSTCORE_S(86400), uiHostMainResets,
+    sHostSimState.dSoC);
+  fflush(NULL);
+  exit(0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeichen der Konsole (USART2) ausgeben
+ *
+ * @param[in] ucByte    Zeichen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostMain_Console(uint8_t ucByte)
+{
+  putc(ucByte, stdout);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Simulation aufbauen und die Firmware starten
+ *
+ * @param[in] argc      Anzahl Argumente
+ * @param[in] argv      Argumente
+ * @return    int       Rckgabewert, siehe Dateikopf
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+  static HostMain_Resume sResume;
+  HostCore_Time ullStart = 0;
+  
+  iHostMainArgc = argc;
+  ppszHostMainArgv = argv;
+  sHostSimCfg.ulStart = HostMain_ParseStart("2026-06-21T04:00:00");
+  sHostSimCfg.dLat = 48.137;
+  sHostSimCfg.dLon = 11.575;
+  sHostSimCfg.dAlt = 520.0;
+  sHostSimState.dSoC = 0.8;
+  sHostSimState.ulSeed = 1;
+  HostMain_Args(argc, argv);
+  if (bHostMainResume)
+  {
+    HostMain_LoadResume(&sResume);
+    ullStart = sResume.ullNow;
+    uiHostMainResets = sResume.uiResets;
+    sHostSimState = sResume.sPersist;
+    memcpy(aucHostEeprom, sResume.aucEeprom, sizeof(aucHostEeprom));
+  }
+  
+  /* Kern und Peripherie wie nach dem Reset               */
+  HostCore_Init(ullStart);
+  HostHal_Init();
+  HostMain_Eeprom();
+  if (bHostMainResume)
+  {
+    HostRtc_Start(sResume.ulRtcSec, sResume.ullRtcPhase);
+    HostRst_SetCause(RST_FLAG_IWDGF);
+  }
+  else
+  {
+    HostRtc_Start(sHostSimCfg.ulStart, 0);
+    HostRst_SetCause(RST_FLAG_PORF);
+  }
+  HostIwdg_SetReset(HostMain_Reset);
+  HostUsart_SetSink(HostUsart_2, HostMain_Console);
+  
+  /* Umgebung und Auenbeschaltung                        */
+  HostEnv_Init();
+  HostMotor_Init();
+  HostGps_Init(HostMain_Open(pszHostMainNmea, "r"));
+  HostBt_Init(HostMain_Open(pszHostMainAtIn, "r"),
+    HostMain_Open(pszHostMainAtOut, bHostMainResume ? "a" : "w"));
+  HostSens_Init();
+  if (!HostSd_Init(pszHostMainImage))
+  {
+    fprintf(stderr, "%s: Abbild nicht nutzbar\n", pszHostMainImage);
+    return 1;
+  }
+  sHostMainEnd.pszName = "ENDE";
+  sHostMainEnd.ullNext = (HostCore_Time)(dHostMainDays * 86400.0)
+    * HOSTCORE_S(1);
+  sHostMainEnd.pfnFire = HostMain_End;
+  sHostMainEnd.bSysClk = false;
+  HostCore_AddSource(&sHostMainEnd);
+  
+  Firmware_Main();
+  HostCore_Fatal("Firmware beendet");
+  return 3;
+}
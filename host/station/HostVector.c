@@ -0,0 +1,100 @@
+/*!****************************************************************************
+ * @file
+ * HostVector.c
+ *
+ * Vektortabelle der Host-Station. Ersetzt stm8_interrupt_vector.c und ruft
+ * die Interruptserviceroutinen der Firmware ber ihre Vektornummer auf.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostCore.h"
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+/* Interruptserviceroutinen der Firmware                                      */
+void RTC_InterruptHandler(void);
+void Motor_LimitInterruptHandler(void);
+void Timer2Interrupt(void);
+void UART3_TxInterruptHandler(void);
+void UART3_RxInterruptHandler(void);
+void Profiler_TimerInterrupt(void);
+void UART1_TxInterruptHandler(void);
+void UART1_RxInterruptHandler(void);
+void I2CMaster_Int_I2CInterruptHandler(void);
+
+/* Abfrage der Firmware und Original hinter -Wl,--wrap                        */
+bool __real_UART1_IsTxReady(void);
+bool __wrap_UART1_IsTxReady(void);
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Interruptserviceroutine zu einer Vektornummer aufrufen
+ *
+ * @param[in] ucVector  Vektornummer wie in INTERRUPT_HANDLER
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void HostVector_Call(uint8_t ucVector)
+{
+  switch (ucVector)
+  {
+    case HOSTCORE_VEC_RTC:
+      RTC_InterruptHandler();
+      break;
+    
+    case HOSTCORE_VEC_EXTIB:
+      Motor_LimitInterruptHandler();
+      break;
+    
+    case HOSTCORE_VEC_TIM2:
+      Timer2Interrupt();
+      break;
+    
+    case HOSTCORE_VEC_USART3_TX:
+      UART3_TxInterruptHandler();
+      break;
+    
+    case HOSTCORE_VEC_USART3_RX:
+      UART3_RxInterruptHandler();
+      break;
+    
+    case HOSTCORE_VEC_TIM1:
+      Profiler_TimerInterrupt();
+      break;
+    
+    case HOSTCORE_VEC_USART1_TX:
+      UART1_TxInterruptHandler();
+      break;
+    
+    case HOSTCORE_VEC_USART1_RX:
+      UART1_RxInterruptHandler();
+      break;
+    
+    case HOSTCORE_VEC_I2C:
+      I2CMaster_Int_I2CInterruptHandler();
+      break;
+    
+    default:
+      HostCore_Fatal("Vektor %u ohne Interruptserviceroutine", ucVector);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Warteschleife auf den Sender von USART1. UART1_IsTxReady() liest nur
+ * eine Variable der Firmware; die Abfrage lsst die virtuelle Zeit
+ * weiterlaufen, damit der Sendeinterrupt kommen kann.
+ *
+ * @return    bool      true, wenn der Sender frei ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool __wrap_UART1_IsTxReady(void)
+{
+  HostCore_Poll(0x09000001UL);
+  return __real_UART1_IsTxReady();
+}
@@ -0,0 +1,603 @@
+/*!****************************************************************************
+ * @file
+ * HostBench.c
+ *
+ * Laufzeitmessung der Rechenroutinen der Firmware auf dem PC. Jeder Fall
+ * luft in Blcken zu HOSTBENCH_BATCH Aufrufen, bis die vorgegebene Zeit
+ * erreicht ist; ausgegeben werden der Mittelwert und der schnellste Block
+ * in ns je Aufruf. Whrend der Messung zhlt ein Ersatz fr malloc() und
+ * Co. jede Anforderung von Speicher, die Firmware muss ohne auskommen.
+ *
+ * Die Zahlen gelten fr den Host und sind nur untereinander vergleichbar
+ * (vorher/nachher auf demselben Rechner). Auf dem Zielsystem misst
+ * AT+CBENCH (Benchmark.c).
+ *
+ * Aufruf:
+ *   hostbench [--json DATEI] [--time MS]
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Protokollzeile mit sprintf() als Bezug
+ * @date  19.10.2026  Binrsatz und gepackter Eintrag
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "HostHal.h"
+#include "sensorlib_bme280.h"
+#include "sensorlib_bme280_internal.h"
+#include "sensorlib_qmc5883.h"
+#include "sensorlib_qmc5883_internal.h"
+#include "sensorlib_wind.h"
+#include "sensorlib_wind_internal.h"
+#include "SolarTracking_Internal.h"
+#include "GPSHandler.h"
+#include "SensorLog.h"
+#include "Logger.h"
+#include "commlib.h"
+#include "ATCmd.h"
+#include "HostFmtRef.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Aufrufe je Zeitmessung                                                    */
+#define HOSTBENCH_BATCH         1000u
+
+/*! Messzeit je Fall in ms ohne --time                                        */
+#define HOSTBENCH_TIME_MS       200u
+
+/*! Abstand zum vorherigen Eintrag in s                                       */
+#define HOSTBENCH_STEP          10
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Messfall
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostBench_Case {
+  /*! Name in der Ausgabe                                 */
+  const char* pszName;
+  
+  /*! Gemessene Routine (ein Aufruf)                      */
+  void (*pfnRun)(void);
+} HostBench_Case;
+
+/*!****************************************************************************
+ * @brief
+ * Ergebnis eines Messfalls
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostBench_Result {
+  /*! Anzahl Aufrufe                                      */
+  unsigned long ulOps;
+  
+  /*! Mittelwert und schnellster Block in ns je Aufruf    */
+  double dMean;
+  double dMin;
+  
+  /*! Speicheranforderungen whrend der Messung           */
+  unsigned long ulAllocs;
+} HostBench_Result;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+/* Speicherverwaltung der glibc hinter dem Ersatz                             */
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t nmemb, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Zhlung der Speicheranforderungen aktiv                                   */
+static volatile int iHostBenchArmed;
+
+/*! Speicheranforderungen seit dem Scharfschalten                             */
+static volatile unsigned long ulHostBenchAllocs;
+
+/*! Ergebnisse gegen Wegoptimieren sichern                                    */
+static volatile uint32_t ulHostBenchSink;
+
+/*! Eingangsdaten der Sensorroutinen                                          */
+static BME280_Sensor sHostBenchBme;
+static QMC5883_Sensor sHostBenchQmc;
+static Wind_Sensor sHostBenchWind;
+static SensorLogItem sHostBenchLog;
+
+/*! Vorheriger Satz fr den gepackten Eintrag                                 */
+static Logger_Record sHostBenchPrev;
+
+/*! Fester Sentence, Hamburg am 21.12.2019 12:00 UTC                          */
+static const char szHostBenchNmea[] =
+  "$GPRMC,120000.00,A,5333.00000,N,01000.00000,E,0.012,,211219,,,A*7F";
+
+/*! AT-Befehl aus der Mitte der Befehlstabelle                                */
+static const char szHostBenchAt[] = "AT+CLOGFMT?\r";
+
+/*! Antwort auf den AT-Befehl fr die Plausibilittsprfung                   */
+static char acHostBenchTx[64];
+static uint8_t ucHostBenchTxPos;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Kompensation BME280: Temperatur, Luftdruck und Feuchte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_BmeCalc(void)
+{
+  ulHostBenchSink = (uint32_t)BME280_CalcTemp(&sHostBenchBme);
+  ulHostBenchSink = BME280_CalcPress(&sHostBenchBme);
+  ulHostBenchSink = BME280_CalcHum(&sHostBenchBme);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Azimut aus dem Magnetfeld
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Azim(void)
+{
+  ulHostBenchSink = QMC5883_CalcAzimuth(&sHostBenchQmc);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Mittlere Windgeschwindigkeit
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Wind(void)
+{
+  ulHostBenchSink = Wind_CalcAvgVelocity(&sHostBenchWind);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sonnenstand, Hamburg am 21.12.2019 12:00 UTC
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_SunPos(void)
+{
+  double dAzimuth;
+  double dZenith;
+  
+  calculate_current_sun_position(2019, 12, 21, 12.0, 0, 53.55, 10.0,
+    &dAzimuth, &dZenith);
+  ulHostBenchSink = (uint32_t)(dAzimuth * 10) + (uint32_t)(dZenith * 10);
+}
+
+/*!****************************************************************************
+ * @brief
+ * NMEA-Parser mit einem GPRMC-Sentence
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Nmea(void)
+{
+  GPSHandler_ParseSentence((char*)szHostBenchNmea,
+    sizeof(szHostBenchNmea) - 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Protokollzeile wie in SaveSensors() formatieren
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Csv(void)
+{
+  char acBuf[LOGGER_CSV_MAX];
+  
+  ulHostBenchSink = Logger_FormatCsv(&sHostBenchLog, acBuf);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Dieselbe Protokollzeile mit sprintf() wie vor NumFmt, Bezug fr CSV
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Sprintf(void)
+{
+  char acBuf[HOSTFMTREF_MAX];
+  
+  ulHostBenchSink = HostFmtRef_Csv(&sHostBenchLog, acBuf);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz zusammenstellen und wie in der Datei ablegen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Bin(void)
+{
+  Logger_Record sRec;
+  uint8_t aucRec[sizeof(Logger_Record)];
+  
+  Logger_BuildRecord(&sHostBenchLog, &sRec);
+  Logger_EncodeRecord(&sRec, aucRec);
+  ulHostBenchSink = aucRec[sizeof(aucRec) - 1];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz zusammenstellen und seine Lnge als gepackter Eintrag gegenber
+ * dem Vorgnger bestimmen, wie Logger_WritePack()
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Pack(void)
+{
+  Logger_Record sRec;
+  uint32_t ulMask;
+  
+  Logger_BuildRecord(&sHostBenchLog, &sRec);
+  ulHostBenchSink = Logger_GetPackSize(&sRec, &sHostBenchPrev, HOSTBENCH_STEP,
+    &ulMask) + ulMask;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ausgabe von USART1 mitschreiben
+ *
+ * @param[in] ucByte    Gesendetes Zeichen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Tx(uint8_t ucByte)
+{
+  if (ucHostBenchTxPos < sizeof(acHostBenchTx) - 1)
+  {
+    acHostBenchTx[ucHostBenchTxPos++] = (char)ucByte;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * AT-Befehl ber USART1 empfangen und mit ATCmd_Poll() ausfhren. Enthlt
+ * den Empfangsinterrupt und die Ausgabe der Antwort ber die simulierte
+ * Schnittstelle.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_AtCmd(void)
+{
+  const char* pc;
+  
+  for (pc = szHostBenchAt; *pc != '\0'; ++pc)
+  {
+    HostUsart_Receive(HostUsart_1, (uint8_t)*pc);
+  }
+  ATCmd_Poll();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eingangsdaten und simulierte Peripherie vorbereiten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Init(void)
+{
+  SensorLogItem sPrev;
+  uint8_t ucIdx;
+  
+  /* Kalibrierwerte und Rohdaten aus dem Datenblatt       */
+  sHostBenchBme.sCalib.uiDigT1 = 27504;
+  sHostBenchBme.sCalib.iDigT2 = 26435;
+  sHostBenchBme.sCalib.iDigT3 = -1000;
+  sHostBenchBme.sCalib.uiDigP1 = 36477;
+  sHostBenchBme.sCalib.iDigP2 = -10685;
+  sHostBenchBme.sCalib.iDigP3 = 3024;
+  sHostBenchBme.sCalib.iDigP4 = 2855;
+  sHostBenchBme.sCalib.iDigP5 = 140;
+  sHostBenchBme.sCalib.iDigP6 = -7;
+  sHostBenchBme.sCalib.iDigP7 = 15500;
+  sHostBenchBme.sCalib.iDigP8 = -14600;
+  sHostBenchBme.sCalib.iDigP9 = 6000;
+  sHostBenchBme.sCalib.ucDigH1 = 75;
+  sHostBenchBme.sCalib.iDigH2 = 362;
+  sHostBenchBme.sCalib.ucDigH3 = 0;
+  sHostBenchBme.sCalib.iDigH4 = 313;
+  sHostBenchBme.sCalib.iDigH5 = 50;
+  sHostBenchBme.sCalib.cDigH6 = 30;
+  sHostBenchBme.sRaw.ulRawTemp = 519888;
+  sHostBenchBme.sRaw.ulRawPress = 415148;
+  sHostBenchBme.sRaw.uiRawHum = 30000;
+  
+  sHostBenchQmc.sCalib.fXComp = -1140.0f;
+  sHostBenchQmc.sCalib.fYComp = -830.0f;
+  sHostBenchQmc.sCalib.fXGain = 0.8921f;
+  sHostBenchQmc.sCalib.fYGain = 0.7746f;
+  sHostBenchQmc.sRaw.iRawX = 520;
+  sHostBenchQmc.sRaw.iRawY = -2730;
+  
+  sHostBenchWind.sRaw.ucHead = 3;
+  for (ucIdx = 0; ucIdx < NUM_WIND_AVG; ++ucIdx)
+  {
+    sHostBenchWind.sRaw.auiRawVelocity[ucIdx] = (uint16_t)(40 + 3 * ucIdx);
+  }
+  
+  /* Protokolleintrag mit vollen Feldbreiten              */
+  sHostBenchLog.sTimestamp.sDate.RTC_Year = 26;
+  sHostBenchLog.sTimestamp.sDate.RTC_Month = 10;
+  sHostBenchLog.sTimestamp.sDate.RTC_Date = 19;
+  sHostBenchLog.sTimestamp.sTime.RTC_Hours = 13;
+  sHostBenchLog.sTimestamp.sTime.RTC_Minutes = 45;
+  sHostBenchLog.sTimestamp.sTime.RTC_Seconds = 30;
+  sHostBenchLog.sTemperature.iBME = 2150;
+  sHostBenchLog.sTemperature.iCPU = 2600;
+  sHostBenchLog.sTemperature.iQMC = -350;
+  sHostBenchLog.sTemperature.iMPU = 2480;
+  sHostBenchLog.ulPressure = 101325;
+  sHostBenchLog.ulHumidity = 46080;
+  sHostBenchLog.sWind.uiDir = 6;
+  sHostBenchLog.sWind.uiVelo = 125;
+  sHostBenchLog.sAlignment.uiAzimuth = 1805;
+  sHostBenchLog.sAlignment.iZenith = -120;
+  sHostBenchLog.sPosition.lLat = 53550000;
+  sHostBenchLog.sPosition.lLong = -10000000;
+  sHostBenchLog.sPosition.iAlt = 12;
+  sHostBenchLog.sPower.uiBatVolt = 3950;
+  sHostBenchLog.sPower.uiPanelVolt = 5210;
+  sHostBenchLog.sPower.iBatCurr = -85;
+  sHostBenchLog.sPower.iPanelCurr = 310;
+  sHostBenchLog.sEnergy.ucSoC = 87;
+  sHostBenchLog.sEnergy.uiBatIn = 1250;
+  sHostBenchLog.sEnergy.uiBatOut = 980;
+  sHostBenchLog.sEnergy.ulPvEnergy = 123456;
+  
+  /* Vorgnger: ein Intervall frher, typische nderungen */
+  sPrev = sHostBenchLog;
+  sPrev.sTimestamp.sTime.RTC_Seconds -= HOSTBENCH_STEP;
+  sPrev.sTemperature.iBME -= 3;
+  sPrev.sTemperature.iCPU += 1;
+  sPrev.ulPressure -= 2;
+  sPrev.ulHumidity += 40;
+  sPrev.sWind.uiVelo -= 17;
+  sPrev.sPower.uiBatVolt += 1;
+  sPrev.sPower.iPanelCurr -= 12;
+  sPrev.sEnergy.ulPvEnergy -= 9;
+  Logger_BuildRecord(&sPrev, &sHostBenchPrev);
+  
+  /* USART1 fr den AT-Befehl                             */
+  HostCore_Init(0);
+  HostHal_Init();
+  HostUsart_SetSink(HostUsart_1, HostBench_Tx);
+  UART1_Init();
+  ATCmd_Init();
+  enableInterrupts();
+  UART1_ReceiveUntil('\r', COMMLIB_UART1_MAX_BUF);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Monotone Zeit in ns
+ *
+ * @return    double    Zeit in ns
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static double HostBench_Now(void)
+{
+  struct timespec sTs;
+  
+  clock_gettime(CLOCK_MONOTONIC, &sTs);
+  return sTs.tv_sec * 1e9 + sTs.tv_nsec;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messfall in Blcken ausfhren, bis die Messzeit erreicht ist
+ *
+ * @param[in]  pCase    Messfall
+ * @param[in]  dTime    Messzeit in ns
+ * @param[out] pResult  Ergebnis
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostBench_Run(const HostBench_Case* pCase, double dTime,
+  HostBench_Result* pResult)
+{
+  double dStart;
+  double dBatch;
+  double dTotal = 0.0;
+  unsigned uRun;
+  
+  /* Ein Block zum Aufwrmen, ohne Zhlung                */
+  for (uRun = 0; uRun < HOSTBENCH_BATCH; ++uRun)
+  {
+    pCase->pfnRun();
+  }
+  
+  pResult->ulOps = 0;
+  pResult->dMin = 1e30;
+  ulHostBenchAllocs = 0;
+  iHostBenchArmed = 1;
+  while (dTotal < dTime)
+  {
+    dStart = HostBench_Now();
+    for (uRun = 0; uRun < HOSTBENCH_BATCH; ++uRun)
+    {
+      pCase->pfnRun();
+    }
+    dBatch = HostBench_Now() - dStart;
+    
+    dTotal += dBatch;
+    pResult->ulOps += HOSTBENCH_BATCH;
+    if (dBatch / HOSTBENCH_BATCH < pResult->dMin)
+    {
+      pResult->dMin = dBatch / HOSTBENCH_BATCH;
+    }
+  }
+  iHostBenchArmed = 0;
+  pResult->ulAllocs = ulHostBenchAllocs;
+  pResult->dMean = dTotal / pResult->ulOps;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Ersatz fr malloc(), zhlt whrend der Messung
+ *
+ * @param[in] size      Gre
+ * @return    void*     Speicher
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void* malloc(size_t size)
+{
+  ulHostBenchAllocs += iHostBenchArmed;
+  return __libc_malloc(size);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ersatz fr calloc(), zhlt whrend der Messung
+ *
+ * @param[in] nmemb     Anzahl
+ * @param[in] size      Gre eines Elements
+ * @return    void*     Speicher
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void* calloc(size_t nmemb, size_t size)
+{
+  ulHostBenchAllocs += iHostBenchArmed;
+  return __libc_calloc(nmemb, size);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ersatz fr realloc(), zhlt whrend der Messung
+ *
+ * @param[in] ptr       Bisheriger Speicher
+ * @param[in] size      Neue Gre
+ * @return    void*     Speicher
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void* realloc(void* ptr, size_t size)
+{
+  ulHostBenchAllocs += iHostBenchArmed;
+  return __libc_realloc(ptr, size);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ersatz fr free()
+ *
+ * @param[in] ptr       Speicher
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void free(void* ptr)
+{
+  __libc_free(ptr);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Alle Flle messen und als JSON ausgeben
+ *
+ * @param[in] argc      Anzahl Argumente
+ * @param[in] argv      Argumente
+ * @return    int       0, wenn kein Fall Speicher anfordert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+  static const HostBench_Case asCases[] = {
+    {"BMECALC", HostBench_BmeCalc},
+    {"AZIM",    HostBench_Azim},
+    {"WIND",    HostBench_Wind},
+    {"SUNPOS",  HostBench_SunPos},
+    {"NMEA",    HostBench_Nmea},
+    {"CSV",     HostBench_Csv},
+    {"SPRINTF", HostBench_Sprintf},
+    {"BIN",     HostBench_Bin},
+    {"PACK",    HostBench_Pack},
+    {"ATCMD",   HostBench_AtCmd}
+  };
+  const unsigned uNum = sizeof(asCases) / sizeof(asCases[0]);
+  HostBench_Result sResult;
+  const char* pszJson = NULL;
+  unsigned long ulTimeMs = HOSTBENCH_TIME_MS;
+  unsigned long ulAllocs = 0;
+  FILE* pJson = stdout;
+  unsigned uIdx;
+  int iArg;
+  
+  for (iArg = 1; iArg < argc; ++iArg)
+  {
+    if ((strcmp(argv[iArg], "--json") == 0) && (iArg + 1 < argc))
+    {
+      pszJson = argv[++iArg];
+    }
+    else if ((strcmp(argv[iArg], "--time") == 0) && (iArg + 1 < argc))
+    {
+      ulTimeMs = strtoul(argv[++iArg], NULL, 10);
+    }
+    else
+    {
+      fprintf(stderr, "Aufruf: hostbench [--json DATEI] [--time MS]\n");
+      return 1;
+    }
+  }
+  if (pszJson != NULL)
+  {
+    pJson = fopen(pszJson, "w");
+    if (pJson == NULL)
+    {
+      fprintf(stderr, "%s: kann nicht angelegt werden\n", pszJson);
+      return 1;
+    }
+  }
+  
+  HostBench_Init();
+  
+  /* Der AT-Befehl muss beantwortet werden, sonst misst   *
+   * ATCMD nur den Fehlerpfad                             */
+  HostBench_AtCmd();
+  if (strstr(acHostBenchTx, "+CLOGFMT: ") != acHostBenchTx)
+  {
+    fprintf(stderr, "%s: keine Antwort (%s)\n", szHostBenchAt,
+      acHostBenchTx);
+    return 1;
+  }
+  HostUsart_SetSink(HostUsart_1, NULL);
+  
+  fprintf(pJson, "{\n  \"unit\": \"ns/op\",\n  \"cases\": [\n");
+  for (uIdx = 0; uIdx < uNum; ++uIdx)
+  {
+    HostBench_Run(&asCases[uIdx], ulTimeMs * 1e6, &sResult);
+    ulAllocs += sResult.ulAllocs;
+    fprintf(stderr, "%-8s %10.1f ns/op (min %.1f, %lu Aufrufe)%s\n",
+      asCases[uIdx].pszName, sResult.dMean, sResult.dMin, sResult.ulOps,
+      (sResult.ulAllocs != 0) ? " SPEICHERANFORDERUNG" : "");
+    fprintf(pJson, "    {\"name\": \"%s\", \"ops\": %lu, \"ns_per_op\": %.2f, "
+      "\"ns_min\": %.2f, \"allocs\": %lu}%s\n",
+      asCases[uIdx].pszName, sResult.ulOps, sResult.dMean, sResult.dMin,
+      sResult.ulAllocs, (uIdx + 1 < uNum) ? "," : "");
+  }
+  fprintf(pJson, "  ]\n}\n");
+  if (pJson != stdout)
+  {
+    fclose(pJson);
+  }
+  return (ulAllocs == 0) ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+/*!****************************************************************************
+ * @file
+ * HostFmtRef.c
+ *
+ * Protokollzeile (frher Logger_WriteCsv()) und Zeile der Wertetabelle
+ * (frher AT_SendGuiItem()) mit den damaligen Formatstrings. Auf dem Host
+ * ist int 32 Bit und long 64 Bit breit, die Argumente werden deshalb auf
+ * die Breite umgewandelt, mit der Cosmic sie gelesen hat: %d als int16_t,
+ * %u als uint16_t, %ld als int32_t.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+#include "HostFmtRef.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Argument fr %d, %u und %ld wie mit 16-Bit-int und 32-Bit-long            */
+#define HOSTFMTREF_D(x)         ((int)(int16_t)(x))
+#define HOSTFMTREF_U(x)         ((unsigned)(uint16_t)(x))
+#define HOSTFMTREF_LD(x)        ((long)(int32_t)(x))
+#define HOSTFMTREF_LU(x)        ((unsigned long)(uint32_t)(x))
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Protokollzeile abschnittsweise mit sprintf() formatieren
+ *
+ * @param[in] *pLog     Eintrag
+ * @param[out] *pcDest  Zeile mit Abschluss, HOSTFMTREF_MAX Zeichen
+ * @return    unsigned  Lnge ohne Abschluss
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+unsigned HostFmtRef_Csv(const SensorLogItem* pLog, char* pcDest)
+{
+  int iLen;
+  
+  iLen = sprintf(pcDest, "%04d-%02d-%02dT%02d:%02d:%02dZ,",
+    HOSTFMTREF_D(pLog->sTimestamp.sDate.RTC_Year + 2000),
+    HOSTFMTREF_D(pLog->sTimestamp.sDate.RTC_Month),
+    HOSTFMTREF_D(pLog->sTimestamp.sDate.RTC_Date),
+    HOSTFMTREF_D(pLog->sTimestamp.sTime.RTC_Hours),
+    HOSTFMTREF_D(pLog->sTimestamp.sTime.RTC_Minutes),
+    HOSTFMTREF_D(pLog->sTimestamp.sTime.RTC_Seconds)
+  );
+  iLen += sprintf(pcDest + iLen, "%d,%d,%d,%d,",
+    HOSTFMTREF_D(pLog->sTemperature.iBME),
+    HOSTFMTREF_D(pLog->sTemperature.iCPU),
+    HOSTFMTREF_D(pLog->sTemperature.iQMC),
+    HOSTFMTREF_D(pLog->sTemperature.iMPU)
+  );
+  iLen += sprintf(pcDest + iLen, "%ld,%ld,",
+    HOSTFMTREF_LD(pLog->ulPressure),
+    HOSTFMTREF_LD(pLog->ulHumidity)
+  );
+  iLen += sprintf(pcDest + iLen, "%d,%d,%d,%d,",
+    HOSTFMTREF_D(pLog->sWind.uiDir),
+    HOSTFMTREF_D(pLog->sWind.uiVelo),
+    HOSTFMTREF_D(pLog->sAlignment.uiAzimuth),
+    HOSTFMTREF_D(pLog->sAlignment.iZenith)
+  );
+  iLen += sprintf(pcDest + iLen, "%ld,%ld,%d,",
+    HOSTFMTREF_LD(pLog->sPosition.lLat),
+    HOSTFMTREF_LD(pLog->sPosition.lLong),
+    HOSTFMTREF_D(pLog->sPosition.iAlt)
+  );
+  iLen += sprintf(pcDest + iLen, "%d,%d,%d,%d,",
+    HOSTFMTREF_D(pLog->sPower.uiBatVolt),
+    HOSTFMTREF_D(pLog->sPower.uiPanelVolt),
+    HOSTFMTREF_D(pLog->sPower.iBatCurr),
+    HOSTFMTREF_D(pLog->sPower.iPanelCurr)
+  );
+  iLen += sprintf(pcDest + iLen, "%d,%u,%u,%lu\r\n",
+    HOSTFMTREF_D(pLog->sEnergy.ucSoC),
+    HOSTFMTREF_U(pLog->sEnergy.uiBatIn),
+    HOSTFMTREF_U(pLog->sEnergy.uiBatOut),
+    HOSTFMTREF_LU(pLog->sEnergy.ulPvEnergy)
+  );
+  return (unsigned)iLen;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeile der Wertetabelle fr GUI abschnittsweise mit sprintf() formatieren
+ *
+ * @param[in] *pLog     Eintrag
+ * @param[out] *pcDest  Zeile mit Abschluss, HOSTFMTREF_MAX Zeichen
+ * @return    unsigned  Lnge ohne Abschluss
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+unsigned HostFmtRef_Gui(const SensorLogItem* pLog, char* pcDest)
+{
+  int iLen;
+  
+  iLen = sprintf(pcDest, "+CGUI: %02d,%02d,%02d,%02d,%02d,%02d,",
+    HOSTFMTREF_D(pLog->sTimestamp.sDate.RTC_Year),
+    HOSTFMTREF_D(pLog->sTimestamp.sDate.RTC_Month),
+    HOSTFMTREF_D(pLog->sTimestamp.sDate.RTC_Date),
+    HOSTFMTREF_D(pLog->sTimestamp.sTime.RTC_Hours),
+    HOSTFMTREF_D(pLog->sTimestamp.sTime.RTC_Minutes),
+    HOSTFMTREF_D(pLog->sTimestamp.sTime.RTC_Seconds)
+  );
+  iLen += sprintf(pcDest + iLen, "%d,%d,%d,%d,",
+    HOSTFMTREF_D(pLog->sTemperature.iBME),
+    HOSTFMTREF_D(pLog->sTemperature.iCPU),
+    HOSTFMTREF_D(pLog->sTemperature.iQMC),
+    HOSTFMTREF_D(pLog->sTemperature.iMPU)
+  );
+  iLen += sprintf(pcDest + iLen, "%d,%d,",
+    HOSTFMTREF_D(pLog->sWind.uiDir),
+    HOSTFMTREF_D(pLog->sWind.uiVelo)
+  );
+  iLen += sprintf(pcDest + iLen, "%ld,%ld,%d,%d,",
+    HOSTFMTREF_LD(pLog->ulHumidity),
+    HOSTFMTREF_LD(pLog->ulPressure),
+    HOSTFMTREF_D(pLog->sAlignment.iZenith),
+    HOSTFMTREF_D(pLog->sAlignment.uiAzimuth)
+  );
+  iLen += sprintf(pcDest + iLen, "%ld,%ld,%d,",
+    HOSTFMTREF_LD(pLog->sPosition.lLat),
+    HOSTFMTREF_LD(pLog->sPosition.lLong),
+    HOSTFMTREF_D(pLog->sPosition.iAlt)
+  );
+  iLen += sprintf(pcDest + iLen, "%d,%d,%d,%d,%d\r\n",
+    HOSTFMTREF_D(pLog->sPower.uiBatVolt / 10),
+    HOSTFMTREF_D(pLog->sPower.iBatCurr / 10),
+    HOSTFMTREF_D(pLog->sPower.uiPanelVolt / 10),
+    HOSTFMTREF_D(pLog->sPower.iPanelCurr / 10),
+    330
+  );
+  return (unsigned)iLen;
+}
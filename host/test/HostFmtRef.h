@@ -0,0 +1,29 @@
+/*!****************************************************************************
+ * @file
+ * HostFmtRef.h
+ *
+ * Bezug fr die Formatierung ohne Formatstring: Protokollzeile und Zeile
+ * der Wertetabelle fr GUI mit sprintf() wie vor NumFmt, Zeichen fr
+ * Zeichen so, wie sie Cosmic mit 16-Bit-int ausgegeben hat.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOSTFMTREF_H_
+#define HOSTFMTREF_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include "SensorLog.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Grte Lnge einer Zeile mit Abschluss                                    */
+#define HOSTFMTREF_MAX          256
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+unsigned HostFmtRef_Csv(const SensorLogItem* pLog, char* pcDest);
+unsigned HostFmtRef_Gui(const SensorLogItem* pLog, char* pcDest);
+
+#endif /* HOSTFMTREF_H_ */
@@ -0,0 +1,59 @@
+/*!****************************************************************************
+ * @file
+ * HostTest.h
+ *
+ * Prfmakros der Host-Tests. Ein Test ist ein eigenes Programm, das bei
+ * einem Fehler Datei, Zeile und Bedingung ausgibt und mit einem
+ * Rckgabewert ungleich 0 endet (ctest).
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef HOSTTEST_H_
+#define HOSTTEST_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Bedingung prfen, bei Fehler Meldung und Zhler                           */
+#define HOSTTEST_CHECK(cond)                                                  \
+  do                                                                          \
+  {                                                                           \
+    ++uiHostTestChecks;                                                       \
+    if (!(cond))                                                              \
+    {                                                                         \
+      fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond);              \
+      ++uiHostTestFails;                                                      \
+    }                                                                         \
+  } while (0)
+
+/*! Abweichung prfen, bei Fehler mit Ist- und Sollwert                       */
+#define HOSTTEST_NEAR(act, ref, tol)                                          \
+  do                                                                          \
+  {                                                                           \
+    double dAct_ = (double)(act);                                             \
+    double dRef_ = (double)(ref);                                             \
+    ++uiHostTestChecks;                                                       \
+    if ((dAct_ - dRef_ > (tol)) || (dRef_ - dAct_ > (tol)))                   \
+    {                                                                         \
+      fprintf(stderr, "%s:%d: %s = %g, erwartet %g +- %g\n", __FILE__,        \
+        __LINE__, #act, dAct_, dRef_, (double)(tol));                         \
+      ++uiHostTestFails;                                                      \
+    }                                                                         \
+  } while (0)
+
+/*! Ergebnis ausgeben, Rckgabewert fr main()                                */
+#define HOSTTEST_RESULT()                                                     \
+  (printf("%u Prfungen, %u Fehler\n", uiHostTestChecks, uiHostTestFails),   \
+    (uiHostTestFails == 0) ? 0 : 1)
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Anzahl Prfungen und Fehler des Testprogramms                             */
+static unsigned uiHostTestChecks;
+static unsigned uiHostTestFails;
+
+#endif /* HOSTTEST_H_ */
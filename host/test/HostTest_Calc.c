@@ -0,0 +1,258 @@
+/*!****************************************************************************
+ * @file
+ * HostTest_Calc.c
+ *
+ * Test der Umrechnungen der Firmware gegen Referenzformeln: Kompensation
+ * des BME280 (Gleitkommaformeln aus dem Datenblatt), Azimut des QMC5883,
+ * Neigung und Temperatur des MPU6050 und Sonnenstand.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <math.h>
+#include "HostTest.h"
+#include "sensorlib_bme280.h"
+#include "sensorlib_bme280_internal.h"
+#include "sensorlib_qmc5883.h"
+#include "sensorlib_qmc5883_internal.h"
+#include "sensorlib_mpu6050.h"
+#include "sensorlib_mpu6050_internal.h"
+#include "SolarTracking_Internal.h"
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Kalibrierwerte aus dem Beispiel des Datenblatts setzen
+ *
+ * @param[out] pSensor  Sensor
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_BmeCalib(BME280_Sensor* pSensor)
+{
+  pSensor->sCalib.uiDigT1 = 27504;
+  pSensor->sCalib.iDigT2 = 26435;
+  pSensor->sCalib.iDigT3 = -1000;
+  pSensor->sCalib.uiDigP1 = 36477;
+  pSensor->sCalib.iDigP2 = -10685;
+  pSensor->sCalib.iDigP3 = 3024;
+  pSensor->sCalib.iDigP4 = 2855;
+  pSensor->sCalib.iDigP5 = 140;
+  pSensor->sCalib.iDigP6 = -7;
+  pSensor->sCalib.iDigP7 = 15500;
+  pSensor->sCalib.iDigP8 = -14600;
+  pSensor->sCalib.iDigP9 = 6000;
+  pSensor->sCalib.ucDigH1 = 75;
+  pSensor->sCalib.iDigH2 = 362;
+  pSensor->sCalib.ucDigH3 = 0;
+  pSensor->sCalib.iDigH4 = 313;
+  pSensor->sCalib.iDigH5 = 50;
+  pSensor->sCalib.cDigH6 = 30;
+}
+
+/*!****************************************************************************
+ * @brief
+ * BME280: Festkommarechnung der Firmware gegen die Gleitkommaformeln des
+ * Datenblatts ber den Arbeitsbereich
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Bme280(void)
+{
+  BME280_Sensor sSensor;
+  const BME280_Sensor* pS = &sSensor;
+  uint32_t ulAdcT;
+  uint32_t ulAdcP;
+  uint32_t ulAdcH;
+  double dFine;
+  double dVar1;
+  double dVar2;
+  double dRef;
+  
+  HostTest_BmeCalib(&sSensor);
+  
+  /* Beispiel des Datenblatts: 25.08 C                   */
+  sSensor.sRaw.ulRawTemp = 519888;
+  HOSTTEST_CHECK(BME280_CalcTemp(&sSensor) == 2508);
+  HOSTTEST_CHECK(sSensor.sRaw.lTfine == 128422);
+  
+  for (ulAdcT = 420000; ulAdcT <= 600000; ulAdcT += 20000)
+  {
+    dVar1 = (ulAdcT / 16384.0 - pS->sCalib.uiDigT1 / 1024.0)
+      * pS->sCalib.iDigT2;
+    dVar2 = (ulAdcT / 131072.0 - pS->sCalib.uiDigT1 / 8192.0)
+      * (ulAdcT / 131072.0 - pS->sCalib.uiDigT1 / 8192.0)
+      * pS->sCalib.iDigT3;
+    dFine = dVar1 + dVar2;
+    sSensor.sRaw.ulRawTemp = ulAdcT;
+    HOSTTEST_NEAR(BME280_CalcTemp(&sSensor), dFine / 51.2, 1.0);
+    
+    for (ulAdcP = 250000; ulAdcP <= 500000; ulAdcP += 25000)
+    {
+      dVar1 = sSensor.sRaw.lTfine / 2.0 - 64000.0;
+      dVar2 = dVar1 * dVar1 * pS->sCalib.iDigP6 / 32768.0;
+      dVar2 += dVar1 * pS->sCalib.iDigP5 * 2.0;
+      dVar2 = dVar2 / 4.0 + pS->sCalib.iDigP4 * 65536.0;
+      dVar1 = (pS->sCalib.iDigP3 * dVar1 * dVar1 / 524288.0
+        + pS->sCalib.iDigP2 * dVar1) / 524288.0;
+      dVar1 = (1.0 + dVar1 / 32768.0) * pS->sCalib.uiDigP1;
+      dRef = 1048576.0 - ulAdcP;
+      dRef = (dRef - dVar2 / 4096.0) * 6250.0 / dVar1;
+      dVar1 = pS->sCalib.iDigP9 * dRef * dRef / 2147483648.0;
+      dVar2 = dRef * pS->sCalib.iDigP8 / 32768.0;
+      dRef += (dVar1 + dVar2 + pS->sCalib.iDigP7) / 16.0;
+      if ((dRef < 30000.0) || (dRef > 110000.0))
+      {
+        continue;
+      }
+      sSensor.sRaw.ulRawPress = ulAdcP;
+      HOSTTEST_NEAR(BME280_CalcPress(&sSensor), dRef, 5.0);
+    }
+    
+    for (ulAdcH = 20000; ulAdcH <= 45000; ulAdcH += 2500)
+    {
+      dVar1 = sSensor.sRaw.lTfine - 76800.0;
+      dRef = (ulAdcH - (pS->sCalib.iDigH4 * 64.0
+        + pS->sCalib.iDigH5 / 16384.0 * dVar1))
+        * (pS->sCalib.iDigH2 / 65536.0 * (1.0 + pS->sCalib.cDigH6
+          / 67108864.0 * dVar1 * (1.0 + pS->sCalib.ucDigH3 / 67108864.0
+            * dVar1)));
+      dRef = dRef * (1.0 - pS->sCalib.ucDigH1 * dRef / 524288.0);
+      dRef = (dRef < 0.0) ? 0.0 : ((dRef > 100.0) ? 100.0 : dRef);
+      sSensor.sRaw.uiRawHum = (uint16_t)ulAdcH;
+      HOSTTEST_NEAR(BME280_CalcHum(&sSensor) / 1024.0, dRef, 0.1);
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * QMC5883: Azimut ber den Vollkreis mit Offset und Verstrkung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Qmc5883(void)
+{
+  QMC5883_Sensor sSensor;
+  int16_t iHeading;
+  double dAngle;
+  int iDiff;
+  
+  sSensor.sCalib.fXComp = -1140.0f;
+  sSensor.sCalib.fYComp = -830.0f;
+  sSensor.sCalib.fXGain = 0.8921f;
+  sSensor.sCalib.fYGain = 0.7746f;
+  for (iHeading = 0; iHeading < 3600; iHeading += 75)
+  {
+    dAngle = (iHeading - 900) / 573.0;
+    sSensor.sRaw.iRawX = (int16_t)lround(2000.0 * sin(dAngle) / 0.8921
+      - 1140.0);
+    sSensor.sRaw.iRawY = (int16_t)lround(2000.0 * cos(dAngle) / 0.7746
+      - 830.0);
+    iDiff = (QMC5883_CalcAzimuth(&sSensor) - iHeading + 5400) % 3600 - 1800;
+    HOSTTEST_NEAR(iDiff, 0, 3);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * MPU6050: Neigung aus der Schwerkraft und Temperatur
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Mpu6050(void)
+{
+  MPU6050_Sensor sSensor;
+  int16_t iTilt;
+  int16_t iTemp;
+  
+  sSensor.sRaw.iRawX = 0;
+  for (iTilt = 0; iTilt <= 900; iTilt += 30)
+  {
+    sSensor.sRaw.iRawY = (int16_t)lround(16384.0 * cos(iTilt / 573.0));
+    sSensor.sRaw.iRawZ = (int16_t)lround(16384.0 * sin(iTilt / 573.0));
+    HOSTTEST_NEAR(MPU6050_CalcAngle(&sSensor, false), iTilt, 2);
+  }
+  
+  /* Datenblatt: 340 LSB/K, 35 C bei -521 LSB            */
+  for (iTemp = -2000; iTemp <= 6000; iTemp += 500)
+  {
+    sSensor.sRaw.iRawTemp = (int16_t)lround((iTemp - 3500) * 3.4 - 521);
+    HOSTTEST_NEAR(MPU6050_CalcTemp(&sSensor), iTemp, 1);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sonnenstand: tiefster Zenitwinkel des Tages im Sden, zur Sonnenwende
+ * 90 - Breite + 23.44, zur Tag-und-Nacht-Gleiche 90 - Breite
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_SunPos(void)
+{
+  static const struct {
+    uint8_t ucMonth;
+    uint8_t ucDay;
+    double dDecl;
+  } asDays[] = {
+    {6, 21, 23.44},
+    {3, 20, -0.05},
+    {12, 21, -23.44}
+  };
+  const double dLat = 48.137;
+  const double dLon = 11.575;
+  double dHour;
+  double dAzim;
+  double dZen;
+  double dMinZen;
+  double dMinAzim;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < sizeof(asDays) / sizeof(asDays[0]); ++ucIdx)
+  {
+    dMinZen = 180.0;
+    dMinAzim = 0.0;
+    for (dHour = 9.0; dHour < 14.0; dHour += 1.0 / 60.0)
+    {
+      calculate_current_sun_position(2026, asDays[ucIdx].ucMonth,
+        asDays[ucIdx].ucDay, dHour, 0, dLat, dLon, &dAzim, &dZen);
+      if (dZen < dMinZen)
+      {
+        dMinZen = dZen;
+        dMinAzim = dAzim;
+      }
+    }
+    HOSTTEST_NEAR(dMinZen, dLat - asDays[ucIdx].dDecl, 0.3);
+    HOSTTEST_NEAR(dMinAzim, 180.0, 3.0);
+  }
+  
+  /* Vormittags im Osten, nachmittags im Westen           */
+  calculate_current_sun_position(2026, 6, 21, 7.0, 0, dLat, dLon, &dAzim,
+    &dZen);
+  HOSTTEST_CHECK((dAzim > 90.0) && (dAzim < 150.0));
+  calculate_current_sun_position(2026, 6, 21, 16.0, 0, dLat, dLon, &dAzim,
+    &dZen);
+  HOSTTEST_CHECK((dAzim > 220.0) && (dAzim < 290.0));
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Alle Umrechnungen prfen
+ *
+ * @return    int       0 ohne Fehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(void)
+{
+  HostTest_Bme280();
+  HostTest_Qmc5883();
+  HostTest_Mpu6050();
+  HostTest_SunPos();
+  return HOSTTEST_RESULT();
+}
@@ -0,0 +1,511 @@
+/*!****************************************************************************
+ * @file
+ * HostTest_Crash.c
+ *
+ * Spannungsausfall beim Protokollieren: dieselbe Folge von Eintrgen wird
+ * fr jedes Format und jede Einstellung des Schreibpuffers einmal ohne
+ * Ausfall und dann fr jeden Schreibvorgang auf Karte oder EEPROM einmal mit
+ * Ausfall genau bei diesem Vorgang geschrieben (halber Sektor bzw. halbes
+ * Wort). Danach startet die Firmware mit Karte und EEPROM neu, Logger_Init()
+ * repariert das Ende der Datei und die restlichen Eintrge folgen.
+ *
+ * Jeder Durchlauf luft in einem eigenen Prozess (fork), wie ein Neustart
+ * mit leerem RAM. Die Tagesdatei jedes Durchlaufs wird als
+ * <Fall>_<Vorgang>.<Endung> in das Verzeichnis geschrieben, die Liste
+ * crash.lst nennt dazu den Eintrag, bei dem die Versorgung ausfiel, und fr
+ * den Durchlauf ohne Ausfall, wie viele Eintrge bis einschlielich des
+ * unterbrochenen verloren gehen drfen: die seit dem letzten f_sync, also
+ * hchstens <syncage> / HOSTTEST_STEP, und der unterbrochene. Der Test
+ * crash_check wertet die Dateien mit tools/log_decode.py aus
+ * (host/test/check_crash.py).
+ *
+ * Aufruf:
+ *   hosttest_crash VERZEICHNIS [FALL [VORGANG]]
+ *
+ * Mit FALL nur dieser Fall, mit VORGANG nur der Ausfall bei diesem
+ * Schreibvorgang; SD-Abbild und EEPROM bleiben danach zur Untersuchung im
+ * Verzeichnis (crash.img, crash.eep).
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "HostTest.h"
+#include "HostHal.h"
+#include "HostSim.h"
+#include "io_map.h"
+#include "ff.h"
+#include "Scheduler.h"
+#include "Deferred.h"
+#include "powerlib.h"
+#include "SensorLog.h"
+#include "Logger.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! 21.06.2026 00:00:00 in Sekunden seit dem 01.01.2000                       */
+#define HOSTTEST_START          835315200UL
+
+/*! Anzahl Eintrge je Durchlauf                                              */
+#define HOSTTEST_ITEMS          100u
+
+/*! Messintervall in s                                                        */
+#define HOSTTEST_STEP           120u
+
+/*! Rckgabewert eines Durchlaufs, der mit dem Ausfall endet                  */
+#define HOSTTEST_CUT            4
+
+/*! Maximale Lnge eines Dateipfads                                           */
+#define HOSTTEST_PATH_MAX       256
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Format und Einstellungen eines Falls
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostTest_Case {
+  /*! Name, Anfang der Dateinamen                         */
+  const char* pszName;
+  
+  /*! Format                                              */
+  Logger_Format eFormat;
+  
+  /*! Einstellungen wie AT+CLOGBUF und AT+CLOGPRE         */
+  uint16_t uiMaxFill;
+  uint16_t uiSyncAge;
+  uint16_t uiPrealloc;
+} HostTest_Case;
+
+/*!****************************************************************************
+ * @brief
+ * Zwischen den Prozessen geteilter Zustand
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostTest_Shared {
+  /*! Eintrag, der gerade geschrieben wird                */
+  uint16_t uiItem;
+  
+  /*! Schreibvorgnge eines Durchlaufs ohne Ausfall       */
+  uint32_t ulWrites;
+} HostTest_Shared;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Flle: Werkseinstellung, frh geschriebene Sektoren mit f_sync nach jedem
+ * Eintrag, vorbelegte Binrdatei                                             */
+static const HostTest_Case asHostTestCases[] = {
+  {"CSV",  Logger_Format_CSV, LOGGER_SECTOR_SIZE, 600, 0},
+  {"CSVS", Logger_Format_CSV, 120,                0,   0},
+  {"BIN",  Logger_Format_BIN, LOGGER_SECTOR_SIZE, 600, 0},
+  {"BINS", Logger_Format_BIN, 120,                0,   0},
+  {"BINP", Logger_Format_BIN, LOGGER_SECTOR_SIZE, 600, 64},
+  {"PAK",  Logger_Format_PAK, LOGGER_SECTOR_SIZE, 600, 0},
+  {"PAKS", Logger_Format_PAK, 120,                0,   0}
+};
+
+/*! Endung der Tagesdatei je Format                                           */
+static const char* const apszHostTestExt[Logger_Format_NUM] = {
+  "TXT", "BIN", "PAK"
+};
+
+/*! Dateisystem der Karte                                                     */
+static FATFS sHostTestFs;
+
+/*! Geteilter Zustand (mmap)                                                  */
+static HostTest_Shared* pHostTestShared;
+
+/*! Ausgabeverzeichnis, SD-Abbild und Datei des EEPROMs                       */
+static const char* pszHostTestDir;
+static char acHostTestImage[HOSTTEST_PATH_MAX];
+static char acHostTestEeprom[HOSTTEST_PATH_MAX];
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Eintrag der Folge bilden, nur von der Nummer abhngig
+ *
+ * @param[in] uIdx      Nummer des Eintrags
+ * @param[out] *pLog    Eintrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Item(unsigned uIdx, SensorLogItem* pLog)
+{
+  uint32_t ulSec = uIdx * HOSTTEST_STEP;
+  
+  memset(pLog, 0, sizeof(*pLog));
+  pLog->sTimestamp.sDate.RTC_Year = 26;
+  pLog->sTimestamp.sDate.RTC_Month = RTC_Month_June;
+  pLog->sTimestamp.sDate.RTC_Date = 21;
+  pLog->sTimestamp.sTime.RTC_Hours = (uint8_t)(ulSec / 3600);
+  pLog->sTimestamp.sTime.RTC_Minutes = (uint8_t)(ulSec / 60 % 60);
+  pLog->sTimestamp.sTime.RTC_Seconds = (uint8_t)(ulSec % 60);
+  pLog->sTemperature.iBME = (int16_t)(1520 + uIdx % 7);
+  pLog->sTemperature.iCPU = 2100;
+  pLog->ulPressure = 95210 + uIdx / 10;
+  pLog->ulHumidity = 55000 + uIdx;
+  pLog->sWind.uiVelo = (uint16_t)(uIdx * 37 % 300);
+  pLog->sPosition.lLat = 48137000;
+  pLog->sPosition.lLong = 11575000;
+  pLog->sPosition.iAlt = 520;
+  pLog->sPower.uiBatVolt = 3900;
+  pLog->sEnergy.ucSoC = 80;
+  pLog->sEnergy.ulPvEnergy = uIdx * 13;
+  pLog->ucStatus = SENSORLOG_STATUS_POS | SENSORLOG_STATUS_ALT;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Versorgung ausgefallen: Prozess ohne weitere Schreibvorgnge beenden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Cut(void)
+{
+  _exit(HOSTTEST_CUT);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Simulation, SD-Karte und EEPROM wie nach dem Einschalten aufsetzen und
+ * das Protokoll starten
+ *
+ * @param[in] bNew      Leere Karte und leeres EEPROM
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Start(bool bNew)
+{
+  RTC_AlarmTypeDef sAlarm;
+  int iFd;
+  
+  if (bNew)
+  {
+    unlink(acHostTestImage);
+    unlink(acHostTestEeprom);
+  }
+  sHostSimCfg.bQuiet = true;
+  HostCore_Init(0);
+  HostHal_Init();
+  HostRtc_Start(HOSTTEST_START, 0);
+  if (!HostSd_Init(acHostTestImage))
+  {
+    HostCore_Fatal("%s: Abbild nicht nutzbar", acHostTestImage);
+  }
+  
+  /* EEPROM laden und durchschreiben                      */
+  iFd = open(acHostTestEeprom, O_RDWR | O_CREAT, 0644);
+  if ((iFd < 0) || (ftruncate(iFd, HOSTHAL_EEPROM_SIZE) != 0)
+    || (pread(iFd, aucHostEeprom, HOSTHAL_EEPROM_SIZE, 0)
+      != HOSTHAL_EEPROM_SIZE))
+  {
+    HostCore_Fatal("%s: EEPROM nicht nutzbar", acHostTestEeprom);
+  }
+  HostFlash_SetBacking(iFd);
+  Sched_Init(NULL, 0);
+  
+  /* Timer 1 und Alarm A wie in hosttest_pack             */
+  CLK_SYSCLKSourceConfig(CLK_SYSCLKSource_HSI);
+  CLK_SYSCLKDivConfig(CLK_SYSCLKDiv_1);
+  Deferred_Init();
+  CLK_PeripheralClockConfig(CLK_Peripheral_RTC, ENABLE);
+  RTC_AlarmStructInit(&sAlarm);
+  sAlarm.RTC_AlarmMask = RTC_AlarmMask_All;
+  RTC_SetAlarm(RTC_Format_BIN, &sAlarm);
+  RTC_ITConfig(RTC_IT_ALRA, ENABLE);
+  RTC_AlarmCmd(ENABLE);
+  LowPower_Init();
+  enableInterrupts();
+  
+  /* SPI und SD-Karte wie in main()                       */
+  GPIO_Init(SPI2_PORT, SPI2_SCK_PIN, GPIO_Mode_Out_PP_Low_Fast);
+  GPIO_Init(SPI2_PORT, SPI2_MOSI_PIN, GPIO_Mode_Out_PP_Low_Fast);
+  GPIO_Init(SPI2_PORT, SPI2_MISO_PIN, GPIO_Mode_In_PU_No_IT);
+  GPIO_Init(SD_CS_PORT, SD_CS_PIN, GPIO_Mode_Out_PP_High_Fast);
+  CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, ENABLE);
+  SPI_Init(SPI2, SPI_FirstBit_MSB, SPI_BaudRatePrescaler_64, SPI_Mode_Master,
+    SPI_CPOL_Low, SPI_CPHA_1Edge, SPI_Direction_2Lines_FullDuplex,
+    SPI_NSS_Soft, 0);
+  SPI_Cmd(SPI2, ENABLE);
+  CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, DISABLE);
+  if (f_mount(&sHostTestFs, "", 0) != FR_OK)
+  {
+    HostCore_Fatal("f_mount");
+  }
+  Logger_Init();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrge im Messintervall anhngen
+ *
+ * @param[in] uFrom     Erster Eintrag
+ * @return    bool      true, wenn alle Eintrge angenommen wurden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostTest_Append(unsigned uFrom)
+{
+  SensorLogItem sLog;
+  unsigned uIdx;
+  unsigned uSec;
+  bool bOk = true;
+  
+  for (uIdx = uFrom; uIdx < HOSTTEST_ITEMS; ++uIdx)
+  {
+    /* Sekundenzhler fr Hchstalter und Pufferdurchlauf */
+    for (uSec = 0; uSec < HOSTTEST_STEP; ++uSec)
+    {
+      Sched_Post(Sched_Event_SECOND);
+      Sched_Run();
+    }
+    pHostTestShared->uiItem = (uint16_t)uIdx;
+    HostTest_Item(uIdx, &sLog);
+    bOk = Logger_Append(&sLog) && bOk;
+  }
+  return Logger_Flush() && bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Tagesdatei aus dem Abbild in das Ausgabeverzeichnis kopieren
+ *
+ * @param[in] pCase     Fall
+ * @param[in] ulCut     Schreibvorgang mit Ausfall, 0: keiner
+ * @return    bool      true bei Erfolg
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostTest_Export(const HostTest_Case* pCase, uint32_t ulCut)
+{
+  char acPath[HOSTTEST_PATH_MAX];
+  char acName[LOGGER_NAME_SIZE];
+  uint8_t aucBuf[LOGGER_SECTOR_SIZE];
+  FILE* pOut;
+  FIL sFile;
+  UINT uiRead;
+  bool bOk = true;
+  
+  snprintf(acName, sizeof(acName), "LOG/260621.%s",
+    apszHostTestExt[pCase->eFormat]);
+  snprintf(acPath, sizeof(acPath), "%s/%s_%lu.%s", pszHostTestDir,
+    pCase->pszName, (unsigned long)ulCut, apszHostTestExt[pCase->eFormat]);
+  if (f_open(&sFile, acName, FA_READ) != FR_OK)
+  {
+    return false;
+  }
+  pOut = fopen(acPath, "wb");
+  if (pOut == NULL)
+  {
+    f_close(&sFile);
+    return false;
+  }
+  do
+  {
+    if (f_read(&sFile, aucBuf, sizeof(aucBuf), &uiRead) != FR_OK)
+    {
+      bOk = false;
+      break;
+    }
+    bOk = (fwrite(aucBuf, 1, uiRead, pOut) == uiRead) && bOk;
+  } while (uiRead == sizeof(aucBuf));
+  f_close(&sFile);
+  return (fclose(pOut) == 0) && bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Durchlauf von Anfang an, ggf. bis zum Ausfall (eigener Prozess)
+ *
+ * @param[in] pCase     Fall
+ * @param[in] ulCut     Schreibvorgang mit Ausfall, 0: keiner
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Run(const HostTest_Case* pCase, uint32_t ulCut)
+{
+  uint32_t ulFrom;
+  bool bOk;
+  
+  HostTest_Start(true);
+  Logger_SetFormat(pCase->eFormat);
+  Logger_SetPolicy(3600, pCase->uiMaxFill, pCase->uiSyncAge);
+  Logger_SetPrealloc(pCase->uiPrealloc);
+  ulFrom = ulHostWrites;
+  HostCore_SetPowerCut((ulCut != 0) ? (ulFrom + ulCut) : 0, HostTest_Cut);
+  bOk = HostTest_Append(0);
+  Logger_Close();
+  pHostTestShared->ulWrites = ulHostWrites - ulFrom;
+  bOk = HostTest_Export(pCase, 0) && bOk;
+  exit(bOk ? 0 : 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Neustart nach dem Ausfall: Wiederherstellung und restliche Eintrge
+ * (eigener Prozess)
+ *
+ * @param[in] pCase     Fall
+ * @param[in] ulCut     Schreibvorgang mit Ausfall
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Recover(const HostTest_Case* pCase, uint32_t ulCut)
+{
+  bool bOk;
+  
+  HostTest_Start(false);
+  bOk = HostTest_Append(pHostTestShared->uiItem + 1u);
+  Logger_Close();
+  bOk = HostTest_Export(pCase, ulCut) && bOk;
+  exit(bOk ? 0 : 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Durchlauf in einem eigenen Prozess ausfhren
+ *
+ * @param[in] pfnRun    Durchlauf
+ * @param[in] pCase     Fall
+ * @param[in] ulCut     Schreibvorgang mit Ausfall
+ * @return    int       Rckgabewert des Prozesses, -1 bei Abbruch
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int HostTest_Fork(void (*pfnRun)(const HostTest_Case*, uint32_t),
+  const HostTest_Case* pCase, uint32_t ulCut)
+{
+  pid_t iPid;
+  int iStatus;
+  
+  /* Gepufferte Ausgaben nicht im Kindprozess wiederholen */
+  fflush(NULL);
+  iPid = fork();
+  if (iPid == 0)
+  {
+    pfnRun(pCase, ulCut);
+  }
+  if ((iPid < 0) || (waitpid(iPid, &iStatus, 0) != iPid)
+    || !WIFEXITED(iStatus))
+  {
+    return -1;
+  }
+  return WEXITSTATUS(iStatus);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Alle Ausflle eines Falls durchspielen
+ *
+ * @param[in] pCase     Fall
+ * @param[in] pList     Liste crash.lst
+ * @param[in] ulOnly    Nur dieser Schreibvorgang, 0: alle
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Cuts(const HostTest_Case* pCase, FILE* pList,
+  uint32_t ulOnly)
+{
+  const char* pszExt = apszHostTestExt[pCase->eFormat];
+  uint32_t ulWrites;
+  uint32_t ulCut;
+  uint16_t uiItem;
+  int iRes;
+  
+  /* Bezug ohne Ausfall                                   */
+  iRes = HostTest_Fork(HostTest_Run, pCase, 0);
+  HOSTTEST_CHECK(iRes == 0);
+  if (iRes != 0)
+  {
+    return;
+  }
+  ulWrites = pHostTestShared->ulWrites;
+  fprintf(pList, "%s_0.%s - %u\n", pCase->pszName, pszExt,
+    pCase->uiSyncAge / HOSTTEST_STEP + 1);
+  
+  for (ulCut = 1; ulCut <= ulWrites; ++ulCut)
+  {
+    if ((ulOnly != 0) && (ulCut != ulOnly))
+    {
+      continue;
+    }
+    iRes = HostTest_Fork(HostTest_Run, pCase, ulCut);
+    HOSTTEST_CHECK(iRes == HOSTTEST_CUT);
+    if (iRes != HOSTTEST_CUT)
+    {
+      continue;
+    }
+    uiItem = pHostTestShared->uiItem;
+    iRes = HostTest_Fork(HostTest_Recover, pCase, ulCut);
+    HOSTTEST_CHECK(iRes == 0);
+    if (iRes == 0)
+    {
+      fprintf(pList, "%s_%lu.%s %u\n", pCase->pszName, (unsigned long)ulCut,
+        pszExt, uiItem);
+    }
+  }
+  printf("%s: %lu Ausflle\n", pCase->pszName, (unsigned long)ulWrites);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Alle Flle durchspielen und die Liste der Dateien schreiben
+ *
+ * @param[in] argc      Anzahl Argumente
+ * @param[in] argv      Argumente
+ * @return    int       0 ohne Fehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+  char acPath[HOSTTEST_PATH_MAX];
+  FILE* pList;
+  uint8_t ucIdx;
+  
+  if ((argc < 2) || (argc > 4))
+  {
+    fprintf(stderr, "Aufruf: hosttest_crash VERZEICHNIS [FALL [VORGANG]]\n");
+    return 2;
+  }
+  pszHostTestDir = argv[1];
+  snprintf(acHostTestImage, sizeof(acHostTestImage), "%s/crash.img",
+    pszHostTestDir);
+  snprintf(acHostTestEeprom, sizeof(acHostTestEeprom), "%s/crash.eep",
+    pszHostTestDir);
+  snprintf(acPath, sizeof(acPath), "%s/crash.lst", pszHostTestDir);
+  pList = fopen(acPath, "w");
+  pHostTestShared = mmap(NULL, sizeof(HostTest_Shared),
+    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if ((pList == NULL) || (pHostTestShared == MAP_FAILED))
+  {
+    fprintf(stderr, "%s: nicht beschreibbar\n", pszHostTestDir);
+    return 1;
+  }
+  
+  for (ucIdx = 0; ucIdx < sizeof(asHostTestCases) / sizeof(asHostTestCases[0]);
+    ++ucIdx)
+  {
+    if ((argc > 2) && (strcmp(argv[2], asHostTestCases[ucIdx].pszName) != 0))
+    {
+      continue;
+    }
+    HostTest_Cuts(&asHostTestCases[ucIdx], pList,
+      (argc > 3) ? strtoul(argv[3], NULL, 10) : 0);
+    fflush(pList);
+  }
+  fclose(pList);
+  return HOSTTEST_RESULT();
+}
@@ -0,0 +1,352 @@
+/*!****************************************************************************
+ * @file
+ * HostTest_Format.c
+ *
+ * Vergleich der Formatierung ohne Formatstring mit der frheren Ausgabe
+ * ber sprintf() (HostFmtRef.c): Logger_FormatCsv() direkt, die Zeilen von
+ * AT+CGUI? ber die simulierte USART1. Geprft werden Grenzwerte und
+ * Stellenwechsel jedes Felds sowie Zufallswerte aller Grenordnungen.
+ *
+ * Wie auf dem Zielsystem mit 16-Bit-int: vorzeichenlose 16-Bit-Felder, die
+ * frher mit %d ausgegeben wurden, bleiben bis 32767, Luftdruck und
+ * Luftfeuchte (%ld) bis 2^31 - 1. Darber gab sprintf() sie negativ aus,
+ * NumFmt gibt sie ohne Vorzeichen aus.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <string.h>
+#include "HostTest.h"
+#include "HostHal.h"
+#include "HostFmtRef.h"
+#include "SensorLog.h"
+#include "Logger.h"
+#include "commlib.h"
+#include "ATCmd.h"
+#include "Scheduler.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Anzahl Eintrge mit Zufallswerten                                         */
+#define HOSTTEST_RANDOM         200000UL
+
+/*! Jeder wievielte Block aus Zufallswerten auch ber AT+CGUI? geht           */
+#define HOSTTEST_GUI_EVERY      8
+
+/*! Hchstens ausgegebene Abweichungen                                        */
+#define HOSTTEST_REPORT         5
+
+/*! Gre der mitgeschriebenen Ausgabe von USART1                             */
+#define HOSTTEST_TX_MAX         (NUM_SENSORLOG_RINGITEMS * HOSTFMTREF_MAX + 16)
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Ausgabe von USART1                                                        */
+static char acHostTestTx[HOSTTEST_TX_MAX];
+static unsigned uHostTestTxPos;
+
+/*! Zustand des Zufallsgenerators                                             */
+static uint32_t ulHostTestRand = 0x2026A19UL;
+
+/*! Ausgegebene Abweichungen                                                  */
+static unsigned uHostTestReported;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Ausgabe von USART1 mitschreiben
+ *
+ * @param[in] ucByte    Gesendetes Zeichen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Tx(uint8_t ucByte)
+{
+  if (uHostTestTxPos < sizeof(acHostTestTx))
+  {
+    acHostTestTx[uHostTestTxPos++] = (char)ucByte;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zufallszahl (xorshift32), reproduzierbar
+ *
+ * @return    uint32_t  Zufallszahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostTest_Next(void)
+{
+  ulHostTestRand ^= ulHostTestRand << 13;
+  ulHostTestRand ^= ulHostTestRand >> 17;
+  ulHostTestRand ^= ulHostTestRand << 5;
+  return ulHostTestRand;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zufallszahl mit zuflliger Stellenzahl, damit kurze und lange Zahlen
+ * gleich oft vorkommen
+ *
+ * @return    uint32_t  Zufallszahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostTest_Any(void)
+{
+  return HostTest_Next() >> (HostTest_Next() % 32);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Vorzeichenbehaftete Zufallszahl mit zuflliger Stellenzahl
+ *
+ * @return    int32_t   Zufallszahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int32_t HostTest_AnySigned(void)
+{
+  uint32_t ulValue = HostTest_Any();
+  
+  return (HostTest_Next() & 1) ? (int32_t)(0UL - ulValue) : (int32_t)ulValue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag mit gltigem Zeitstempel und Zufallswerten fllen
+ *
+ * @param[out] *pLog    Eintrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Fill(SensorLogItem* pLog)
+{
+  memset(pLog, 0, sizeof(*pLog));
+  pLog->sTimestamp.sDate.RTC_Year = (uint8_t)(HostTest_Next() % 100);
+  pLog->sTimestamp.sDate.RTC_Month = (RTC_Month_TypeDef)(1 + HostTest_Next() % 12);
+  pLog->sTimestamp.sDate.RTC_Date = (uint8_t)(1 + HostTest_Next() % 31);
+  pLog->sTimestamp.sTime.RTC_Hours = (uint8_t)(HostTest_Next() % 24);
+  pLog->sTimestamp.sTime.RTC_Minutes = (uint8_t)(HostTest_Next() % 60);
+  pLog->sTimestamp.sTime.RTC_Seconds = (uint8_t)(HostTest_Next() % 60);
+  pLog->sTemperature.iBME = (int16_t)HostTest_AnySigned();
+  pLog->sTemperature.iCPU = (int16_t)HostTest_AnySigned();
+  pLog->sTemperature.iQMC = (int16_t)HostTest_AnySigned();
+  pLog->sTemperature.iMPU = (int16_t)HostTest_AnySigned();
+  pLog->ulPressure = HostTest_Any() & 0x7FFFFFFFUL;
+  pLog->ulHumidity = HostTest_Any() & 0x7FFFFFFFUL;
+  pLog->sWind.uiDir = (uint16_t)(HostTest_Any() & 0x7FFF);
+  pLog->sWind.uiVelo = (uint16_t)(HostTest_Any() & 0x7FFF);
+  pLog->sAlignment.uiAzimuth = (uint16_t)(HostTest_Any() & 0x7FFF);
+  pLog->sAlignment.iZenith = (int16_t)HostTest_AnySigned();
+  pLog->sPosition.lLat = HostTest_AnySigned();
+  pLog->sPosition.lLong = HostTest_AnySigned();
+  pLog->sPosition.iAlt = (int16_t)HostTest_AnySigned();
+  pLog->sPower.uiBatVolt = (uint16_t)(HostTest_Any() & 0x7FFF);
+  pLog->sPower.uiPanelVolt = (uint16_t)(HostTest_Any() & 0x7FFF);
+  pLog->sPower.iBatCurr = (int16_t)HostTest_AnySigned();
+  pLog->sPower.iPanelCurr = (int16_t)HostTest_AnySigned();
+  pLog->sEnergy.ucSoC = (uint8_t)HostTest_Next();
+  pLog->sEnergy.uiBatIn = (uint16_t)HostTest_Any();
+  pLog->sEnergy.uiBatOut = (uint16_t)HostTest_Any();
+  pLog->sEnergy.ulPvEnergy = HostTest_Any();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Alle Zahlenfelder auf denselben Wert setzen, begrenzt auf ihren
+ * Wertebereich wie in HostTest_Fill()
+ *
+ * @param[out] *pLog    Eintrag
+ * @param[in] lValue    Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_FillAll(SensorLogItem* pLog, int32_t lValue)
+{
+  int16_t iValue;
+  uint16_t uiValue;
+  uint32_t ulValue;
+  
+  iValue = (lValue > INT16_MAX) ? INT16_MAX
+    : ((lValue < INT16_MIN) ? INT16_MIN : (int16_t)lValue);
+  uiValue = (lValue < 0) ? 0 : ((lValue > INT16_MAX) ? INT16_MAX : (uint16_t)lValue);
+  ulValue = (lValue < 0) ? 0 : (uint32_t)lValue;
+  
+  pLog->sTemperature.iBME = iValue;
+  pLog->sTemperature.iCPU = iValue;
+  pLog->sTemperature.iQMC = iValue;
+  pLog->sTemperature.iMPU = iValue;
+  pLog->ulPressure = ulValue;
+  pLog->ulHumidity = ulValue;
+  pLog->sWind.uiDir = uiValue;
+  pLog->sWind.uiVelo = uiValue;
+  pLog->sAlignment.uiAzimuth = uiValue;
+  pLog->sAlignment.iZenith = iValue;
+  pLog->sPosition.lLat = lValue;
+  pLog->sPosition.lLong = lValue;
+  pLog->sPosition.iAlt = iValue;
+  pLog->sPower.uiBatVolt = uiValue;
+  pLog->sPower.uiPanelVolt = uiValue;
+  pLog->sPower.iBatCurr = iValue;
+  pLog->sPower.iPanelCurr = iValue;
+  pLog->sEnergy.ucSoC = (uint8_t)((ulValue > UINT8_MAX) ? UINT8_MAX : ulValue);
+  pLog->sEnergy.uiBatIn = (uint16_t)((ulValue > UINT16_MAX) ? UINT16_MAX : ulValue);
+  pLog->sEnergy.uiBatOut = pLog->sEnergy.uiBatIn;
+  pLog->sEnergy.ulPvEnergy = ulValue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ausgabe mit dem Bezug vergleichen, die ersten Abweichungen ausgeben
+ *
+ * @param[in] *pszWhat  Bezeichnung
+ * @param[in] *pcAct    Ausgabe
+ * @param[in] uActLen   Lnge der Ausgabe
+ * @param[in] *pcRef    Bezug
+ * @param[in] uRefLen   Lnge des Bezugs
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Compare(const char* pszWhat, const char* pcAct,
+  unsigned uActLen, const char* pcRef, unsigned uRefLen)
+{
+  bool bSame = (uActLen == uRefLen) && (memcmp(pcAct, pcRef, uRefLen) == 0);
+  
+  HOSTTEST_CHECK(bSame);
+  if (!bSame && (uHostTestReported++ < HOSTTEST_REPORT))
+  {
+    fprintf(stderr, "%s:\n  ist  %.*s  soll %.*s", pszWhat,
+      (int)uActLen, pcAct, (int)uRefLen, pcRef);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Protokollzeile eines Eintrags vergleichen
+ *
+ * @param[in] *pLog     Eintrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Csv(const SensorLogItem* pLog)
+{
+  char acAct[LOGGER_CSV_MAX];
+  char acRef[HOSTFMTREF_MAX];
+  unsigned uActLen;
+  unsigned uRefLen;
+  
+  uActLen = Logger_FormatCsv(pLog, acAct);
+  uRefLen = HostFmtRef_Csv(pLog, acRef);
+  HostTest_Compare("Logger_FormatCsv", acAct, uActLen, acRef, uRefLen);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ringspeicher mit den Eintrgen fllen, AT+CGUI? ber USART1 ausfhren
+ * und die Antwort Zeile fr Zeile mit dem Bezug vergleichen
+ *
+ * @param[in] *psLog    Eintrge, Anzahl NUM_SENSORLOG_RINGITEMS
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Gui(const SensorLogItem* psLog)
+{
+  static const char szCmd[] = "AT+CGUI?\r";
+  char acRef[HOSTTEST_TX_MAX];
+  unsigned uRefLen = 0;
+  const char* pc;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < NUM_SENSORLOG_RINGITEMS; ++ucIdx)
+  {
+    *SensorLog_Advance() = psLog[ucIdx];
+    SensorLog_Commit();
+    uRefLen += HostFmtRef_Gui(&psLog[ucIdx], &acRef[uRefLen]);
+  }
+  memcpy(&acRef[uRefLen], "OK\r\n", 4);
+  uRefLen += 4;
+  
+  uHostTestTxPos = 0;
+  for (pc = szCmd; *pc != '\0'; ++pc)
+  {
+    HostUsart_Receive(HostUsart_1, (uint8_t)*pc);
+  }
+  ATCmd_Poll();
+  
+  /* Letztes Zeichen aus dem Schieberegister abwarten     */
+  while (USART_GetFlagStatus(USART1, USART_FLAG_TC) == RESET);
+  HostTest_Compare("AT+CGUI?", acHostTestTx, uHostTestTxPos, acRef, uRefLen);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Grenzwerte, Stellenwechsel und Zufallswerte vergleichen
+ *
+ * @return    int       0 ohne Fehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(void)
+{
+  static const int32_t alEdges[] = {
+    0, 1, 9, 10, 99, 100, 999, 1000, 9999, 10000, 99999, 100000, 999999,
+    1000000, 9999999, 10000000, 99999999, 100000000, 999999999, 1000000000,
+    INT16_MAX, (int32_t)INT16_MAX + 1, UINT16_MAX, INT32_MAX
+  };
+  SensorLogItem asLog[NUM_SENSORLOG_RINGITEMS];
+  unsigned long ulRun;
+  unsigned uIdx;
+  uint8_t ucIdx = 0;
+  
+  HostCore_Init(0);
+  HostHal_Init();
+  
+  /* Ohne Task bleibt Watchdog_Kick() ohne Wirkung        */
+  Sched_Init(NULL, 0);
+  HostUsart_SetSink(HostUsart_1, HostTest_Tx);
+  UART1_Init();
+  ATCmd_Init();
+  SensorLog_Init();
+  enableInterrupts();
+  UART1_ReceiveUntil('\r', COMMLIB_UART1_MAX_BUF);
+  
+  /* Grenzwerte und Stellenwechsel, positiv und negativ   */
+  HostTest_Fill(&asLog[0]);
+  for (uIdx = 0; uIdx < sizeof(alEdges) / sizeof(alEdges[0]); ++uIdx)
+  {
+    HostTest_FillAll(&asLog[0], alEdges[uIdx]);
+    HostTest_Csv(&asLog[0]);
+    HostTest_FillAll(&asLog[0], -alEdges[uIdx]);
+    HostTest_Csv(&asLog[0]);
+  }
+  HostTest_FillAll(&asLog[0], INT32_MIN);
+  HostTest_Csv(&asLog[0]);
+  for (uIdx = 0; uIdx < NUM_SENSORLOG_RINGITEMS; ++uIdx)
+  {
+    asLog[uIdx] = asLog[0];
+    HostTest_FillAll(&asLog[uIdx], (uIdx & 1) ? INT32_MIN : INT32_MAX);
+  }
+  HostTest_Gui(asLog);
+  
+  /* Zufallswerte                                         */
+  for (ulRun = 0; ulRun < HOSTTEST_RANDOM; ++ulRun)
+  {
+    HostTest_Fill(&asLog[ucIdx]);
+    HostTest_Csv(&asLog[ucIdx]);
+    if (++ucIdx == NUM_SENSORLOG_RINGITEMS)
+    {
+      ucIdx = 0;
+      if ((ulRun / NUM_SENSORLOG_RINGITEMS) % HOSTTEST_GUI_EVERY == 0)
+      {
+        HostTest_Gui(asLog);
+      }
+    }
+  }
+  return HOSTTEST_RESULT();
+}
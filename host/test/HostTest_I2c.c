@@ -0,0 +1,228 @@
+/*!****************************************************************************
+ * @file
+ * HostTest_I2c.c
+ *
+ * Test der I2C-Ansteuerung und der Sensortreiber gegen die Modelle am
+ * simulierten Bus: vorgegebene Messwerte, Zhler von Firmware und Modell,
+ * Verhalten bei NAK, festgehaltenem Bus und verflschten Daten.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostTest.h"
+#include "HostHal.h"
+#include "HostSim.h"
+#include "commlib_i2c.h"
+#include "sensorlib_bme280.h"
+#include "sensorlib_qmc5883.h"
+#include "sensorlib_mpu6050.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Register der Chip-ID des BME280 und erwarteter Inhalt                     */
+#define HOSTTEST_BME_ID_REG     0xD0
+#define HOSTTEST_BME_ID         0x60
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Vorgegebene Umgebung der Sensoren                                         */
+static HostSens_Input sHostTestInput = {
+  21.5, 1013.25, 45.0, 1234, 150
+};
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Summe der Zhler aller Sensormodelle
+ *
+ * @param[out] pSum     Summe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_SensSum(HostSens_Stats* pSum)
+{
+  const HostSens_Stats* pStats;
+  uint8_t ucId;
+  
+  pSum->ulTransfers = 0;
+  pSum->ulBytes = 0;
+  pSum->ulWrites = 0;
+  pSum->ulReads = 0;
+  pSum->ulNaks = 0;
+  for (ucId = 0; ucId < HostSens_Id_NUM; ++ucId)
+  {
+    pStats = HostSens_GetStats((HostSens_Id)ucId);
+    pSum->ulTransfers += pStats->ulTransfers;
+    pSum->ulBytes += pStats->ulBytes;
+    pSum->ulWrites += pStats->ulWrites;
+    pSum->ulReads += pStats->ulReads;
+    pSum->ulNaks += pStats->ulNaks;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Chip-ID des BME280 lesen
+ *
+ * @return    uint8_t   Gelesener Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostTest_ReadId(void)
+{
+  return I2CMaster_RegisterRead(HOSTSENS_ADDR_BME280, HOSTTEST_BME_ID_REG);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messwerte der Treiber bei vorgegebener Umgebung, Zhler der Firmware
+ * gegen die Zhler der Modelle
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Sensors(void)
+{
+  static BME280_Sensor sBme;
+  static QMC5883_Sensor sQmc;
+  static MPU6050_Sensor sMpu;
+  const I2CMaster_Stats* pStats = I2CMaster_GetStats();
+  HostSens_Stats sSum;
+  int iDiff;
+  
+  I2CMaster_ClearStats();
+  HostSens_ClearStats();
+  
+  BME280_Init(&sBme, HOSTSENS_ADDR_BME280);
+  BME280_Update(&sBme);
+  HOSTTEST_NEAR(sBme.sMeasure.iTemperature, 2150, 2);
+  HOSTTEST_NEAR(sBme.sMeasure.ulPressure, 101325, 10);
+  HOSTTEST_NEAR(sBme.sMeasure.ulHumidity / 1024.0, 45.0, 0.2);
+  
+  QMC5883_Init(&sQmc, HOSTSENS_ADDR_QMC5883);
+  QMC5883_Update(&sQmc);
+  iDiff = (sQmc.sMeasure.uiAzimuth - sHostTestInput.iHeading + 5400) % 3600
+    - 1800;
+  HOSTTEST_NEAR(iDiff, 0, 10);
+  
+  MPU6050_Init(&sMpu, HOSTSENS_ADDR_MPU6050, false);
+  MPU6050_Update(&sMpu);
+  HOSTTEST_NEAR(sMpu.sMeasure.sAngle.iYZ, sHostTestInput.iTilt, 5);
+  
+  /* Ohne Fehler sieht das Modell jedes Byte der Firmware */
+  HostTest_SensSum(&sSum);
+  HOSTTEST_CHECK(pStats->uiErrors == 0);
+  HOSTTEST_CHECK(sSum.ulNaks == 0);
+  HOSTTEST_CHECK(sSum.ulTransfers == pStats->ulTransfers);
+  HOSTTEST_CHECK(sSum.ulBytes == pStats->ulBytes);
+  HOSTTEST_CHECK(sSum.ulReads > 0);
+  HOSTTEST_CHECK(sSum.ulWrites > 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fehler der Modelle: NAK beim Senden und Empfangen, festgehaltener Bus,
+ * verflschte Daten. Nach jedem Fehler muss der nchste Zugriff gelingen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_SensFaults(void)
+{
+  const I2CMaster_Stats* pStats = I2CMaster_GetStats();
+  const HostSens_Stats* pBme = HostSens_GetStats(HostSens_Id_BME280);
+  
+  I2CMaster_ClearStats();
+  HostSens_ClearStats();
+  
+  /* NAK auf die Adresse beim Senden der Registernummer   */
+  HostSens_SetFault(HostSens_Id_BME280, HostSens_Fault_NAK, 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == 0xFF);
+  HOSTTEST_CHECK(pStats->uiErrors == 1);
+  HOSTTEST_CHECK(pBme->ulNaks == 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == HOSTTEST_BME_ID);
+  
+  /* NAK auf die Adresse beim Lesen                       */
+  HostSens_SetFault(HostSens_Id_BME280, HostSens_Fault_NAK_READ, 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == 0xFF);
+  HOSTTEST_CHECK(pStats->uiErrors == 2);
+  HOSTTEST_CHECK(pBme->ulNaks == 2);
+  HOSTTEST_CHECK(HostTest_ReadId() == HOSTTEST_BME_ID);
+  HOSTTEST_CHECK(HostTest_ReadId() == HOSTTEST_BME_ID);
+  
+  /* Festgehaltener Bus: Abbruch und Freigabe ber SWRST  */
+  HostSens_SetFault(HostSens_Id_BME280, HostSens_Fault_STUCK, 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == 0xFF);
+  HOSTTEST_CHECK(pStats->uiTimeouts == 1);
+  HOSTTEST_CHECK(pStats->uiRecoveries == 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == HOSTTEST_BME_ID);
+  
+  /* Verflschte Daten kommen unerkannt durch             */
+  HostSens_SetFault(HostSens_Id_BME280, HostSens_Fault_CORRUPT, 2);
+  HOSTTEST_CHECK(HostTest_ReadId() == (uint8_t)~HOSTTEST_BME_ID);
+  HOSTTEST_CHECK(HostTest_ReadId() == HOSTTEST_BME_ID);
+  HOSTTEST_CHECK(pStats->uiErrors == 3);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eingespeiste Fehler der Firmware (I2C_FAULTS)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_FwFaults(void)
+{
+  const I2CMaster_Stats* pStats = I2CMaster_GetStats();
+  
+  I2CMaster_ClearStats();
+  
+  I2CMaster_SetFault(I2CMaster_Fault_NAK, 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == 0xFF);
+  HOSTTEST_CHECK(pStats->uiErrors == 1);
+  
+  I2CMaster_SetFault(I2CMaster_Fault_CORRUPT, 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == (uint8_t)~HOSTTEST_BME_ID);
+  
+  /* Auftrag bleibt stehen: Abbruch statt Hnger          */
+  I2CMaster_SetFault(I2CMaster_Fault_BUSY, 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == 0xFF);
+  HOSTTEST_CHECK(pStats->uiTimeouts == 1);
+  HOSTTEST_CHECK(pStats->uiRecoveries == 1);
+  HOSTTEST_CHECK(HostTest_ReadId() == HOSTTEST_BME_ID);
+  HOSTTEST_CHECK(pStats->uiErrors == 2);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Simulierten Bus aufsetzen und alle Flle prfen
+ *
+ * @return    int       0 ohne Fehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(void)
+{
+  sHostSimCfg.bQuiet = true;
+  HostCore_Init(0);
+  HostHal_Init();
+  HostSens_Init();
+  HostSens_SetInput(&sHostTestInput);
+  
+  /* Weckquelle fr die Wartezeiten der Treiber (WFI)     */
+  HostRtc_Start(0, 0);
+  CLK_PeripheralClockConfig(CLK_Peripheral_RTC, ENABLE);
+  RTC_WakeUpClockConfig(RTC_WakeUpClock_CK_SPRE_16bits);
+  RTC_SetWakeUpCounter(0);
+  RTC_WakeUpCmd(ENABLE);
+  RTC_ITConfig(RTC_IT_WUT, ENABLE);
+  
+  I2CMaster_Init();
+  enableInterrupts();
+  
+  HostTest_Sensors();
+  HostTest_SensFaults();
+  HostTest_FwFaults();
+  return HOSTTEST_RESULT();
+}
@@ -0,0 +1,254 @@
+/*!****************************************************************************
+ * @file
+ * HostTest_Pack.c
+ *
+ * Dieselbe Folge von Eintrgen ber Logger_Append() einmal binr
+ * (LOG/260621.BIN) und einmal gepackt (LOG/260621.PAK) in ein SD-Abbild
+ * schreiben. Die Tests pack_getbin und pack_getpak lesen beide mit hostimg
+ * aus, pack_decode_bin und pack_decode_pak wandeln sie mit
+ * tools/log_decode.py in CSV um, pack_compare vergleicht die CSV-Dateien.
+ *
+ * Die Folge enthlt kleine nderungen, lange Wiederholungen ber den Zhler
+ * von 255 hinaus, eine Lcke in der Zeit, Sprnge ber den ganzen
+ * Wertebereich und genug Eintrge fr viele Blcke.
+ *
+ * Aufruf:
+ *   hosttest_pack ABBILD
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <string.h>
+#include "HostTest.h"
+#include "HostHal.h"
+#include "HostSim.h"
+#include "io_map.h"
+#include "ff.h"
+#include "Scheduler.h"
+#include "Deferred.h"
+#include "powerlib.h"
+#include "SensorLog.h"
+#include "Logger.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! 21.06.2026 00:00:00 in Sekunden seit dem 01.01.2000                       */
+#define HOSTTEST_START          835315200UL
+
+/*! Anzahl Eintrge je Format                                                 */
+#define HOSTTEST_ITEMS          2500u
+
+/*! Messintervall in s                                                        */
+#define HOSTTEST_STEP           10u
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Dateisystem der Karte                                                     */
+static FATFS sHostTestFs;
+
+/*! Zustand des Zufallsgenerators                                             */
+static uint32_t ulHostTestRand = 0x2026A46UL;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zufallszahl (xorshift32), reproduzierbar
+ *
+ * @return    uint32_t  Zufallszahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostTest_Next(void)
+{
+  ulHostTestRand ^= ulHostTestRand << 13;
+  ulHostTestRand ^= ulHostTestRand >> 17;
+  ulHostTestRand ^= ulHostTestRand << 5;
+  return ulHostTestRand;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Kleine nderung -2 ... +2
+ *
+ * @return    int16_t   nderung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int16_t HostTest_Walk(void)
+{
+  return (int16_t)(HostTest_Next() % 5) - 2;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag der Folge bilden
+ *
+ * @param[in] uIdx      Nummer des Eintrags
+ * @param[in,out] *pLog Vorheriger Eintrag, danach der neue
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Item(unsigned uIdx, SensorLogItem* pLog)
+{
+  uint32_t ulSec;
+  
+  /* Zeit des Tages, ab Eintrag 1500 eine Stunde Lcke    */
+  ulSec = uIdx * HOSTTEST_STEP + ((uIdx >= 1500) ? 3600 : 0);
+  pLog->sTimestamp.sDate.RTC_Year = 26;
+  pLog->sTimestamp.sDate.RTC_Month = RTC_Month_June;
+  pLog->sTimestamp.sDate.RTC_Date = 21;
+  pLog->sTimestamp.sTime.RTC_Hours = (uint8_t)(ulSec / 3600);
+  pLog->sTimestamp.sTime.RTC_Minutes = (uint8_t)(ulSec / 60 % 60);
+  pLog->sTimestamp.sTime.RTC_Seconds = (uint8_t)(ulSec % 60);
+  
+  /* Eintrge 100 bis 399 unverndert: Wiederholung       */
+  if ((uIdx >= 100) && (uIdx < 400))
+  {
+    return;
+  }
+  
+  if ((uIdx >= 1600) && (uIdx < 1610))
+  {
+    /* Sprnge ber den ganzen Wertebereich               */
+    pLog->sTemperature.iBME = (int16_t)HostTest_Next();
+    pLog->ulPressure = HostTest_Next();
+    pLog->ulHumidity = HostTest_Next();
+    pLog->sWind.uiVelo = (uint16_t)HostTest_Next();
+    pLog->sPosition.lLat = (int32_t)HostTest_Next();
+    pLog->sPosition.lLong = (int32_t)HostTest_Next();
+    pLog->sEnergy.ulPvEnergy = HostTest_Next();
+    pLog->ucStatus = (uint8_t)HostTest_Next();
+    return;
+  }
+  
+  /* Langsame nderungen wie im Betrieb                   */
+  pLog->sTemperature.iBME += HostTest_Walk();
+  pLog->sTemperature.iCPU += HostTest_Walk();
+  pLog->sTemperature.iQMC += HostTest_Walk();
+  pLog->sTemperature.iMPU += HostTest_Walk();
+  pLog->ulPressure += (uint32_t)(int32_t)HostTest_Walk();
+  pLog->ulHumidity += (uint32_t)(int32_t)(HostTest_Walk() * 40);
+  pLog->sWind.uiDir = (uint16_t)(HostTest_Next() % 16);
+  pLog->sWind.uiVelo = (uint16_t)(HostTest_Next() % 300);
+  pLog->sAlignment.uiAzimuth += (uint16_t)HostTest_Walk();
+  pLog->sAlignment.iZenith += HostTest_Walk();
+  pLog->sPower.uiBatVolt += (uint16_t)HostTest_Walk();
+  pLog->sPower.uiPanelVolt = (uint16_t)(HostTest_Next() % 6000);
+  pLog->sPower.iBatCurr += HostTest_Walk();
+  pLog->sPower.iPanelCurr = (int16_t)(HostTest_Next() % 400);
+  pLog->sEnergy.uiBatIn += (uint16_t)(HostTest_Next() % 3);
+  pLog->sEnergy.ulPvEnergy += HostTest_Next() % 50;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Folge in einem Format schreiben
+ *
+ * @param[in] eFormat   Format
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Write(Logger_Format eFormat)
+{
+  SensorLogItem sLog;
+  unsigned uIdx;
+  unsigned uFails = 0;
+  
+  memset(&sLog, 0, sizeof(sLog));
+  sLog.sTemperature.iBME = 1520;
+  sLog.sTemperature.iCPU = 2100;
+  sLog.sTemperature.iQMC = 1480;
+  sLog.sTemperature.iMPU = 1900;
+  sLog.ulPressure = 95210;
+  sLog.ulHumidity = 55000;
+  sLog.sAlignment.uiAzimuth = 1800;
+  sLog.sPosition.lLat = 48137000;
+  sLog.sPosition.lLong = 11575000;
+  sLog.sPosition.iAlt = 520;
+  sLog.sPower.uiBatVolt = 3900;
+  sLog.sEnergy.ucSoC = 80;
+  sLog.ucStatus = SENSORLOG_STATUS_POS | SENSORLOG_STATUS_ALT;
+  ulHostTestRand = 0x2026A46UL;
+  
+  Logger_SetFormat(eFormat);
+  for (uIdx = 0; uIdx < HOSTTEST_ITEMS; ++uIdx)
+  {
+    HostTest_Item(uIdx, &sLog);
+    if (!Logger_Append(&sLog))
+    {
+      ++uFails;
+    }
+  }
+  HOSTTEST_CHECK(uFails == 0);
+  HOSTTEST_CHECK(Logger_Flush());
+  Logger_Close();
+  printf("%s: %u Eintrge\n", Logger_GetFileName(), HOSTTEST_ITEMS);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Abbild anlegen und die Folge binr und gepackt schreiben
+ *
+ * @param[in] argc      Anzahl Argumente
+ * @param[in] argv      Argumente
+ * @return    int       0 ohne Fehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+  RTC_AlarmTypeDef sAlarm;
+  
+  if (argc != 2)
+  {
+    fprintf(stderr, "Aufruf: hosttest_pack ABBILD\n");
+    return 2;
+  }
+  
+  sHostSimCfg.bQuiet = true;
+  HostCore_Init(0);
+  HostHal_Init();
+  HostRtc_Start(HOSTTEST_START, 0);
+  if (!HostSd_Init(argv[1]))
+  {
+    fprintf(stderr, "%s: Abbild nicht nutzbar\n", argv[1]);
+    return 1;
+  }
+  Sched_Init(NULL, 0);
+  
+  /* Timer 1 als s-Zhler der Zeitmessung, Alarm A als  *
+   * Weckquelle, damit Warteschleifen die Zeit vorstellen */
+  CLK_SYSCLKSourceConfig(CLK_SYSCLKSource_HSI);
+  CLK_SYSCLKDivConfig(CLK_SYSCLKDiv_1);
+  Deferred_Init();
+  CLK_PeripheralClockConfig(CLK_Peripheral_RTC, ENABLE);
+  RTC_AlarmStructInit(&sAlarm);
+  sAlarm.RTC_AlarmMask = RTC_AlarmMask_All;
+  RTC_SetAlarm(RTC_Format_BIN, &sAlarm);
+  RTC_ITConfig(RTC_IT_ALRA, ENABLE);
+  RTC_AlarmCmd(ENABLE);
+  LowPower_Init();
+  enableInterrupts();
+  
+  /* SPI und SD-Karte wie in main()                       */
+  GPIO_Init(SPI2_PORT, SPI2_SCK_PIN, GPIO_Mode_Out_PP_Low_Fast);
+  GPIO_Init(SPI2_PORT, SPI2_MOSI_PIN, GPIO_Mode_Out_PP_Low_Fast);
+  GPIO_Init(SPI2_PORT, SPI2_MISO_PIN, GPIO_Mode_In_PU_No_IT);
+  GPIO_Init(SD_CS_PORT, SD_CS_PIN, GPIO_Mode_Out_PP_High_Fast);
+  CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, ENABLE);
+  SPI_Init(SPI2, SPI_FirstBit_MSB, SPI_BaudRatePrescaler_64, SPI_Mode_Master,
+    SPI_CPOL_Low, SPI_CPHA_1Edge, SPI_Direction_2Lines_FullDuplex,
+    SPI_NSS_Soft, 0);
+  SPI_Cmd(SPI2, ENABLE);
+  CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, DISABLE);
+  HOSTTEST_CHECK(f_mount(&sHostTestFs, "", 0) == FR_OK);
+  Logger_Init();
+  
+  HostTest_Write(Logger_Format_BIN);
+  HostTest_Write(Logger_Format_PAK);
+  return HOSTTEST_RESULT();
+}
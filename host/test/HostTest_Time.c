@@ -0,0 +1,153 @@
+/*!****************************************************************************
+ * @file
+ * HostTest_Time.c
+ *
+ * Test des fortlaufenden Zeitstempels (LowPower_GetStamp) fr Scheduler,
+ * Watchdog und Energiezhler: Sekundentakt ber Alarm A, Stellen der Uhr
+ * vor und zurck wie beim Abgleich mit dem GPS.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "HostTest.h"
+#include "HostHal.h"
+#include "powerlib.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Start der Uhr: 21.06.2026 12:00:00 in Sekunden seit dem 01.01.2000        */
+#define HOSTTEST_START          835358400UL
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Sekundentakte abwarten
+ *
+ * @param[in] ucNum     Anzahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Seconds(uint8_t ucNum)
+{
+  while (ucNum-- > 0)
+  {
+    wfi();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Uhrzeit stellen wie TaskGps
+ *
+ * @param[in] ucHour    Stunde
+ * @param[in] ucMin     Minute
+ * @param[in] ucSec     Sekunde
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_SetTime(uint8_t ucHour, uint8_t ucMin, uint8_t ucSec)
+{
+  RTC_TimeTypeDef sTime;
+  
+  RTC_TimeStructInit(&sTime);
+  sTime.RTC_Hours = ucHour;
+  sTime.RTC_Minutes = ucMin;
+  sTime.RTC_Seconds = ucSec;
+  RTC_SetTime(RTC_Format_BIN, &sTime);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ablauf der Zeit im Sekundentakt, berlauf der Differenz
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Count(void)
+{
+  uint32_t ulFrom;
+  uint32_t ulPrev;
+  uint32_t ulStamp;
+  uint8_t ucIdx;
+  
+  /* Ab der nchsten Sekundengrenze                       */
+  HostTest_Seconds(1);
+  ulFrom = LowPower_GetStamp();
+  ulPrev = ulFrom;
+  for (ucIdx = 0; ucIdx < 5; ++ucIdx)
+  {
+    HostTest_Seconds(1);
+    ulStamp = LowPower_GetStamp();
+    HOSTTEST_CHECK(ulStamp > ulPrev);
+    ulPrev = ulStamp;
+  }
+  HOSTTEST_NEAR(LowPower_GetElapsed(ulFrom, ulPrev), 5 * LOWPOWER_TICK_HZ, 1);
+  
+  /* Differenz ber den berlauf des Zeitstempels         */
+  HOSTTEST_CHECK(LowPower_GetElapsed(0xFFFFFF00UL, 0x00000100UL) == 0x200);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Uhr zurck- und vorstellen: der Zeitstempel springt nicht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostTest_Step(void)
+{
+  uint32_t ulFrom;
+  uint32_t ulStamp;
+  
+  /* Eine Minute vor der vollen Stunde zurck, frher     */
+  /* fast eine Stunde Differenz                           */
+  HostTest_SetTime(12, 0, 10);
+  HostTest_Seconds(2);
+  ulFrom = LowPower_GetStamp();
+  HostTest_SetTime(11, 59, 0);
+  ulStamp = LowPower_GetStamp();
+  HOSTTEST_CHECK(LowPower_GetElapsed(ulFrom, ulStamp) < LOWPOWER_TICK_HZ);
+  HostTest_Seconds(3);
+  HOSTTEST_NEAR(LowPower_GetElapsed(ulFrom, LowPower_GetStamp()),
+    3 * LOWPOWER_TICK_HZ, LOWPOWER_TICK_HZ);
+  
+  /* Vorstellen um eine halbe Stunde                      */
+  ulFrom = LowPower_GetStamp();
+  HostTest_SetTime(12, 29, 3);
+  HostTest_Seconds(2);
+  HOSTTEST_NEAR(LowPower_GetElapsed(ulFrom, LowPower_GetStamp()),
+    2 * LOWPOWER_TICK_HZ, LOWPOWER_TICK_HZ);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Uhr mit Sekundentakt aufsetzen und alle Flle prfen
+ *
+ * @return    int       0 ohne Fehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(void)
+{
+  RTC_AlarmTypeDef sAlarm;
+  
+  HostCore_Init(0);
+  HostHal_Init();
+  HostRtc_Start(HOSTTEST_START, HOSTCORE_MS(300));
+  
+  /* Alarm A ohne Vergleich wie in main()                 */
+  CLK_PeripheralClockConfig(CLK_Peripheral_RTC, ENABLE);
+  RTC_AlarmStructInit(&sAlarm);
+  sAlarm.RTC_AlarmMask = RTC_AlarmMask_All;
+  RTC_SetAlarm(RTC_Format_BIN, &sAlarm);
+  RTC_ITConfig(RTC_IT_ALRA, ENABLE);
+  RTC_AlarmCmd(ENABLE);
+  LowPower_Init();
+  enableInterrupts();
+  
+  HostTest_Count();
+  HostTest_Step();
+  return HOSTTEST_RESULT();
+}
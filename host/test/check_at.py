@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+check_at.py
+
+Prüfung der AT-Antworten einer Host-Station (--at-out) gegen eine Liste
+erwarteter Zeilen. Jede Zeile der Liste ist ein regulärer Ausdruck, der in
+dieser Reihenfolge auf eine Antwortzeile passen muss; mit "!" davor darf
+keine Antwortzeile passen. Leerzeilen und Zeilen mit "#" am Anfang werden
+übergangen. Die Daten von AT+CLOGGET (Zeile "+CLOGGET: <file>,<len>" und
+<len> Byte) werden übersprungen und mit --get als GET_<Datei> in das
+angegebene Verzeichnis geschrieben, z.B. für tools/log_decode.py.
+
+Aufruf: python3 check_at.py AT.OUT ERWARTUNG [--get VERZEICHNIS]
+
+@date  19.10.2026
+"""
+
+import os
+import re
+import sys
+
+# Kopfzeile eines Datenblocks von AT+CLOGGET
+GET_LINE = re.compile(rb"^\+CLOGGET: ([^,]+),([0-9]+)$")
+
+
+def split(buf, getdir):
+    """Antworten in Zeilen zerlegen, Datenblöcke überspringen bzw. sichern,
+    liefert die Zeilen und die Anzahl der Blöcke"""
+    lines = []
+    blocks = 0
+    pos = 0
+    while pos < len(buf):
+        end = buf.find(b"\r\n", pos)
+        if end < 0:
+            end = len(buf)
+        line = buf[pos:end]
+        pos = end + 2
+        match = GET_LINE.match(line)
+        if match:
+            size = int(match.group(2))
+            if getdir is not None:
+                name = os.path.basename(match.group(1).decode("ascii"))
+                with open(os.path.join(getdir, "GET_" + name), "wb") as f:
+                    f.write(buf[pos:pos + size])
+            pos += size
+            blocks += 1
+        lines.append(line.decode("latin-1"))
+    return lines, blocks
+
+
+def check(lines, rules):
+    """Erwartungen prüfen, liefert die Anzahl der Fehler"""
+    errors = 0
+    idx = 0
+    for rule in rules:
+        if rule.startswith("!"):
+            expr = re.compile(rule[1:])
+            for line in lines:
+                if expr.search(line):
+                    print("Unerwartet: %s (%s)" % (line, rule[1:]))
+                    errors += 1
+            continue
+        expr = re.compile(rule)
+        found = idx
+        while found < len(lines) and not expr.search(lines[found]):
+            found += 1
+        if found == len(lines):
+            # Folgende Erwartungen ab derselben Zeile weiter prüfen
+            print("Nicht gefunden: %s" % rule)
+            errors += 1
+        else:
+            idx = found + 1
+    return errors
+
+
+def main(argv):
+    if len(argv) not in (3, 5) or (len(argv) == 5 and argv[3] != "--get"):
+        print("Aufruf: python3 check_at.py AT.OUT ERWARTUNG [--get VERZEICHNIS]")
+        return 2
+
+    with open(argv[1], "rb") as f:
+        lines, blocks = split(f.read(), argv[4] if len(argv) == 5 else None)
+    with open(argv[2], "r", encoding="utf-8") as f:
+        rules = [rule.strip() for rule in f
+                 if rule.strip() and not rule.startswith("#")]
+
+    errors = check(lines, rules)
+    print("%d Zeilen, %d Blöcke, %d Erwartungen, %d Fehler"
+          % (len(lines), blocks, len(rules), errors))
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
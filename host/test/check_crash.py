@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+check_crash.py
+
+Auswertung von hosttest_crash: jede Tagesdatei der Liste crash.lst wird
+gelesen, Binär- und gepackte Dateien mit tools/log_decode.py. Alle Sätze
+müssen gültig sein und denen des Durchlaufs ohne Ausfall (<Fall>_0.*)
+gleichen. Fehlen dürfen nur der beim Ausfall unterbrochene Eintrag und die
+ungesicherten davor, höchstens so viele, wie die Liste beim Durchlauf ohne
+Ausfall angibt.
+
+Aufruf: python3 check_crash.py LOG_DECODE.PY VERZEICHNIS
+
+@date  19.10.2026
+@date  19.10.2026  Verlust bis zum letzten f_sync
+"""
+
+import contextlib
+import importlib.util
+import io
+import os
+import re
+import sys
+
+# Meldung von log_decode.py am Ende der Auswertung
+RESULT = re.compile(r"Version [0-9]+: ([0-9]+) Sätze, ([0-9]+) fehlerhaft")
+
+
+def load_decoder(path):
+    """tools/log_decode.py als Modul laden"""
+    spec = importlib.util.spec_from_file_location("log_decode", path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+def read_rows(decoder, path, tmp):
+    """Sätze einer Tagesdatei als Textzeilen, dazu die Anzahl fehlerhafter
+    Sätze bzw. einer unvollständigen letzten Zeile"""
+    if path.endswith(".TXT"):
+        with open(path, "rb") as f:
+            lines = f.read().decode("latin-1").split("\r\n")
+        return lines[:-1], 0 if lines[-1] == "" else 1
+    err = io.StringIO()
+    with contextlib.redirect_stderr(err):
+        decoder.main(["log_decode.py", path, tmp])
+    match = RESULT.search(err.getvalue())
+    if match is None:
+        return [], 1
+    with open(tmp, "r", newline="") as f:
+        rows = f.read().splitlines()[1:]
+    return rows, int(match.group(2))
+
+
+def main(argv):
+    if len(argv) != 3:
+        print("Aufruf: python3 check_crash.py LOG_DECODE.PY VERZEICHNIS")
+        return 2
+
+    decoder = load_decoder(argv[1])
+    tmp = os.path.join(argv[2], "crash.csv")
+    with open(os.path.join(argv[2], "crash.lst"), "r") as f:
+        entries = [line.split() for line in f if line.strip()]
+
+    refs = {}
+    limits = {}
+    stats = {}
+    errors = 0
+    for name, item, *limit in entries:
+        case = name.split("_")[0]
+        rows, bad = read_rows(decoder, os.path.join(argv[2], name), tmp)
+        if item == "-":
+            refs[case] = rows
+            limits[case] = int(limit[0])
+            stats[case] = [0, 0, 0]
+            continue
+        ref = refs[case]
+        idx = int(item)
+        # Anfang bis zum Verlust, danach die Einträge nach dem unterbrochenen
+        lost = len(ref) - len(rows)
+        keep = idx + 1 - lost
+        if bad:
+            print("%s: %d fehlerhafte Sätze" % (name, bad))
+            errors += 1
+        elif rows == ref:
+            stats[case][0] += 1
+        elif (0 < lost <= limits[case]
+              and rows == ref[:keep] + ref[idx + 1:]):
+            stats[case][1] += 1
+            stats[case][2] = max(stats[case][2], lost)
+        else:
+            # Erste Abweichung gegenüber dem Bezug
+            pos = 0
+            while pos < min(len(rows), len(ref)) and rows[pos] == ref[pos]:
+                pos += 1
+            print("%s: Ausfall bei Eintrag %d, %d statt %d Sätze, ab Satz %d"
+                  " verschieden" % (name, idx, len(rows), len(ref), pos))
+            errors += 1
+
+    for case, (full, part, most) in stats.items():
+        print("%s: %d Sätze, %d Ausfälle, %d ohne Verlust, %d mit Verlust"
+              " (höchstens %d von %d Einträgen)"
+              % (case, len(refs[case]), full + part, full, part, most,
+                 limits[case]))
+    if not stats:
+        print("Keine Dateien")
+        errors += 1
+    print("%d Dateien, %d Fehler" % (len(entries), errors))
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
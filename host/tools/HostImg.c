@@ -0,0 +1,279 @@
+/*!****************************************************************************
+ * @file
+ * HostImg.c
+ *
+ * Zugriff auf das SD-Karten-Abbild der Host-Station mit FatFs aus der
+ * Firmware. Die Laufwerksschnittstelle (diskio.h) liest und schreibt die
+ * Sektoren direkt in der Abbilddatei.
+ *
+ * Aufruf:
+ *   hostimg ABBILD ls [VERZEICHNIS]   Eintrge mit Gre auflisten
+ *   hostimg ABBILD cat DATEI [ZIEL]   Datei nach stdout oder in ZIEL
+ *                                     ausgeben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Ausgabe in eine Datei
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "ff.h"
+#include "diskio.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Sektorgre                                                               */
+#define HOSTIMG_SECTOR          512u
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Abbilddatei                                                               */
+static int iHostImgFd = -1;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Verzeichnis auflisten
+ *
+ * @param[in] pszPath   Verzeichnis
+ * @return    int       Rckgabewert des Programms
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int HostImg_List(const char* pszPath)
+{
+  DIR sDir;
+  FILINFO sInfo;
+  FRESULT eRes;
+  
+  eRes = f_opendir(&sDir, pszPath);
+  if (eRes != FR_OK)
+  {
+    fprintf(stderr, "%s: Fehler %d\n", pszPath, (int)eRes);
+    return 1;
+  }
+  while ((f_readdir(&sDir, &sInfo) == FR_OK) && (sInfo.fname[0] != '\0'))
+  {
+    if (sInfo.fattrib & AM_DIR)
+    {
+      printf("%-12s       <DIR>\n", sInfo.fname);
+    }
+    else
+    {
+      printf("%-12s %12lu\n", sInfo.fname, (unsigned long)sInfo.fsize);
+    }
+  }
+  f_closedir(&sDir);
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datei nach stdout oder in eine Datei auf dem PC ausgeben
+ *
+ * @param[in] pszPath   Datei
+ * @param[in] pszDest   Ziel auf dem PC, NULL fr stdout
+ * @return    int       Rckgabewert des Programms
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Ausgabe in eine Datei
+ ******************************************************************************/
+static int HostImg_Cat(const char* pszPath, const char* pszDest)
+{
+  FIL sFile;
+  FRESULT eRes;
+  UINT uiRead;
+  BYTE aucBuf[HOSTIMG_SECTOR];
+  FILE* pOut = stdout;
+  
+  eRes = f_open(&sFile, pszPath, FA_READ);
+  if (eRes != FR_OK)
+  {
+    fprintf(stderr, "%s: Fehler %d\n", pszPath, (int)eRes);
+    return 1;
+  }
+  if (pszDest != NULL)
+  {
+    pOut = fopen(pszDest, "wb");
+    if (pOut == NULL)
+    {
+      fprintf(stderr, "%s: kann nicht angelegt werden\n", pszDest);
+      f_close(&sFile);
+      return 1;
+    }
+  }
+  while ((f_read(&sFile, aucBuf, sizeof(aucBuf), &uiRead) == FR_OK)
+    && (uiRead > 0))
+  {
+    fwrite(aucBuf, 1, uiRead, pOut);
+  }
+  f_close(&sFile);
+  if (pOut != stdout)
+  {
+    fclose(pOut);
+  }
+  return 0;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Laufwerk initialisieren (Abbild ist bereits geffnet)
+ *
+ * @param[in] pdrv      Laufwerk
+ * @return    DSTATUS   Status
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+DSTATUS disk_initialize(BYTE pdrv)
+{
+  return disk_status(pdrv);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufwerksstatus
+ *
+ * @param[in] pdrv      Laufwerk
+ * @return    DSTATUS   Status
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+DSTATUS disk_status(BYTE pdrv)
+{
+  return ((pdrv == 0) && (iHostImgFd >= 0)) ? 0 : STA_NOINIT;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sektoren lesen
+ *
+ * @param[in]  pdrv     Laufwerk
+ * @param[out] buff     Ziel
+ * @param[in]  sector   Erster Sektor
+ * @param[in]  count    Anzahl
+ * @return     DRESULT  Ergebnis
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+DRESULT disk_read(BYTE pdrv, BYTE* buff, LBA_t sector, UINT count)
+{
+  ssize_t lLen = (ssize_t)count * HOSTIMG_SECTOR;
+  
+  if (disk_status(pdrv) != 0)
+  {
+    return RES_NOTRDY;
+  }
+  return (pread(iHostImgFd, buff, (size_t)lLen,
+    (off_t)sector * HOSTIMG_SECTOR) == lLen) ? RES_OK : RES_ERROR;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sektoren schreiben
+ *
+ * @param[in] pdrv      Laufwerk
+ * @param[in] buff      Daten
+ * @param[in] sector    Erster Sektor
+ * @param[in] count     Anzahl
+ * @return    DRESULT   Ergebnis
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+DRESULT disk_write(BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count)
+{
+  ssize_t lLen = (ssize_t)count * HOSTIMG_SECTOR;
+  
+  if (disk_status(pdrv) != 0)
+  {
+    return RES_NOTRDY;
+  }
+  return (pwrite(iHostImgFd, buff, (size_t)lLen,
+    (off_t)sector * HOSTIMG_SECTOR) == lLen) ? RES_OK : RES_ERROR;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Steuerbefehle
+ *
+ * @param[in]     pdrv  Laufwerk
+ * @param[in]     cmd   Befehl
+ * @param[in,out] buff  Parameter
+ * @return        DRESULT Ergebnis
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void* buff)
+{
+  if (disk_status(pdrv) != 0)
+  {
+    return RES_NOTRDY;
+  }
+  switch (cmd)
+  {
+    case CTRL_SYNC:
+      return RES_OK;
+    
+    case GET_SECTOR_COUNT:
+      *(LBA_t*)buff = (LBA_t)(lseek(iHostImgFd, 0, SEEK_END)
+        / HOSTIMG_SECTOR);
+      return RES_OK;
+    
+    case GET_BLOCK_SIZE:
+      *(DWORD*)buff = 1;
+      return RES_OK;
+    
+    default:
+      return RES_PARERR;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abbild einbinden und Befehl ausfhren
+ *
+ * @param[in] argc      Anzahl Argumente
+ * @param[in] argv      Argumente
+ * @return    int       0 bei Erfolg
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+  static FATFS sFs;
+  FRESULT eRes;
+  
+  if (argc < 3)
+  {
+    fprintf(stderr, "Aufruf: hostimg ABBILD ls [VERZEICHNIS] | "
+      "cat DATEI [ZIEL]\n");
+    return 1;
+  }
+  iHostImgFd = open(argv[1], O_RDONLY);
+  if (iHostImgFd < 0)
+  {
+    fprintf(stderr, "%s: kann nicht geffnet werden\n", argv[1]);
+    return 1;
+  }
+  eRes = f_mount(&sFs, "", 1);
+  if (eRes != FR_OK)
+  {
+    fprintf(stderr, "%s: kein FAT-Dateisystem (%d)\n", argv[1], (int)eRes);
+    return 1;
+  }
+  if (strcmp(argv[2], "ls") == 0)
+  {
+    return HostImg_List((argc > 3) ? argv[3] : "");
+  }
+  if ((strcmp(argv[2], "cat") == 0) && (argc > 3))
+  {
+    return HostImg_Cat(argv[3], (argc > 4) ? argv[4] : NULL);
+  }
+  fprintf(stderr, "%s: unbekannter Befehl\n", argv[2]);
+  return 1;
+}
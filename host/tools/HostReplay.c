@@ -0,0 +1,771 @@
+/*!****************************************************************************
+ * @file
+ * HostReplay.c
+ *
+ * Wiedergabe einer Aufzeichnung (TRACE.BIN, AT+CTRACE) durch die Firmware
+ * auf dem PC. Die Rohdaten und Kalibrierwerte werden Feld fr Feld in die
+ * Sensorstrukturen der Firmware bernommen und mit deren Umrechnungen wie
+ * in den Update-Funktionen ausgewertet. NMEA-Sentences laufen durch den
+ * GPSHandler, AT-Befehle ber die simulierte USART1 durch ATCmd. Mit dem
+ * POWER-Eintrag endet ein Wakeup: SaveSensors() legt den Protokolleintrag
+ * an, er wird als CSV-Zeile wie im Protokoll nach stdout ausgegeben.
+ *
+ * Mehrbytewerte stehen in der Byte-Reihenfolge des Schreibers, Big Endian
+ * auf dem STM8 und Little Endian in der Host-Station. Der BOOT-Eintrag legt
+ * sie ber TRACE_ORDER_MARK fest, bis zum ersten gilt die des STM8.
+ *
+ * Die Firmware zeichnet die Rohdaten unmittelbar vor dem Protokolleintrag
+ * auf, die CSV-Zeilen stimmen damit Byte fr Byte mit dem Protokoll der
+ * Station berein. Ausgenommen sind die nicht aufgezeichneten Felder ab dem
+ * Ladezustand (Energiezhler) und der Azimut whrend der Kalibrierung des
+ * Kompasses. Mit --log wird das Protokoll (AT+CLOGFMT=0) daraufhin
+ * geprft, jede abweichende Zeile zhlt als Fehler.
+ *
+ * Aufruf:
+ *   hostreplay [-v] [--log PROTOKOLL] DATEI...
+ *                              mehrere Dateien in der Reihenfolge
+ *                              TRACE.OLD TRACE.BIN angeben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "HostHal.h"
+#include "sensorlib.h"
+#include "sensorlib_bme280_internal.h"
+#include "sensorlib_qmc5883_internal.h"
+#include "sensorlib_mpu6050_internal.h"
+#include "sensorlib_wind_internal.h"
+#include "sensorlib_cputemp_internal.h"
+#include "sensorlib_power_internal.h"
+#include "app_sensors.h"
+#include "commlib.h"
+#include "ATCmd.h"
+#include "GPSHandler.h"
+#include "SensorLog.h"
+#include "Logger.h"
+#include "Trace.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Lnge des Zeitstempels am Anfang der CSV-Zeile                            */
+#define HOSTREPLAY_TIME_LEN     20
+
+/*! Verglichene Felder der CSV-Zeile, bis vor den Ladezustand                 */
+#define HOSTREPLAY_LOG_FIELDS   18
+
+/*! Kalibrierwerte, ohne die ein Wakeup nicht ausgewertet wird                */
+#define HOSTREPLAY_CALIB_NEEDED ((1 << Trace_Calib_BME280)                    \
+  | (1 << Trace_Calib_QMC5883) | (1 << Trace_Calib_PBAT)                      \
+  | (1 << Trace_Calib_PPV))
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zhler der Wiedergabe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_HostReplay_Stats {
+  /*! Gelesene Eintrge                                   */
+  unsigned long ulRecords;
+  
+  /*! Ausgewertete Wakeups                                */
+  unsigned long ulWakeups;
+  
+  /*! Wakeups ohne vorherige Kalibrierwerte               */
+  unsigned long ulSkipped;
+  
+  /*! Unbekannte Eintrge und falsche Lngen              */
+  unsigned long ulErrors;
+  
+  /*! Vom Protokoll abweichende oder fehlende Zeilen      */
+  unsigned long ulMismatches;
+} HostReplay_Stats;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Sensoren der Firmware ohne eigene Headerdatei (main.c)                    */
+extern Power_Sensor sSensorPBAT;
+extern Power_Sensor sSensorPPV;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void SaveSensors(void);
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Aufzeichnung in Little Endian (Host-Station)                              */
+static bool bHostReplayLe;
+
+/*! Jeden Eintrag und die AT-Antworten nach stderr ausgeben                   */
+static bool bHostReplayVerbose;
+
+/*! Bit je Trace_Calib: Kalibrierwerte seit dem letzten Start gelesen         */
+static uint8_t ucHostReplayCalib;
+
+/*! Lesezeiger in den Nutzdaten des Eintrags                                  */
+static const uint8_t* pucHostReplayPos;
+
+/*! Protokoll der Station zum Vergleich, NULL ohne Vergleich                  */
+static FILE* pHostReplayLog;
+
+/*! Zhler                                                                    */
+static HostReplay_Stats sHostReplayStats;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * 8-Bit-Wert aus den Nutzdaten lesen
+ *
+ * @return    uint8_t   Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t HostReplay_Get8(void)
+{
+  return *pucHostReplayPos++;
+}
+
+/*!****************************************************************************
+ * @brief
+ * 16-Bit-Wert in der Byte-Reihenfolge der Aufzeichnung lesen
+ *
+ * @return    uint16_t  Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t HostReplay_Get16(void)
+{
+  const uint8_t* puc = pucHostReplayPos;
+  
+  pucHostReplayPos += 2;
+  return bHostReplayLe ? (uint16_t)(puc[0] | (puc[1] << 8))
+    : (uint16_t)((puc[0] << 8) | puc[1]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * 32-Bit-Wert in der Byte-Reihenfolge der Aufzeichnung lesen
+ *
+ * @return    uint32_t  Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t HostReplay_Get32(void)
+{
+  uint32_t ulFirst = HostReplay_Get16();
+  uint32_t ulSecond = HostReplay_Get16();
+  
+  return bHostReplayLe ? (ulSecond << 16) | ulFirst
+    : (ulFirst << 16) | ulSecond;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gleitkommawert (IEEE 754, 32 Bit, auch bei Cosmic) lesen
+ *
+ * @return    float     Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static float HostReplay_GetFloat(void)
+{
+  uint32_t ulBits = HostReplay_Get32();
+  float fValue;
+  
+  memcpy(&fValue, &ulBits, sizeof(fValue));
+  return fValue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Lnge der Nutzdaten prfen, falsche Lngen werden gezhlt
+ *
+ * @param[in] ucLen     Lnge im Eintrag
+ * @param[in] uExpect   Erwartete Lnge
+ * @return    bool      true, wenn die Lnge passt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostReplay_Check(uint8_t ucLen, size_t uExpect)
+{
+  if (ucLen != uExpect)
+  {
+    ++sHostReplayStats.ulErrors;
+    return false;
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ausgabe von USART1 (Antworten auf AT-Befehle)
+ *
+ * @param[in] ucByte    Gesendetes Zeichen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostReplay_Tx(uint8_t ucByte)
+{
+  if (bHostReplayVerbose)
+  {
+    fputc(ucByte, stderr);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * BOOT: Version und Byte-Reihenfolge, die Kalibrierwerte folgen neu
+ *
+ * @param[in] *pucData  Nutzdaten
+ * @param[in] ucLen     Lnge
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostReplay_Boot(const uint8_t* pucData, uint8_t ucLen)
+{
+  if (ucLen < 2)
+  {
+    ++sHostReplayStats.ulErrors;
+    return;
+  }
+  if (ucLen >= 4)
+  {
+    bHostReplayLe = (pucData[2] == (uint8_t)TRACE_ORDER_MARK);
+  }
+  ucHostReplayCalib = 0;
+  if (bHostReplayVerbose)
+  {
+    fprintf(stderr, "# BOOT Version %u, Reset %02X, %s Endian\n",
+      pucData[0], pucData[1], bHostReplayLe ? "Little" : "Big");
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * RTC: Echtzeituhr stellen. Die Sekunde beginnt mit dem Stellen, damit
+ * die Wiedergabe des Wakeups nicht in die nchste Sekunde fllt und der
+ * Zeitstempel des Protokolleintrags dem der Station entspricht.
+ *
+ * @param[in] *pucData  Jahr ab 2000, Monat, Tag, Stunde, Minute, Sekunde
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Sekundengrenze beim Stellen
+ ******************************************************************************/
+static void HostReplay_Clock(const uint8_t* pucData)
+{
+  RTC_DateTypeDef sDate;
+  RTC_TimeTypeDef sTime;
+  
+  RTC_DateStructInit(&sDate);
+  sDate.RTC_Year = pucData[0];
+  sDate.RTC_Month = (RTC_Month_TypeDef)pucData[1];
+  sDate.RTC_Date = pucData[2];
+  RTC_TimeStructInit(&sTime);
+  sTime.RTC_Hours = pucData[3];
+  sTime.RTC_Minutes = pucData[4];
+  sTime.RTC_Seconds = pucData[5];
+  if ((RTC_SetDate(RTC_Format_BIN, &sDate) != SUCCESS)
+    || (RTC_SetTime(RTC_Format_BIN, &sTime) != SUCCESS))
+  {
+    ++sHostReplayStats.ulErrors;
+    return;
+  }
+  HostRtc_Start(HostRtc_GetSeconds(), 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * CALIB: Kalibrierwerte eines Sensors bernehmen
+ *
+ * @param[in] *pucData  Nutzdaten
+ * @param[in] ucLen     Lnge
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostReplay_Calib(const uint8_t* pucData, uint8_t ucLen)
+{
+  Power_Sensor* pPower;
+  uint8_t ucCalib;
+  
+  if (ucLen < 1)
+  {
+    ++sHostReplayStats.ulErrors;
+    return;
+  }
+  ucCalib = pucData[0];
+  pucHostReplayPos = &pucData[1];
+  --ucLen;
+  
+  switch (ucCalib)
+  {
+    case Trace_Calib_BME280:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorBME280.sCalib)))
+      {
+        return;
+      }
+      sSensorBME280.sCalib.uiDigT1 = HostReplay_Get16();
+      sSensorBME280.sCalib.iDigT2 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigT3 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.uiDigP1 = HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP2 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP3 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP4 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP5 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP6 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP7 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP8 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigP9 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.ucDigH1 = HostReplay_Get8();
+      sSensorBME280.sCalib.iDigH2 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.ucDigH3 = HostReplay_Get8();
+      sSensorBME280.sCalib.iDigH4 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.iDigH5 = (int16_t)HostReplay_Get16();
+      sSensorBME280.sCalib.cDigH6 = (int8_t)HostReplay_Get8();
+      break;
+    
+    case Trace_Calib_QMC5883:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorQMC5883.sCalib)))
+      {
+        return;
+      }
+      sSensorQMC5883.sCalib.iRefTemp = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sCalib.fXComp = HostReplay_GetFloat();
+      sSensorQMC5883.sCalib.fYComp = HostReplay_GetFloat();
+      sSensorQMC5883.sCalib.iXMin = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sCalib.iXMax = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sCalib.iYMin = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sCalib.iYMax = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sCalib.fXGain = HostReplay_GetFloat();
+      sSensorQMC5883.sCalib.fYGain = HostReplay_GetFloat();
+      sSensorQMC5883.sCalib.uiNumComp = HostReplay_Get16();
+      break;
+    
+    case Trace_Calib_MPU6050:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorMPU6050.bMeasureTemp)))
+      {
+        return;
+      }
+      sSensorMPU6050.bMeasureTemp = (HostReplay_Get8() != 0);
+      break;
+    
+    case Trace_Calib_PBAT:
+    case Trace_Calib_PPV:
+      pPower = (ucCalib == Trace_Calib_PBAT) ? &sSensorPBAT : &sSensorPPV;
+      if (!HostReplay_Check(ucLen, sizeof(pPower->sCalib)))
+      {
+        return;
+      }
+      pPower->sCalib.uiCurrZeroOffset = HostReplay_Get16();
+      pPower->sCalib.uiCurrZeroRef = HostReplay_Get16();
+      pPower->sCalib.iCurrSlope = (int16_t)HostReplay_Get16();
+      pPower->sCalib.uiVoltSlope = HostReplay_Get16();
+      break;
+    
+    default:
+      ++sHostReplayStats.ulErrors;
+      return;
+  }
+  ucHostReplayCalib |= (uint8_t)(1 << ucCalib);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Rohdaten eines Sensors bernehmen und wie die Update-Funktion umrechnen
+ *
+ * @param[in] eType     Art des Eintrags
+ * @param[in] *pucData  Nutzdaten
+ * @param[in] ucLen     Lnge
+ * @return    bool      true bei gltigem Eintrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostReplay_Sensor(Trace_Type eType, const uint8_t* pucData,
+  uint8_t ucLen)
+{
+  uint8_t ucIdx;
+  
+  pucHostReplayPos = pucData;
+  switch (eType)
+  {
+    case Trace_Type_BME280:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorBME280.sRaw)))
+      {
+        return false;
+      }
+      sSensorBME280.sRaw.lTfine = (int32_t)HostReplay_Get32();
+      sSensorBME280.sRaw.ulRawTemp = HostReplay_Get32();
+      sSensorBME280.sRaw.ulRawPress = HostReplay_Get32();
+      sSensorBME280.sRaw.uiRawHum = HostReplay_Get16();
+      sSensorBME280.sMeasure.iTemperature = BME280_CalcTemp(&sSensorBME280);
+      sSensorBME280.sMeasure.ulPressure = BME280_CalcPress(&sSensorBME280);
+      sSensorBME280.sMeasure.ulHumidity = BME280_CalcHum(&sSensorBME280);
+      break;
+    
+    case Trace_Type_QMC5883:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorQMC5883.sRaw)))
+      {
+        return false;
+      }
+      sSensorQMC5883.sRaw.iRawX = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sRaw.iRawY = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sRaw.iRawZ = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sRaw.iRawTemp = (int16_t)HostReplay_Get16();
+      sSensorQMC5883.sMeasure.uiAzimuth = QMC5883_CalcAzimuth(&sSensorQMC5883);
+      sSensorQMC5883.sMeasure.iTemperature =
+        QMC5883_CalcTemperature(&sSensorQMC5883);
+      break;
+    
+    case Trace_Type_MPU6050:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorMPU6050.sRaw)))
+      {
+        return false;
+      }
+      sSensorMPU6050.sRaw.iRawX = (int16_t)HostReplay_Get16();
+      sSensorMPU6050.sRaw.iRawY = (int16_t)HostReplay_Get16();
+      sSensorMPU6050.sRaw.iRawZ = (int16_t)HostReplay_Get16();
+      sSensorMPU6050.sRaw.iRawTemp = (int16_t)HostReplay_Get16();
+      sSensorMPU6050.sMeasure.sAngle.iXZ =
+        MPU6050_CalcAngle(&sSensorMPU6050, true);
+      sSensorMPU6050.sMeasure.sAngle.iYZ =
+        MPU6050_CalcAngle(&sSensorMPU6050, false);
+      if (sSensorMPU6050.bMeasureTemp)
+      {
+        sSensorMPU6050.sMeasure.iTemperature = MPU6050_CalcTemp(&sSensorMPU6050);
+      }
+      break;
+    
+    case Trace_Type_WIND:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorWind.sRaw)))
+      {
+        return false;
+      }
+      sSensorWind.sRaw.bRawDataUpdate = (HostReplay_Get8() != 0);
+      sSensorWind.sRaw.ucHead = HostReplay_Get8();
+      for (ucIdx = 0; ucIdx < NUM_WIND_AVG; ++ucIdx)
+      {
+        sSensorWind.sRaw.auiRawVelocity[ucIdx] = HostReplay_Get16();
+      }
+      sSensorWind.sRaw.uiRawDirection = HostReplay_Get16();
+      sSensorWind.sMeasure.uiAvgVelocity = Wind_CalcAvgVelocity(&sSensorWind);
+      sSensorWind.sMeasure.uiMaxVelocity = Wind_CalcMaxVelocity(&sSensorWind);
+      sSensorWind.sMeasure.eDirection = Wind_CalcDirection(&sSensorWind);
+      break;
+    
+    case Trace_Type_CPUTEMP:
+      if (!HostReplay_Check(ucLen, sizeof(sSensorCPUTemp.sRaw)))
+      {
+        return false;
+      }
+      sSensorCPUTemp.sRaw.uiRawTemp = HostReplay_Get16();
+      sSensorCPUTemp.sMeasure.cTemp = CPUTemp_CalcTemperature(&sSensorCPUTemp);
+      break;
+    
+    case Trace_Type_POWER:
+      if (!HostReplay_Check(ucLen, 4 * sizeof(uint16_t)))
+      {
+        return false;
+      }
+      sSensorPBAT.sRaw.uiRawVolt = HostReplay_Get16();
+      sSensorPBAT.sRaw.uiRawCurr = HostReplay_Get16();
+      sSensorPPV.sRaw.uiRawVolt = HostReplay_Get16();
+      sSensorPPV.sRaw.uiRawCurr = HostReplay_Get16();
+      sSensorPBAT.sMeasure.iCurr = Power_CalcCurr(&sSensorPBAT);
+      sSensorPBAT.sMeasure.uiVolt = Power_CalcVolt(&sSensorPBAT);
+      sSensorPPV.sMeasure.iCurr = Power_CalcCurr(&sSensorPPV);
+      sSensorPPV.sMeasure.uiVolt = Power_CalcVolt(&sSensorPPV);
+      break;
+    
+    default:
+      ++sHostReplayStats.ulErrors;
+      return false;
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wiedergegebene CSV-Zeile mit der Zeile gleicher Zeit im Protokoll
+ * vergleichen. Zeilen vor dem Beginn der Aufzeichnung werden bergangen.
+ *
+ * @param[in] *pszLine  Wiedergegebene Zeile
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostReplay_Compare(const char* pszLine)
+{
+  char acLog[LOGGER_CSV_MAX + 2];
+  const char* pc = pszLine;
+  uint8_t ucFields = 0;
+  size_t uLen;
+  long lPos;
+  int iCmp;
+  
+  /* Vergleich bis vor das erste nicht erfasste Feld      */
+  while ((*pc != '\0') && (ucFields < HOSTREPLAY_LOG_FIELDS))
+  {
+    ucFields += (*pc++ == ',');
+  }
+  uLen = (size_t)(pc - pszLine);
+  
+  for (;;)
+  {
+    lPos = ftell(pHostReplayLog);
+    if (fgets(acLog, sizeof(acLog), pHostReplayLog) == NULL)
+    {
+      iCmp = 1;
+      break;
+    }
+    
+    /* Kopfzeilen und ltere Eintrge bergehen           */
+    if ((acLog[0] >= '0') && (acLog[0] <= '9'))
+    {
+      iCmp = strncmp(acLog, pszLine, HOSTREPLAY_TIME_LEN);
+      if (iCmp >= 0)
+      {
+        break;
+      }
+    }
+  }
+  
+  if (iCmp > 0)
+  {
+    /* Fehlt im Protokoll, sptere Zeile bleibt stehen    */
+    fseek(pHostReplayLog, lPos, SEEK_SET);
+    acLog[0] = '\0';
+  }
+  if ((iCmp != 0) || (strncmp(acLog, pszLine, uLen) != 0))
+  {
+    ++sHostReplayStats.ulMismatches;
+    if (bHostReplayVerbose)
+    {
+      fprintf(stderr, "# Abweichung\n< %s> %s", acLog, pszLine);
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ende des Wakeups: Protokolleintrag mit SaveSensors() anlegen und als
+ * CSV-Zeile ausgeben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostReplay_Save(void)
+{
+  char acLine[LOGGER_CSV_MAX + 1];
+  uint8_t ucLen;
+  
+  if ((ucHostReplayCalib & HOSTREPLAY_CALIB_NEEDED) != HOSTREPLAY_CALIB_NEEDED)
+  {
+    ++sHostReplayStats.ulSkipped;
+    return;
+  }
+  SaveSensors();
+  ucLen = Logger_FormatCsv(
+    SensorLog_Dump(SensorLog_GetConfig()->ucDepth - 1u), acLine);
+  fwrite(acLine, 1, ucLen, stdout);
+  if (pHostReplayLog != NULL)
+  {
+    acLine[ucLen] = '\0';
+    HostReplay_Compare(acLine);
+  }
+  ++sHostReplayStats.ulWakeups;
+}
+
+/*!****************************************************************************
+ * @brief
+ * AT-Befehl ber USART1 empfangen und ausfhren
+ *
+ * @param[in] *pucData  Befehl wie empfangen
+ * @param[in] ucLen     Lnge
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostReplay_AtCmd(const uint8_t* pucData, uint8_t ucLen)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < ucLen; ++ucIdx)
+  {
+    HostUsart_Receive(HostUsart_1, pucData[ucIdx]);
+  }
+  if ((ucLen == 0) || (pucData[ucLen - 1] != '\r'))
+  {
+    HostUsart_Receive(HostUsart_1, '\r');
+  }
+  ATCmd_Poll();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Einen Eintrag wiedergeben
+ *
+ * @param[in] eType     Art des Eintrags
+ * @param[in] *pucData  Nutzdaten
+ * @param[in] ucLen     Lnge
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void HostReplay_Record(Trace_Type eType, const uint8_t* pucData,
+  uint8_t ucLen)
+{
+  char acNmea[TRACE_MAX_DATA + 1];
+  
+  switch (eType)
+  {
+    case Trace_Type_BOOT:
+      HostReplay_Boot(pucData, ucLen);
+      break;
+    
+    case Trace_Type_RTC:
+      if (HostReplay_Check(ucLen, 6))
+      {
+        HostReplay_Clock(pucData);
+      }
+      break;
+    
+    case Trace_Type_NMEA:
+      memcpy(acNmea, pucData, ucLen);
+      acNmea[ucLen] = '\0';
+      GPSHandler_ParseSentence(acNmea, ucLen);
+      break;
+    
+    case Trace_Type_AT:
+      HostReplay_AtCmd(pucData, ucLen);
+      break;
+    
+    case Trace_Type_CALIB:
+      HostReplay_Calib(pucData, ucLen);
+      break;
+    
+    default:
+      /* POWER ist der letzte Eintrag des Wakeups         */
+      if (HostReplay_Sensor(eType, pucData, ucLen)
+        && (eType == Trace_Type_POWER))
+      {
+        HostReplay_Save();
+      }
+      break;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Alle Eintrge einer Datei wiedergeben
+ *
+ * @param[in] *pszName  Datei
+ * @return    bool      true, wenn die Datei vollstndig gelesen wurde
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool HostReplay_File(const char* pszName)
+{
+  uint8_t aucHead[TRACE_HEAD_SIZE];
+  uint8_t aucData[UINT8_MAX];
+  bool bOk = true;
+  FILE* pFile;
+  
+  pFile = fopen(pszName, "rb");
+  if (pFile == NULL)
+  {
+    fprintf(stderr, "%s: kann nicht geffnet werden\n", pszName);
+    return false;
+  }
+  while (fread(aucHead, 1, sizeof(aucHead), pFile) == sizeof(aucHead))
+  {
+    if (fread(aucData, 1, aucHead[1], pFile) != aucHead[1])
+    {
+      fprintf(stderr, "%s: unvollstndiger Eintrag\n", pszName);
+      bOk = false;
+      break;
+    }
+    ++sHostReplayStats.ulRecords;
+    if (bHostReplayVerbose)
+    {
+      fprintf(stderr, "# %5u Art %u, %u Byte\n",
+        (unsigned)((aucHead[2] << 8) | aucHead[3]), aucHead[0], aucHead[1]);
+    }
+    HostReplay_Record((Trace_Type)aucHead[0], aucData, aucHead[1]);
+  }
+  fclose(pFile);
+  return bOk;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Firmware und simulierte Peripherie vorbereiten, Dateien wiedergeben
+ *
+ * @param[in] argc      Anzahl Argumente
+ * @param[in] argv      Argumente
+ * @return    int       0, wenn alle Eintrge gelesen und verstanden wurden
+ *                      und das Protokoll bereinstimmt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char** argv)
+{
+  bool bOk = true;
+  int iArg;
+  
+  for (iArg = 1; (iArg < argc) && (argv[iArg][0] == '-'); ++iArg)
+  {
+    if (strcmp(argv[iArg], "-v") == 0)
+    {
+      bHostReplayVerbose = true;
+    }
+    else if ((strcmp(argv[iArg], "--log") == 0) && (iArg + 1 < argc))
+    {
+      ++iArg;
+      pHostReplayLog = fopen(argv[iArg], "rb");
+      if (pHostReplayLog == NULL)
+      {
+        fprintf(stderr, "%s: kann nicht geffnet werden\n", argv[iArg]);
+        return 1;
+      }
+    }
+    else
+    {
+      break;
+    }
+  }
+  if ((iArg >= argc) || (argv[iArg][0] == '-'))
+  {
+    fprintf(stderr, "Aufruf: hostreplay [-v] [--log PROTOKOLL] [TRACE.OLD] "
+      "TRACE.BIN\n");
+    return 1;
+  }
+  
+  /* Kern und Peripherie wie nach dem Reset, USART1 fr   *
+   * die AT-Befehle, USART2 fr printf() (ohne Ausgabe)   */
+  HostCore_Init(0);
+  HostHal_Init();
+  HostRtc_Start(0, 0);
+  HostUsart_SetSink(HostUsart_1, HostReplay_Tx);
+  UART2_Init();
+  UART1_Init();
+  ATCmd_Init();
+  SensorLog_Init();
+  enableInterrupts();
+  UART1_ReceiveUntil('\r', COMMLIB_UART1_MAX_BUF);
+  
+  for (; iArg < argc; ++iArg)
+  {
+    bOk = HostReplay_File(argv[iArg]) && bOk;
+  }
+  
+  fprintf(stderr, "hostreplay: %lu Eintrge, %lu Wakeups, %lu ohne "
+    "Kalibrierwerte, %lu Fehler, %lu Abweichungen\n",
+    sHostReplayStats.ulRecords, sHostReplayStats.ulWakeups,
+    sHostReplayStats.ulSkipped, sHostReplayStats.ulErrors,
+    sHostReplayStats.ulMismatches);
+  return (bOk && (sHostReplayStats.ulErrors == 0)
+    && (sHostReplayStats.ulMismatches == 0)) ? 0 : 1;
+}
@@ -6,15 +6,83 @@
  *
  * @date  16.10.2019
  * @date  22.10.2019
+ * @date  19.10.2026    Busstatistik und Fehlereinspeisung
+ * @date  19.10.2026    Begrenzte Wartezeit und Freigabe ber SWRST
  ******************************************************************************/
  
 /*- Headerdateien ------------------------------------------------------------*/
 #include "stm8l15x.h"
-#include "powerlib.h"
 #include "commlib_i2c_interrupt.h"
 #include "commlib_i2c.h"
 
 
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Busstatistik                                                              */
+static I2CMaster_Stats sI2CStats;
+
+#ifdef I2C_FAULTS
+/*! Art des eingespeisten Fehlers                                             */
+static I2CMaster_Fault eI2CFault;
+
+/*! Anzahl der noch zu verflschenden Lesezugriffe                            */
+static uint8_t ucI2CFaultCnt;
+#endif /* I2C_FAULTS */
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Schnittstelle ber SWRST zurcksetzen und neu initialisieren. SWRST
+ * lscht alle Register und gibt SDA/SCL frei; ohne Zurcknehmen des Bits
+ * ignoriert die Schnittstelle jedes weitere START.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void I2CMaster_Recover(void)
+{
+  ++sI2CStats.uiRecoveries;
+  I2C_SoftwareResetCmd(I2C1, ENABLE);
+  I2C_SoftwareResetCmd(I2C1, DISABLE);
+  I2CMaster_Init();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Auf das Ende des laufenden Auftrags warten. Die Wartezeit ist begrenzt,
+ * da bei einem hngenden Bus kein Interrupt mehr kommt; danach wird die
+ * Schnittstelle zurckgesetzt.
+ *
+ * @return    bool      true, wenn der Auftrag fehlerfrei abgeschlossen ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool I2CMaster_Wait(void)
+{
+  uint16_t uiPolls;
+  
+  for (uiPolls = COMMLIB_I2C_WAIT_POLLS; uiPolls > 0; --uiPolls)
+  {
+    if (I2CMaster_Int_IsReady())
+    {
+      return true;
+    }
+    if (I2CMaster_Int_IsError())
+    {
+      ++sI2CStats.uiErrors;
+      I2CMaster_Int_Flush();
+      return false;
+    }
+    nop();
+  }
+  
+  ++sI2CStats.uiTimeouts;
+  ++sI2CStats.uiErrors;
+  I2CMaster_Recover();
+  return false;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
 /*!**************************************************************************** 
  * @brief
  * I2C Master Schnittstelle initialisieren
@@ -71,24 +139,23 @@ I2CMaster_TxData_TypeDef* I2CMaster_GetTx(void)
  * @param[in] ucValue       Registerwert
  *
  * @date  22.10.2019
+ * @date  19.10.2026    Busstatistik, begrenzte Wartezeit
  ******************************************************************************/
 void I2CMaster_RegisterWrite(uint8_t ucSlaveAddr, uint8_t ucRegister, uint8_t ucValue)
 {
-  //while (!I2CMaster_Int_IsReady() && !I2CMaster_Int_IsError());
   if (!I2CMaster_Int_IsReady())
   {
-    I2C_GenerateSTOP(I2C1, ENABLE);
-    while (I2C_GetFlagStatus(I2C1, I2C_FLAG_STOPF)) { Power_Wait(); }
-    I2C_GenerateSTOP(I2C1, DISABLE);
-    I2CMaster_Int_Flush();
+    I2CMaster_Recover();
   }
     
-  /* Datensatz zusammenstellen */
+  /* Datensatz zusammenstellen                            */
   I2CMaster_GetTx()->ucRegister = ucRegister;
   I2CMaster_GetTx()->aucData[0] = ucValue;
   I2CMaster_Int_QueueTransmit(ucSlaveAddr, 2);
+  ++sI2CStats.ulTransfers;
+  sI2CStats.ulBytes += 3;
   
-  while (!I2CMaster_Int_IsReady() && !I2CMaster_Int_IsError()) { Power_Wait(); }
+  (void)I2CMaster_Wait();
 }
 
 /*!****************************************************************************
@@ -99,35 +166,115 @@ void I2CMaster_RegisterWrite(uint8_t ucSlaveAddr, uint8_t ucRegister, uint8_t uc
  * @param[in] ucRegister    Register/Offset
  * 
  * @date  22.10.2019
+ * @date  19.10.2026    Busstatistik und Fehlereinspeisung, begrenzte
+ *                      Wartezeit
  ******************************************************************************/
 uint8_t I2CMaster_RegisterRead(uint8_t ucSlaveAddr, uint8_t ucRegister)
 {
-  //while (!I2CMaster_Int_IsReady() && !I2CMaster_Int_IsError());
+  uint8_t ucData;
+  
+  #ifdef I2C_FAULTS
+  I2CMaster_Fault eFault = I2CMaster_Fault_NONE;
+  
+  if (ucI2CFaultCnt > 0)
+  {
+    --ucI2CFaultCnt;
+    eFault = eI2CFault;
+  }
+  if (eFault == I2CMaster_Fault_NAK)
+  {
+    ++sI2CStats.uiErrors;
+    return 0xFF;
+  }
+  #endif /* I2C_FAULTS */
+  
   if (!I2CMaster_Int_IsReady())
   {
-    I2C_GenerateSTOP(I2C1, ENABLE);
-    while (I2C_GetFlagStatus(I2C1, I2C_FLAG_STOPF)) { Power_Wait(); }
-    I2C_GenerateSTOP(I2C1, DISABLE);
-    I2CMaster_Int_Flush();
+    I2CMaster_Recover();
+  }
+  
+  #ifdef I2C_FAULTS
+  if (eFault == I2CMaster_Fault_BUSY)
+  {
+    /* Ohne Ereignisinterrupt bleibt der Auftrag stehen   */
+    I2C_ITConfig(I2C1, I2C_IT_EVT, DISABLE);
   }
+  #endif /* I2C_FAULTS */
   
   /* Registeradresse senden                               */
   I2CMaster_Int_ClearRx();
   I2CMaster_GetTx()->ucRegister = ucRegister;
   I2CMaster_Int_QueueTransmit(ucSlaveAddr, 1);
-  while (!I2CMaster_Int_IsReady() && !I2CMaster_Int_IsError()) { Power_Wait(); }
-  if (I2CMaster_Int_IsError())
+  ++sI2CStats.ulTransfers;
+  sI2CStats.ulBytes += 2;
+  if (!I2CMaster_Wait())
   {
     return 0xFF;
   }
   
   /* Registerinhalt lesen                                 */
   I2CMaster_Int_QueueReceive(ucSlaveAddr, 1);
-  while (!I2CMaster_Int_IsReady() && !I2CMaster_Int_IsError()) { Power_Wait(); }
-  if (I2CMaster_Int_IsError())
+  ++sI2CStats.ulTransfers;
+  sI2CStats.ulBytes += 2;
+  if (!I2CMaster_Wait())
   {
     return 0xFF;
   }
   
-  return I2CMaster_GetRx()->aucData[0];
-}
\ No newline at end of file
+  ucData = I2CMaster_GetRx()->aucData[0];
+  
+  #ifdef I2C_FAULTS
+  if (eFault == I2CMaster_Fault_CORRUPT)
+  {
+    ucData = (uint8_t)~ucData;
+  }
+  #endif /* I2C_FAULTS */
+  
+  return ucData;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Busstatistik abfragen
+ *
+ * @return    const I2CMaster_Stats*  Busstatistik
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const I2CMaster_Stats* I2CMaster_GetStats(void)
+{
+  return &sI2CStats;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Busstatistik zurcksetzen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void I2CMaster_ClearStats(void)
+{
+  sI2CStats.ulTransfers = 0;
+  sI2CStats.ulBytes = 0;
+  sI2CStats.uiErrors = 0;
+  sI2CStats.uiRecoveries = 0;
+  sI2CStats.uiTimeouts = 0;
+}
+
+#ifdef I2C_FAULTS
+/*!****************************************************************************
+ * @brief
+ * Fehler fr die nchsten Registerlesezugriffe einspeisen, um die Reaktion
+ * der Sensortreiber und des Watchdogs ohne defekte Hardware zu prfen
+ *
+ * @param[in] eFault    Art des Fehlers
+ * @param[in] ucCount   Anzahl der betroffenen Lesezugriffe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void I2CMaster_SetFault(I2CMaster_Fault eFault, uint8_t ucCount)
+{
+  eI2CFault = eFault;
+  ucI2CFaultCnt = ucCount;
+}
+#endif /* I2C_FAULTS */
\ No newline at end of file
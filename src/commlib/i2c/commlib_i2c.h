@@ -6,6 +6,8 @@
  *
  * @date  16.10.2019
  * @date  22.20.2019
+ * @date  19.10.2026    Busstatistik und Fehlereinspeisung
+ * @date  19.10.2026    Begrenzte Wartezeit und Freigabe ber SWRST
  ******************************************************************************/
 
 #ifndef COMMLIB_I2C_H_
@@ -19,6 +21,16 @@
 /*- Symbolische Konstanten ---------------------------------------------------*/
 #define COMMLIB_I2C_MAX_BUF   2
 
+/*! Abfragen bis zum Abbruch eines Auftrags (ca. 10 ms bei 16 MHz)            */
+#define COMMLIB_I2C_WAIT_POLLS  10000u
+
+/*! Registerzugriffe der Sensortreiber inline erweitern (Cosmic: @inline)     */
+#ifdef __CSMC__
+#define COMMLIB_I2C_INLINE    @inline
+#else
+#define COMMLIB_I2C_INLINE    inline
+#endif /* __CSMC__ */
+
 
 /*- Typdefinitionen ----------------------------------------------------------*/
 typedef struct tag_I2CMaster_TxData_TypeDef {
@@ -29,6 +41,53 @@ typedef struct tag_I2CMaster_RxData_TypeDef {
   volatile uint8_t aucData[COMMLIB_I2C_MAX_BUF];
 } I2CMaster_RxData_TypeDef;
 
+/*!****************************************************************************
+ * @brief
+ * Busstatistik zur Bewertung der Sensortreiber
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_I2CMaster_Stats {
+  /*! bertragungen von START bis STOP                    */
+  uint32_t ulTransfers;
+  
+  /*! Bytes auf dem Bus einschlielich Adressbyte         */
+  uint32_t ulBytes;
+  
+  /*! Abgebrochene bertragungen                          */
+  uint16_t uiErrors;
+  
+  /*! Schnittstelle ber SWRST freigegeben                */
+  uint16_t uiRecoveries;
+  
+  /*! Auftrge ohne Abschluss in COMMLIB_I2C_WAIT_POLLS   */
+  uint16_t uiTimeouts;
+} I2CMaster_Stats;
+
+#ifdef I2C_FAULTS
+/*!****************************************************************************
+ * @brief
+ * Eingespeiste Fehler beim Registerlesen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_I2CMaster_Fault {
+  /*! Kein Fehler                                         */
+  I2CMaster_Fault_NONE,
+  
+  /*! Slave antwortet nicht (NAK), Ergebnis 0xFF          */
+  I2CMaster_Fault_NAK,
+  
+  /*! Gelesenes Byte invertiert                           */
+  I2CMaster_Fault_CORRUPT,
+  
+  /*! Auftrag bleibt nach START stehen (Wartezeit)        */
+  I2CMaster_Fault_BUSY,
+  
+  I2CMaster_Fault_NUM
+} I2CMaster_Fault;
+#endif /* I2C_FAULTS */
+
 
 /*- Funktionsdeklarationen ---------------------------------------------------*/
 void I2CMaster_Init(void);
@@ -40,4 +99,10 @@ I2CMaster_TxData_TypeDef* I2CMaster_GetTx(void);*/
 void I2CMaster_RegisterWrite(uint8_t ucSlaveAddr, uint8_t ucRegister, uint8_t ucValue);
 uint8_t I2CMaster_RegisterRead(uint8_t ucSlaveAddr, uint8_t ucRegister);
 
+const I2CMaster_Stats* I2CMaster_GetStats(void);
+void I2CMaster_ClearStats(void);
+#ifdef I2C_FAULTS
+void I2CMaster_SetFault(I2CMaster_Fault eFault, uint8_t ucCount);
+#endif /* I2C_FAULTS */
+
 #endif /* COMMLIB_I2C_H_ */
\ No newline at end of file
@@ -45,6 +45,34 @@ volatile uint8_t ucIsrDebug;
 volatile I2CMaster_Int_Mode eMode;
 
 
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Auf das letzte Empfangsbyte warten (begrenzt, im Fehlerfall bernimmt
+ * I2CMaster_Wait() die Freigabe der Schnittstelle)
+ *
+ * @return    bool      true, wenn RXNE gesetzt ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool I2CMaster_Int_WaitRxne(void)
+{
+  uint16_t uiPolls;
+  
+  for (uiPolls = COMMLIB_I2C_WAIT_POLLS; uiPolls > 0; --uiPolls)
+  {
+    if (I2C_GetFlagStatus(I2C1, I2C_FLAG_RXNE))
+    {
+      return true;
+    }
+  }
+  
+  eMode = I2CMaster_Int_Mode_ERROR;
+  return false;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
 /*!****************************************************************************
  * @brief
  * Interrupts fr I2C-Schnittstelle initialisieren 
@@ -173,20 +201,19 @@ bool I2CMaster_Int_IsError(void)
  * I2C Interruptserviceroutine - FSM abarbeiten
  *
  * @date  22.10.2019
+ * @date  19.10.2026    Compilerunabhngige Deklaration
+ * @date  19.10.2026    NAK auch beim Senden, begrenzte Wartezeit auf RXNE
  ******************************************************************************/
-@far @interrupt void I2CMaster_Int_I2CInterruptHandler(void)
+INTERRUPT_HANDLER(I2CMaster_Int_I2CInterruptHandler, 29)
 {
   if (I2C_GetFlagStatus(I2C1, I2C_FLAG_AF))
   {
-    /* ACK Fehler erkannt                              */
+    /* ACK Fehler erkannt (Adresse oder Daten, in beiden   *
+     * Richtungen): bertragung mit STOP beenden           */
     I2C_ClearFlag(I2C1, I2C_FLAG_AF);
-    
-    if (eMode == I2CMaster_Int_Mode_RECEIVE)
-    {
-      I2C_SoftwareResetCmd(I2C1, ENABLE);
-      eMode = I2CMaster_Int_Mode_ERROR;
-      return;
-    }
+    I2C_GenerateSTOP(I2C1, ENABLE);
+    eMode = I2CMaster_Int_Mode_ERROR;
+    return;
   }
   
   if (I2C_GetFlagStatus(I2C1, I2C_FLAG_OVR))
@@ -264,9 +291,11 @@ bool I2CMaster_Int_IsError(void)
       {
         I2C_AcknowledgeConfig(I2C1, DISABLE);
         I2C_GenerateSTOP(I2C1, ENABLE);
-        while (!I2C_GetFlagStatus(I2C1, I2C_FLAG_RXNE));
-        aucRxBuf[ucRxCtr] = I2C_ReceiveData(I2C1);
-        eMode = I2CMaster_Int_Mode_IDLE;
+        if (I2CMaster_Int_WaitRxne())
+        {
+          aucRxBuf[ucRxCtr] = I2C_ReceiveData(I2C1);
+          eMode = I2CMaster_Int_Mode_IDLE;
+        }
       }
     }
     break;
@@ -285,12 +314,14 @@ bool I2CMaster_Int_IsError(void)
           /* Letztes Byte                                 */
           I2C_AcknowledgeConfig(I2C1, DISABLE);
           I2C_GenerateSTOP(I2C1, ENABLE);
-          while (!I2C_GetFlagStatus(I2C1, I2C_FLAG_RXNE));
-          aucRxBuf[ucRxCtr] = I2C_ReceiveData(I2C1);
-          ucIsrDebug = I2C1->SR1;
-          ucIsrDebug = I2C_ReceiveData(I2C1);
-          ucIsrDebug = I2C_ReceiveData(I2C1);
-          eMode = I2CMaster_Int_Mode_IDLE;
+          if (I2CMaster_Int_WaitRxne())
+          {
+            aucRxBuf[ucRxCtr] = I2C_ReceiveData(I2C1);
+            ucIsrDebug = I2C1->SR1;
+            ucIsrDebug = I2C_ReceiveData(I2C1);
+            ucIsrDebug = I2C_ReceiveData(I2C1);
+            eMode = I2CMaster_Int_Mode_IDLE;
+          }
         }
         else
         {
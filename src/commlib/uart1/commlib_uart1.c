@@ -10,6 +10,8 @@
 /*- Headerdateien ------------------------------------------------------------*/
 #include "stm8l15x.h"
 #include "commlib_uart1.h"
+#include "Scheduler.h"
+#include "Deferred.h"
 
 
 /*- Typdefinitionen ----------------------------------------------------------*/
@@ -265,8 +267,9 @@ void UART1_SetEchoMode(bool bEnable)
  * Interruptserviceroutine fr Datenausgabe an der UART1-Schnittstelle
  *
  * @date  26.10.2019
+ * @date  19.10.2026    Compilerunabhngige Deklaration
  ******************************************************************************/
-@far @interrupt void UART1_TxInterruptHandler(void)
+INTERRUPT_HANDLER(UART1_TxInterruptHandler, 27)
 {
   switch (eUart1TxMode)
   {
@@ -307,9 +310,11 @@ void UART1_SetEchoMode(bool bEnable)
  * Interruptserviceroutine fr Datenempfang an der UART1-Schnittstelle
  *
  * @date  26.10.2019
+ * @date  19.10.2026    Ereignis fr Scheduler, Laufzeitmessung
  ******************************************************************************/
-@far @interrupt void UART1_RxInterruptHandler(void)
+INTERRUPT_HANDLER(UART1_RxInterruptHandler, 28)
 {
+  uint16_t uiStart = Deferred_GetUs();
   uint8_t ucRxData = USART_ReceiveData8(USART1);
   
   if (bUart1EchoMode)
@@ -328,6 +333,7 @@ void UART1_SetEchoMode(bool bEnable)
       if (((char)ucRxData == cUart1RxEndChar) || (ucUart1RxCtr >= ucUart1RxLen))
       {
         eUart1RxMode = UART1_Mode_IDLE;
+        Sched_Post(Sched_Event_UART1_RX);
       }
       break;
       /*if ((ucUart1RxCtr < ucUart1RxLen) && ((char)ucRxData != cUart1RxEndChar))
@@ -357,6 +363,7 @@ void UART1_SetEchoMode(bool bEnable)
       if (ucUart1RxCtr >= ucUart1RxLen)
       {
         eUart1RxMode = UART1_Mode_IDLE;
+        Sched_Post(Sched_Event_UART1_RX);
       }
       break;
       /*if (ucUart1RxCtr < ucUart1RxLen)
@@ -381,4 +388,6 @@ void UART1_SetEchoMode(bool bEnable)
       //USART_ITConfig(USART1, USART_IT_RXNE, DISABLE);
       ;
   }
+  
+  Deferred_IsrDone(Deferred_Isr_UART1_RX, uiStart);
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 /*- Headerdateien ------------------------------------------------------------*/
 #include "stm8l15x.h"
 #include "commlib_uart3.h"
+#include "Scheduler.h"
+#include "Deferred.h"
 
 
 /*- Typdefinitionen ----------------------------------------------------------*/
@@ -286,8 +288,9 @@ void UART3_FlushTx(void)
  * Interruptserviceroutine fr Datenausgabe an der UART3-Schnittstelle
  *
  * @date  26.10.2019
+ * @date  19.10.2026    Compilerunabhngige Deklaration
  ******************************************************************************/
-@far @interrupt void UART3_TxInterruptHandler(void)
+INTERRUPT_HANDLER(UART3_TxInterruptHandler, 21)
 {
   switch (eUart3TxMode)
   {
@@ -329,9 +332,11 @@ void UART3_FlushTx(void)
  *
  * @date  26.10.2019
  * @date  30.10.2019    Trigger hinzugefgt
+ * @date  19.10.2026    Ereignis fr Scheduler, Laufzeitmessung
  ******************************************************************************/
-@far @interrupt void UART3_RxInterruptHandler(void)
+INTERRUPT_HANDLER(UART3_RxInterruptHandler, 22)
 {
+  uint16_t uiStart = Deferred_GetUs();
   uint8_t ucRxData = USART_ReceiveData8(USART3);
   
   switch (eUart3RxMode)
@@ -363,6 +368,7 @@ void UART3_FlushTx(void)
       if (((char)ucRxData == cUart3RxEndChar) || (ucUart3RxCtr >= ucUart3RxLen))
       {
         eUart3RxMode = UART3_Mode_IDLE;
+        Sched_Post(Sched_Event_UART3_RX);
       }
       break;
       
@@ -375,10 +381,13 @@ void UART3_FlushTx(void)
       if (ucUart3RxCtr >= ucUart3RxLen)
       {
         eUart3RxMode = UART3_Mode_IDLE;
+        Sched_Post(Sched_Event_UART3_RX);
       }
       break;
       
     default:
       ;
   }
+  
+  Deferred_IsrDone(Deferred_Isr_UART3_RX, uiStart);
 }
\ No newline at end of file
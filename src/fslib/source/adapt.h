@@ -7,7 +7,8 @@
 
 void init_port(void)
 {
-  /* Ports bereits in main() initialisiert */
+  /* Ports bereits in main() initialisiert, nur SPI2-Takt einschalten */
+  CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, ENABLE);
 }
 
 void dly_us(volatile int n)
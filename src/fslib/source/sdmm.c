@@ -42,6 +42,9 @@
 #define CS_H()    GPIO_WriteBit(SD_CS_PORT, SD_CS_PIN, ENABLE);
 #define CS_L()    GPIO_WriteBit(SD_CS_PORT, SD_CS_PIN, DISABLE);
 
+#define SPI_CLK_ON()  CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, ENABLE);
+#define SPI_CLK_OFF() CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, DISABLE);
+
 /*--------------------------------------------------------------------------
 
    Module Private Functions
@@ -160,7 +163,9 @@ void deselect (void)
 	BYTE d;
 
 	CS_H();				/* Set CS# high */
+	SPI_CLK_ON();		/* Also called while gated (send_cmd, select) */
 	rcvr_mmc(&d, 1);	/* Dummy clock (force DO hi-z for multiple slave SPI) */
+	SPI_CLK_OFF();		/* Gate SPI2 clock until next access */
 }
 
 
@@ -174,6 +179,7 @@ int select (void)	/* 1:OK, 0:Timeout */
 {
 	BYTE d;
 
+	SPI_CLK_ON();		/* Ungate SPI2 clock */
 	CS_L();				/* Set CS# low */
 	rcvr_mmc(&d, 1);	/* Dummy clock (force DO enabled) */
 	if (wait_ready()) return 1;	/* Wait for card ready */
@@ -7,8 +7,20 @@
 #include "ATCmd.h"
 #include "GPSHandler.h"
 #include "SensorLog.h"
+#include "EnergyCounter.h"
+#include "PowerGov.h"
+#include "Timebase.h"
+#include "Scheduler.h"
+#include "Deferred.h"
+#include "Profiler.h"
+#include "RamStat.h"
+#include "Watchdog.h"
+#include "Trace.h"
+#include "Logger.h"
+#include "Rollup.h"
 #include "sensorlib.h"
 #include "motorlib.h"
+#include "powerlib.h"
 #include "diskio.h"
 #include "ff.h"
 #include "io_map.h"
@@ -32,22 +44,27 @@
 #define IPV_SLOPE_CAL   4459          /* Kennlinie fr IPV                    */
 /*! @}                                                                        */
 
+/*! @brief berabtastung der Strom- und Spannungsmessung (4^n Samples)
+ * @{                                                                         */
+#define IBAT_OSR_BITS   3             /* 64 Samples, 15 bit                   */
+#define UBAT_OSR_BITS   2             /* 16 Samples, 14 bit                   */
+#define IPV_OSR_BITS    3             /* 64 Samples, 15 bit                   */
+#define UPV_OSR_BITS    2             /* 16 Samples, 14 bit                   */
+/*! @}                                                                        */
 
-/*- Globale Variablen --------------------------------------------------------*/
-bool bDir;
-
-/*! Timer-Zhler fr 1s-Task                                                  */
-volatile int iTimer1s = 10;
+/*! Panelspannung in mV, unter der kein Solarstrom flieen kann               */
+#define UPV_DARK_VOLT   500
 
-/*! Statusflag fr Ausfhrung des 1s-Task                                     */
-volatile bool bTask1sFlag = true;
 
-/*! Statusflag fr Ausfhrung des Wakeup-Task                                 */
-volatile bool bTaskWakeupFlag = true;
+/*- Globale Variablen --------------------------------------------------------*/
+bool bDir;
 
 /*! Konfigurationsdaten fr die interne Echtzeituhr                           */
 RTC_InitTypeDef sRtcInit;
 
+/*! Sekundenalarm der internen Echtzeituhr                                    */
+RTC_AlarmTypeDef sRtcAlarm;
+
 /*! Datumsangabe fr/aus interner Echtzeituhr                                 */
 RTC_DateTypeDef sDate;
 
@@ -80,7 +97,50 @@ FATFS fs;
 
 
 /*- Funktionsprototypen ------------------------------------------------------*/
+void TaskDeferred(void);
+void Task100ms(void);
+void Task1s(void);
+void TaskGovernor(void);
+void TaskWakeup(void);
+void TaskGps(void);
 void SaveSensors(void);
+void TraceInputs(void);
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! @brief Tasktabelle fr den Scheduler
+ *
+ * Bei gleicher Prioritt luft der frhere Eintrag zuerst. Die Wakeup-Tasks
+ * setzen die Messwerte von TaskWakeup voraus, das Protokoll kommt zuletzt.
+ * Fristen in ms vom Bereitwerden bis zum Ende, alle unter dem Fenster des
+ * Watchdogs von 1,7 s. Lange AT-Ausgaben laufen in Abschnitten als "ATX"
+ * mit der niedrigsten Prioritt.                                             */
+static const Sched_Task asTasks[] = {
+  {"ISR",   TaskDeferred,          SCHED_EVENT(Sched_Event_DEFERRED), 0, 0, 50},
+  {"BT",    BTHandler_Poll,        SCHED_EVENT(Sched_Event_UART1_RX), 1, 0, 100},
+  {"AT",    ATCmd_Poll,            SCHED_EVENT(Sched_Event_UART1_RX), 0, 0, 500},
+  {"GPS",   TaskGps,               SCHED_EVENT(Sched_Event_UART3_RX), 0, 1, 200},
+  {"PWR",   Task100ms,             SCHED_EVENT(Sched_Event_TICK),     1, 1, 100},
+  {"WKUP",  TaskWakeup,            SCHED_EVENT(Sched_Event_WAKEUP),   0, 2, 1000},
+  {"BTWK",  BTHandler_TaskWakeup,  SCHED_EVENT(Sched_Event_WAKEUP),   0, 3, 1000},
+  {"GPSWK", GPSHandler_TaskWakeup, SCHED_EVENT(Sched_Event_WAKEUP),   0, 3, 1000},
+  {"TRKWK", Tracking_TaskWakeup,   SCHED_EVENT(Sched_Event_WAKEUP),   0, 3, 1000},
+  {"1S",    Task1s,                0,                                 1, 4, 500},
+  {"ENRGY", Energy_Task1s,         0,                                 1, 4, 500},
+  {"PGOV",  TaskGovernor,          0,                                 1, 4, 500},
+  {"TRK",   Tracking_Task1s,       0,                                 1, 4, 500},
+  {"BT1S",  BTHandler_Task1s,      0,                                 1, 4, 500},
+  {"LOG",   SaveSensors,           SCHED_EVENT(Sched_Event_WAKEUP),   0, 7, 1500},
+  {"ATX",   ATCmd_TaskResume,      SCHED_EVENT(Sched_Event_RESUME),   0, 8, 1000}
+};
+#define NUM_SCHED_TASKS (sizeof(asTasks)/sizeof(*asTasks))
+SCHED_CHECK_TABLE(NUM_SCHED_TASKS);
+
+/*! Sekunden seit dem letzten Wakeup                                          */
+static uint16_t uiWakeSecs;
+
+/*! Messfenster des Anemometers offen, Active-Halt gesperrt                   */
+static bool bWindWindow;
 
 
 /*!****************************************************************************
@@ -91,20 +151,33 @@ void SaveSensors(void);
  ******************************************************************************/
 void main(void)
 {  
+  /* Freien Stack fr die Hchststandsmessung fllen      */
+  RamStat_Paint();
+  
   /* 16 MHz System Clock                                  */
   CLK_SYSCLKSourceConfig(CLK_SYSCLKSource_HSI);
   CLK_SYSCLKDivConfig(CLK_SYSCLKDiv_1);
   
+  /* Resetursache, Spur nach einem Watchdog-Reset         */
+  Watchdog_Init();
+  
   /* External 32.768 kHz Clock for RTC                    */
   CLK_LSEConfig(CLK_LSE_ON);
   CLK_RTCClockConfig(CLK_RTCCLKSource_LSE, CLK_RTCCLKDiv_1);
   
-  /* Timer 2 fr 100ms-Task Trigger                       */
-  CLK_PeripheralClockConfig(CLK_Peripheral_TIM2, ENABLE);
-  TIM2_InternalClockConfig();
-  TIM2_TimeBaseInit(TIM2_Prescaler_128, TIM2_CounterMode_Down, 12500);
-  TIM2_ITConfig(TIM2_IT_Update, ENABLE);
-  TIM2_Cmd(ENABLE);
+  /* Timer 2 fr 100ms-Task, luft nur bei Bedarf         */
+  Timebase_Init();
+  
+  /* Tasks und Ereignisse                                 */
+  Sched_Init(asTasks, NUM_SCHED_TASKS);
+  
+  /* Warteschlange der Interrupts, Timer 1 als s-Zhler  */
+  Deferred_Init();
+  
+  #ifdef PROFILER
+  /* Laufzeitmessung von Tasks und Treibern               */
+  Profiler_Init();
+  #endif /* PROFILER */
   
   /* GPIO Button                                          */
   GPIO_Init(BTN_BLUE_PORT, BTN_BLUE_PIN, GPIO_Mode_In_FL_No_IT);
@@ -118,12 +191,14 @@ void main(void)
   ADC_Init(ADC1, ADC_ConversionMode_Single, ADC_Resolution_12Bit, ADC_Prescaler_1);
   ADC_Cmd(ADC1, ENABLE);
   
+  #ifdef PWM_DEMO
   /* Timer 5 as PWM output                                */
   CLK_PeripheralClockConfig(CLK_Peripheral_TIM5, ENABLE);
   TIM5_TimeBaseInit(TIM5_Prescaler_128, TIM5_CounterMode_Up, 1250);
   TIM5_OC1Init(TIM5_OCMode_PWM1, TIM5_OutputState_Enable, 3000, TIM5_OCPolarity_High, TIM5_OCIdleState_Reset);
   TIM5_CtrlPWMOutputs(ENABLE);
   TIM5_Cmd(ENABLE);
+  #endif /* PWM_DEMO */
   
   /* Debug UART TX only                                   */
   GPIO_Init(USART2_PORT, USART2_TX_PIN, GPIO_Mode_Out_PP_High_Fast);
@@ -153,10 +228,22 @@ void main(void)
   sRtcInit.RTC_HourFormat = RTC_HourFormat_24;
   RTC_Init(&sRtcInit);
   RTC_WakeUpClockConfig(RTC_WakeUpClock_CK_SPRE_16bits);
-  RTC_SetWakeUpCounter(10);
+  RTC_SetWakeUpCounter(POWERGOV_DEFAULT_INTV);
   RTC_WakeUpCmd(ENABLE);
   RTC_ITConfig(RTC_IT_WUT, ENABLE);
   
+  /* Alarm A ohne Vergleich fr den 1s-Task               */
+  RTC_AlarmCmd(DISABLE);
+  RTC_AlarmStructInit(&sRtcAlarm);
+  sRtcAlarm.RTC_AlarmMask = RTC_AlarmMask_All;
+  RTC_SetAlarm(RTC_Format_BIN, &sRtcAlarm);
+  RTC_AlarmSubSecondConfig(0, RTC_AlarmSubSecondMask_All);
+  RTC_ITConfig(RTC_IT_ALRA, ENABLE);
+  RTC_AlarmCmd(ENABLE);
+  
+  /* Energiesparmodi                                      */
+  LowPower_Init();
+  
   /* SPI und SD-Karte                                     */
   GPIO_Init(SPI2_PORT, SPI2_SCK_PIN, GPIO_Mode_Out_PP_Low_Fast);
   GPIO_Init(SPI2_PORT, SPI2_MOSI_PIN, GPIO_Mode_Out_PP_Low_Fast);
@@ -175,6 +262,9 @@ void main(void)
   );
   SPI_Cmd(SPI2, ENABLE);
   
+  /* SPI2-Takt nur whrend der Kartenzugriffe (sdmm.c)    */
+  CLK_PeripheralClockConfig(CLK_Peripheral_SPI2, DISABLE);
+  
   /* RTC initialisieren                                   */
   #ifdef STATIC_INIT_RTC
   RTC_TimeStructInit(&sTime);
@@ -199,7 +289,13 @@ void main(void)
   
   /* Sun Tracking                                         */
   Tracking_Init();
+  
+  /* Lastabwurf nach Batteriezustand                      */
+  PowerGov_Init();
    
+  /* Blinkmuster whrend der Initialisierung starten      */
+  Timebase_Update();
+  
   /* Enable interrupt execution                           */
   enableInterrupts();
   printf("Program started\r\n");
@@ -215,6 +311,8 @@ void main(void)
   MPU6050_Init(&sSensorMPU6050, 0x68, false);
   printf(" OK\r\nWind Timer + ADC init...");
   Wind_Init(&sSensorWind, 1000); 
+  LowPower_SetLock(LowPower_Lock_WIND, true);
+  bWindWindow = true;
   printf(" OK\r\nCPU Temp init...");
   CPUTemp_Init(&sSensorCPUTemp);
   printf(" OK\r\nPBAT init...");
@@ -223,12 +321,17 @@ void main(void)
     ADC1_UBAT_IN1_PORT, ADC1_UBAT_IN1_PIN);
   Power_SetVoltRef(&sSensorPBAT, UBAT_SLOPE_CAL);
   Power_SetCurrRef(&sSensorPBAT, IBAT_ZERO_OFFS, IBAT_SLOPE_CAL);
+  Power_SetOversampling(&sSensorPBAT, IBAT_OSR_BITS, UBAT_OSR_BITS);
   printf(" OK\r\nPPV init...");
   Power_Init(&sSensorPPV, ADC1_IPV_IN0_CH, ADC1_UPV_IN2_CH, \
     ADC1_IPV_IN0_PORT, ADC1_IPV_IN0_PIN, \
     ADC1_UPV_IN2_PORT, ADC1_UPV_IN2_PIN);
   Power_SetVoltRef(&sSensorPPV, UPV_SLOPE_CAL);
   Power_SetCurrRef(&sSensorPPV, IPV_ZERO_OFFS, IPV_SLOPE_CAL);
+  Power_SetOversampling(&sSensorPPV, IPV_OSR_BITS, UPV_OSR_BITS);
+  LowPower_AdcCmd(false);
+  printf(" OK\r\nEnergy init...");
+  Energy_Init();
   printf(" OK\r\nMotor init...");
   I2CMaster_DeInit();
   Motor_SetTurnRef(sSensorQMC5883.sMeasure.uiAzimuth);
@@ -245,7 +348,14 @@ void main(void)
     printf(" FAIL\r\n");
   }
   
-  Blink_SetPattern(Blink_Led_SYS, 0x0001);
+  /* Aufzeichnung der Eingangsdaten, falls eingeschaltet  */
+  Trace_Init(Watchdog_GetReport()->ucCause);
+  
+  /* Format des Protokolls                                */
+  Logger_Init();
+  Rollup_Init();
+  
+  Blink_SetPattern(Blink_Led_SYS, 0x0000);
   
   #ifdef FATFS_DEMO
   printf("SD-Card init...");
@@ -285,127 +395,282 @@ void main(void)
   }
   #endif /* FATFS_DEMO */
   
+  /* Erster Durchlauf von 1s- und Wakeup-Task             */
+  Sched_Post(Sched_Event_SECOND);
+  Sched_Post(Sched_Event_WAKEUP);
+  
+  /* Ab hier berwacht, max. 1,7 s je Task                */
+  Watchdog_Start();
+  
   while (1)
   {
-    if (bTask1sFlag)
+    /* Bereiten Task mit hchster Prioritt ausfhren     */
+    Sched_Run();
+    
+    /* Nachladen nur, wenn kein Task berfllig ist       */
+    Watchdog_Poll();
+    
+    /* Fertig - bis zum nchsten Interrupt schlafen       */
+    /* Prfung bei gesperrten Interrupts, wfi gibt frei   */
+    disableInterrupts();
+    Timebase_Update();
+    if (Sched_IsIdle())
     {
-      bTask1sFlag = false;
-      //printf("Task1s\r\n");
-      
-      /* Wind-Mittelwert und -Ben auswerten              */
-      Wind_UpdateSpd(&sSensorWind);
-      
-      /* Winkel aktualisieren                             */
-      I2CMaster_Init();
-      MPU6050_Update(&sSensorMPU6050);
-      QMC5883_Update(&sSensorQMC5883);
-      I2CMaster_DeInit();
-      
-      /* Spannungen messen                                */
-      Power_Update(&sSensorPBAT);
-      Power_Update(&sSensorPPV);
-      
-      /* Tracking                                         */
-      Tracking_Task1s();
-      printf("Align: %d, %d, %d\r\n", sSensorQMC5883.sRaw.iRawX, sSensorQMC5883.sRaw.iRawY, sSensorQMC5883.sMeasure.uiAzimuth);
-      //printf("Pwr: %d, %d, %d, %d\r\n", sSensorPBAT.sMeasure.iCurr, sSensorPBAT.sMeasure.uiVolt, sSensorPPV.sMeasure.iCurr, sSensorPPV.sMeasure.uiVolt);
-      
-      /* Blauen Taster fr Bluetooth-Weckfunktion         */
-      if (!GPIO_ReadInputDataBit(BTN_BLUE_PORT, BTN_BLUE_PIN))
-      {
-        BTHandler_TakeWakeup();
-      }
-      BTHandler_Task1s();
-      
-      /* Blink Pattern fr 1s-Task                        */
-      if (Blink_Ready(Blink_Led_SYS))
+      LowPower_Idle();
+    }
+    enableInterrupts();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Verzgerte Bearbeitung der Interrupts: je Eintrag der Warteschlange die
+ * flligen Teilnehmer des Timer-Ticks bzw. die Endlagenschalter bedienen
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Bearbeitung in Deferred_Dispatch()
+ ******************************************************************************/
+void TaskDeferred(void)
+{
+  Deferred_Item sItem;
+  
+  PROFILE_BEGIN(Profiler_Zone_DEFER);
+  while (Deferred_Pop(&sItem))
+  {
+    Deferred_Dispatch(&sItem);
+  }
+  PROFILE_END(Profiler_Zone_DEFER);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag der Warteschlange bearbeiten. Aufruf aus TaskDeferred() oder im
+ * Vergleichsbetrieb (AT+CISR=1) direkt aus der ISR.
+ *
+ * @param[in] *pItem    Eintrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Deferred_Dispatch(const Deferred_Item* pItem)
+{
+  switch (pItem->ucType)
+  {
+    case Deferred_Type_TICK:
+      /* Blink Pattern                                    */
+      if (pItem->ucData & TIMEBASE_DUE(Timebase_Client_BLINK))
       {
-        Blink_SetPattern(Blink_Led_SYS, 0x0001);
+        Blink_Poll();
       }
-    }
-    
-    if (bTaskWakeupFlag)
-    {      
-      bTaskWakeupFlag = false;
-      //printf("TaskWakeup\r\n");
-      Blink_SetPattern(Blink_Led_SYS, 0x005F);
       
-      #ifdef MOTORLIB_DEMO
-      if (Motor_IsTurnReached())
+      /* Lageregelung                                     */
+      if (pItem->ucData & TIMEBASE_DUE(Timebase_Client_MOTOR))
       {
-        Motor_SetTurn(bDir ? 0 : 450);
-        if (Motor_IsTiltReached())
-        {
-          Motor_SetTilt(bDir ? 0 : 900);
-          bDir = !bDir;
-        }
+        Motor_Task100ms();
       }
-      #endif /* MOTORLIB_DEMO */
+      break;
       
-      /* Sensormessswerte abrufen                         */
-      I2CMaster_Init();
-      BME280_Update(&sSensorBME280);   
-      QMC5883_Update(&sSensorQMC5883);
-      MPU6050_Update(&sSensorMPU6050);
-      Wind_UpdateDir(&sSensorWind);
-      CPUTemp_Update(&sSensorCPUTemp);
-      Power_Update(&sSensorPBAT);
-      Power_Update(&sSensorPPV);
-      I2CMaster_DeInit();
+    case Deferred_Type_LIMIT:
+      Motor_HandleLimit(pItem->ucData);
+      break;
       
-      /* Bluetooth / GPS aufwecken                        */
-      BTHandler_TakeWakeup();
-      GPSHandler_TaskWakeup();
-      
-      /* Ausrichtung starten                              */
-      Tracking_TaskWakeup();
-      
-      /* Sensordaten speichern                            */
-      SaveSensors();
+    default:
+      ;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Strme und Spannungen messen und aufintegrieren, ohne Timer-Tick nur im
+ * Sekundentakt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Task100ms(void)
+{
+  LowPower_AdcCmd(true);
+  Power_Update(&sSensorPBAT);
+  Power_Update(&sSensorPPV);
+  LowPower_AdcCmd(false);
+  Energy_Update(&sSensorPBAT, &sSensorPPV);
+}
+
+/*!****************************************************************************
+ * @brief
+ * 1s-Task fr Wind, Ausrichtung, Taster und Lebenszeichen.
+ *
+ * Das Anemometer zhlt nur in den NUM_WIND_AVG Sekunden vor jedem Wakeup,
+ * die Sperre gegen Active-Halt gilt nur in diesem Fenster. Der Durchlauf
+ * in der Sekunde des Wakeups liefert den letzten Wert vor dem Protokoll.
+ * Bei Messintervallen bis NUM_WIND_AVG + 1 bleibt das Fenster (fast) immer
+ * offen, ab den Sparstufen (300 s und mehr) berwiegt Active-Halt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Task1s(void)
+{
+  /* Wind-Mittelwert und -Ben im Messfenster auswerten   */
+  if (bWindWindow)
+  {
+    Wind_UpdateSpd(&sSensorWind);
+    if ((uiWakeSecs == 0) && (PowerGov_GetInterval() > NUM_WIND_AVG))
+    {
+      Wind_Stop(&sSensorWind);
+      LowPower_SetLock(LowPower_Lock_WIND, false);
+      bWindWindow = false;
+    }
+  }
+  else if ((uiWakeSecs + NUM_WIND_AVG) >= PowerGov_GetInterval())
+  {
+    LowPower_SetLock(LowPower_Lock_WIND, true);
+    Wind_Start(&sSensorWind);
+    bWindWindow = true;
+  }
+  ++uiWakeSecs;
+  
+  /* Winkel nur fr die Nachfhrung aktualisieren         */
+  if (PowerGov_GetTier() < PowerGov_Tier_NOTRACK)
+  {
+    I2CMaster_Init();
+    PROFILE_BEGIN(Profiler_Zone_MPU6050);
+    MPU6050_Update(&sSensorMPU6050);
+    PROFILE_END(Profiler_Zone_MPU6050);
+    PROFILE_BEGIN(Profiler_Zone_QMC5883);
+    QMC5883_Update(&sSensorQMC5883);
+    PROFILE_END(Profiler_Zone_QMC5883);
+    I2CMaster_DeInit();
+  }
+  
+  /* Nullpunkt IPV bei dunklem Panel nachfhren           */
+  if (sSensorPPV.sMeasure.uiVolt < UPV_DARK_VOLT)
+  {
+    Power_TrackCurrZero(&sSensorPPV);
+  }
+  
+  printf("Align: %d, %d, %d\r\n", sSensorQMC5883.sRaw.iRawX, sSensorQMC5883.sRaw.iRawY, sSensorQMC5883.sMeasure.uiAzimuth);
+  //printf("Pwr: %d, %d, %d, %d\r\n", sSensorPBAT.sMeasure.iCurr, sSensorPBAT.sMeasure.uiVolt, sSensorPPV.sMeasure.iCurr, sSensorPPV.sMeasure.uiVolt);
+  
+  /* Blauen Taster fr Bluetooth-Weckfunktion             */
+  if (!GPIO_ReadInputDataBit(BTN_BLUE_PORT, BTN_BLUE_PIN))
+  {
+    BTHandler_TakeWakeup();
+  }
+  
+  /* Lebenszeichen fr 1s-Task, Wakeup-Muster einmal      */
+  if (Blink_Ready(Blink_Led_SYS))
+  {
+    Blink_SetPattern(Blink_Led_SYS, 0x0000);
+    Blink_Flash(Blink_Led_SYS);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Lastabwurf nach Batteriespannung und Ladezustand
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void TaskGovernor(void)
+{
+  PowerGov_Task1s(sSensorPBAT.sMeasure.uiVolt, sEnergy.ucSoC);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wakeup-Task: alle Sensormesswerte abrufen. Bluetooth, GPS, Nachfhrung
+ * und Protokoll folgen als eigene Tasks mit niedrigerer Prioritt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void TaskWakeup(void)
+{
+  PROFILE_BEGIN(Profiler_Zone_WKUP);
+  Blink_SetPattern(Blink_Led_SYS, 0x005F);
+  uiWakeSecs = 0;
+  
+  #ifdef MOTORLIB_DEMO
+  if (Motor_IsTurnReached())
+  {
+    Motor_SetTurn(bDir ? 0 : 450);
+    if (Motor_IsTiltReached())
+    {
+      Motor_SetTilt(bDir ? 0 : 900);
+      bDir = !bDir;
+    }
+  }
+  #endif /* MOTORLIB_DEMO */
+  
+  /* Sensormessswerte abrufen                             */
+  I2CMaster_Init();
+  PROFILE_BEGIN(Profiler_Zone_BME280);
+  BME280_Update(&sSensorBME280);   
+  PROFILE_END(Profiler_Zone_BME280);
+  PROFILE_BEGIN(Profiler_Zone_QMC5883);
+  QMC5883_Update(&sSensorQMC5883);
+  PROFILE_END(Profiler_Zone_QMC5883);
+  PROFILE_BEGIN(Profiler_Zone_MPU6050);
+  MPU6050_Update(&sSensorMPU6050);
+  PROFILE_END(Profiler_Zone_MPU6050);
+  I2CMaster_DeInit();
+  LowPower_AdcCmd(true);
+  Wind_UpdateDir(&sSensorWind);
+  CPUTemp_Update(&sSensorCPUTemp);
+  Power_Update(&sSensorPBAT);
+  Power_Update(&sSensorPPV);
+  LowPower_AdcCmd(false);
+  PROFILE_END(Profiler_Zone_WKUP);
+}
+
+/*!****************************************************************************
+ * @brief
+ * NMEA-Sentences vom GPS-Modul parsen und die Echtzeituhr stellen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void TaskGps(void)
+{
+  PROFILE_BEGIN(Profiler_Zone_GPS);
+  if (GPSHandler_Poll())
+  {
+    if (sSensorGPS.sInfo.bTimeValid)
+    {
+      /* Aktualisierung der Echtzeituhr                   */
+      RTC_TimeStructInit(&sTime);
+      sTime.RTC_Hours = sSensorGPS.sTime.ucHour;
+      sTime.RTC_Minutes = sSensorGPS.sTime.ucMin;
+      sTime.RTC_Seconds = sSensorGPS.sTime.ucSec;
+      RTC_SetTime(RTC_Format_BIN, &sTime);
+      printf("GpsTime\r\n");
+      sSensorGPS.sInfo.bTimeValid = false;
     }
     
-    /* Bluetooth Verbindung und AT-Commands verarbeiten   */
-    BTHandler_Poll();
-    ATCmd_Poll();
-    
-    /* NMEA-Sentences vom GPS-Modul parsen                */
-    if (GPSHandler_Poll())
+    if (sSensorGPS.sInfo.bDateValid)
     {
-      if (sSensorGPS.sInfo.bTimeValid)
-      {
-        /* Aktualisierung der Echtzeituhr                 */
-        RTC_TimeStructInit(&sTime);
-        sTime.RTC_Hours = sSensorGPS.sTime.ucHour;
-        sTime.RTC_Minutes = sSensorGPS.sTime.ucMin;
-        sTime.RTC_Seconds = sSensorGPS.sTime.ucSec;
-        RTC_SetTime(RTC_Format_BIN, &sTime);
-        printf("GpsTime\r\n");
-        sSensorGPS.sInfo.bTimeValid = false;
-      }
-      
-      if (sSensorGPS.sInfo.bDateValid)
-      {
-        /* Aktualisierung des Datums                      */
-        RTC_DateStructInit(&sDate);
-        sDate.RTC_Date = sSensorGPS.sDate.ucDay;
-        sDate.RTC_Month = sSensorGPS.sDate.ucMonth;
-        sDate.RTC_Year = sSensorGPS.sDate.ucYear;
-        RTC_SetDate(RTC_Format_BIN, &sDate);
-        printf("GpsDate\r\n");
-        sSensorGPS.sInfo.bDateValid = false;
-      }
+      /* Aktualisierung des Datums                        */
+      RTC_DateStructInit(&sDate);
+      sDate.RTC_Date = sSensorGPS.sDate.ucDay;
+      sDate.RTC_Month = sSensorGPS.sDate.ucMonth;
+      sDate.RTC_Year = sSensorGPS.sDate.ucYear;
+      RTC_SetDate(RTC_Format_BIN, &sDate);
+      printf("GpsDate\r\n");
+      sSensorGPS.sInfo.bDateValid = false;
     }
-        
-    /* Fertig - auf nchsten Interrupt warten             */
-    //wfi();
   }
+  PROFILE_END(Profiler_Zone_GPS);
 }
 
 void SaveSensors(void)
 {
   SensorLogItem* pLog;
   uint16_t uiWindDir;
-  FIL fil;
+  
+  PROFILE_BEGIN(Profiler_Zone_SAVE);
+  
+  /* Rohdaten, aus denen der Eintrag entsteht, fr die    *
+   * Aufzeichnung                                         */
+  if (Trace_IsEnabled())
+  {
+    TraceInputs();
+  }
   
   /* Abs. Windrichtung ber Azimuth bestimmen             */
   uiWindDir = 6300 + sSensorQMC5883.sMeasure.uiAzimuth - (sSensorWind.sMeasure.eDirection * 225);
@@ -435,91 +700,133 @@ void SaveSensors(void)
   pLog->sPower.uiPanelVolt = sSensorPPV.sMeasure.uiVolt;
   pLog->sPower.iBatCurr = sSensorPBAT.sMeasure.iCurr;
   pLog->sPower.iPanelCurr = sSensorPPV.sMeasure.iCurr;
+  pLog->sEnergy.ucSoC = sEnergy.ucSoC;
+  pLog->sEnergy.uiBatIn = (uint16_t)sEnergy.sDay.sBatInCharge.ulValue;
+  pLog->sEnergy.uiBatOut = (uint16_t)sEnergy.sDay.sBatOutCharge.ulValue;
+  pLog->sEnergy.ulPvEnergy = sEnergy.sDay.sPvEnergy.ulValue;
+  pLog->ucStatus = (uint8_t)PowerGov_GetTier() & SENSORLOG_STATUS_TIER;
+  if (sSensorGPS.sInfo.bLatValid && sSensorGPS.sInfo.bLongValid)
+  {
+    pLog->ucStatus |= SENSORLOG_STATUS_POS;
+  }
+  if (sSensorGPS.sInfo.bAltValid)
+  {
+    pLog->ucStatus |= SENSORLOG_STATUS_ALT;
+  }
+  if (Tracking_IsEnabled())
+  {
+    pLog->ucStatus |= SENSORLOG_STATUS_TRACK;
+  }
+  
+  /* Im EEPROM spiegeln                                   */
+  SensorLog_Commit();
   
   /* Auf SD-Karte schreiben                               */
   printf("WriteLog...");
-  if (f_open(&fil, "LOG.TXT", FA_WRITE | FA_OPEN_APPEND) == FR_OK)
+  if (Logger_Append(pLog))
   {
     printf(" OK\r\n");
-    f_printf(&fil, "%04d-%02d-%02dT%02d:%02d:%02dZ,",
-      (int)pLog->sTimestamp.sDate.RTC_Year + 2000,
-      (int)pLog->sTimestamp.sDate.RTC_Month,
-      (int)pLog->sTimestamp.sDate.RTC_Date,
-      (int)pLog->sTimestamp.sTime.RTC_Hours,
-      (int)pLog->sTimestamp.sTime.RTC_Minutes,
-      (int)pLog->sTimestamp.sTime.RTC_Seconds
-    );
-    f_printf(&fil, "%d,%d,%d,%d,", 
-      pLog->sTemperature.iBME,
-      pLog->sTemperature.iCPU,
-      pLog->sTemperature.iQMC,
-      pLog->sTemperature.iMPU
-    );
-    f_printf(&fil, "%l,%l,",
-      pLog->ulPressure,
-      pLog->ulHumidity
-    );
-    f_printf(&fil, "%d,%d,%d,%d,",
-      pLog->sWind.uiDir,
-      pLog->sWind.uiVelo,
-      pLog->sAlignment.uiAzimuth,
-      pLog->sAlignment.iZenith
-    );
-    f_printf(&fil, "%l,%l,%d,",
-      pLog->sPosition.lLat,
-      pLog->sPosition.lLong,
-      pLog->sPosition.iAlt
-    );
-    f_printf(&fil, "%d,%d,%d,%d\r\n",
-      pLog->sPower.uiBatVolt,
-      pLog->sPower.uiPanelVolt,
-      pLog->sPower.iBatCurr,
-      pLog->sPower.iPanelCurr
-    );
-    f_close(&fil);
   }
   else
   {
     printf(" FAIL\r\n");
   }
+  
+  /* Stunden- und Tageswerte                              */
+  Rollup_Add(pLog);
+  
+  /* Aufzeichnung des Wakeups abschlieen                 */
+  Trace_Flush();
+  
+  PROFILE_END(Profiler_Zone_SAVE);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Echtzeituhr und Rohdaten aller Sensoren vor dem Protokolleintrag
+ * aufzeichnen, genderte Kalibrierwerte davor. Die Messwerte des Eintrags
+ * lassen sich daraus mit den Umrechnungen der Sensoren wiederherstellen,
+ * auch wenn 100ms- und 1s-Task sie seit dem Wakeup aktualisiert haben.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Kalibrierwerte, Aufruf aus SaveSensors()
+ ******************************************************************************/
+void TraceInputs(void)
+{
+  uint16_t auiPower[4];
+  
+  Trace_RecordClock();
+  Trace_RecordCalib(Trace_Calib_BME280, &sSensorBME280.sCalib, sizeof(sSensorBME280.sCalib));
+  Trace_RecordCalib(Trace_Calib_QMC5883, &sSensorQMC5883.sCalib, sizeof(sSensorQMC5883.sCalib));
+  Trace_RecordCalib(Trace_Calib_MPU6050, &sSensorMPU6050.bMeasureTemp, sizeof(sSensorMPU6050.bMeasureTemp));
+  Trace_RecordCalib(Trace_Calib_PBAT, &sSensorPBAT.sCalib, sizeof(sSensorPBAT.sCalib));
+  Trace_RecordCalib(Trace_Calib_PPV, &sSensorPPV.sCalib, sizeof(sSensorPPV.sCalib));
+  Trace_Record(Trace_Type_BME280, &sSensorBME280.sRaw, sizeof(sSensorBME280.sRaw));
+  Trace_Record(Trace_Type_QMC5883, &sSensorQMC5883.sRaw, sizeof(sSensorQMC5883.sRaw));
+  Trace_Record(Trace_Type_MPU6050, &sSensorMPU6050.sRaw, sizeof(sSensorMPU6050.sRaw));
+  Trace_Record(Trace_Type_WIND, &sSensorWind.sRaw, sizeof(sSensorWind.sRaw));
+  Trace_Record(Trace_Type_CPUTEMP, &sSensorCPUTemp.sRaw, sizeof(sSensorCPUTemp.sRaw));
+  
+  auiPower[0] = sSensorPBAT.sRaw.uiRawVolt;
+  auiPower[1] = sSensorPBAT.sRaw.uiRawCurr;
+  auiPower[2] = sSensorPPV.sRaw.uiRawVolt;
+  auiPower[3] = sSensorPPV.sRaw.uiRawCurr;
+  Trace_Record(Trace_Type_POWER, auiPower, sizeof(auiPower));
 }
 
 /*!**************************************************************************** 
  * @brief
- * Interrupthandler fr 100ms-Task. Behandelt 
+ * Interrupthandler fr 100ms-Task. Reicht die flligen Teilnehmer an
+ * TaskDeferred() weiter und programmiert den Timer auf die nchste Frist.
  *
- * @date  15.10.2019
+ * @date  19.10.2026
  ******************************************************************************/
-@far @interrupt void Timer2Interrupt(void)
+INTERRUPT_HANDLER(Timer2Interrupt, 19)
 {
+  uint16_t uiStart = Deferred_GetUs();
+  uint8_t ucDue;
+  
   TIM2_ClearFlag(TIM2_FLAG_Update);
-    
-  /* Blink Pattern                                        */
-  Blink_Poll();
+  ucDue = Timebase_Expire();
   
-  /* Lageregelung                                         */
-  Motor_Task100ms();
-      
-  /* Timer-Zhler und Flags fr 1s-Task behandeln         */
-  if (iTimer1s > 0)
-  {
-    --iTimer1s;
-  }
-  else
+  /* Blink Pattern und Lageregelung im Hauptprogramm      */
+  if (ucDue != 0)
   {
-    iTimer1s = 10;
-    bTask1sFlag = true;
+    Deferred_Push(Deferred_Type_TICK, ucDue, uiStart);
   }
+  
+  /* Ereignis fr 100ms-Task                              */
+  Sched_Post(Sched_Event_TICK);
+  
+  /* Nchste Frist                                        */
+  Timebase_Update();
+  
+  Deferred_IsrDone(Deferred_Isr_TIM2, uiStart);
 }
 
 /*!****************************************************************************
  * @brief
- * Interrupthandler fr 15min-Task
+ * Interrupthandler fr 1s-Task (Alarm A) und Wakeup-Task (Weckzeitgeber)
  * 
- * @date 27.10.2019
+ * @date 19.10.2026
+ * @date  19.10.2026  Sekunden fr den Zeitstempel
  ******************************************************************************/
-@far @interrupt void RTC_InterruptHandler(void)
+INTERRUPT_HANDLER(RTC_InterruptHandler, 4)
 {
-  RTC_ClearFlag(RTC_FLAG_WUTF);
-  bTaskWakeupFlag = true;
+  uint16_t uiStart = Deferred_GetUs();
+  
+  if (RTC_GetFlagStatus(RTC_FLAG_ALRAF) != RESET)
+  {
+    RTC_ClearFlag(RTC_FLAG_ALRAF);
+    LowPower_CountSecond();
+    Sched_Post(Sched_Event_SECOND);
+  }
+  
+  if (RTC_GetFlagStatus(RTC_FLAG_WUTF) != RESET)
+  {
+    RTC_ClearFlag(RTC_FLAG_WUTF);
+    Sched_Post(Sched_Event_WAKEUP);
+  }
+  
+  Deferred_IsrDone(Deferred_Isr_RTC, uiStart);
 }
\ No newline at end of file
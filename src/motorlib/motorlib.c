@@ -11,6 +11,9 @@
 #include "stm8l15x.h"
 #include "io_map.h"
 #include "BlinkSequencer.h"
+#include "powerlib.h"
+#include "Timebase.h"
+#include "Deferred.h"
 #include "motorlib.h"
 
 
@@ -21,6 +24,9 @@
 /*! Bitmaske fr Endlagenschalter B-Richtung                                  */
 #define MOT_LIM_B 0x10
 
+/*! Bitmaske fr Nothalt-Taster                                               */
+#define MOT_STOP  0x01
+
 
 /*- Typdefinitionen ----------------------------------------------------------*/
 static int16_t abs(int16_t i)
@@ -178,7 +184,7 @@ static void Motor_CmdTurn(Motor_Direction eDir)
  * @brief
  * Referenzfahrt der Panelansteuerung
  *
- * Regelungsroutinen werden im 100ms-Task innerhalb des Timer-Interrupts aus-
+ * Regelungsroutinen werden im 100ms-Task verzgert im Hauptprogramm aus-
  * gefhrt
  *
  * @date  17.11.2019
@@ -231,7 +237,7 @@ static void Motor_HomingTask(void)
  * @brief
  * Dreipunktregler fr Panel- und Turmausrichtung
  *
- * Regelungsroutinen werden im 100ms-Task innerhalb des Timer-Interrupts aus-
+ * Regelungsroutinen werden im 100ms-Task verzgert im Hauptprogramm aus-
  * gefhrt
  *
  * @date  19.11.2019
@@ -338,10 +344,12 @@ void Motor_Cmd(bool bEnable)
   if (bEnable)
   {
     Blink_SetPattern(Blink_Led_MOT, 0x0001);
+    Timebase_Request(Timebase_Client_MOTOR, 1);
   }
   else
   {
     Blink_SetPattern(Blink_Led_MOT, 0x0000);
+    LowPower_SetLock(LowPower_Lock_MOTOR, false);
     
     /* Anhalten */
     GPIO_ResetBits(GPIOF, GPIO_Pin_4 | GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7);
@@ -360,6 +368,7 @@ void Motor_Cmd(bool bEnable)
 void Motor_SetTurn(int16_t iSetpoint)
 {
   iTurnSet = iSetpoint;
+  Timebase_Request(Timebase_Client_MOTOR, 1);
 }
 
 /*!****************************************************************************
@@ -373,6 +382,7 @@ void Motor_SetTurn(int16_t iSetpoint)
 void Motor_SetTurnRef(int16_t iActval)
 {
   iTurnAct = iActval;
+  Timebase_Request(Timebase_Client_MOTOR, 1);
 }
 
 /*!****************************************************************************
@@ -386,6 +396,7 @@ void Motor_SetTurnRef(int16_t iActval)
 void Motor_SetTilt(int16_t iSetpoint)
 {
   iTiltSet = iSetpoint;
+  Timebase_Request(Timebase_Client_MOTOR, 1);
 }
 
 /*!****************************************************************************
@@ -400,15 +411,19 @@ void Motor_SetTiltRef(int16_t iActval)
 {
   iTiltAct = iActval;
   bHomingActive = false;
+  Timebase_Request(Timebase_Client_MOTOR, 1);
 }
 
 /*!****************************************************************************
  * @brief
  * 100ms-Task fr die Lageregelung
  *
- * Aufgerufen im 100ms-Timer
+ * Aufgerufen je Tick des 100ms-Timers im Hauptprogramm. Der Tick wird nur
+ * fortgesetzt, solange eine Bewegung aktiv ist oder die Motor-LED noch ein
+ * Muster zeigt. Verzgerte Ticks werden einzeln nachgeholt, damit die
+ * Istwerte weiterhin je 100ms Fahrzeit fortgeschrieben werden.
  *
- * @date  19.11.2019
+ * @date  19.10.2026
  ******************************************************************************/
 void Motor_Task100ms(void)
 {
@@ -422,18 +437,71 @@ void Motor_Task100ms(void)
     /* Lageregelung                                       */
     Motor_ControlTask();
   }
+  
+  if (Motor_IsMoving())
+  {
+    /* Bewegung aktiv - Regelung weiter takten            */
+    if (!bHomingActive)
+    {
+      Blink_SetPattern(Blink_Led_MOT, 0x0001);
+    }
+    LowPower_SetLock(LowPower_Lock_MOTOR, true);
+    Timebase_Request(Timebase_Client_MOTOR, 1);
+  }
+  else
+  {
+    LowPower_SetLock(LowPower_Lock_MOTOR, false);
+    
+    /* Muster nach Ende der Bewegung einmal abspielen,    *
+     * Nothalt-Anzeige bleibt bestehen                    */
+    if (!bMotorStop && !Blink_Ready(Blink_Led_MOT))
+    {
+      Timebase_Request(Timebase_Client_MOTOR, 1);
+    }
+    else
+    {
+      if (!bMotorStop)
+      {
+        Blink_SetPattern(Blink_Led_MOT, 0x0000);
+      }
+      Timebase_Cancel(Timebase_Client_MOTOR);
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Verzgerte Bearbeitung von Endlagenschalter und Nothalt im Hauptprogramm.
+ * Die Motoren wurden bereits in der ISR angehalten.
+ *
+ * @param[in] ucState   Zustand Port B bei Auslsung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Motor_HandleLimit(uint8_t ucState)
+{
+  if (ucState & MOT_STOP)
+  {
+    Blink_SetPattern(Blink_Led_MOT, 0x5555);
+  }
+  
+  /* Endlage bzw. Nothalt im nchsten Tick auswerten      */
+  Timebase_Request(Timebase_Client_MOTOR, 1);
 }
 
 /*!****************************************************************************
  * @brief
  * Interrupthandler fr Endlagenschalter
  *
- * Behandelt die Auslsung von Endlagenschaltern oder dem Nothalt
+ * Behandelt die Auslsung von Endlagenschaltern oder dem Nothalt. Die
+ * Motoren werden sofort angehalten, die Anzeige folgt in Motor_HandleLimit().
  *
  * @date  17.11.2019
+ * @date  19.10.2026    LED-Anzeige in das Hauptprogramm verlagert
  ******************************************************************************/
-@far @interrupt void Motor_LimitInterruptHandler(void)
+INTERRUPT_HANDLER(Motor_LimitInterruptHandler, 6)
 {
+  uint16_t uiStart = Deferred_GetUs();
   register uint8_t ucInBuf = GPIO_ReadInputData(GPIOB);
   
   EXTI_ClearITPendingBit(EXTI_IT_PortB);
@@ -445,18 +513,21 @@ void Motor_Task100ms(void)
     GPIO_WriteBit(GPIOF, GPIO_Pin_6, false);
   }
   
-  if (ucInBuf & 0x01)
+  if (ucInBuf & MOT_STOP)
   {
     /* Nothalt ausgelst                                  */
     GPIO_ResetBits(GPIOF, GPIO_Pin_4 | GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7);
     GPIO_ResetBits(GPIOD, GPIO_Pin_4);
     bMotorEnable = false;
     bMotorStop = true;
-    Blink_SetPattern(Blink_Led_MOT, 0x5555);
   }
   
   /* Endlagenschalterposition speichern                   */
   ucLimitHit = ucInBuf & 0x18;
+  
+  /* Rest im Hauptprogramm                                */
+  Deferred_Push(Deferred_Type_LIMIT, ucInBuf, uiStart);
+  Deferred_IsrDone(Deferred_Isr_LIMIT, uiStart);
 }
 
 int16_t Motor_GetTurn(void)
@@ -484,4 +555,19 @@ bool Motor_IsTiltReached(void)
 bool Motor_IsHomingActive(void)
 {
   return bHomingActive;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob eine Bewegung aktiv ist (Referenzfahrt oder Sollwert nicht
+ * erreicht bei erteilter Freigabe)
+ *
+ * @return    bool      true, wenn die Regelung den 100ms-Takt bentigt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Motor_IsMoving(void)
+{
+  return bMotorEnable && !bMotorStop && 
+    (bHomingActive || !Motor_IsTiltReached() || !Motor_IsTurnReached());
 }
\ No newline at end of file
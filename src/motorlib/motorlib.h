@@ -29,6 +29,7 @@
 /*- Funktionsprototypen ------------------------------------------------------*/
 void Motor_Init(void);
 void Motor_Task100ms(void);
+void Motor_HandleLimit(uint8_t ucState);
 void Motor_Cmd(bool bEnable);
 
 void Motor_SetTurn(int16_t iSetpoint);
@@ -43,5 +44,6 @@ bool Motor_IsTurnReached(void);
 bool Motor_IsTiltReached(void);
 
 bool Motor_IsHomingActive(void);
+bool Motor_IsMoving(void);
 
 #endif /* MOTORLIB_H_ */
\ No newline at end of file
@@ -0,0 +1,278 @@
+/*!****************************************************************************
+ * @file
+ * powerlib.c
+ *
+ * Energiesparmodi zwischen den Tasks. Ohne gesetzte Sperre wird Active-Halt
+ * verwendet (Weckung ber RTC, EXTI), sonst Wait (Weckung ber jeden
+ * Interrupt, z.B. USART-Empfang). Die Aufenthaltsdauer je Modus wird ber
+ * den Subsekundenzhler der RTC gemessen.
+ *
+ * Zeitstempel: Die Sekunden zhlt Alarm A mit (LowPower_CountSecond), nicht
+ * die Uhrzeit der RTC, die beim Stellen ber GPS springt. Dazu kommt der
+ * Subsekundenzhler. Stellen der Uhr setzt den Vorteiler zurck; der
+ * Zeitstempel bleibt dann hchstens eine Sekunde lang stehen, statt
+ * rckwrts zu laufen. Er luft erst nach 2^32 / 256 s (194 Tage) ber.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Fortlaufender Zeitstempel unabhngig von der Uhrzeit
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "powerlib.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Wartezeit nach dem Einschalten des ADC (tWAKEUP = 3us) in Schleifen       */
+#define LOWPOWER_ADC_WAKEUP     16
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Sperren gegen Active-Halt, je Sperre ein Byte (atomarer Zugriff aus ISR)  */
+static volatile uint8_t aucLocks[LowPower_Lock_NUM];
+
+/*! Zeitstatistik                                                             */
+static LowPower_Stats sStats;
+
+/*! Zeitstempel des letzten Moduswechsels in 1/256 s                          */
+static uint32_t ulLastStamp;
+
+/*! Sekunden seit dem Start, gezhlt von Alarm A                              */
+static volatile uint32_t ulSeconds;
+
+/*! Zuletzt gelieferter Zeitstempel in 1/256 s                                */
+static uint32_t ulMonoStamp;
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Energiesparmodi konfigurieren. Muss nach der Initialisierung der RTC
+ * aufgerufen werden.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void LowPower_Init(void)
+{
+  uint8_t ucIdx;
+  
+  /* Interne Referenz im Halt abschalten, schnell wecken  */
+  PWR_UltraLowPowerCmd(ENABLE);
+  PWR_FastWakeUpCmd(ENABLE);
+  
+  for (ucIdx = 0; ucIdx < LowPower_Lock_NUM; ++ucIdx)
+  {
+    aucLocks[ucIdx] = 0;
+  }
+  
+  LowPower_ClearStats();
+}
+
+/*!****************************************************************************
+ * @brief
+ * CPU bis zum nchsten Interrupt anhalten. Der Aufruf erfolgt mit gesperrten
+ * Interrupts, nachdem geprft wurde, dass keine Arbeit ansteht; wfi bzw. 
+ * halt geben die Interrupts atomar wieder frei.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void LowPower_Idle(void)
+{
+  LowPower_Mode eMode = LowPower_Mode_HALT;
+  uint32_t ulStamp;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < LowPower_Lock_NUM; ++ucIdx)
+  {
+    if (aucLocks[ucIdx] != 0)
+    {
+      eMode = LowPower_Mode_WAIT;
+    }
+  }
+  
+  ulStamp = LowPower_GetStamp();
+  sStats.aulTime[LowPower_Mode_RUN] += 
+    LowPower_GetElapsed(ulLastStamp, ulStamp);
+  ++sStats.aulCount[eMode];
+  
+  if (eMode == LowPower_Mode_WAIT)
+  {
+    wfi();
+  }
+  else
+  {
+    halt();
+    
+    /* Schattenregister der RTC nach dem Halt neu laden   */
+    RTC_WaitForSynchro();
+  }
+  
+  ulLastStamp = LowPower_GetStamp();
+  sStats.aulTime[eMode] += LowPower_GetElapsed(ulStamp, ulLastStamp);
+  ++sStats.aulCount[LowPower_Mode_RUN];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sperre gegen Active-Halt setzen oder aufheben, auch aus einer ISR
+ *
+ * @param[in] eLock     Sperre
+ * @param[in] bLocked   true, wenn Active-Halt gesperrt werden soll
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void LowPower_SetLock(LowPower_Lock eLock, bool bLocked)
+{
+  aucLocks[eLock] = bLocked ? 1 : 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gesetzte Sperren als Bitmaske abfragen
+ *
+ * @return    uint8_t   Bit n gesetzt, wenn Sperre n aktiv
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t LowPower_GetLocks(void)
+{
+  uint8_t ucMask = 0;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < LowPower_Lock_NUM; ++ucIdx)
+  {
+    if (aucLocks[ucIdx] != 0)
+    {
+      ucMask |= (uint8_t)(1 << ucIdx);
+    }
+  }
+  
+  return ucMask;
+}
+
+/*!****************************************************************************
+ * @brief
+ * ADC1 samt Peripherietakt ein- bzw. ausschalten
+ *
+ * @param[in] bEnable   true zum Einschalten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void LowPower_AdcCmd(bool bEnable)
+{
+  volatile uint8_t ucDelay;
+  
+  if (bEnable)
+  {
+    CLK_PeripheralClockConfig(CLK_Peripheral_ADC1, ENABLE);
+    ADC_Cmd(ADC1, ENABLE);
+    for (ucDelay = 0; ucDelay < LOWPOWER_ADC_WAKEUP; ++ucDelay);
+  }
+  else
+  {
+    ADC_Cmd(ADC1, DISABLE);
+    CLK_PeripheralClockConfig(CLK_Peripheral_ADC1, DISABLE);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeitstatistik abfragen
+ *
+ * @return    const LowPower_Stats*   Zeitstatistik
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const LowPower_Stats* LowPower_GetStats(void)
+{
+  return &sStats;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeitstatistik zurcksetzen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void LowPower_ClearStats(void)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < LowPower_Mode_NUM; ++ucIdx)
+  {
+    sStats.aulTime[ucIdx] = 0;
+    sStats.aulCount[ucIdx] = 0;
+  }
+  ulLastStamp = LowPower_GetStamp();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sekunde zhlen, Aufruf aus der ISR von Alarm A (Sekundentakt)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void LowPower_CountSecond(void)
+{
+  ++ulSeconds;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fortlaufenden Zeitstempel aus den gezhlten Sekunden und dem
+ * Subsekundenzhler der RTC bilden. Das Lesen von SSRL friert TR/DR ein,
+ * bis DR3 gelesen wird. Nicht aus einer ISR aufrufen.
+ *
+ * @return    uint32_t  Zeitstempel in 1/256 s, nie kleiner als der vorige
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Sekunden aus Alarm A statt Uhrzeit, nie rckwrts
+ ******************************************************************************/
+uint32_t LowPower_GetStamp(void)
+{
+  uint32_t ulSec;
+  uint32_t ulStamp;
+  uint8_t ucSubSec;
+  bool bPending;
+  
+  /* Wiederholen, wenn Alarm A dazwischen gezhlt hat     */
+  do
+  {
+    ulSec = ulSeconds;
+    (void)RTC->SSRH;
+    ucSubSec = (uint8_t)(LOWPOWER_TICK_HZ - 1 - RTC->SSRL);
+    (void)RTC->DR3;
+    bPending = (RTC_GetFlagStatus(RTC_FLAG_ALRAF) != RESET);
+  } while (ulSec != ulSeconds);
+  
+  /* Neue Sekunde, Interrupt noch gesperrt                */
+  if (bPending && (ucSubSec < (LOWPOWER_TICK_HZ / 2)))
+  {
+    ++ulSec;
+  }
+  
+  /* Nach dem Stellen der Uhr stehen bleiben              */
+  ulStamp = ulSec * LOWPOWER_TICK_HZ + ucSubSec;
+  if ((int32_t)(ulStamp - ulMonoStamp) < 0)
+  {
+    ulStamp = ulMonoStamp;
+  }
+  ulMonoStamp = ulStamp;
+  return ulStamp;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeitdifferenz zweier Zeitstempel, ber den berlauf hinweg
+ *
+ * @param[in] ulFrom    Startzeitpunkt in 1/256 s
+ * @param[in] ulTo      Endzeitpunkt in 1/256 s
+ * @return    uint32_t  Dauer in 1/256 s
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  berlauf nach 194 Tagen statt einer Stunde
+ ******************************************************************************/
+uint32_t LowPower_GetElapsed(uint32_t ulFrom, uint32_t ulTo)
+{
+  return ulTo - ulFrom;
+}
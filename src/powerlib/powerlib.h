@@ -1,8 +1,106 @@
+/*!****************************************************************************
+ * @file
+ * powerlib.h
+ *
+ * Energiesparmodi zwischen den Tasks: Wait bzw. Active-Halt mit Weckung ber
+ * Interrupts und die Echtzeituhr sowie Zeitstatistik je Modus
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
 #ifndef POWERLIB_H_
 #define POWERLIB_H_
 
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
 #include "stm8l15x.h"
 
+
+/*- Makros -------------------------------------------------------------------*/
 #define Power_Wait()  wfi()
 
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Auflsung der Zeitstatistik in Hz (synchroner Vorteiler der RTC + 1)      */
+#define LOWPOWER_TICK_HZ        256
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Betriebsmodi der CPU
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_LowPower_Mode {
+  /*! CPU aktiv                                           */
+  LowPower_Mode_RUN,
+  
+  /*! Wait: CPU steht, Peripherie luft weiter            */
+  LowPower_Mode_WAIT,
+  
+  /*! Active-Halt: nur RTC (LSE) luft weiter             */
+  LowPower_Mode_HALT,
+  
+  LowPower_Mode_NUM
+} LowPower_Mode;
+
+/*!****************************************************************************
+ * @brief
+ * Sperren gegen Active-Halt. Solange eine Sperre gesetzt ist, wird nur der
+ * Wait-Modus verwendet, weil die Peripherie ihren Takt weiter bentigt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_LowPower_Lock {
+  /*! Timer-Tick (TIM2) mit ausstehender Frist            */
+  LowPower_Lock_TICK,
+  
+  /*! Pulszhler des Anemometers (TIM3) im Messfenster    */
+  LowPower_Lock_WIND,
+  
+  /*! Bluetooth-Modul eingeschaltet (USART1 Empfang)      */
+  LowPower_Lock_BT,
+  
+  /*! GPS-Modul eingeschaltet (USART3 Empfang)            */
+  LowPower_Lock_GPS,
+  
+  /*! Motoransteuerung aktiv                              */
+  LowPower_Lock_MOTOR,
+  
+  LowPower_Lock_NUM
+} LowPower_Lock;
+
+/*!****************************************************************************
+ * @brief
+ * Zeitstatistik je Betriebsmodus
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_LowPower_Stats {
+  /*! Aufenthaltsdauer je Modus in 1/256 s                */
+  uint32_t aulTime[LowPower_Mode_NUM];
+  
+  /*! Anzahl der Eintritte je Modus                       */
+  uint32_t aulCount[LowPower_Mode_NUM];
+} LowPower_Stats;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void LowPower_Init(void);
+void LowPower_Idle(void);
+
+void LowPower_SetLock(LowPower_Lock eLock, bool bLocked);
+uint8_t LowPower_GetLocks(void);
+
+void LowPower_AdcCmd(bool bEnable);
+
+const LowPower_Stats* LowPower_GetStats(void);
+void LowPower_ClearStats(void);
+
+void LowPower_CountSecond(void);
+uint32_t LowPower_GetStamp(void);
+uint32_t LowPower_GetElapsed(uint32_t ulFrom, uint32_t ulTo);
+
 #endif /* POWERLIB_H_ */
\ No newline at end of file
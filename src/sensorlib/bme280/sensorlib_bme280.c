@@ -10,6 +10,7 @@
 
 /*- Headerdateien ------------------------------------------------------------*/
 #include "commlib_i2c.h"
+#include "Profiler.h"
 #include "sensorlib_bme280_internal.h"
 #include "sensorlib_bme280.h"
 
@@ -49,6 +50,7 @@ void BME280_Init(BME280_Sensor* pSensor, uint8_t ucSlaveAddr)
  * @param[inout]  *pSensor  Sensor-Struktur
  *
  * @date  31.10.2019
+ * @date  19.10.2026  Laufzeitmessung der Kompensation
  ******************************************************************************/
 void BME280_Update(BME280_Sensor* pSensor)
 {
@@ -63,7 +65,9 @@ void BME280_Update(BME280_Sensor* pSensor)
   
   /* Sensordaten auslesen und kompensierte Werte ber.     */
   BME280_GetSensorData(pSensor);
+  PROFILE_BEGIN(Profiler_Zone_BMECALC);
   pSensor->sMeasure.iTemperature = BME280_CalcTemp(pSensor);
   pSensor->sMeasure.ulPressure = BME280_CalcPress(pSensor);
   pSensor->sMeasure.ulHumidity = BME280_CalcHum(pSensor);
+  PROFILE_END(Profiler_Zone_BMECALC);
 }
\ No newline at end of file
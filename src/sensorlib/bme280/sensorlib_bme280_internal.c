@@ -42,7 +42,7 @@
  *
  * @date  31.10.2019
  ******************************************************************************/
-static @inline uint8_t BME280_ReadRegister(BME280_Sensor* pSensor, BME280_Register eRegister)
+static COMMLIB_I2C_INLINE uint8_t BME280_ReadRegister(BME280_Sensor* pSensor, BME280_Register eRegister)
 {
   return I2CMaster_RegisterRead(pSensor->ucSlaveAddr, eRegister);
 }
@@ -57,7 +57,7 @@ static @inline uint8_t BME280_ReadRegister(BME280_Sensor* pSensor, BME280_Regist
  *
  * @date  31.10.2019
  ******************************************************************************/
-static @inline void BME280_WriteRegister(BME280_Sensor* pSensor, BME280_Register eRegister, uint8_t ucValue)
+static COMMLIB_I2C_INLINE void BME280_WriteRegister(BME280_Sensor* pSensor, BME280_Register eRegister, uint8_t ucValue)
 {
   I2CMaster_RegisterWrite(pSensor->ucSlaveAddr, eRegister, ucValue);
 }
@@ -468,7 +468,7 @@ uint32_t BME280_CalcHum(BME280_Sensor* pSensor)
   var2 = ((var4 * ((int32_t)pSensor->sCalib.iDigH2)) + 8192) >> 14;
   var3 = var5 * var2;
   var4 = ((var3 >> 15) * (var3 >> 15)) >> 7;
-  var5 = var3 - ((var4 * ((int32_t)pSensor->sCalib.ucDigH1)) >> 5);
+  var5 = var3 - ((var4 * ((int32_t)pSensor->sCalib.ucDigH1)) >> 4);
   var5 = (var5 < 0 ? 0 : var5);
   var5 = (var5 > 419430400 ? 419430400 : var5);
   humidity = (uint32_t)(var5 >> 12);
@@ -26,7 +26,7 @@ void CPUTemp_GetSensorData(CPUTemp_Sensor* pSensor)
 {
   ADC_ChannelCmd(ADC1, ADC_Channel_TempSensor, ENABLE);
   ADC_SoftwareStartConv(ADC1);
-  while (!ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC)) { Power_Wait() };
+  while (!ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC)) { Power_Wait(); }
   pSensor->sRaw.uiRawTemp = ADC_GetConversionValue(ADC1);
   ADC_ChannelCmd(ADC1, ADC_Channel_TempSensor, DISABLE);
 }
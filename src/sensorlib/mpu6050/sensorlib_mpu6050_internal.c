@@ -26,7 +26,7 @@
  * 
  * @date  06.11.2019
  ******************************************************************************/
-static @inline uint8_t MPU6050_ReadRegister(MPU6050_Sensor* pSensor, MPU6050_Register eReg)
+static COMMLIB_I2C_INLINE uint8_t MPU6050_ReadRegister(MPU6050_Sensor* pSensor, MPU6050_Register eReg)
 {
   return I2CMaster_RegisterRead(pSensor->ucSlaveAddr, eReg);
 }
@@ -41,7 +41,7 @@ static @inline uint8_t MPU6050_ReadRegister(MPU6050_Sensor* pSensor, MPU6050_Reg
  *
  * @date  06.11.2019
  ******************************************************************************/
-static @inline void MPU6050_WriteRegister(MPU6050_Sensor* pSensor, MPU6050_Register eReg, uint8_t ucVal)
+static COMMLIB_I2C_INLINE void MPU6050_WriteRegister(MPU6050_Sensor* pSensor, MPU6050_Register eReg, uint8_t ucVal)
 {
   I2CMaster_RegisterWrite(pSensor->ucSlaveAddr, eReg, ucVal);
 }
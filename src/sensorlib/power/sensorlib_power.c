@@ -25,7 +25,9 @@ void Power_Init(Power_Sensor* pSensor, \
 
 void Power_SetCurrRef(Power_Sensor* pSensor, uint16_t uiOffset, int16_t iSlope)
 {
-  pSensor->sCalib.uiCurrZeroOffset = uiOffset;
+  /* Abgleichwert als 12-bit Rohwert, intern linksbndig  */
+  pSensor->sCalib.uiCurrZeroRef = uiOffset << (POWER_RAW_BITS - 12);
+  pSensor->sCalib.uiCurrZeroOffset = pSensor->sCalib.uiCurrZeroRef;
   pSensor->sCalib.iCurrSlope = iSlope;
 }
 
@@ -34,10 +36,51 @@ void Power_SetVoltRef(Power_Sensor* pSensor, uint16_t uiSlope)
   pSensor->sCalib.uiVoltSlope = uiSlope;
 }
 
+void Power_SetOversampling(Power_Sensor* pSensor, uint8_t ucCurrBits, uint8_t ucVoltBits)
+{
+  pSensor->sChannel.ucCurrOsrBits = (ucCurrBits > POWER_OSR_MAX_BITS) ? POWER_OSR_MAX_BITS : ucCurrBits;
+  pSensor->sChannel.ucVoltOsrBits = (ucVoltBits > POWER_OSR_MAX_BITS) ? POWER_OSR_MAX_BITS : ucVoltBits;
+}
+
 void Power_Update(Power_Sensor* pSensor)
 {
   Power_GetAnalogVal(pSensor);
   
   pSensor->sMeasure.iCurr = Power_CalcCurr(pSensor);
   pSensor->sMeasure.uiVolt = Power_CalcVolt(pSensor);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nullpunkt der Strommessung nachfhren
+ *
+ * Darf nur aufgerufen werden, wenn der Strom bekanntermaen null ist (z.B.
+ * Solarpanel ohne Spannung). Der zuletzt gemessene Rohwert wird ber einen
+ * Tiefpass in den Nullpunkt bernommen, die Abweichung vom Abgleichwert ist
+ * auf POWER_ZERO_TRACK_LIMIT begrenzt.
+ *
+ * @param[inout]  *pSensor  Sensor-Struktur
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Power_TrackCurrZero(Power_Sensor* pSensor)
+{
+  int32_t lOffset = pSensor->sCalib.uiCurrZeroOffset;
+  int32_t lLimit = (int32_t)POWER_ZERO_TRACK_LIMIT << (POWER_RAW_BITS - 12);
+  
+  /* Tiefpass erster Ordnung                              */
+  lOffset += ((int32_t)pSensor->sRaw.uiRawCurr - lOffset) >> POWER_ZERO_TRACK_SHIFT;
+  
+  /* Auf zulssigen Bereich um den Abgleichwert begrenzen */
+  if (lOffset > (int32_t)pSensor->sCalib.uiCurrZeroRef + lLimit)
+  {
+    lOffset = (int32_t)pSensor->sCalib.uiCurrZeroRef + lLimit;
+  }
+  else if (lOffset < (int32_t)pSensor->sCalib.uiCurrZeroRef - lLimit)
+  {
+    lOffset = (int32_t)pSensor->sCalib.uiCurrZeroRef - lLimit;
+  }
+  
+  pSensor->sCalib.uiCurrZeroOffset = (uint16_t)lOffset;
+  pSensor->sMeasure.iCurr = Power_CalcCurr(pSensor);
 }
\ No newline at end of file
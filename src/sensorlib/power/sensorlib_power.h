@@ -6,6 +6,20 @@
 #include "stm8l15x.h"
 
 
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Maximale berabtastung als Exponent n fr 4^n Samples                     */
+#define POWER_OSR_MAX_BITS      4
+
+/*! Auflsung der Rohwerte nach der Dezimierung (linksbndig, 12.4)           */
+#define POWER_RAW_BITS          16
+
+/*! Filterkonstante der Nullpunktnachfhrung als Zweierpotenz                 */
+#define POWER_ZERO_TRACK_SHIFT  3
+
+/*! Max. Abweichung der Nullpunktnachfhrung vom Abgleichwert (12-bit lsb)    */
+#define POWER_ZERO_TRACK_LIMIT  64
+
+
 /*- Typdefinitionen ----------------------------------------------------------*/
 /*!****************************************************************************
  * @brief
@@ -20,6 +34,9 @@ typedef struct tag_Power_Sensor {
     /*! Nullpunktabgleich fr die Strommessung als Rohw.  */
     uint16_t uiCurrZeroOffset;
     
+    /*! Nullpunkt aus der Kalibrierung als Rohwert        */
+    uint16_t uiCurrZeroRef;
+    
     /*! Kennliniensteigung fr den Strom in 1mA/lsb       */
     int16_t iCurrSlope;
     
@@ -35,9 +52,15 @@ typedef struct tag_Power_Sensor {
     
     /*! Kanal fr die Spannungsmessung                    */
     ADC_Channel_TypeDef eVolt;
+    
+    /*! berabtastung der Strommessung (4^n Samples)      */
+    uint8_t ucCurrOsrBits;
+    
+    /*! berabtastung der Spannungsmessung (4^n Samples)  */
+    uint8_t ucVoltOsrBits;
   } sChannel;
   
-  /*! Rohdaten                                            */
+  /*! Rohdaten, dezimiert und linksbndig auf 16 bit      */
   struct 
   {
     /*! ADC Rohwert fr die Spannungsmessung              */
@@ -62,6 +85,8 @@ typedef struct tag_Power_Sensor {
 void Power_Init(Power_Sensor* pSensor, ADC_Channel_TypeDef eChCurr, ADC_Channel_TypeDef eChVolt, GPIO_TypeDef* pCurrPort, GPIO_Pin_TypeDef eCurrPin, GPIO_TypeDef* pVoltPort, GPIO_Pin_TypeDef eVoltPin);
 void Power_SetCurrRef(Power_Sensor* pSensor, uint16_t uiOffset, int16_t iSlope);
 void Power_SetVoltRef(Power_Sensor* pSensor, uint16_t uiSlope);
+void Power_SetOversampling(Power_Sensor* pSensor, uint8_t ucCurrBits, uint8_t ucVoltBits);
 void Power_Update(Power_Sensor* pSensor);
+void Power_TrackCurrZero(Power_Sensor* pSensor);
 
 #endif /* SENSORLIB_POWER_H_ */
\ No newline at end of file
@@ -3,31 +3,57 @@
 #include "powerlib.h"
 
 
+/*!****************************************************************************
+ * @brief
+ * ADC-Kanal mit 4^n Samples berabtasten und auf 12+n bit dezimieren
+ *
+ * Das Ergebnis wird linksbndig auf POWER_RAW_BITS skaliert, damit die
+ * Kennlinien unabhngig von der eingestellten berabtastung bleiben. Die
+ * Wandlung ist nach wenigen Mikrosekunden abgeschlossen, daher wird hier
+ * nicht mit Power_Wait() auf den nchsten Interrupt gewartet.
+ *
+ * @param[in] eChannel  ADC-Kanal
+ * @param[in] ucBits    Exponent n der berabtastung
+ * @return    uint16_t  Dezimierter Rohwert (12.4)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t Power_Oversample(ADC_Channel_TypeDef eChannel, uint8_t ucBits)
+{
+  uint32_t ulAccu = 0;
+  uint16_t uiCount = (uint16_t)1 << (ucBits << 1);
+  
+  ADC_ChannelCmd(ADC1, eChannel, ENABLE);
+  do
+  {
+    ADC_SoftwareStartConv(ADC1);
+    while (!ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC));
+    ulAccu += ADC_GetConversionValue(ADC1);
+  } while (--uiCount > 0);
+  ADC_ChannelCmd(ADC1, eChannel, DISABLE);
+  
+  /* Dezimierung: 4^n Summanden ergeben n zustzliche Bit */
+  ulAccu >>= ucBits;
+  return (uint16_t)(ulAccu << (POWER_RAW_BITS - 12 - ucBits));
+}
+
 void Power_GetAnalogVal(Power_Sensor* pSensor)
 {
   /* Strommessung                                         */
-  ADC_ChannelCmd(ADC1, pSensor->sChannel.eCurr, ENABLE);
-  ADC_SoftwareStartConv(ADC1);
-  while (!ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC)) { Power_Wait(); }
-  pSensor->sRaw.uiRawCurr = ADC_GetConversionValue(ADC1);
-  ADC_ChannelCmd(ADC1, pSensor->sChannel.eCurr, DISABLE);
+  pSensor->sRaw.uiRawCurr = Power_Oversample(pSensor->sChannel.eCurr, pSensor->sChannel.ucCurrOsrBits);
   
   /* Spannungsmessung                                     */
-  ADC_ChannelCmd(ADC1, pSensor->sChannel.eVolt, ENABLE);
-  ADC_SoftwareStartConv(ADC1);
-  while (!ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC)) { Power_Wait(); }
-  pSensor->sRaw.uiRawVolt = ADC_GetConversionValue(ADC1);
-  ADC_ChannelCmd(ADC1, pSensor->sChannel.eVolt, DISABLE);
+  pSensor->sRaw.uiRawVolt = Power_Oversample(pSensor->sChannel.eVolt, pSensor->sChannel.ucVoltOsrBits);
 }
 
 int16_t Power_CalcCurr(Power_Sensor* pSensor)
 {
-  int16_t iRawZeroComp;
-  iRawZeroComp = pSensor->sRaw.uiRawCurr - pSensor->sCalib.uiCurrZeroOffset;
-  return ((int32_t)iRawZeroComp * pSensor->sCalib.iCurrSlope) >> 10;
+  int32_t lRawZeroComp;
+  lRawZeroComp = (int32_t)pSensor->sRaw.uiRawCurr - pSensor->sCalib.uiCurrZeroOffset;
+  return (lRawZeroComp * pSensor->sCalib.iCurrSlope) >> (10 + POWER_RAW_BITS - 12);
 }
 
 uint16_t Power_CalcVolt(Power_Sensor* pSensor)
 {
-  return ((uint32_t)pSensor->sRaw.uiRawVolt * pSensor->sCalib.uiVoltSlope) >> 10;
+  return ((uint32_t)pSensor->sRaw.uiRawVolt * pSensor->sCalib.uiVoltSlope) >> (10 + POWER_RAW_BITS - 12);
 }
\ No newline at end of file
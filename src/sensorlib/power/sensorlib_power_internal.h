@@ -6,6 +6,7 @@
 
 
 /*- Funktionsprototypen ------------------------------------------------------*/
+uint16_t Power_Oversample(ADC_Channel_TypeDef eChannel, uint8_t ucBits);
 void Power_GetAnalogVal(Power_Sensor* pSensor);
 
 int16_t Power_CalcCurr(Power_Sensor* pSensor);
@@ -12,6 +12,7 @@
 #include "sensorlib_qmc5883_internal.h"
 #include "sensorlib_qmc5883.h"
 #include "motorlib.h"
+#include "Profiler.h"
 #include <stdio.h>
 
 
@@ -62,6 +63,7 @@ void QMC5883_Init(QMC5883_Sensor* pSensor, uint8_t ucSlaveAddr)
  *
  * @date  31.10.2019
  * @date  01.10.2019  Bugfix: alte Statusflags vor dem Neustart zurcksetzen
+ * @date  19.10.2026  Laufzeitmessung der Azimutberechnung
  ******************************************************************************/
 void QMC5883_Update(QMC5883_Sensor* pSensor)
 {
@@ -71,7 +73,9 @@ void QMC5883_Update(QMC5883_Sensor* pSensor)
   QMC5883_SetMode(pSensor, QMC5883_Mode_CONT);*/
   while (!QMC5883_IsDataReady(pSensor));
   QMC5883_GetSensorData(pSensor);
+  PROFILE_BEGIN(Profiler_Zone_AZIM);
   pSensor->sMeasure.uiAzimuth = QMC5883_CalcAzimuth(pSensor);
+  PROFILE_END(Profiler_Zone_AZIM);
   pSensor->sMeasure.iTemperature = QMC5883_CalcTemperature(pSensor);
   /*QMC5883_SoftReset(pSensor);*/
   
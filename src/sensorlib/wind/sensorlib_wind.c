@@ -10,6 +10,7 @@
 /*- Headerdateien ------------------------------------------------------------*/
 #include "stm8l15x.h"
 #include "io_map.h"
+#include "Profiler.h"
 #include "sensorlib_wind_internal.h"
 #include "sensorlib_wind.h"
 
@@ -43,6 +44,39 @@ void Wind_Init(Wind_Sensor* pSensor, uint16_t uiPollInterval)
   TIM3_Cmd(ENABLE);
 }
 
+/*!****************************************************************************
+ * @brief
+ * Pulszhler fr ein Messfenster starten. Timer 3 braucht den Systemtakt,
+ * im Active-Halt gehen Pulse verloren.
+ *
+ * @param[inout]  *pSensor  Sensor-Struktur
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Wind_Start(Wind_Sensor* pSensor)
+{
+  (void)pSensor;
+  CLK_PeripheralClockConfig(CLK_Peripheral_TIM3, ENABLE);
+  TIM3_SetCounter(0);
+  TIM3_Cmd(ENABLE);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Pulszhler am Ende des Messfensters anhalten, die Messwerte bleiben bis
+ * zum nchsten Fenster erhalten
+ *
+ * @param[inout]  *pSensor  Sensor-Struktur
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Wind_Stop(Wind_Sensor* pSensor)
+{
+  (void)pSensor;
+  TIM3_Cmd(DISABLE);
+  CLK_PeripheralClockConfig(CLK_Peripheral_TIM3, DISABLE);
+}
+
 /*!****************************************************************************
  * @brief
  * Rohdaten einlesen und Messwerte umrechnen
@@ -51,11 +85,14 @@ void Wind_Init(Wind_Sensor* pSensor, uint16_t uiPollInterval)
  *
  * @date  31.10.2019
  * @date  19.12.2019  Nur Windgeschwindigkeit
+ * @date  19.10.2026  Laufzeitmessung der Mittelwertbildung
  ******************************************************************************/
 void Wind_UpdateSpd(Wind_Sensor* pSensor)
 {
   Wind_GetPulseCount(pSensor);
+  PROFILE_BEGIN(Profiler_Zone_WIND);
   pSensor->sMeasure.uiAvgVelocity = Wind_CalcAvgVelocity(pSensor);
+  PROFILE_END(Profiler_Zone_WIND);
   pSensor->sMeasure.uiMaxVelocity = Wind_CalcMaxVelocity(pSensor);
 }
 
@@ -88,6 +88,8 @@ typedef struct tag_Wind_Sensor
 
 /*- Funktionsprototypen ------------------------------------------------------*/
 void Wind_Init(Wind_Sensor* pSensor, uint16_t uiPollInterval);
+void Wind_Start(Wind_Sensor* pSensor);
+void Wind_Stop(Wind_Sensor* pSensor);
 void Wind_UpdateSpd(Wind_Sensor* pSensor);
 void Wind_UpdateDir(Wind_Sensor* pSensor);
 
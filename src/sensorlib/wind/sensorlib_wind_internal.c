@@ -171,7 +171,7 @@ uint16_t Wind_CalcMaxVelocity(Wind_Sensor* pSensor)
 Wind_Direction Wind_CalcDirection(Wind_Sensor* pSensor)
 {
   uint8_t ucIndex;
-  Wind_Direction eDir;
+  Wind_Direction eDir = Wind_Direction_N;
   uint16_t uiRaw = pSensor->sRaw.uiRawDirection;
   for (ucIndex = 0; ucIndex < WIND_DIRLUT_NUM; ++ucIndex)
   {
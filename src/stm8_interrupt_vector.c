@@ -26,6 +26,9 @@ extern @far @interrupt void UART3_RxInterruptHandler(void);
 extern @far @interrupt void UART3_TxInterruptHandler(void);
 extern @far @interrupt void RTC_InterruptHandler(void);
 extern @far @interrupt void Motor_LimitInterruptHandler(void);
+#ifdef PROFILER
+extern @far @interrupt void Profiler_TimerInterrupt(void);
+#endif
 
 struct interrupt_vector const _vectab[] = {
 	{0x82, (interrupt_handler_t)_stext}, /* reset */
@@ -53,7 +56,11 @@ struct interrupt_vector const _vectab[] = {
 	{0x82, NonHandledInterrupt}, /* tim2cc usart2rx  */
 	{0x82, UART3_TxInterruptHandler}, /* tim3 usart3tx */
 	{0x82, UART3_RxInterruptHandler}, /* tim3cc usart3rx */
+#ifdef PROFILER
+	{0x82, Profiler_TimerInterrupt}, /* tim1upd */
+#else
 	{0x82, NonHandledInterrupt}, /* tim1upd */
+#endif
 	{0x82, NonHandledInterrupt}, /* tim1cc */
 	{0x82, NonHandledInterrupt}, /* tim4upd */
 	{0x82, NonHandledInterrupt}, /* spi1eot */
@@ -3,6 +3,9 @@
 #include <stdio.h>
 #include <string.h>
 #include "commlib.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include "Scheduler.h"
 #include "ATCmd_CmdFunc.h"
 #include "ATCmd.h"
 
@@ -35,10 +38,32 @@ static const ATCmd_CbConf asCommands[] = {
   {"CGNSPWR", ATCmd_GnsPwrTest,0,               ATCmd_GnsPwrWrite,0},
   {"CGNSTST", ATCmd_GnsTstTest,ATCmd_GnsTstRead,ATCmd_GnsTstWrite,0},
   {"CPWR",    ATCmd_OK,       ATCmd_PwrRead,    0,                0},
+  {"CENERGY", ATCmd_EnergyTest,ATCmd_EnergyRead,ATCmd_EnergyWrite,ATCmd_EnergyClear},
+  {"CLPM",    ATCmd_OK,       ATCmd_LpmRead,    0,                ATCmd_LpmClear},
+  {"CSCHED",  ATCmd_OK,       ATCmd_SchedRead,  0,                ATCmd_SchedClear},
+  {"CISR",    ATCmd_IsrTest,  ATCmd_IsrRead,    ATCmd_IsrWrite,   ATCmd_IsrClear},
+  {"CRAM",    ATCmd_OK,       ATCmd_RamRead,    0,                0},
+  {"CWDG",    ATCmd_OK,       ATCmd_WdgRead,    0,                ATCmd_WdgClear},
+#ifdef I2C_FAULTS
+  {"CI2C",    ATCmd_I2cTest,  ATCmd_I2cRead,    ATCmd_I2cWrite,   ATCmd_I2cClear},
+#else
+  {"CI2C",    ATCmd_OK,       ATCmd_I2cRead,    0,                ATCmd_I2cClear},
+#endif /* I2C_FAULTS */
+  {"CTRACE",  ATCmd_TraceTest,ATCmd_TraceRead,  ATCmd_TraceWrite, ATCmd_TraceFlush},
+#ifdef PROFILER
+  {"CPROF",   ATCmd_ProfTest, ATCmd_ProfRead,   ATCmd_ProfWrite,  ATCmd_ProfClear},
+  {"CBENCH",  ATCmd_BenchTest, ATCmd_BenchRead, ATCmd_BenchWrite, 0},
+#endif /* PROFILER */
   {"CINTV",   ATCmd_IntvTest, 0,                ATCmd_IntvWrite,  0},
-  {"CGUI",    ATCmd_OK,       ATCmd_GuiRead,    0,                0},
+  {"CGUI",    ATCmd_OK,       ATCmd_GuiRead,    ATCmd_GuiWrite,   0},
   {"CWKUP",   ATCmd_OK,       0,                0,                ATCmd_ForceWkup},
+  {"CLOGFMT", ATCmd_LogFmtTest,ATCmd_LogFmtRead,ATCmd_LogFmtWrite,0},
+  {"CLOGBUF", ATCmd_LogBufTest,ATCmd_LogBufRead,ATCmd_LogBufWrite,ATCmd_LogBufFlush},
+  {"CLOGPRE", ATCmd_LogPreTest,ATCmd_LogPreRead,ATCmd_LogPreWrite,0},
+  {"CLOGGET", ATCmd_LogGetTest,0,               ATCmd_LogGetWrite,0},
   {"CLOG",    ATCmd_OK,       0,                0,                ATCmd_LogClear},
+  {"CROLLUP", ATCmd_RollupTest,ATCmd_RollupRead,ATCmd_RollupWrite,ATCmd_RollupFlush},
+  {"CSLOG",   ATCmd_SLogTest, ATCmd_SLogRead,   ATCmd_SLogWrite,  0},
   {"CDEBUG",  ATCmd_DebugTest,ATCmd_DebugRead,  ATCmd_DebugWrite, 0},
   {"CFILE",   ATCmd_FileTest, ATCmd_FileRead,   ATCmd_FileWrite,  0},
   {"CTRACK",  ATCmd_TrackTest,ATCmd_TrackRead,  ATCmd_TrackWrite, 0},
@@ -48,6 +73,9 @@ static const ATCmd_CbConf asCommands[] = {
 
 static int iExitDataMode;
 
+/*! Fortsetzung eines aufgeteilten Befehls, 0: keine                          */
+static ATCmd_Resume pfResume;
+
 
 /*- Lokale Funktionen --------------------------------------------------------*/
 static void ATCmd_SendCONNECT(void)
@@ -88,6 +116,7 @@ void ATCmd_Init(void)
   eDataModeSrc = ATCmd_DataModeSrc_None;
   bDataMode = false;
   iExitDataMode = 3;
+  pfResume = 0;
 }
 
 void ATCmd_Poll(void)
@@ -101,18 +130,22 @@ void ATCmd_Poll(void)
     {
       /* Mindestens "AT"                                  */
       UART1_FlushTx();
+      Trace_Record(Trace_Type_AT, aucUart1RxBuf, (uint8_t)UART1_GetRxCount());
       if (strncmp(&aucUart1RxBuf[0], "AT", 2) == 0)
       {
         /* "AT" gefunden                                  */
         if (aucUart1RxBuf[2] == '+')
         {
           /* Befehl folgt                                 */
+          PROFILE_BEGIN(Profiler_Zone_ATCMD);
           for (ucIndex = 0; ucIndex < NUM_ATCMD_CONF; ++ucIndex)
           {
             if (strncmp(&aucUart1RxBuf[3], asCommands[ucIndex].pszCmdStr, strlen(asCommands[ucIndex].pszCmdStr)) == 0)
             {
               /* Command String gefunden                  */
               char* pszCmd = &aucUart1RxBuf[3 + strlen(asCommands[ucIndex].pszCmdStr)];              
+              PROFILE_END(Profiler_Zone_ATCMD);
+              
               if (pszCmd[0] == '=')
               {
                 if (pszCmd[1] == '?')
@@ -214,6 +247,15 @@ void ATCmd_Poll(void)
       }
     }
     
+    /* Aufgeteilte Ausgabe: Quittung nach dem letzten     */
+    /* Abschnitt, bis dahin kein neuer Befehl             */
+    if (bResult && (pfResume != 0))
+    {
+      Sched_Post(Sched_Event_RESUME);
+      return;
+    }
+    pfResume = 0;
+    
     /* "OK" oder "ERROR" senden                           */
     if (!bDataMode)
     {
@@ -233,6 +275,57 @@ void ATCmd_Poll(void)
   }
 }
 
+/*!****************************************************************************
+ * @brief
+ * Task fr aufgeteilte Ausgaben: einen Abschnitt senden, danach erneut
+ * bereit werden oder quittieren und den Empfang wieder starten. Luft mit
+ * der niedrigsten Prioritt, die brigen Tasks kommen dazwischen zum Zug.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void ATCmd_TaskResume(void)
+{
+  ATCmd_Step eStep;
+  
+  if (pfResume == 0)
+  {
+    return;
+  }
+  
+  eStep = pfResume();
+  if (eStep == ATCmd_Step_MORE)
+  {
+    Sched_Post(Sched_Event_RESUME);
+    return;
+  }
+  
+  pfResume = 0;
+  if (eStep == ATCmd_Step_OK)
+  {
+    ATCmd_SendOK();
+  }
+  else
+  {
+    ATCmd_SendError();
+  }
+  UART1_FlushRx();
+  ATCmd_ReceiveNext();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fortsetzung fr die Ausgabe des laufenden Befehls vormerken. Aufruf aus
+ * einer Befehlsfunktion, die danach true zurckgibt.
+ *
+ * @param[in] pfNext    Fortsetzung, je Aufruf ein Abschnitt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void ATCmd_SetResume(ATCmd_Resume pfNext)
+{
+  pfResume = pfNext;
+}
+
 bool ATCmd_GetDataMode(ATCmd_DataModeSrc eSource)
 {
   return bDataMode && (eDataModeSrc == eSource);
@@ -12,6 +12,16 @@ typedef enum {
   ATCmd_DataModeSrc_Debug
 } ATCmd_DataModeSrc;
 
+/*! Ergebnis eines Abschnitts einer aufgeteilten Ausgabe                      */
+typedef enum {
+  ATCmd_Step_MORE,
+  ATCmd_Step_OK,
+  ATCmd_Step_ERROR
+} ATCmd_Step;
+
+/*! Fortsetzung einer aufgeteilten Ausgabe, ein Abschnitt je Aufruf           */
+typedef ATCmd_Step (*ATCmd_Resume)(void);
+
 
 /*- DataMode Variablen -------------------------------------------------------*/
 extern ATCmd_DataModeSrc eDataModeSrc;
@@ -21,6 +31,8 @@ extern bool bDataMode;
 /*- Funktionsprototypen ------------------------------------------------------*/
 void ATCmd_Init(void);
 void ATCmd_Poll(void);
+void ATCmd_TaskResume(void);
+void ATCmd_SetResume(ATCmd_Resume pfNext);
 bool ATCmd_GetDataMode(ATCmd_DataModeSrc eSource);
 
 #endif /* USERLIB_ATCMD_H_ */
\ No newline at end of file
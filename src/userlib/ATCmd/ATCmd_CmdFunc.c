@@ -14,9 +14,22 @@
 #include "stm8l15x.h"
 #include "commlib.h"
 #include "app_sensors.h"
-#include "sensorlog.h"
+#include "SensorLog.h"
 #include "SolarTracking.h"
+#include "EnergyCounter.h"
+#include "PowerGov.h"
+#include "powerlib.h"
 #include "motorlib.h"
+#include "Scheduler.h"
+#include "Deferred.h"
+#include "Profiler.h"
+#include "Benchmark.h"
+#include "RamStat.h"
+#include "Watchdog.h"
+#include "Trace.h"
+#include "Logger.h"
+#include "Rollup.h"
+#include "NumFmt.h"
 #include "ff.h"
 #include "ATCmd.h"
 #include "ATCmd_CmdFunc.h"
@@ -26,6 +39,32 @@
 /*! @brief Sendepuffer                                                        */
 #define AT_TXBUF  ((volatile char*)&aucUart1TxBuf)
 
+/*! @brief Abschnitte des Sendepuffers je Durchlauf einer aufgeteilten
+ * Ausgabe, bei 9600 Baud etwa 400 ms                                         */
+#define AT_RESUME_CHUNKS  4
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Geffnete Datei einer aufgeteilten Ausgabe                                */
+static FIL sAtFile;
+
+/*! Noch zu sendende Byte der aufgeteilten Ausgabe                            */
+static uint32_t ulAtLeft;
+
+/*! Bereich der laufenden Tagesdatei fr "AT+CLOGGET"                         */
+static Logger_Range sAtRange;
+
+/*! Eintrge der laufenden Tagesdatei folgen nach dem Dateikopf               */
+static bool bAtRange;
+
+/*! Nchste und letzte Tagesdatei fr "AT+CLOGGET"                            */
+static uint16_t uiAtDay;
+static uint16_t uiAtLast;
+
+/*! Zeitbereich fr "AT+CLOGGET" als Unix-Zeit in s                           */
+static uint32_t ulAtFrom;
+static uint32_t ulAtTo;
+
 
 /*- Lokale Funktionen --------------------------------------------------------*/
 /*!****************************************************************************
@@ -74,6 +113,212 @@ static int CountArgs(const char* pszBuf)
   return count;
 }
 
+/*!****************************************************************************
+ * @brief
+ * Abschnitt der aufgeteilten Dateiausgabe senden: hchstens
+ * AT_RESUME_CHUNKS Pufferinhalte ab der aktuellen Dateiposition
+ *
+ * @return    ATCmd_Step  Fortsetzung folgt, fertig oder Lesefehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static ATCmd_Step AT_ResumeFile(void)
+{
+  uint8_t ucChunk;
+  unsigned int num;
+  
+  for (ucChunk = 0; (ucChunk < AT_RESUME_CHUNKS) && (ulAtLeft > 0); ++ucChunk)
+  {
+    num = (ulAtLeft < COMMLIB_UART1_MAX_BUF) ? (unsigned int)ulAtLeft : COMMLIB_UART1_MAX_BUF;
+    if ((f_read(&sAtFile, AT_TXBUF, num, &num) != FR_OK) || (num == 0))
+    {
+      f_close(&sAtFile);
+      return ATCmd_Step_ERROR;
+    }
+    
+    /* Binrdatei: Nullbyte ist kein Ende                 */
+    UART1_Send((uint8_t)num);
+    while(!UART1_IsTxReady());
+    UART1_FlushTx();
+    Watchdog_Kick();
+    ulAtLeft -= num;
+  }
+  
+  if (ulAtLeft > 0)
+  {
+    return ATCmd_Step_MORE;
+  }
+  f_close(&sAtFile);
+  return ATCmd_Step_OK;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abschnitt der Ausgabe von "AT+CLOGGET": je Durchlauf eine Tagesdatei
+ * durchsuchen bzw. einen Abschnitt ihres Kopfes oder ihrer Eintrge senden
+ *
+ * @return    ATCmd_Step  Fortsetzung folgt, fertig oder Lesefehler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static ATCmd_Step AT_ResumeLog(void)
+{
+  ATCmd_Step eStep;
+  
+  /* Dateikopf bzw. Eintrge der Tagesdatei fortsetzen    */
+  if (ulAtLeft > 0)
+  {
+    eStep = AT_ResumeFile();
+    if ((eStep != ATCmd_Step_OK) || (ulAtLeft > 0))
+    {
+      return eStep;
+    }
+  }
+  
+  /* Nach dem Kopf die Eintrge im Bereich                */
+  if (bAtRange)
+  {
+    bAtRange = false;
+    if ((f_open(&sAtFile, sAtRange.szFile, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+      || (f_lseek(&sAtFile, sAtRange.ulStart) != FR_OK))
+    {
+      return ATCmd_Step_ERROR;
+    }
+    ulAtLeft = sAtRange.ulEnd - sAtRange.ulStart;
+    return ATCmd_Step_MORE;
+  }
+  
+  /* Nchste Tagesdatei mit Eintrgen im Bereich          */
+  if (uiAtDay > uiAtLast)
+  {
+    return ATCmd_Step_OK;
+  }
+  if (Logger_FindRange(uiAtDay++, ulAtFrom, ulAtTo, &sAtRange)
+    && (sAtRange.ulEnd > sAtRange.ulStart))
+  {
+    sprintf(AT_TXBUF, "+CLOGGET: %s,%ld\r\n", sAtRange.szFile,
+      (long)(sAtRange.uiHead + sAtRange.ulEnd - sAtRange.ulStart));
+    AT_Send();
+    if (f_open(&sAtFile, sAtRange.szFile, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+    {
+      return ATCmd_Step_ERROR;
+    }
+    ulAtLeft = sAtRange.uiHead;
+    bAtRange = true;
+    if (ulAtLeft == 0)
+    {
+      f_close(&sAtFile);
+    }
+  }
+  return ATCmd_Step_MORE;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeichen in Abschnitten der Gre des Sendepuffers senden
+ *
+ * @param[in] *pcData   Zeichen
+ * @param[in] ucLen     Anzahl Zeichen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void AT_SendBuf(const char* pcData, uint8_t ucLen)
+{
+  uint8_t ucNum;
+  
+  while (ucLen > 0)
+  {
+    ucNum = (ucLen < COMMLIB_UART1_MAX_BUF) ? ucLen : COMMLIB_UART1_MAX_BUF;
+    memcpy((char*)AT_TXBUF, pcData, ucNum);
+    UART1_Send(ucNum);
+    while(!UART1_IsTxReady());
+    UART1_FlushTx();
+    Watchdog_Kick();
+    pcData += ucNum;
+    ucLen -= ucNum;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag des Ringspeichers als Zeile der Wertetabelle fr GUI senden. Die
+ * Zeile wird ohne Formatstring im Zeilenpuffer des Loggers zusammengestellt
+ * und in einem Stck gesendet, Zeichen fr Zeichen gleich der frheren
+ * Ausgabe mit sprintf().
+ *
+ * @param[in] *pLog     Eintrag
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Zeilenpuffer acLoggerLine statt Stack
+ ******************************************************************************/
+static void AT_SendGuiItem(const SensorLogItem* pLog)
+{
+  char* pc = acLoggerLine;
+  
+  /* Header und RTC Zeitstempel                           */
+  memcpy(pc, "+CGUI: ", 7);
+  pc += 7;
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sDate.RTC_Year);
+  *(pc++) = ',';
+  pc = NumFmt_Put2(pc, (uint8_t)pLog->sTimestamp.sDate.RTC_Month);
+  *(pc++) = ',';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sDate.RTC_Date);
+  *(pc++) = ',';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sTime.RTC_Hours);
+  *(pc++) = ',';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sTime.RTC_Minutes);
+  *(pc++) = ',';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sTime.RTC_Seconds);
+  
+  /* Temperaturmesswerte                                  */
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iBME);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iCPU);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iQMC);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iMPU);
+  
+  /* Wind                                                 */
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sWind.uiDir);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sWind.uiVelo);
+  
+  /* Luftdruck, Luftfeuchte, Ausrichtung                  */
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->ulHumidity);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->ulPressure);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sAlignment.iZenith);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sAlignment.uiAzimuth);
+  
+  /* GPS Position und Hhe                                */
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPosition.lLat);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPosition.lLong);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPosition.iAlt);
+  
+  /* Leistungsmessdaten                                   */
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sPower.uiBatVolt / 10);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPower.iBatCurr / 10);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sPower.uiPanelVolt / 10);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPower.iPanelCurr / 10);
+  memcpy(pc, ",330\r\n", 6);
+  pc += 6;
+  
+  AT_SendBuf(acLoggerLine, (uint8_t)(pc - acLoggerLine));
+}
+
 
 /*!****************************************************************************
  * @brief
@@ -538,39 +783,81 @@ bool ATCmd_PwrRead(const char* pszBuf)
 
 /*!****************************************************************************
  * @brief
- * Test-Befehl fr "AT+CINTV"
+ * Einen Zhlersatz der Energiebilanz ausgeben
+ *
+ * @param[in] ucIdx     Kennung des Zhlersatzes (0: Tag, 1: Gesamt)
+ * @param[in] *pSet     Zhlersatz
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void AT_SendEnergySet(uint8_t ucIdx, const Energy_Set* pSet)
+{
+  sprintf(AT_TXBUF, "+CENERGY: %u,%lu,%lu,%lu,%lu,%lu,%lu\r\n",
+    (unsigned)ucIdx,
+    pSet->sBatInCharge.ulValue,
+    pSet->sBatOutCharge.ulValue,
+    pSet->sBatInEnergy.ulValue,
+    pSet->sBatOutEnergy.ulValue,
+    pSet->sPvCharge.ulValue,
+    pSet->sPvEnergy.ulValue
+  );
+  AT_Send();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CENERGY"
  *
  * @param[in] *pszBuf   Nicht genutzt
  * @return    bool      true
  *
- * @date  09.12.2019
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_IntvTest(const char* pszBuf)
+bool ATCmd_EnergyTest(const char* pszBuf)
 {
-  sprintf(AT_TXBUF, "+CINTV: 10-3600\r\n");
+  sprintf(AT_TXBUF, "+CENERGY: 0-100\r\n");
   AT_Send();
   return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Wakeup-Timer Zhlerwert zurcksetzn
- * 
+ * Ladezustand sowie Tages- und Gesamtzhler der Energiebilanz lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_EnergyRead(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CENERGY: %u,%u\r\n", 
+    (unsigned)sEnergy.ucSoC, 
+    (unsigned)sEnergy.bAnchored
+  );
+  AT_Send();
+  AT_SendEnergySet(0, &sEnergy.sDay);
+  AT_SendEnergySet(1, &sEnergy.sTotal);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ladezustand vorgeben, z.B. nach dem Tausch der Batterie
+ *
  * @param[in] *pszBuf   Eingabewerte
  * @return    bool      true, wenn Eingabe gltig
  *
- * @date  09.12.2019
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_IntvWrite(const char* pszBuf)
+bool ATCmd_EnergyWrite(const char* pszBuf)
 {
-  short iInterval = atoi(pszBuf);
-  if ((iInterval >= 10) && (iInterval <= 3600))
+  int iSoC = atoi(pszBuf);
+  if ((*pszBuf >= '0') && (*pszBuf <= '9') && (iSoC <= 100))
   {
-    RTC_WakeUpCmd(DISABLE);
-    RTC_SetWakeUpCounter((unsigned short)iInterval);
-    RTC_WakeUpCmd(ENABLE);
-    sprintf(AT_TXBUF, "+CINTV: %d\r\n", iInterval);
-    printf("WakeupTimer Reset: %d\r\n", iInterval);
+    Energy_SetSoC((uint8_t)iSoC);
+    Energy_Save();
+    sprintf(AT_TXBUF, "+CENERGY: %d\r\n", iSoC);
     AT_Send();
     return true;
   }
@@ -582,315 +869,1421 @@ bool ATCmd_IntvWrite(const char* pszBuf)
 
 /*!****************************************************************************
  * @brief
- * Wertetabelle fr GUI lesen
+ * Gesamtzhler der Energiebilanz zurcksetzen
  *
  * @param[in] *pszBuf   Nicht genutzt
  * @return    bool      true
  *
- * @date  07.12.2019
- * @date  08.12.2019  UART-Modul Funktionsaufrufe ausgelagert
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_GuiRead(const char* pszBuf)
+bool ATCmd_EnergyClear(const char* pszBuf)
 {
-  unsigned uOffset;
-  for (uOffset = 0; uOffset < NUM_SENSORLOG_RINGITEMS; ++uOffset)
-  {
-    SensorLogItem* pLog = SensorLog_Dump(uOffset);
-  
-    /* Header und RTC Zeitstempel                           */
-    sprintf(AT_TXBUF, "+CGUI: %02d,%02d,%02d,%02d,%02d,%02d,",
-      (int)pLog->sTimestamp.sDate.RTC_Year,
-      (int)pLog->sTimestamp.sDate.RTC_Month,
-      (int)pLog->sTimestamp.sDate.RTC_Date,
-      (int)pLog->sTimestamp.sTime.RTC_Hours,
-      (int)pLog->sTimestamp.sTime.RTC_Minutes,
-      (int)pLog->sTimestamp.sTime.RTC_Seconds
-    );
-    AT_Send();
-    
-    /* Temperaturmesswerte                                  */
-    sprintf(AT_TXBUF, "%d,%d,%d,%d,", 
-      pLog->sTemperature.iBME,
-      pLog->sTemperature.iCPU,
-      pLog->sTemperature.iQMC,
-      pLog->sTemperature.iMPU
-    );
-    AT_Send();
-    
-    /* Wind                                                 */
-    sprintf(AT_TXBUF, "%d,%d,",
-      pLog->sWind.uiDir,
-      pLog->sWind.uiVelo
-    );
-    AT_Send();
-    
-    /* Luftdruck, Luftfeuchte, Ausrichtung                  */
-    sprintf(AT_TXBUF, "%ld,%ld,%d,%d,", 
-      pLog->ulHumidity,
-      pLog->ulPressure,
-      pLog->sAlignment.iZenith,
-      pLog->sAlignment.uiAzimuth
-    );
-    AT_Send();
-    
-    /* GPS Position und Hhe                                */
-    sprintf(AT_TXBUF, "%ld,%ld,%d,",
-      pLog->sPosition.lLat,
-      pLog->sPosition.lLong,
-      pLog->sPosition.iAlt
-    );
-    AT_Send();
-    
-    /* Leistungsmessdaten                                 */
-    sprintf(AT_TXBUF, "%d,%d,%d,%d,%d\r\n",
-      pLog->sPower.uiBatVolt / 10,
-      pLog->sPower.iBatCurr / 10,
-      pLog->sPower.uiPanelVolt / 10,
-      pLog->sPower.iPanelCurr / 10,
-      330
-    );
-    AT_Send();
-  }
+  Energy_ClearTotal();
   return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Wakeup-Task auslsen
+ * Aufenthaltsdauer und Anzahl der Eintritte je Energiesparmodus lesen
  *
  * @param[in] *pszBuf   Nicht genutzt
  * @return    bool      true
  *
- * @date  23.12.2019
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_ForceWkup(const char* pszBuf)
+bool ATCmd_LpmRead(const char* pszBuf)
 {
-  extern volatile bool bTaskWakeupFlag;
-  bTaskWakeupFlag = true;
+  const LowPower_Stats* pStats = LowPower_GetStats();
+  
+  sprintf(AT_TXBUF, "+CLPM: %lu,%lu,%lu,%lu,%lu,%u\r\n",
+    pStats->aulTime[LowPower_Mode_RUN] / LOWPOWER_TICK_HZ,
+    pStats->aulTime[LowPower_Mode_WAIT] / LOWPOWER_TICK_HZ,
+    pStats->aulTime[LowPower_Mode_HALT] / LOWPOWER_TICK_HZ,
+    pStats->aulCount[LowPower_Mode_WAIT],
+    pStats->aulCount[LowPower_Mode_HALT],
+    (unsigned)LowPower_GetLocks()
+  );
+  AT_Send();
   return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Messwerte-Protokoll lschen
+ * Zeitstatistik der Energiesparmodi zurcksetzen
  *
  * @param[in] *pszBuf   Nicht genutzt
  * @return    bool      true
  *
- * @date  19.12.2019
- ******************************************************************************/ 
-bool ATCmd_LogClear(const char* pszBuf)
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LpmClear(const char* pszBuf)
 {
-  SensorLog_Clear();
+  LowPower_ClearStats();
   return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Test-Befehl fr "AT+CDEBUG"
+ * Laufzeitstatistik des Schedulers lesen, eine Zeile je Task mit Name,
+ * Prioritt, Ausfhrungen, Fristberschreitungen und max. Latenz in ms
  *
  * @param[in] *pszBuf   Nicht genutzt
  * @return    bool      true
  *
- * @date  30.12.2019
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_DebugTest(const char* pszBuf)
+bool ATCmd_SchedRead(const char* pszBuf)
 {
-  sprintf(AT_TXBUF, "+CDEBUG: 0-1\r\n");
-  AT_Send();
+  const Sched_Task* pTask;
+  const Sched_Stats* pStats;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < Sched_GetNum(); ++ucIdx)
+  {
+    pTask = Sched_GetTask(ucIdx);
+    pStats = Sched_GetStats(ucIdx);
+    sprintf(AT_TXBUF, "+CSCHED: %s,%u,%u,%u,%u\r\n",
+      pTask->pszName,
+      (unsigned)pTask->ucPrio,
+      pStats->uiRuns,
+      pStats->uiMisses,
+      pStats->uiMaxLatency
+    );
+    AT_Send();
+  }
   return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Aktivierungsstatus der Debug-Umleitung anzeigen
+ * Laufzeitstatistik des Schedulers zurcksetzen
  *
  * @param[in] *pszBuf   Nicht genutzt
  * @return    bool      true
  *
- * @date  30.12.2019
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_DebugRead(const char* pszBuf)
+bool ATCmd_SchedClear(const char* pszBuf)
 {
-  sprintf(AT_TXBUF, "+CDEBUG: %d\r\n", (int)(eDataModeSrc == ATCmd_DataModeSrc_Debug));
-  AT_Send();
+  Sched_ClearStats();
   return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Umleitung der Debug-Ausgabe an die Bluetooth-Verbindung 
+ * Test-Befehl fr "AT+CISR"
  *
- * @param[in] *pszBuf   Aktivierungszustand '0' oder '1'
- * @return    bool      true, wenn Umleitung erfolgreich
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
  *
- * @date  30.12.2019
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_DebugWrite(const char* pszBuf)
+bool ATCmd_IsrTest(const char* pszBuf)
 {
-  if (*pszBuf == '0')
-  {
-    if (eDataModeSrc == ATCmd_DataModeSrc_Debug)
-    {
-      eDataModeSrc = ATCmd_DataModeSrc_None;
-      bDataMode = false;
-      sprintf(AT_TXBUF, "+CDEBUG: 0\r\n");
-      AT_Send();
-      return true;
-    }
-    else
-    {
-      sprintf(AT_TXBUF, "+CDEBUG: not act\r\n");
-      AT_Send();
-      return false;
-    }
-  }
-  else if (*pszBuf == '1')
-  {
-    if (eDataModeSrc == ATCmd_DataModeSrc_None)
-    {
-      sprintf(AT_TXBUF, "+CDEBUG: 1\r\n");
-      AT_Send();
-      eDataModeSrc = ATCmd_DataModeSrc_Debug;
-      bDataMode = true;
-      return true;
-    }
-    else
-    {
-      sprintf(AT_TXBUF, "+CDEBUG: busy\r\n");
-      AT_Send();
-      return false;
-    }
-  }
-  else
-  {
-    return false;
-  }
+  sprintf(AT_TXBUF, "+CISR: 0-1\r\n");
+  AT_Send();
+  return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Test-Befehl fr "AT+CFILE"
+ * Max. Laufzeiten der Interruptserviceroutinen und Statistik der
+ * Warteschlange zum Hauptprogramm lesen
  *
  * @param[in] *pszBuf   Nicht genutzt
  * @return    bool      true
  *
- * @date  30.12.2019
+ * @date  19.10.2026
+ * @date  19.10.2026  Betriebsart anhngen
  ******************************************************************************/
-bool ATCmd_FileTest(const char* pszBuf)
+bool ATCmd_IsrRead(const char* pszBuf)
 {
-  sprintf(AT_TXBUF, "+CFILE: 0-2\r\n");
+  const Deferred_Stats* pStats = Deferred_GetStats();
+  
+  sprintf(AT_TXBUF, "+CISR: %u,%u,%u,%u,%u,%u,%u,%u,%u\r\n",
+    pStats->auiIsrMax[Deferred_Isr_TIM2],
+    pStats->auiIsrMax[Deferred_Isr_RTC],
+    pStats->auiIsrMax[Deferred_Isr_LIMIT],
+    pStats->auiIsrMax[Deferred_Isr_UART1_RX],
+    pStats->auiIsrMax[Deferred_Isr_UART3_RX],
+    pStats->uiDelayMax,
+    (unsigned)pStats->ucHighWater,
+    (unsigned)pStats->ucOverflows,
+    (unsigned)Deferred_IsInline()
+  );
   AT_Send();
   return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Inhalt der Logdatei auslesen und ber Bluetooth ausgeben
+ * Statistik der Interruptserviceroutinen zurcksetzen
  *
  * @param[in] *pszBuf   Nicht genutzt
- * @return    bool      true, wenn Lesen erfolgreich
+ * @return    bool      true
  *
- * @date  30.12.2019
+ * @date  19.10.2026
  ******************************************************************************/
-bool ATCmd_FileRead(const char* pszBuf)
+bool ATCmd_IsrClear(const char* pszBuf)
 {
-  FIL fp;
-  unsigned int num;
-  
-  if (f_open(&fp, "LOG.TXT", FA_READ | FA_OPEN_EXISTING) == FR_OK)
-  {
-    sprintf(AT_TXBUF, "+CFILE: %d\r\n", (int)f_size(&fp));
-    AT_Send();
-  
-    do {
-      if (f_read(&fp, AT_TXBUF, COMMLIB_UART1_MAX_BUF, &num) == FR_OK)
-      {
-        AT_Send();
-      }      
-    } while (num > 0);
-    f_close(&fp);
-    return true;
-  }
-  else
+  Deferred_ClearStats();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Betriebsart setzen: 0 Bearbeitung im Hauptprogramm, 1 direkt in der ISR
+ * zum Vergleich der Laufzeiten. Setzt die Statistik zurck.
+ *
+ * @param[in] *pszBuf   Eingabedaten
+ * @return    bool      true, wenn Betriebsart gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_IsrWrite(const char* pszBuf)
+{
+  if ((*pszBuf != '0') && (*pszBuf != '1'))
   {
-    sprintf(AT_TXBUF, "+CFILE: fopen\r\n");
-    AT_Send();
     return false;
   }
+  
+  Deferred_SetInline(*pszBuf == '1');
+  sprintf(AT_TXBUF, "+CISR: %c\r\n", *pszBuf);
+  AT_Send();
+  return true;
 }
 
 /*!****************************************************************************
  * @brief
- * Logdatei leeren oder umbenennen
+ * RAM-Belegung lesen: statische Daten, Hchststand und Reserve des Stacks,
+ * danach eine Zeile je Modul und der Rest der statischen Daten. Ohne
+ * Angabe der statischen Daten (Host-Build) ist der Rest 0.
  *
- * @param[in] *pszBuf   Befehlsargument
- * @return    bool      true, wenn Befehl erfolgreich ausgefhrt
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
  *
- * @date  30.12.2019
+ * @date  19.10.2026
+ * @date  19.10.2026  Rest nicht unter 0
  ******************************************************************************/
-bool ATCmd_FileWrite(const char* pszBuf)
+bool ATCmd_RamRead(const char* pszBuf)
 {
-  FIL fp;
-  DIR dp;
+  const RamStat_Module* pModule;
+  uint16_t uiRest = RamStat_GetStatic();
+  uint8_t ucIdx;
   
-  if (*pszBuf == '0')
-  {
-    return true;
+  sprintf(AT_TXBUF, "+CRAM: %u,%u,%u\r\n",
+    RamStat_GetStatic(),
+    RamStat_GetStackUsed(),
+    RamStat_GetStackFree()
+  );
+  AT_Send();
+  
+  for (ucIdx = 0; ucIdx < RamStat_GetNumModules(); ++ucIdx)
+  {
+    pModule = RamStat_GetModule(ucIdx);
+    sprintf(AT_TXBUF, "+CRAM: %s,%u\r\n", pModule->pszName, pModule->uiSize);
+    AT_Send();
+    uiRest = (uiRest > pModule->uiSize) ? (uiRest - pModule->uiSize) : 0;
+  }
+  
+  sprintf(AT_TXBUF, "+CRAM: REST,%u\r\n", uiRest);
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bericht des Watchdogs lesen: Resetursache beim letzten Start, Anzahl der
+ * Watchdog-Resets sowie laufender und berflliger Task beim letzten
+ * Watchdog-Reset ("-", wenn keiner)
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_WdgRead(const char* pszBuf)
+{
+  const Watchdog_Report* pReport = Watchdog_GetReport();
+  const char* pszTask = "-";
+  const char* pszStalled = "-";
+  
+  if (pReport->ucTask < Sched_GetNum())
+  {
+    pszTask = Sched_GetTask(pReport->ucTask)->pszName;
+  }
+  if (pReport->ucStalled < Sched_GetNum())
+  {
+    pszStalled = Sched_GetTask(pReport->ucStalled)->pszName;
+  }
+  
+  sprintf(AT_TXBUF, "+CWDG: %02X,%u,%s,%s\r\n",
+    (unsigned)pReport->ucCause,
+    pReport->uiResets,
+    pszTask,
+    pszStalled
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bericht des Watchdogs zurcksetzen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_WdgClear(const char* pszBuf)
+{
+  Watchdog_ClearReport();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Busstatistik des I2C-Masters lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_I2cRead(const char* pszBuf)
+{
+  const I2CMaster_Stats* pStats = I2CMaster_GetStats();
+  
+  sprintf(AT_TXBUF, "+CI2C: %lu,%lu,%u,%u,%u\r\n",
+    pStats->ulTransfers,
+    pStats->ulBytes,
+    pStats->uiErrors,
+    pStats->uiRecoveries,
+    pStats->uiTimeouts
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Busstatistik des I2C-Masters zurcksetzen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_I2cClear(const char* pszBuf)
+{
+  I2CMaster_ClearStats();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CTRACE"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_TraceTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CTRACE: (0,1)\r\n");
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zustand und Zhler der Aufzeichnung lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Dateiwechsel
+ ******************************************************************************/
+bool ATCmd_TraceRead(const char* pszBuf)
+{
+  const Trace_Stats* pStats = Trace_GetStats();
+  
+  sprintf(AT_TXBUF, "+CTRACE: %d,%u,%lu,%u,%u,%u\r\n",
+    Trace_IsEnabled() ? 1 : 0,
+    pStats->uiRecords,
+    pStats->ulBytes,
+    pStats->uiFlushes,
+    pStats->uiLost,
+    pStats->uiRotations
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Aufzeichnung ein- oder ausschalten
+ *
+ * @param[in] *pszBuf   0: aus, 1: ein
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_TraceWrite(const char* pszBuf)
+{
+  if ((*pszBuf != '0') && (*pszBuf != '1'))
+  {
+    return false;
+  }
+  
+  Trace_SetEnable(*pszBuf == '1');
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Puffer der Aufzeichnung sofort auf die SD-Karte schreiben
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_TraceFlush(const char* pszBuf)
+{
+  Trace_Flush();
+  return true;
+}
+
+#ifdef I2C_FAULTS
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CI2C"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_I2cTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CI2C: (0-%u),(0-255)\r\n", (unsigned)(I2CMaster_Fault_NUM - 1));
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fehler fr die nchsten Registerlesezugriffe einspeisen
+ *
+ * @param[in] *pszBuf   Fehlerart, Anzahl der Zugriffe
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_I2cWrite(const char* pszBuf)
+{
+  int iFault;
+  int iCount;
+  
+  if (CountArgs(pszBuf) != 2)
+  {
+    return false;
+  }
+  
+  iFault = atoi(pszBuf);
+  while (*(pszBuf++) != ',');
+  iCount = atoi(pszBuf);
+  if ((iFault < 0) || (iFault >= I2CMaster_Fault_NUM) ||
+    (iCount < 0) || (iCount > 255))
+  {
+    return false;
+  }
+  
+  I2CMaster_SetFault((I2CMaster_Fault)iFault, (uint8_t)iCount);
+  return true;
+}
+#endif /* I2C_FAULTS */
+
+#ifdef PROFILER
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CPROF"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_ProfTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CPROF: 0-%d\r\n", Profiler_Zone_NUM - 1);
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufzeiten aller Zonen lesen, eine Zeile je Zone mit Name, Anzahl,
+ * Minimum, Mittelwert und Maximum in s
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_ProfRead(const char* pszBuf)
+{
+  const Profiler_Stats* pStats;
+  uint8_t ucZone;
+  
+  for (ucZone = 0; ucZone < Profiler_Zone_NUM; ++ucZone)
+  {
+    pStats = Profiler_GetStats((Profiler_Zone)ucZone);
+    sprintf(AT_TXBUF, "+CPROF: %s,%u,%lu,%lu,%lu\r\n",
+      Profiler_GetName((Profiler_Zone)ucZone),
+      pStats->uiCount,
+      (pStats->uiCount > 0) ? pStats->ulMin : 0,
+      (pStats->uiCount > 0) ? pStats->ulSum / pStats->uiCount : 0,
+      pStats->ulMax
+    );
+    AT_Send();
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Histogramm einer Zone lesen, zwei Zeilen mit je acht Klassen
+ *
+ * @param[in] *pszBuf   Index der Zone
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_ProfWrite(const char* pszBuf)
+{
+  const Profiler_Stats* pStats;
+  short iZone = atoi(pszBuf);
+  uint8_t ucBin;
+  
+  if ((iZone < 0) || (iZone >= Profiler_Zone_NUM))
+  {
+    return false;
+  }
+  
+  pStats = Profiler_GetStats((Profiler_Zone)iZone);
+  for (ucBin = 0; ucBin < PROFILER_HIST_BINS; ucBin += 8)
+  {
+    sprintf(AT_TXBUF, "+CPROF: %s,%u,%u,%u,%u,%u,%u,%u,%u,%u\r\n",
+      Profiler_GetName((Profiler_Zone)iZone),
+      (unsigned)ucBin,
+      pStats->auiHist[ucBin],
+      pStats->auiHist[ucBin + 1],
+      pStats->auiHist[ucBin + 2],
+      pStats->auiHist[ucBin + 3],
+      pStats->auiHist[ucBin + 4],
+      pStats->auiHist[ucBin + 5],
+      pStats->auiHist[ucBin + 6],
+      pStats->auiHist[ucBin + 7]
+    );
+    AT_Send();
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufzeiten aller Zonen zurcksetzen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_ProfClear(const char* pszBuf)
+{
+  Profiler_ClearStats();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CBENCH"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_BenchTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CBENCH: (0-%d),(1-%d)\r\n", Benchmark_Case_NUM - 1, BENCHMARK_MAX_RUNS);
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messflle auflisten, eine Zeile je Fall mit Index und Name
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_BenchRead(const char* pszBuf)
+{
+  uint8_t ucCase;
+  
+  for (ucCase = 0; ucCase < Benchmark_Case_NUM; ++ucCase)
+  {
+    sprintf(AT_TXBUF, "+CBENCH: %u,%s\r\n",
+      (unsigned)ucCase,
+      Benchmark_GetName((Benchmark_Case)ucCase)
+    );
+    AT_Send();
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messfall ausfhren und krzeste sowie mittlere Laufzeit in CPU-Takten
+ * ausgeben
+ *
+ * @param[in] *pszBuf   Index des Falls, Anzahl der Durchlufe
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_BenchWrite(const char* pszBuf)
+{
+  Benchmark_Result sResult;
+  int iCase;
+  int iRuns;
+  
+  if (CountArgs(pszBuf) != 2)
+  {
+    return false;
+  }
+  
+  iCase = atoi(pszBuf);
+  while (*(pszBuf++) != ',');
+  iRuns = atoi(pszBuf);
+  if ((iCase < 0) || (iCase >= Benchmark_Case_NUM) ||
+    (iRuns < 1) || (iRuns > BENCHMARK_MAX_RUNS))
+  {
+    return false;
+  }
+  
+  Benchmark_Run((Benchmark_Case)iCase, (uint16_t)iRuns, &sResult);
+  sprintf(AT_TXBUF, "+CBENCH: %s,%u,%lu,%lu\r\n",
+    Benchmark_GetName((Benchmark_Case)iCase),
+    sResult.uiRuns,
+    sResult.ulMin,
+    sResult.ulMean
+  );
+  AT_Send();
+  return true;
+}
+#endif /* PROFILER */
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CINTV"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  09.12.2019
+ ******************************************************************************/
+bool ATCmd_IntvTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CINTV: 10-3600\r\n");
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wakeup-Timer Zhlerwert zurcksetzn
+ * 
+ * @param[in] *pszBuf   Eingabewerte
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  09.12.2019
+ ******************************************************************************/
+bool ATCmd_IntvWrite(const char* pszBuf)
+{
+  short iInterval = atoi(pszBuf);
+  if ((iInterval >= 10) && (iInterval <= 3600))
+  {
+    PowerGov_SetInterval((unsigned short)iInterval);
+    sprintf(AT_TXBUF, "+CINTV: %d\r\n", PowerGov_GetInterval());
+    printf("WakeupTimer Reset: %d\r\n", PowerGov_GetInterval());
+    AT_Send();
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wertetabelle fr GUI lesen: alle Eintrge der genutzten Tiefe
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  07.12.2019
+ * @date  08.12.2019  UART-Modul Funktionsaufrufe ausgelagert
+ * @date  19.10.2026  Genutzte Tiefe des Ringspeichers
+ ******************************************************************************/
+bool ATCmd_GuiRead(const char* pszBuf)
+{
+  unsigned uOffset;
+  
+  PROFILE_BEGIN(Profiler_Zone_GUI);
+  for (uOffset = 0; uOffset < SensorLog_GetConfig()->ucDepth; ++uOffset)
+  {
+    AT_SendGuiItem(SensorLog_Dump(uOffset));
+  }
+  PROFILE_END(Profiler_Zone_GUI);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nur die Eintrge der Wertetabelle lesen, die neuer als eine Folgenummer
+ * sind, danach die Folgenummer des neuesten Eintrags
+ *
+ * @param[in] *pszBuf   Zuletzt gelesene Folgenummer, 0: alle
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_GuiWrite(const char* pszBuf)
+{
+  SensorLogItem* pLog;
+  uint32_t ulSeq;
+  
+  if (CountArgs(pszBuf) != 1)
+  {
+    return false;
+  }
+  
+  ulSeq = strtoul(pszBuf, 0, 10);
+  PROFILE_BEGIN(Profiler_Zone_GUI);
+  while ((pLog = SensorLog_GetNext(&ulSeq)) != 0)
+  {
+    AT_SendGuiItem(pLog);
+  }
+  PROFILE_END(Profiler_Zone_GUI);
+  
+  sprintf(AT_TXBUF, "+CGUI: %lu\r\n", SensorLog_GetSeq());
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Wakeup-Task auslsen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  23.12.2019
+ ******************************************************************************/
+bool ATCmd_ForceWkup(const char* pszBuf)
+{
+  Sched_Post(Sched_Event_WAKEUP);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messwerte-Protokoll lschen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.12.2019
+ ******************************************************************************/ 
+bool ATCmd_LogClear(const char* pszBuf)
+{
+  SensorLog_Clear();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CLOGFMT"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogFmtTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CLOGFMT: (0-%d)\r\n", Logger_Format_NUM - 1);
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Format und Datei des Protokolls lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogFmtRead(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CLOGFMT: %d,%s\r\n",
+    (int)Logger_GetFormat(),
+    Logger_GetFileName()
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Format des Protokolls einstellen
+ *
+ * @param[in] *pszBuf   0: CSV (.TXT), 1: binr (.BIN), 2: gepackt (.PAK)
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Gepacktes Format
+ ******************************************************************************/
+bool ATCmd_LogFmtWrite(const char* pszBuf)
+{
+  if ((*pszBuf < '0') || (*pszBuf >= '0' + Logger_Format_NUM))
+  {
+    return false;
+  }
+  
+  Logger_SetFormat((Logger_Format)(*pszBuf - '0'));
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CLOGBUF"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogBufTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CLOGBUF: (0-65535),(1-%u),(0-65535)\r\n",
+    (unsigned)LOGGER_SECTOR_SIZE);
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Grenzen, Belegung und Zhler des Schreibpuffers lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Zhler der Wiederherstellung
+ * @date  19.10.2026  Direkt geschriebene Eintrge
+ ******************************************************************************/
+bool ATCmd_LogBufRead(const char* pszBuf)
+{
+  const Logger_Config* pCfg = Logger_GetConfig();
+  const Logger_Stats* pStats = Logger_GetStats();
+  
+  sprintf(AT_TXBUF, "+CLOGBUF: %u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%lu,%u,%u\r\n",
+    pCfg->uiMaxAge,
+    pCfg->uiMaxFill,
+    pCfg->uiSyncAge,
+    pStats->uiFill,
+    pStats->uiPending,
+    pStats->uiSectors,
+    pStats->uiPartial,
+    pStats->uiLost,
+    pStats->uiSyncs,
+    pStats->uiOpens,
+    pStats->ulRecovered,
+    pStats->uiTruncated,
+    pStats->uiDirect
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Grenzen fr ungeschriebene und ungesicherte Daten einstellen. Ohne
+ * dritten Wert bleibt das Alter fr f_sync unverndert.
+ *
+ * @param[in] *pszBuf   Hchstes Alter in s, Hchstmenge in Byte[, Alter
+ *                      fr f_sync in s]
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogBufWrite(const char* pszBuf)
+{
+  long lMaxAge;
+  long lMaxFill;
+  long lSyncAge = Logger_GetConfig()->uiSyncAge;
+  int iArgs = CountArgs(pszBuf);
+  
+  if ((iArgs != 2) && (iArgs != 3))
+  {
+    return false;
+  }
+  
+  lMaxAge = atol(pszBuf);
+  while (*(pszBuf++) != ',');
+  lMaxFill = atol(pszBuf);
+  if (iArgs == 3)
+  {
+    while (*(pszBuf++) != ',');
+    lSyncAge = atol(pszBuf);
+  }
+  
+  if ((lMaxAge < 0) || (lMaxAge > 65535) ||
+      (lMaxFill < 1) || (lMaxFill > LOGGER_SECTOR_SIZE) ||
+      (lSyncAge < 0) || (lSyncAge > 65535))
+  {
+    return false;
+  }
+  
+  Logger_SetPolicy((uint16_t)lMaxAge, (uint16_t)lMaxFill, (uint16_t)lSyncAge);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Schreibpuffer sofort auf die SD-Karte schreiben
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true, wenn erfolgreich geschrieben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogBufFlush(const char* pszBuf)
+{
+  return Logger_Flush();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CLOGPRE"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogPreTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CLOGPRE: (0-%u)\r\n", (unsigned)LOGGER_PREALLOC_MAX);
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Vorbelegung und freien Platz der aktuellen Binrdatei lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogPreRead(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CLOGPRE: %u,%u\r\n",
+    Logger_GetConfig()->uiPrealloc,
+    Logger_GetStats()->uiContigFree / (1024 / LOGGER_SECTOR_SIZE)
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Vorbelegung neuer Binrdateien einstellen
+ *
+ * @param[in] *pszBuf   Gre in KByte, 0: aus
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogPreWrite(const char* pszBuf)
+{
+  long lSize;
+  
+  if (CountArgs(pszBuf) != 1)
+  {
+    return false;
+  }
+  
+  lSize = atol(pszBuf);
+  if ((lSize < 0) || (lSize > LOGGER_PREALLOC_MAX))
+  {
+    return false;
+  }
+  
+  Logger_SetPrealloc((uint16_t)lSize);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CLOGGET"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogGetTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CLOGGET: <from>,<to>\r\n");
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrge eines Zeitbereichs ausgeben. Je Tagesdatei mit Eintrgen im
+ * Bereich folgt auf "+CLOGGET: <file>,<len>" der Dateikopf und die
+ * Eintrge unverndert, zusammen <len> Byte. Die Ausgabe luft ber
+ * AT_ResumeLog() in mehreren Durchlufen des Schedulers.
+ *
+ * @param[in] *pszBuf   Beginn und Ende als Unix-Zeit in s
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_LogGetWrite(const char* pszBuf)
+{
+  uint32_t ulFrom;
+  uint32_t ulTo;
+  
+  if (CountArgs(pszBuf) != 2)
+  {
+    return false;
   }
-  else if (*pszBuf == '1')
+  
+  ulFrom = strtoul(pszBuf, 0, 10);
+  while (*(pszBuf++) != ',');
+  ulTo = strtoul(pszBuf, 0, 10);
+  
+  if ((ulTo < ulFrom) || (ulFrom < LOGGER_EPOCH_2000)
+    || (Logger_GetDay(ulTo) - Logger_GetDay(ulFrom) >= LOGGER_QUERY_DAYS))
   {
-    /* Datei leeren                                       */
-    if (f_open(&fp, "LOG.TXT", FA_WRITE | FA_CREATE_ALWAYS) == FR_OK)
+    return false;
+  }
+  
+  Logger_Flush();
+  ulAtFrom = ulFrom;
+  ulAtTo = ulTo;
+  uiAtDay = Logger_GetDay(ulFrom);
+  uiAtLast = Logger_GetDay(ulTo);
+  ulAtLeft = 0;
+  bAtRange = false;
+  ATCmd_SetResume(AT_ResumeLog);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CROLLUP"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_RollupTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CROLLUP: (0-%d),(1-%u)\r\n", Rollup_Level_NUM - 1,
+    Rollup_GetSlots(Rollup_Level_HOUR));
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhler der Verdichtung und ausstehende Zeitrume je Stufe lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_RollupRead(const char* pszBuf)
+{
+  const Rollup_Stats* pStats = Rollup_GetStats();
+  
+  sprintf(AT_TXBUF, "+CROLLUP: %u,%u,%u,%u,%u,%u\r\n",
+    pStats->uiSamples,
+    pStats->uiWrites,
+    pStats->uiLost,
+    (unsigned)pStats->ucRestored,
+    (unsigned)Rollup_GetPending(Rollup_Level_HOUR),
+    (unsigned)Rollup_GetPending(Rollup_Level_DAY)
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Verdichtete Werte der letzten Zeitrume einer Stufe ausgeben, ltester
+ * zuerst, der laufende Zeitraum zuletzt. Je Zeitraum mit Werten folgt eine
+ * Zeile "+CROLLUP: <time>,<count>", danach Minimum, Maximum und Mittelwert
+ * je Feld und die letzte Position mit Zustandsbits.
+ *
+ * @param[in] *pszBuf   Stufe und Anzahl der Zeitrume
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_RollupWrite(const char* pszBuf)
+{
+  SensorLogItem sNow;
+  Rollup_Entry sEntry;
+  Rollup_Level eLevel;
+  uint32_t ulStep;
+  uint32_t ulTime;
+  long lCount;
+  uint8_t ucField;
+  
+  if ((CountArgs(pszBuf) != 2) || (*pszBuf < '0')
+    || (*pszBuf >= '0' + Rollup_Level_NUM))
+  {
+    return false;
+  }
+  
+  eLevel = (Rollup_Level)(*pszBuf - '0');
+  while (*(pszBuf++) != ',');
+  lCount = strtol(pszBuf, 0, 10);
+  if ((lCount < 1) || (lCount > Rollup_GetSlots(eLevel)))
+  {
+    return false;
+  }
+  
+  /* Laufender Zeitraum, vor dem ersten Eintrag nach dem
+     Start aus der Echtzeituhr                            */
+  ulStep = Rollup_GetStep(eLevel);
+  ulTime = Rollup_GetCurrent(eLevel);
+  if (ulTime == 0)
+  {
+    RTC_GetDate(RTC_Format_BIN, &sNow.sTimestamp.sDate);
+    RTC_GetTime(RTC_Format_BIN, &sNow.sTimestamp.sTime);
+    ulTime = Logger_GetTime(&sNow);
+    ulTime -= ulTime % ulStep;
+  }
+  
+  Rollup_Flush();
+  for (ulTime -= (uint32_t)(lCount - 1) * ulStep; lCount > 0; --lCount)
+  {
+    if (Rollup_Get(eLevel, ulTime, &sEntry))
     {
-      f_close(&fp);
+      sprintf(AT_TXBUF, "+CROLLUP: %lu,%u", sEntry.ulTime, sEntry.uiCount);
+      AT_Send();
+      for (ucField = 0; ucField < Rollup_Field_NUM; ++ucField)
+      {
+        sprintf(AT_TXBUF, ",%d,%d,%d",
+          sEntry.asValue[ucField].iMin,
+          sEntry.asValue[ucField].iMax,
+          sEntry.asValue[ucField].iMean
+        );
+        AT_Send();
+      }
+      sprintf(AT_TXBUF, ",%ld,%ld,%d,%u\r\n",
+        sEntry.lLat,
+        sEntry.lLong,
+        sEntry.iAlt,
+        (unsigned)sEntry.ucStatus
+      );
+      AT_Send();
+    }
+    ulTime += ulStep;
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abgeschlossene Zeitrume sofort auf die SD-Karte schreiben
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true, wenn keine Zeitrume mehr ausstehen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_RollupFlush(const char* pszBuf)
+{
+  return Rollup_Flush();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CSLOG"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_SLogTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CSLOG: (1-%u),(0,1)\r\n", NUM_SENSORLOG_RINGITEMS);
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Einstellungen und Zustand des Ringspeichers lesen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_SLogRead(const char* pszBuf)
+{
+  const SensorLogConfig* pCfg = SensorLog_GetConfig();
+  
+  sprintf(AT_TXBUF, "+CSLOG: %u,%u,%lu,%u,%u\r\n",
+    (unsigned)pCfg->ucDepth,
+    (unsigned)pCfg->bMirror,
+    SensorLog_GetSeq(),
+    (unsigned)SensorLog_GetRestored(),
+    (unsigned)SensorLog_GetMirrorSlots()
+  );
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Genutzte Tiefe des Ringspeichers und Spiegel im EEPROM einstellen
+ *
+ * @param[in] *pszBuf   Tiefe (Zweierpotenz), optional Spiegel 0/1
+ * @return    bool      true, wenn Eingabe gltig
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool ATCmd_SLogWrite(const char* pszBuf)
+{
+  int iDepth;
+  int iMirror = SensorLog_GetConfig()->bMirror;
+  int iArgs = CountArgs(pszBuf);
+  
+  if ((iArgs != 1) && (iArgs != 2))
+  {
+    return false;
+  }
+  
+  iDepth = atoi(pszBuf);
+  if (iArgs == 2)
+  {
+    while (*(pszBuf++) != ',');
+    iMirror = atoi(pszBuf);
+  }
+  
+  if ((iDepth < 1) || (iDepth > NUM_SENSORLOG_RINGITEMS) ||
+      (iMirror < 0) || (iMirror > 1))
+  {
+    return false;
+  }
+  
+  return SensorLog_SetConfig((uint8_t)iDepth, (iMirror != 0));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CDEBUG"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  30.12.2019
+ ******************************************************************************/
+bool ATCmd_DebugTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CDEBUG: 0-1\r\n");
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Aktivierungsstatus der Debug-Umleitung anzeigen
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  30.12.2019
+ ******************************************************************************/
+bool ATCmd_DebugRead(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CDEBUG: %d\r\n", (int)(eDataModeSrc == ATCmd_DataModeSrc_Debug));
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Umleitung der Debug-Ausgabe an die Bluetooth-Verbindung 
+ *
+ * @param[in] *pszBuf   Aktivierungszustand '0' oder '1'
+ * @return    bool      true, wenn Umleitung erfolgreich
+ *
+ * @date  30.12.2019
+ ******************************************************************************/
+bool ATCmd_DebugWrite(const char* pszBuf)
+{
+  if (*pszBuf == '0')
+  {
+    if (eDataModeSrc == ATCmd_DataModeSrc_Debug)
+    {
+      eDataModeSrc = ATCmd_DataModeSrc_None;
+      bDataMode = false;
+      sprintf(AT_TXBUF, "+CDEBUG: 0\r\n");
+      AT_Send();
       return true;
     }
     else
     {
-      sprintf(AT_TXBUF, "+CFILE: fopen\r\n");
+      sprintf(AT_TXBUF, "+CDEBUG: not act\r\n");
+      AT_Send();
       return false;
     }
   }
-  else if (*pszBuf == '2')
+  else if (*pszBuf == '1')
   {
-    /* Datei umbenennen                                   */
-    char cHelp[28] = "";
-    int iRes;
-    int iNum;
-    FILINFO fno;
-    
-    iRes = f_opendir(&dp, "/");
-    if (iRes == FR_OK)
+    if (eDataModeSrc == ATCmd_DataModeSrc_None)
     {
-      iNum = 0;
-      do
-      {
-        iRes = f_readdir(&dp, &fno);
-        if ((iRes == FR_OK) && ((fno.fattrib & AM_DIR) != 0))
-        {
-          ++iNum;
-        }
-      } while ((iRes == FR_OK) && (fno.fname[0] != '\0'));
-      f_closedir(&dp);
+      sprintf(AT_TXBUF, "+CDEBUG: 1\r\n");
+      AT_Send();
+      eDataModeSrc = ATCmd_DataModeSrc_Debug;
+      bDataMode = true;
+      return true;
     }
     else
     {
-      sprintf(AT_TXBUF, "+CFILE: fopendir %d\r\n", iRes);
+      sprintf(AT_TXBUF, "+CDEBUG: busy\r\n");
       AT_Send();
       return false;
     }
-    
-    sprintf(cHelp, "LOG_%04d.TXT", iNum);    
-    iRes = f_rename("LOG.TXT", cHelp);
-    if (iRes == FR_OK)
+  }
+  else
+  {
+    return false;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Test-Befehl fr "AT+CFILE"
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true
+ *
+ * @date  30.12.2019
+ ******************************************************************************/
+bool ATCmd_FileTest(const char* pszBuf)
+{
+  sprintf(AT_TXBUF, "+CFILE: 0-1\r\n");
+  AT_Send();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Inhalt der Logdatei auslesen und ber Bluetooth ausgeben. Der Inhalt
+ * folgt in Abschnitten ber AT_ResumeFile(), die Quittung danach.
+ *
+ * @param[in] *pszBuf   Nicht genutzt
+ * @return    bool      true, wenn die Datei geffnet wurde
+ *
+ * @date  30.12.2019
+ * @date  19.10.2026  Datei des eingestellten Formats, Lnge statt Endzeichen
+ * @date  19.10.2026  Schreibpuffer vorher schreiben
+ * @date  19.10.2026  Ausgabe ber mehrere Durchlufe des Schedulers
+ ******************************************************************************/
+bool ATCmd_FileRead(const char* pszBuf)
+{
+  Logger_Flush();
+  if (f_open(&sAtFile, Logger_GetFileName(), FA_READ | FA_OPEN_EXISTING) == FR_OK)
+  {
+    ulAtLeft = f_size(&sAtFile);
+    sprintf(AT_TXBUF, "+CFILE: %ld\r\n", (long)ulAtLeft);
+    AT_Send();
+    ATCmd_SetResume(AT_ResumeFile);
+    return true;
+  }
+  else
+  {
+    sprintf(AT_TXBUF, "+CFILE: fopen\r\n");
+    AT_Send();
+    return false;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Logdatei leeren. Das frhere Umbenennen (2) entfllt: Die Tagesdateien
+ * sind nach dem Datum benannt, eine umbenannte Datei fiele aus dem
+ * Stundenindex und aus "AT+CLOGGET" heraus.
+ *
+ * @param[in] *pszBuf   Befehlsargument
+ * @return    bool      true, wenn Befehl erfolgreich ausgefhrt
+ *
+ * @date  30.12.2019
+ * @date  19.10.2026  Datei des eingestellten Formats
+ * @date  19.10.2026  Schreibpuffer schreiben bzw. verwerfen
+ * @date  19.10.2026  Protokolldatei vorher schlieen
+ * @date  19.10.2026  Umbenennen entfernt
+ ******************************************************************************/
+bool ATCmd_FileWrite(const char* pszBuf)
+{
+  FIL fp;
+  
+  if (*pszBuf == '0')
+  {
+    return true;
+  }
+  else if (*pszBuf == '1')
+  {
+    /* Datei leeren                                       */
+    Logger_Close();
+    if (f_open(&fp, Logger_GetFileName(), FA_WRITE | FA_CREATE_ALWAYS) == FR_OK)
     {
+      f_close(&fp);
+      Logger_Discard();
       return true;
     }
     else
     {
-      sprintf(AT_TXBUF, "+CFILE: frename %d (%s)\r\n", iRes, cHelp);
-      AT_Send();
+      sprintf(AT_TXBUF, "+CFILE: fopen\r\n");
       return false;
     }
   }
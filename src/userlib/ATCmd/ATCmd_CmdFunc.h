@@ -35,14 +35,70 @@ bool ATCmd_GnsTstWrite(const char* pszBuf);
 
 bool ATCmd_PwrRead(const char* pszBuf);
 
+bool ATCmd_EnergyTest(const char* pszBuf);
+bool ATCmd_EnergyRead(const char* pszBuf);
+bool ATCmd_EnergyWrite(const char* pszBuf);
+bool ATCmd_EnergyClear(const char* pszBuf);
+
+bool ATCmd_LpmRead(const char* pszBuf);
+bool ATCmd_LpmClear(const char* pszBuf);
+bool ATCmd_SchedRead(const char* pszBuf);
+bool ATCmd_SchedClear(const char* pszBuf);
+bool ATCmd_IsrTest(const char* pszBuf);
+bool ATCmd_IsrRead(const char* pszBuf);
+bool ATCmd_IsrWrite(const char* pszBuf);
+bool ATCmd_IsrClear(const char* pszBuf);
+bool ATCmd_RamRead(const char* pszBuf);
+bool ATCmd_WdgRead(const char* pszBuf);
+bool ATCmd_WdgClear(const char* pszBuf);
+bool ATCmd_I2cRead(const char* pszBuf);
+bool ATCmd_I2cClear(const char* pszBuf);
+bool ATCmd_TraceTest(const char* pszBuf);
+bool ATCmd_TraceRead(const char* pszBuf);
+bool ATCmd_TraceWrite(const char* pszBuf);
+bool ATCmd_TraceFlush(const char* pszBuf);
+#ifdef I2C_FAULTS
+bool ATCmd_I2cTest(const char* pszBuf);
+bool ATCmd_I2cWrite(const char* pszBuf);
+#endif /* I2C_FAULTS */
+#ifdef PROFILER
+bool ATCmd_ProfTest(const char* pszBuf);
+bool ATCmd_ProfRead(const char* pszBuf);
+bool ATCmd_ProfWrite(const char* pszBuf);
+bool ATCmd_ProfClear(const char* pszBuf);
+bool ATCmd_BenchTest(const char* pszBuf);
+bool ATCmd_BenchRead(const char* pszBuf);
+bool ATCmd_BenchWrite(const char* pszBuf);
+#endif /* PROFILER */
+
 bool ATCmd_IntvTest(const char* pszBuf);
 bool ATCmd_IntvWrite(const char* pszBuf);
 
 bool ATCmd_GuiRead(const char* pszBuf);
+bool ATCmd_GuiWrite(const char* pszBuf);
 
 bool ATCmd_ForceWkup(const char* pszBuf);
 
 bool ATCmd_LogClear(const char* pszBuf);
+bool ATCmd_LogFmtTest(const char* pszBuf);
+bool ATCmd_LogFmtRead(const char* pszBuf);
+bool ATCmd_LogFmtWrite(const char* pszBuf);
+bool ATCmd_LogBufTest(const char* pszBuf);
+bool ATCmd_LogBufRead(const char* pszBuf);
+bool ATCmd_LogBufWrite(const char* pszBuf);
+bool ATCmd_LogBufFlush(const char* pszBuf);
+bool ATCmd_LogPreTest(const char* pszBuf);
+bool ATCmd_LogPreRead(const char* pszBuf);
+bool ATCmd_LogPreWrite(const char* pszBuf);
+bool ATCmd_LogGetTest(const char* pszBuf);
+bool ATCmd_LogGetWrite(const char* pszBuf);
+bool ATCmd_RollupTest(const char* pszBuf);
+bool ATCmd_RollupRead(const char* pszBuf);
+bool ATCmd_RollupWrite(const char* pszBuf);
+bool ATCmd_RollupFlush(const char* pszBuf);
+bool ATCmd_SLogTest(const char* pszBuf);
+bool ATCmd_SLogRead(const char* pszBuf);
+bool ATCmd_SLogWrite(const char* pszBuf);
 
 bool ATCmd_DebugTest(const char* pszBuf);
 bool ATCmd_DebugRead(const char* pszBuf);
@@ -3,6 +3,7 @@
 #include "commlib.h"
 #include "io_map.h"
 #include "BlinkSequencer.h"
+#include "powerlib.h"
 
 
 /*- Symbolische Konstanten ---------------------------------------------------*/
@@ -24,6 +25,9 @@ typedef enum tag_BTHandler_State
 /*- Modulglobale Variablen ---------------------------------------------------*/
 BTHandler_State eState;
 uint8_t ucAdTimer;
+uint8_t ucAdTime = USERLIB_BTHANDLER_ADTIME;
+uint8_t ucWakeDiv = 1;
+uint8_t ucWakeCnt;
 
 
 void BTHandler_Init(void)
@@ -39,6 +43,7 @@ void BTHandler_Init(void)
   Blink_SetPattern(Blink_Led_BT, USERLIB_BTHANDLER_LED_ADV);
   ucAdTimer = USERLIB_BTHANDLER_ADTIME;
   eState = BTHandler_State_ADVERTISE;
+  LowPower_SetLock(LowPower_Lock_BT, true);
 }
 
 void BTHandler_Poll(void)
@@ -63,7 +68,7 @@ void BTHandler_Poll(void)
       /* Verbindung abgebrochen                           */
       printf("BTHandler DISC\r\n");
       Blink_SetPattern(Blink_Led_BT, USERLIB_BTHANDLER_LED_ADV);
-      ucAdTimer = USERLIB_BTHANDLER_ADTIME;
+      ucAdTimer = ucAdTime;
       eState = BTHandler_State_ADVERTISE;
     }
   }
@@ -84,6 +89,7 @@ void BTHandler_Task1s(void)
       printf("BTHandler OFF\r\n");
       GPIO_WriteBit(BT_PWREN_PORT, BT_PWREN_PIN, DISABLE);
       eState = BTHandler_State_OFF;
+      LowPower_SetLock(LowPower_Lock_BT, false);
       Blink_SetPattern(Blink_Led_BT, USERLIB_BTHANDLER_LED_OFF);
     }
   }
@@ -96,12 +102,33 @@ void BTHandler_TakeWakeup(void)
     /* Advertising fr einige Sekunden einschalten        */
     printf("BTHandler ON\r\n");
     GPIO_WriteBit(BT_PWREN_PORT, BT_PWREN_PIN, ENABLE);
-    ucAdTimer = USERLIB_BTHANDLER_ADTIME;
+    LowPower_SetLock(LowPower_Lock_BT, true);
+    ucAdTimer = ucAdTime;
     eState = BTHandler_State_ADVERTISE;   
     Blink_SetPattern(Blink_Led_BT, USERLIB_BTHANDLER_LED_ADV);
   }
 }
 
+void BTHandler_TaskWakeup(void)
+{
+  /* Advertising nur bei jedem n-ten Wakeup               */
+  if (ucWakeDiv > 0)
+  {
+    if (++ucWakeCnt >= ucWakeDiv)
+    {
+      ucWakeCnt = 0;
+      BTHandler_TakeWakeup();
+    }
+  }
+}
+
+void BTHandler_SetPolicy(uint8_t ucAdSeconds, uint8_t ucDiv)
+{
+  ucAdTime = ucAdSeconds;
+  ucWakeDiv = ucDiv;
+  ucWakeCnt = 0;
+}
+
 bool BTHandler_IsActive(void)
 {
   return (eState == BTHandler_State_CONNECTED);
@@ -2,11 +2,14 @@
 #define USERLIB_BTHANDLER_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
 void BTHandler_Init(void);
 void BTHandler_Poll(void);
 void BTHandler_Task1s(void);
 void BTHandler_TakeWakeup(void);
+void BTHandler_TaskWakeup(void);
+void BTHandler_SetPolicy(uint8_t ucAdSeconds, uint8_t ucDiv);
 bool BTHandler_IsActive(void);
 
 #endif /* USERLIB_BTHANDLER_H_ */
\ No newline at end of file
@@ -0,0 +1,346 @@
+/*!****************************************************************************
+ * @file
+ * Benchmark.c
+ *
+ * Jeder Durchlauf wird einzeln mit dem s-Zhler des Profilers gemessen und
+ * in CPU-Takte umgerechnet (Auflsung 16 Takte). Interrupts bleiben
+ * freigegeben, daher ist das Minimum der aussagekrftige Wert; der Fall NOP
+ * liefert den Aufwand der Messung, der von allen Fllen abzuziehen ist.
+ *
+ * Die Sensorroutinen rechnen auf einer Kopie der zuletzt gelesenen
+ * Rohdaten, Sonnenstand und NMEA-Parser auf festen Werten. Die GPS-Daten
+ * werden nach der Messung wiederhergestellt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+#include "stm8l15x.h"
+#include "app_sensors.h"
+#include "sensorlib_bme280_internal.h"
+#include "sensorlib_qmc5883_internal.h"
+#include "sensorlib_wind_internal.h"
+#include "SolarTracking_Internal.h"
+#include "SensorLog.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include "Benchmark.h"
+
+#ifdef PROFILER
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Grter Abschnitt der Protokollzeile in Zeichen                           */
+#define BENCHMARK_CSV_BUF       48
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Namen der Messflle fr die Ausgabe                                       */
+static const char* const apszBenchNames[Benchmark_Case_NUM] = {
+  "NOP", "BMECALC", "AZIM", "WIND", "SUNPOS", "NMEA", "CSV", "CSVFAST", "BIN",
+  "PACK"
+};
+
+/*! Kopien der Sensordaten, die Berechnung verndert die Rohdaten             */
+static BME280_Sensor sBenchBME280;
+static QMC5883_Sensor sBenchQMC5883;
+static Wind_Sensor sBenchWind;
+
+/*! Vorgnger fr den gepackten Eintrag                                       */
+static Logger_Record sBenchPrev;
+
+/*! Fester Sentence, Hamburg am 21.12.2019 12:00 UTC                          */
+static const char szBenchNmea[] =
+  "$GPRMC,120000.00,A,5333.00000,N,01000.00000,E,0.012,,211219,,,A*7F";
+
+/*! Ergebnisse gegen Wegoptimieren sichern                                    */
+static volatile uint32_t ulBenchSink;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Kompensation BME280: Temperatur, Luftdruck und Feuchte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunBmeCalc(void)
+{
+  ulBenchSink = BME280_CalcTemp(&sBenchBME280);
+  ulBenchSink = BME280_CalcPress(&sBenchBME280);
+  ulBenchSink = BME280_CalcHum(&sBenchBME280);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Azimut aus dem Magnetfeld
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunAzim(void)
+{
+  ulBenchSink = QMC5883_CalcAzimuth(&sBenchQMC5883);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Mittlere Windgeschwindigkeit
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunWind(void)
+{
+  ulBenchSink = Wind_CalcAvgVelocity(&sBenchWind);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sonnenstand, Hamburg am 21.12.2019 12:00 UTC
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunSunPos(void)
+{
+  double dAzimuth;
+  double dZenith;
+  
+  calculate_current_sun_position(2019, 12, 21, 12.0, 0, 53.55, 10.0,
+    &dAzimuth, &dZenith);
+  ulBenchSink = (uint32_t)(dAzimuth * 10) + (uint32_t)(dZenith * 10);
+}
+
+/*!****************************************************************************
+ * @brief
+ * NMEA-Parser mit einem GPRMC-Sentence
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunNmea(void)
+{
+  GPSHandler_ParseSentence((char*)szBenchNmea, sizeof(szBenchNmea) - 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Protokollzeile des jngsten Ringspeichereintrags abschnittsweise mit
+ * sprintf() formatieren wie frher in SaveSensors(), ohne Zugriff auf die
+ * SD-Karte. Bezug fr CSVFAST.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunCsv(void)
+{
+  char acBuf[BENCHMARK_CSV_BUF];
+  SensorLogItem* pLog = SensorLog_Dump(0);
+  
+  sprintf(acBuf, "%04d-%02d-%02dT%02d:%02d:%02dZ,",
+    (int)pLog->sTimestamp.sDate.RTC_Year + 2000,
+    (int)pLog->sTimestamp.sDate.RTC_Month,
+    (int)pLog->sTimestamp.sDate.RTC_Date,
+    (int)pLog->sTimestamp.sTime.RTC_Hours,
+    (int)pLog->sTimestamp.sTime.RTC_Minutes,
+    (int)pLog->sTimestamp.sTime.RTC_Seconds
+  );
+  sprintf(acBuf, "%d,%d,%d,%d,",
+    pLog->sTemperature.iBME,
+    pLog->sTemperature.iCPU,
+    pLog->sTemperature.iQMC,
+    pLog->sTemperature.iMPU
+  );
+  sprintf(acBuf, "%ld,%ld,",
+    pLog->ulPressure,
+    pLog->ulHumidity
+  );
+  sprintf(acBuf, "%d,%d,%d,%d,",
+    pLog->sWind.uiDir,
+    pLog->sWind.uiVelo,
+    pLog->sAlignment.uiAzimuth,
+    pLog->sAlignment.iZenith
+  );
+  sprintf(acBuf, "%ld,%ld,%d,",
+    pLog->sPosition.lLat,
+    pLog->sPosition.lLong,
+    pLog->sPosition.iAlt
+  );
+  sprintf(acBuf, "%d,%d,%d,%d,",
+    pLog->sPower.uiBatVolt,
+    pLog->sPower.uiPanelVolt,
+    pLog->sPower.iBatCurr,
+    pLog->sPower.iPanelCurr
+  );
+  sprintf(acBuf, "%d,%u,%u,%lu\r\n",
+    (int)pLog->sEnergy.ucSoC,
+    pLog->sEnergy.uiBatIn,
+    pLog->sEnergy.uiBatOut,
+    pLog->sEnergy.ulPvEnergy
+  );
+  ulBenchSink = acBuf[0];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Protokollzeile des jngsten Ringspeichereintrags mit Logger_FormatCsv()
+ * in einem Stck formatieren, ohne Zugriff auf die SD-Karte, im Zeilenpuffer
+ * wie in SaveSensors()
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Zeilenpuffer acLoggerLine statt Stack
+ ******************************************************************************/
+static void Benchmark_RunCsvFast(void)
+{
+  ulBenchSink = Logger_FormatCsv(SensorLog_Dump(0), acLoggerLine);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz des jngsten Ringspeichereintrags zusammenstellen und wie in
+ * der Datei ablegen, ohne Zugriff auf die SD-Karte
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Mit Logger_EncodeRecord()
+ ******************************************************************************/
+static void Benchmark_RunBin(void)
+{
+  Logger_Record sRec;
+  uint8_t aucRec[sizeof(Logger_Record)];
+  
+  Logger_BuildRecord(SensorLog_Dump(0), &sRec);
+  Logger_EncodeRecord(&sRec, aucRec);
+  ulBenchSink = sRec.uiCrc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz des jngsten Ringspeichereintrags zusammenstellen und die
+ * Differenzen zum vorherigen Eintrag bilden, wie beim gepackten Protokoll
+ * ohne Zugriff auf EEPROM und SD-Karte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunPack(void)
+{
+  Logger_Record sRec;
+  uint32_t ulMask;
+  
+  Logger_BuildRecord(SensorLog_Dump(0), &sRec);
+  ulBenchSink = Logger_GetPackSize(&sRec, &sBenchPrev,
+    (int32_t)(sRec.ulTime - sBenchPrev.ulTime), &ulMask);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Einen Durchlauf eines Messfalls ausfhren
+ *
+ * @param[in] eCase     Messfall
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Benchmark_RunCase(Benchmark_Case eCase)
+{
+  switch (eCase)
+  {
+    case Benchmark_Case_BMECALC:
+      Benchmark_RunBmeCalc();
+      break;
+    
+    case Benchmark_Case_AZIM:
+      Benchmark_RunAzim();
+      break;
+    
+    case Benchmark_Case_WIND:
+      Benchmark_RunWind();
+      break;
+    
+    case Benchmark_Case_SUNPOS:
+      Benchmark_RunSunPos();
+      break;
+    
+    case Benchmark_Case_NMEA:
+      Benchmark_RunNmea();
+      break;
+    
+    case Benchmark_Case_CSV:
+      Benchmark_RunCsv();
+      break;
+    
+    case Benchmark_Case_CSVFAST:
+      Benchmark_RunCsvFast();
+      break;
+    
+    case Benchmark_Case_BIN:
+      Benchmark_RunBin();
+      break;
+    
+    case Benchmark_Case_PACK:
+      Benchmark_RunPack();
+      break;
+    
+    default:
+      ;
+  }
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Namen eines Messfalls abfragen
+ *
+ * @param[in] eCase     Messfall
+ * @return    const char*   Name
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const char* Benchmark_GetName(Benchmark_Case eCase)
+{
+  return apszBenchNames[eCase];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messfall wiederholt ausfhren. Bricht nach BENCHMARK_MAX_TIME ab, damit
+ * der aufrufende Task den Watchdog nicht auslst.
+ *
+ * @param[in] eCase     Messfall
+ * @param[in] uiRuns    Gewnschte Durchlufe, 1 ... BENCHMARK_MAX_RUNS
+ * @param[out] *pResult Ergebnis
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Benchmark_Run(Benchmark_Case eCase, uint16_t uiRuns, Benchmark_Result* pResult)
+{
+  GPSHandler_Data sSavedGPS;
+  uint32_t ulStart;
+  uint32_t ulTime;
+  uint32_t ulSum = 0;
+  
+  /* Eingangsdaten einfrieren                             */
+  sBenchBME280 = sSensorBME280;
+  sBenchQMC5883 = sSensorQMC5883;
+  sBenchWind = sSensorWind;
+  sSavedGPS = sSensorGPS;
+  Logger_BuildRecord(SensorLog_Dump(1), &sBenchPrev);
+  
+  pResult->uiRuns = 0;
+  pResult->ulMin = 0xFFFFFFFF;
+  while ((pResult->uiRuns < uiRuns) && (ulSum < BENCHMARK_MAX_TIME))
+  {
+    ulStart = Profiler_GetTime();
+    Benchmark_RunCase(eCase);
+    ulTime = Profiler_GetTime() - ulStart;
+    
+    ++pResult->uiRuns;
+    ulSum += ulTime;
+    if (ulTime < pResult->ulMin)
+    {
+      pResult->ulMin = ulTime;
+    }
+  }
+  
+  sSensorGPS = sSavedGPS;
+  
+  pResult->ulMin *= BENCHMARK_CYCLES_PER_US;
+  pResult->ulMean = (ulSum * BENCHMARK_CYCLES_PER_US) / pResult->uiRuns;
+}
+
+#endif /* PROFILER */
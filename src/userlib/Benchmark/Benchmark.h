@@ -0,0 +1,98 @@
+/*!****************************************************************************
+ * @file
+ * Benchmark.h
+ *
+ * Wiederholte Ausfhrung der Rechenroutinen mit festen Eingangsdaten auf
+ * der Zielhardware. Die Laufzeit wird in CPU-Takten ausgegeben und dient als
+ * Vergleichsbasis zwischen bestehender und optimierter Implementierung.
+ * Nur mit dem Compilerschalter PROFILER verfgbar.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! CPU-Takte je s des Profiler-Zeitgebers (16 MHz HSI, Teiler 1)            */
+#define BENCHMARK_CYCLES_PER_US 16
+
+/*! Hchstzahl der Durchlufe je Aufruf                                       */
+#define BENCHMARK_MAX_RUNS      1000
+
+/*! Zeitgrenze je Aufruf in s, deutlich unter der Watchdog-Zeit von 1,7 s    */
+#define BENCHMARK_MAX_TIME      1000000UL
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Messflle. Optimierte Varianten werden als eigener Fall direkt hinter der
+ * bestehenden Implementierung eingetragen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Benchmark_Case {
+  /*! Leerer Aufruf, Aufwand der Messung selbst           */
+  Benchmark_Case_NOP,
+  
+  /*! BME280_CalcTemp/Press/Hum                           */
+  Benchmark_Case_BMECALC,
+  
+  /*! QMC5883_CalcAzimuth                                 */
+  Benchmark_Case_AZIM,
+  
+  /*! Wind_CalcAvgVelocity                                */
+  Benchmark_Case_WIND,
+  
+  /*! calculate_current_sun_position                      */
+  Benchmark_Case_SUNPOS,
+  
+  /*! GPSHandler_ParseSentence mit GPRMC                  */
+  Benchmark_Case_NMEA,
+  
+  /*! Formatierung der Protokollzeile mit sprintf         */
+  Benchmark_Case_CSV,
+  
+  /*! Logger_FormatCsv, Protokollzeile ohne Formatstring  */
+  Benchmark_Case_CSVFAST,
+  
+  /*! Logger_BuildRecord, Binrsatz mit CRC               */
+  Benchmark_Case_BIN,
+  
+  /*! Logger_BuildRecord und Logger_GetPackSize           */
+  Benchmark_Case_PACK,
+  
+  Benchmark_Case_NUM
+} Benchmark_Case;
+
+/*!****************************************************************************
+ * @brief
+ * Ergebnis eines Messfalls
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Benchmark_Result {
+  /*! Ausgefhrte Durchlufe                              */
+  uint16_t uiRuns;
+  
+  /*! Krzester Durchlauf in CPU-Takten                   */
+  uint32_t ulMin;
+  
+  /*! Mittlerer Durchlauf in CPU-Takten                   */
+  uint32_t ulMean;
+} Benchmark_Result;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+#ifdef PROFILER
+const char* Benchmark_GetName(Benchmark_Case eCase);
+void Benchmark_Run(Benchmark_Case eCase, uint16_t uiRuns, Benchmark_Result* pResult);
+#endif /* PROFILER */
+
+#endif /* BENCHMARK_H_ */
@@ -1,5 +1,6 @@
 #include "stm8l15x.h"
 #include "io_map.h"
+#include "Timebase.h"
 #include "BlinkSequencer.h"
 
 /*- Typdefinitionen ----------------------------------------------------------*/
@@ -39,7 +40,29 @@ void Blink_Init(void)
 
 void Blink_SetPattern(Blink_Led eLed, uint16_t uiPattern)
 {
-  uiNextBlinkPattern[eLed] = uiPattern;
+  if (uiNextBlinkPattern[eLed] != uiPattern)
+  {
+    uiNextBlinkPattern[eLed] = uiPattern;
+    Timebase_Request(Timebase_Client_BLINK, 1);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * LED fr einen Tick einschalten, z.B. als Lebenszeichen ohne dauerhaft
+ * laufenden Timer. Nur wirksam, solange die LED kein Muster abspielt.
+ *
+ * @param[in] eLed      LED
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Blink_Flash(Blink_Led eLed)
+{
+  if ((uiBlinkPattern[eLed] == 0) && (uiNextBlinkPattern[eLed] == 0))
+  {
+    GPIO_WriteBit(asBlinkGPIO[eLed].pGpio, asBlinkGPIO[eLed].ucPin, SET);
+    Timebase_Request(Timebase_Client_BLINK, 1);
+  }
 }
 
 bool Blink_Ready(Blink_Led eLed)
@@ -50,6 +73,8 @@ bool Blink_Ready(Blink_Led eLed)
 void Blink_Poll(void)
 {
   uint8_t ucIndex;
+  bool bAnimate = false;
+  
   for (ucIndex = 0; ucIndex < Blink_MaxLed; ++ucIndex)
   {
     BitAction bBitState = (uiBlinkPattern[ucIndex] & (1 << ucPatternIndex)) == (1 << ucPatternIndex);
@@ -65,4 +90,25 @@ void Blink_Poll(void)
       uiBlinkPattern[ucIndex] = uiNextBlinkPattern[ucIndex];
     }
   }
+  
+  /* Tick nur weiterlaufen lassen, solange ein Muster    *
+   * wechselt oder noch nicht konstant ist                */
+  for (ucIndex = 0; ucIndex < Blink_MaxLed; ++ucIndex)
+  {
+    if ((uiBlinkPattern[ucIndex] != uiNextBlinkPattern[ucIndex]) ||
+      ((uiBlinkPattern[ucIndex] != 0x0000) && 
+      (uiBlinkPattern[ucIndex] != 0xFFFF)))
+    {
+      bAnimate = true;
+    }
+  }
+  
+  if (bAnimate)
+  {
+    Timebase_Request(Timebase_Client_BLINK, 1);
+  }
+  else
+  {
+    Timebase_Cancel(Timebase_Client_BLINK);
+  }
 }
\ No newline at end of file
@@ -20,6 +20,7 @@ typedef enum tag_Blink_Led
 void Blink_Init(void);
 void Blink_SetPattern(Blink_Led eLed, uint16_t uiPattern);
 bool Blink_Ready(Blink_Led eLed);
+void Blink_Flash(Blink_Led eLed);
 void Blink_Poll(void);
 
 #endif /* USERLIB_BLINKSEQUENCER_H_ */
\ No newline at end of file
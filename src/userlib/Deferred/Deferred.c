@@ -0,0 +1,248 @@
+/*!****************************************************************************
+ * @file
+ * Deferred.c
+ *
+ * Warteschlange von den Interrupts zum Hauptprogramm als Ringpuffer mit je
+ * einem Schreiber und Leser. Alle ISRs laufen auf derselben Priorittsstufe
+ * und unterbrechen sich nicht gegenseitig, sie bilden damit gemeinsam den
+ * einzigen Schreiber. Der Schreibindex wird nur in den ISRs, der Leseindex
+ * nur im Hauptprogramm verndert; beide sind einzelne Bytes und werden
+ * atomar gelesen und geschrieben, eine Interruptsperre ist nicht ntig.
+ *
+ * TIM1 luft frei mit 1 MHz als Zeitbasis fr die Laufzeitmessung. Im
+ * Active-Halt steht der Zhler, was innerhalb einer ISR keine Rolle spielt.
+ *
+ * Zum Vergleich der Laufzeiten lsst sich die Bearbeitung wie vor Einfhrung
+ * der Warteschlange direkt in der ISR ausfhren (Deferred_SetInline, AT+CISR=1).
+ * Beide Messungen stammen so aus demselben Firmwarestand.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Bearbeitung in der ISR zum Vergleich der Laufzeiten
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "Scheduler.h"
+#include "Deferred.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Indexmaske der Warteschlange                                              */
+#define DEFERRED_QUEUE_MASK     (DEFERRED_QUEUE_SIZE - 1)
+
+/*! Vorteiler TIM1 fr 1 s bei 16 MHz                                        */
+#define DEFERRED_TIM1_PSC       15
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Eintrge der Warteschlange                                                */
+static Deferred_Item asQueue[DEFERRED_QUEUE_SIZE];
+
+/*! Schreibindex, nur in den ISRs verndert                                   */
+static volatile uint8_t ucQueueHead;
+
+/*! Leseindex, nur im Hauptprogramm verndert                                 */
+static volatile uint8_t ucQueueTail;
+
+/*! Statistik                                                                 */
+static Deferred_Stats sDeferredStats;
+
+/*! Bearbeitung direkt in der ISR (nur zum Vergleich)                         */
+static bool bDeferredInline;
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Warteschlange leeren und TIM1 als freilaufenden s-Zhler starten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Deferred_Init(void)
+{
+  ucQueueHead = 0;
+  ucQueueTail = 0;
+  bDeferredInline = false;
+  Deferred_ClearStats();
+  
+  CLK_PeripheralClockConfig(CLK_Peripheral_TIM1, ENABLE);
+  TIM1_TimeBaseInit(DEFERRED_TIM1_PSC, TIM1_CounterMode_Up, 0xFFFF, 0);
+  TIM1_Cmd(ENABLE);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag fr die Bearbeitung im Hauptprogramm ablegen. Aufruf nur aus einer
+ * ISR, bei voller Warteschlange wird der Eintrag verworfen und gezhlt.
+ * Im Vergleichsbetrieb wird der Eintrag sofort in der ISR bearbeitet.
+ *
+ * @param[in] eType     Art des Eintrags
+ * @param[in] ucData    In der ISR erfasster Zustand
+ * @param[in] uiStamp   Zeitstempel bei Eintritt in die ISR (Deferred_GetUs)
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Bearbeitung in der ISR zum Vergleich
+ ******************************************************************************/
+void Deferred_Push(Deferred_Type eType, uint8_t ucData, uint16_t uiStamp)
+{
+  uint8_t ucHead = ucQueueHead;
+  uint8_t ucFill = (uint8_t)(ucHead - ucQueueTail) & DEFERRED_QUEUE_MASK;
+  Deferred_Item sItem;
+  
+  if (bDeferredInline)
+  {
+    sItem.ucType = (uint8_t)eType;
+    sItem.ucData = ucData;
+    sItem.uiStamp = uiStamp;
+    Deferred_Dispatch(&sItem);
+    return;
+  }
+  
+  if (ucFill >= DEFERRED_QUEUE_MASK)
+  {
+    if (sDeferredStats.ucOverflows < 0xFF)
+    {
+      ++sDeferredStats.ucOverflows;
+    }
+    return;
+  }
+  
+  asQueue[ucHead].ucType = (uint8_t)eType;
+  asQueue[ucHead].ucData = ucData;
+  asQueue[ucHead].uiStamp = uiStamp;
+  
+  /* Eintrag erst nach dem Fllen freigeben               */
+  ucQueueHead = (ucHead + 1) & DEFERRED_QUEUE_MASK;
+  
+  if (ucFill + 1 > sDeferredStats.ucHighWater)
+  {
+    sDeferredStats.ucHighWater = ucFill + 1;
+  }
+  
+  Sched_Post(Sched_Event_DEFERRED);
+}
+
+/*!****************************************************************************
+ * @brief
+ * ltesten Eintrag aus der Warteschlange entnehmen. Aufruf nur aus dem
+ * Hauptprogramm.
+ *
+ * @param[out] *pItem   Eintrag
+ * @return     bool     true, wenn ein Eintrag vorlag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Deferred_Pop(Deferred_Item* pItem)
+{
+  uint8_t ucTail = ucQueueTail;
+  uint16_t uiDelay;
+  
+  if (ucTail == ucQueueHead)
+  {
+    return false;
+  }
+  
+  *pItem = asQueue[ucTail];
+  ucQueueTail = (ucTail + 1) & DEFERRED_QUEUE_MASK;
+  
+  uiDelay = Deferred_GetUs() - pItem->uiStamp;
+  if (uiDelay > sDeferredStats.uiDelayMax)
+  {
+    sDeferredStats.uiDelayMax = uiDelay;
+  }
+  
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bearbeitung direkt in der ISR ein- oder ausschalten und die Statistik
+ * zurcksetzen. Die Bearbeitung in der ISR dient nur der Messung der
+ * Laufzeiten ohne Warteschlange.
+ *
+ * @param[in] bInline   true: Bearbeitung in der ISR
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Deferred_SetInline(bool bInline)
+{
+  bDeferredInline = bInline;
+  Deferred_ClearStats();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob die Eintrge direkt in der ISR bearbeitet werden
+ *
+ * @return    bool      true: Bearbeitung in der ISR
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Deferred_IsInline(void)
+{
+  return bDeferredInline;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Freilaufenden s-Zhler lesen
+ *
+ * @return    uint16_t  Zhlerstand in s, berlauf nach 65 ms
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t Deferred_GetUs(void)
+{
+  return TIM1_GetCounter();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufzeit einer ISR erfassen. Aufruf als letzte Anweisung der ISR.
+ *
+ * @param[in] eIsr      Interruptserviceroutine
+ * @param[in] uiStart   Zeitstempel bei Eintritt (Deferred_GetUs)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Deferred_IsrDone(Deferred_Isr eIsr, uint16_t uiStart)
+{
+  uint16_t uiTime = Deferred_GetUs() - uiStart;
+  
+  if (uiTime > sDeferredStats.auiIsrMax[eIsr])
+  {
+    sDeferredStats.auiIsrMax[eIsr] = uiTime;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Statistik abfragen
+ *
+ * @return    const Deferred_Stats*   Statistik
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Deferred_Stats* Deferred_GetStats(void)
+{
+  return &sDeferredStats;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Statistik zurcksetzen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Deferred_ClearStats(void)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < Deferred_Isr_NUM; ++ucIdx)
+  {
+    sDeferredStats.auiIsrMax[ucIdx] = 0;
+  }
+  sDeferredStats.uiDelayMax = 0;
+  sDeferredStats.ucHighWater = 0;
+  sDeferredStats.ucOverflows = 0;
+}
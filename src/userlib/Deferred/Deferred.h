@@ -0,0 +1,122 @@
+/*!****************************************************************************
+ * @file
+ * Deferred.h
+ *
+ * Verzgerte Bearbeitung von Interrupts: die ISR erfasst nur den Zustand und
+ * legt ihn in einer Warteschlange ab, der Rest luft im Hauptprogramm.
+ * Zustzlich wird die Laufzeit der Interruptserviceroutinen gemessen.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Bearbeitung in der ISR zum Vergleich der Laufzeiten
+ ******************************************************************************/
+
+#ifndef DEFERRED_H_
+#define DEFERRED_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Anzahl der Eintrge in der Warteschlange (Zweierpotenz)                   */
+#define DEFERRED_QUEUE_SIZE     16
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Art des Eintrags in der Warteschlange
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Deferred_Type {
+  /*! Timer-Tick, Daten: fllige Teilnehmer               */
+  Deferred_Type_TICK,
+  
+  /*! Endlagenschalter/Nothalt, Daten: Zustand Port B     */
+  Deferred_Type_LIMIT,
+  
+  Deferred_Type_NUM
+} Deferred_Type;
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag in der Warteschlange
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Deferred_Item {
+  /*! Art des Eintrags (Deferred_Type)                    */
+  uint8_t ucType;
+  
+  /*! In der ISR erfasster Zustand                        */
+  uint8_t ucData;
+  
+  /*! Zeitstempel bei Eintritt in die ISR in s           */
+  uint16_t uiStamp;
+} Deferred_Item;
+
+/*!****************************************************************************
+ * @brief
+ * Interruptserviceroutinen mit Laufzeitmessung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Deferred_Isr {
+  /*! Timer-Tick (TIM2)                                   */
+  Deferred_Isr_TIM2,
+  
+  /*! Sekundentakt und Weckzeitgeber (RTC)                */
+  Deferred_Isr_RTC,
+  
+  /*! Endlagenschalter und Nothalt (EXTI Port B)          */
+  Deferred_Isr_LIMIT,
+  
+  /*! Bluetooth-Empfang (USART1)                          */
+  Deferred_Isr_UART1_RX,
+  
+  /*! GPS-Empfang (USART3)                                */
+  Deferred_Isr_UART3_RX,
+  
+  Deferred_Isr_NUM
+} Deferred_Isr;
+
+/*!****************************************************************************
+ * @brief
+ * Statistik der Warteschlange und der Interruptlaufzeiten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Deferred_Stats {
+  /*! Max. Laufzeit je ISR in s                          */
+  uint16_t auiIsrMax[Deferred_Isr_NUM];
+  
+  /*! Max. Zeit von der ISR bis zur Bearbeitung in s,   *
+   *  lngere Zeiten als 65 ms zeigt AT+CSCHED (Task ISR) */
+  uint16_t uiDelayMax;
+  
+  /*! Max. Fllstand der Warteschlange                    */
+  uint8_t ucHighWater;
+  
+  /*! Verworfene Eintrge bei voller Warteschlange        */
+  uint8_t ucOverflows;
+} Deferred_Stats;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Deferred_Init(void);
+void Deferred_Push(Deferred_Type eType, uint8_t ucData, uint16_t uiStamp);
+bool Deferred_Pop(Deferred_Item* pItem);
+void Deferred_Dispatch(const Deferred_Item* pItem);
+
+void Deferred_SetInline(bool bInline);
+bool Deferred_IsInline(void);
+
+uint16_t Deferred_GetUs(void);
+void Deferred_IsrDone(Deferred_Isr eIsr, uint16_t uiStart);
+
+const Deferred_Stats* Deferred_GetStats(void);
+void Deferred_ClearStats(void);
+
+#endif /* DEFERRED_H_ */
@@ -0,0 +1,349 @@
+/*!****************************************************************************
+ * @file
+ * EnergyCounter.c
+ *
+ * Ladungs- und Energiebilanz fr Bleizelle und Solarpanel. Die Strme werden
+ * als Festkommawert in 100ms-Schritten aufintegriert und mit der ber die
+ * RTC gemessenen Zeit seit der letzten Abtastung gewichtet (100ms bei
+ * laufendem Timer-Tick, sonst 1s). Der Ladezustand wird per Coulomb-Zhlung
+ * gefhrt und nach lngerer Ruhephase ber die Ruhespannung neu verankert.
+ * Die Zhler werden zyklisch im EEPROM gesichert.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <string.h>
+#include "stm8l15x.h"
+#include "NvStore.h"
+#include "powerlib.h"
+#include "EnergyCounter.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Anzahl der Sttzstellen der Ruhespannungskennlinie                        */
+#define ENERGY_OCV_POINTS       11
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+Energy_Data sEnergy;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Ruhespannung der Bleizelle (12V) in mV fr 0%, 10%, ... 100% Ladezustand  */
+static const uint16_t auiOcvTable[ENERGY_OCV_POINTS] = {
+  11310, 11510, 11660, 11810, 11960, 12100, 12240, 12370, 12500, 12620, 12730
+};
+
+/*! Letzter Messwert der Batteriespannung in mV                               */
+static uint16_t uiLastBatVolt;
+
+/*! Dauer der aktuellen Ruhephase in 100ms                                    */
+static uint16_t uiRestTicks;
+
+/*! Zeitstempel der letzten Abtastung in 1/256 s                              */
+static uint32_t ulLastStamp;
+
+/*! Rest der Zeit seit der letzten Abtastung unter 100ms, in 10/256 s         */
+static uint16_t uiStampRem;
+
+/*! Sekundenzhler bis zur nchsten Sicherung im EEPROM                       */
+static uint16_t uiSaveTimer;
+
+/*! Ladungsinhalt beim nchsten 1s-Task ber die Spannung schtzen            */
+static bool bEstimate;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Abtastwert ber eine Anzahl 100ms-Schritte auf einen Zhler aufaddieren.
+ * Die Leistung ist 32 bit breit, da 14 V * 5 A schon 65,535 W bersteigen;
+ * mit hchstens ENERGY_MAX_GAP * 10 Schritten bleibt die Summe unter 2^32.
+ *
+ * @param[in] *pCounter Zhler
+ * @param[in] ulValue   Strom in mA oder Leistung in mW
+ * @param[in] ucTicks   Anzahl 100ms-Schritte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Energy_Add(Energy_Counter* pCounter, uint32_t ulValue, 
+  uint8_t ucTicks)
+{
+  uint32_t ulFrac = (uint32_t)pCounter->uiFrac + ulValue * ucTicks;
+  
+  if (ulFrac >= ENERGY_TICKS_PER_HOUR)
+  {
+    pCounter->ulValue += ulFrac / ENERGY_TICKS_PER_HOUR;
+    ulFrac %= ENERGY_TICKS_PER_HOUR;
+  }
+  pCounter->uiFrac = (uint16_t)ulFrac;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abtastwert ber eine Anzahl 100ms-Schritte von einem Zhler abziehen,
+ * Untergrenze ist 0
+ *
+ * @param[in] *pCounter Zhler
+ * @param[in] uiValue   Strom in mA
+ * @param[in] ucTicks   Anzahl 100ms-Schritte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Energy_Sub(Energy_Counter* pCounter, uint16_t uiValue, 
+  uint8_t ucTicks)
+{
+  uint32_t ulValue = (uint32_t)uiValue * ucTicks;
+  uint32_t ulFrac = pCounter->uiFrac;
+  
+  while (ulFrac < ulValue)
+  {
+    if (pCounter->ulValue == 0)
+    {
+      pCounter->uiFrac = 0;
+      return;
+    }
+    --pCounter->ulValue;
+    ulFrac += ENERGY_TICKS_PER_HOUR;
+  }
+  pCounter->uiFrac = (uint16_t)(ulFrac - ulValue);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ladezustand aus der Ruhespannung ber die Kennlinie interpolieren
+ *
+ * @param[in] uiVolt    Batteriespannung in mV
+ * @return    uint8_t   Ladezustand in 1%
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t Energy_SoCFromVolt(uint16_t uiVolt)
+{
+  uint8_t ucIdx;
+  
+  if (uiVolt <= auiOcvTable[0])
+  {
+    return 0;
+  }
+  
+  for (ucIdx = 1; ucIdx < ENERGY_OCV_POINTS; ++ucIdx)
+  {
+    if (uiVolt < auiOcvTable[ucIdx])
+    {
+      return (uint8_t)((ucIdx - 1) * 10 + 
+        ((uiVolt - auiOcvTable[ucIdx - 1]) * 10) / 
+        (auiOcvTable[ucIdx] - auiOcvTable[ucIdx - 1]));
+    }
+  }
+  
+  return 100;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zhlerstnde aus dem EEPROM laden. Ist der Block ungltig, beginnen die
+ * Zhler bei 0 und der Ladezustand wird aus der Batteriespannung geschtzt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Energy_Init(void)
+{
+  if (!NvStore_Load(NVSTORE_OFFS_ENERGY, &sEnergy, sizeof(sEnergy)))
+  {
+    memset(&sEnergy, 0, sizeof(sEnergy));
+    bEstimate = true;
+  }
+  
+  uiRestTicks = 0;
+  uiSaveTimer = ENERGY_SAVE_INTERVAL;
+  ulLastStamp = LowPower_GetStamp();
+  uiStampRem = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Strom- und Leistungswerte einer Abtastung ber die seit der letzten
+ * Abtastung vergangene Zeit aufintegrieren. Der Rest unter 100ms wird in die
+ * nchste Abtastung bertragen, damit sich keine Fehler aufsummieren.
+ *
+ * @param[in] *pBat     Messwerte der Batterie (Ladestrom positiv)
+ * @param[in] *pPv      Messwerte des Solarpanels
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Energy_Update(const Power_Sensor* pBat, const Power_Sensor* pPv)
+{
+  uint32_t ulStamp;
+  uint32_t ulElapsed;
+  uint16_t uiCurr;
+  uint32_t ulPower;
+  uint8_t ucTicks;
+  
+  uiLastBatVolt = pBat->sMeasure.uiVolt;
+  
+  /* Vergangene Zeit in 100ms-Schritten                   */
+  ulStamp = LowPower_GetStamp();
+  ulElapsed = LowPower_GetElapsed(ulLastStamp, ulStamp);
+  ulLastStamp = ulStamp;
+  if (ulElapsed > (ENERGY_MAX_GAP * LOWPOWER_TICK_HZ))
+  {
+    ulElapsed = ENERGY_MAX_GAP * LOWPOWER_TICK_HZ;
+  }
+  ulElapsed = ulElapsed * 10 + uiStampRem;
+  ucTicks = (uint8_t)(ulElapsed / LOWPOWER_TICK_HZ);
+  uiStampRem = (uint16_t)(ulElapsed % LOWPOWER_TICK_HZ);
+  if (ucTicks == 0)
+  {
+    return;
+  }
+  
+  /* Batterie: Laden und Entladen getrennt zhlen         */
+  if (pBat->sMeasure.iCurr >= 0)
+  {
+    uiCurr = (uint16_t)pBat->sMeasure.iCurr;
+    ulPower = ((uint32_t)pBat->sMeasure.uiVolt * uiCurr) / 1000;
+    Energy_Add(&sEnergy.sTotal.sBatInCharge, uiCurr, ucTicks);
+    Energy_Add(&sEnergy.sTotal.sBatInEnergy, ulPower, ucTicks);
+    Energy_Add(&sEnergy.sDay.sBatInCharge, uiCurr, ucTicks);
+    Energy_Add(&sEnergy.sDay.sBatInEnergy, ulPower, ucTicks);
+    Energy_Add(&sEnergy.sBatContent, 
+      (uint16_t)(((uint32_t)uiCurr * ENERGY_CHARGE_EFF) >> 8), ucTicks);
+    if (sEnergy.sBatContent.ulValue >= ENERGY_BAT_CAPACITY)
+    {
+      sEnergy.sBatContent.ulValue = ENERGY_BAT_CAPACITY;
+      sEnergy.sBatContent.uiFrac = 0;
+    }
+  }
+  else
+  {
+    uiCurr = (uint16_t)(-pBat->sMeasure.iCurr);
+    ulPower = ((uint32_t)pBat->sMeasure.uiVolt * uiCurr) / 1000;
+    Energy_Add(&sEnergy.sTotal.sBatOutCharge, uiCurr, ucTicks);
+    Energy_Add(&sEnergy.sTotal.sBatOutEnergy, ulPower, ucTicks);
+    Energy_Add(&sEnergy.sDay.sBatOutCharge, uiCurr, ucTicks);
+    Energy_Add(&sEnergy.sDay.sBatOutEnergy, ulPower, ucTicks);
+    Energy_Sub(&sEnergy.sBatContent, uiCurr, ucTicks);
+  }
+  
+  /* Ruhephase fr den Spannungsabgleich erkennen         */
+  if (uiCurr <= ENERGY_REST_CURR)
+  {
+    uiRestTicks += ucTicks;
+    if (uiRestTicks > (ENERGY_REST_TIME * 10U))
+    {
+      uiRestTicks = ENERGY_REST_TIME * 10U;
+    }
+  }
+  else
+  {
+    uiRestTicks = 0;
+    sEnergy.bAnchored = false;
+  }
+  
+  /* Solarpanel: nur Ertrag zhlen                        */
+  if (pPv->sMeasure.iCurr > 0)
+  {
+    uiCurr = (uint16_t)pPv->sMeasure.iCurr;
+    ulPower = ((uint32_t)pPv->sMeasure.uiVolt * uiCurr) / 1000;
+    Energy_Add(&sEnergy.sTotal.sPvCharge, uiCurr, ucTicks);
+    Energy_Add(&sEnergy.sTotal.sPvEnergy, ulPower, ucTicks);
+    Energy_Add(&sEnergy.sDay.sPvCharge, uiCurr, ucTicks);
+    Energy_Add(&sEnergy.sDay.sPvEnergy, ulPower, ucTicks);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ladezustand berechnen, Tageswechsel behandeln und Zhler zyklisch sichern
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Energy_Task1s(void)
+{
+  RTC_DateTypeDef sDate;
+  
+  /* Abgleich ber die Ruhespannung                       */
+  if (bEstimate && (uiLastBatVolt > 0))
+  {
+    Energy_SetSoC(Energy_SoCFromVolt(uiLastBatVolt));
+    sEnergy.bAnchored = false;
+    bEstimate = false;
+  }
+  else if (!sEnergy.bAnchored && (uiRestTicks >= (ENERGY_REST_TIME * 10U)))
+  {
+    Energy_SetSoC(Energy_SoCFromVolt(uiLastBatVolt));
+  }
+  
+  sEnergy.ucSoC = (uint8_t)((sEnergy.sBatContent.ulValue * 100 + 
+    ENERGY_BAT_CAPACITY / 2) / ENERGY_BAT_CAPACITY);
+  
+  /* Tageszhler bei Datumswechsel zurcksetzen           */
+  RTC_GetDate(RTC_Format_BIN, &sDate);
+  if (sDate.RTC_Date != sEnergy.ucDate)
+  {
+    memset(&sEnergy.sDay, 0, sizeof(sEnergy.sDay));
+    sEnergy.ucDate = sDate.RTC_Date;
+    uiSaveTimer = 0;
+  }
+  
+  /* Zhlerstnde sichern                                 */
+  if (uiSaveTimer > 0)
+  {
+    --uiSaveTimer;
+  }
+  else
+  {
+    Energy_Save();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ladezustand vorgeben, z.B. nach dem Tausch der Batterie
+ *
+ * @param[in] ucSoC     Ladezustand in 1%
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Energy_SetSoC(uint8_t ucSoC)
+{
+  if (ucSoC > 100)
+  {
+    ucSoC = 100;
+  }
+  
+  sEnergy.sBatContent.ulValue = ((uint32_t)ENERGY_BAT_CAPACITY * ucSoC) / 100;
+  sEnergy.sBatContent.uiFrac = 0;
+  sEnergy.ucSoC = ucSoC;
+  sEnergy.bAnchored = true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gesamtzhler zurcksetzen und sofort sichern
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Energy_ClearTotal(void)
+{
+  memset(&sEnergy.sTotal, 0, sizeof(sEnergy.sTotal));
+  Energy_Save();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhlerstnde im EEPROM sichern
+ *
+ * @return    bool      true, wenn erfolgreich
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Energy_Save(void)
+{
+  uiSaveTimer = ENERGY_SAVE_INTERVAL;
+  return NvStore_Save(NVSTORE_OFFS_ENERGY, &sEnergy, sizeof(sEnergy));
+}
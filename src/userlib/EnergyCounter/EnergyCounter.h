@@ -0,0 +1,125 @@
+/*!****************************************************************************
+ * @file
+ * EnergyCounter.h
+ *
+ * Ladungs- und Energiebilanz fr Bleizelle und Solarpanel mit Schtzung des
+ * Ladezustands
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef ENERGYCOUNTER_H_
+#define ENERGYCOUNTER_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sensorlib_power.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Nennkapazitt der Bleizelle in mAh                                        */
+#define ENERGY_BAT_CAPACITY     7000
+
+/*! Ladewirkungsgrad der Bleizelle in 1/256 (ca. 85%)                         */
+#define ENERGY_CHARGE_EFF       218
+
+/*! Max. Batteriestrom in mA, bei dem die Zelle als unbelastet gilt           */
+#define ENERGY_REST_CURR        30
+
+/*! Ruhezeit in s bis zum Abgleich ber die Ruhespannung                      */
+#define ENERGY_REST_TIME        1800
+
+/*! Speicherintervall der Zhler im EEPROM in s                               */
+#define ENERGY_SAVE_INTERVAL    3600
+
+/*! Anzahl der 100ms-Abtastungen pro Stunde, Nenner des Nachkommaanteils      */
+#define ENERGY_TICKS_PER_HOUR   36000U
+
+/*! Max. gewertete Zeit zwischen zwei Abtastungen in s (Sprnge der RTC)      */
+#define ENERGY_MAX_GAP          5
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Festkommazhler fr Ladung (mAh) oder Energie (mWh)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Energy_Counter {
+  /*! Ganzzahliger Anteil in 1mAh bzw. 1mWh               */
+  uint32_t ulValue;
+  
+  /*! Nachkommaanteil in 1/36000 (eine 100ms-Abtastung)   */
+  uint16_t uiFrac;
+} Energy_Counter;
+
+/*!****************************************************************************
+ * @brief
+ * Zhlersatz fr Laden, Entladen und Solarertrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Energy_Set {
+  /*! Ladung in die Batterie in mAh                       */
+  Energy_Counter sBatInCharge;
+  
+  /*! Energie in die Batterie in mWh                      */
+  Energy_Counter sBatInEnergy;
+  
+  /*! Ladung aus der Batterie in mAh                      */
+  Energy_Counter sBatOutCharge;
+  
+  /*! Energie aus der Batterie in mWh                     */
+  Energy_Counter sBatOutEnergy;
+  
+  /*! Ladung vom Solarpanel in mAh                        */
+  Energy_Counter sPvCharge;
+  
+  /*! Energie vom Solarpanel in mWh                       */
+  Energy_Counter sPvEnergy;
+} Energy_Set;
+
+/*!****************************************************************************
+ * @brief
+ * Gesamter Zustand des Energiezhlers, wird im EEPROM gesichert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Energy_Data {
+  /*! Zhler seit dem letzten Rcksetzen                  */
+  Energy_Set sTotal;
+  
+  /*! Zhler seit Tagesbeginn (RTC)                       */
+  Energy_Set sDay;
+  
+  /*! Geschtzter Ladungsinhalt der Batterie in mAh       */
+  Energy_Counter sBatContent;
+  
+  /*! Ladezustand in 1%                                   */
+  uint8_t ucSoC;
+  
+  /*! Tag im Monat des Tageszhlers                       */
+  uint8_t ucDate;
+  
+  /*! Ladezustand wurde ber die Ruhespannung besttigt   */
+  bool bAnchored;
+} Energy_Data;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Zhlerstnde und Ladezustand                                              */
+extern Energy_Data sEnergy;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Energy_Init(void);
+void Energy_Update(const Power_Sensor* pBat, const Power_Sensor* pPv);
+void Energy_Task1s(void);
+
+void Energy_SetSoC(uint8_t ucSoC);
+void Energy_ClearTotal(void);
+bool Energy_Save(void);
+
+#endif /* ENERGYCOUNTER_H_ */
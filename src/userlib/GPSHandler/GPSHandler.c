@@ -13,7 +13,10 @@
 #include "stm8l15x.h"
 #include "io_map.h"
 #include "commlib.h"
+#include "powerlib.h"
 #include "ATCmd.h"
+#include "Profiler.h"
+#include "Trace.h"
 #include "GPSHandler.h"
 
 
@@ -48,6 +51,12 @@ GPSHandler_Data sSensorGPS;
 /*! GPS Aktivierungszustand                                                   */
 static bool bGpsActive;
 
+/*! GPS bei jedem n-ten Wakeup einschalten, 0: nie                            */
+static uint8_t ucWakeDiv;
+
+/*! Zhler der Wakeups seit dem letzten Einschalten                           */
+static uint8_t ucWakeCnt;
+
 
 /*- Lokale Funktionen --------------------------------------------------------*/
 /*!****************************************************************************
@@ -266,7 +275,7 @@ static void GPSHandler_ParseNmeaField(char* pszBuf, int iLen, int iNum, GPSHandl
         {
           /* Altitude */
           int i;
-          int iNumDec;
+          int iNumDec = 0;
           int iExp;
           
           /* Anzahl der Vorkommastellen zhlen */
@@ -354,6 +363,7 @@ static void GPSHandler_ParseNmeaFields(char* aucBuf, int iLen, GPSHandler_Senten
  * @return    bool    true, wenn ein NMEA Sentence verarbeitet wurde
  *
  * @date  06.11.2019
+ * @date  19.10.2026  Aufzeichnung der ausgewerteten Sentences
  ******************************************************************************/
 static bool GPSHandler_ParseNmeaIn(char* pszBuf, int iLen)
 {
@@ -393,6 +403,7 @@ static bool GPSHandler_ParseNmeaIn(char* pszBuf, int iLen)
           {
             case GPSHandler_Sentence_GGA:
             case GPSHandler_Sentence_RMC:
+              Trace_Record(Trace_Type_NMEA, pszBuf, (uint8_t)iLen);
               GPSHandler_ParseNmeaFields(pszBuf, iLen, eType);
               break;
               
@@ -446,6 +457,8 @@ static bool GPSHandler_ParseNmeaIn(char* pszBuf, int iLen)
 void GPSHandler_Init(void)
 {
   bGpsActive = false;
+  ucWakeDiv = 1;
+  ucWakeCnt = 0;
     
   GPIO_Init(USART3_GPS_PORT, USART3_GPS_RX_PIN, GPIO_Mode_In_FL_No_IT);
   GPIO_Init(USART3_GPS_PORT, USART3_GPS_TX_PIN, GPIO_Mode_Out_PP_High_Fast);
@@ -462,22 +475,62 @@ void GPSHandler_Init(void)
  * Pollingroutine, aufgerufen bei Auslsung eines UART-Interrupts 
  *
  * @date  06.11.2019
+ * @date  19.10.2026    Laufzeitmessung des Parsers
  ******************************************************************************/
 bool GPSHandler_Poll(void)
 {
-  return GPSHandler_ParseNmeaIn(aucUart3RxBuf, UART3_GetRxCount());
+  bool bResult;
+  
+  PROFILE_BEGIN(Profiler_Zone_NMEA);
+  bResult = GPSHandler_ParseNmeaIn(aucUart3RxBuf, UART3_GetRxCount());
+  PROFILE_END(Profiler_Zone_NMEA);
+  
+  return bResult;
 }
 
 /*!****************************************************************************
  * @brief
- * Wakeup-Routine; Aktiviert das GPS-Modul nach lngerer Wartezeit
+ * Wakeup-Routine; Aktiviert das GPS-Modul nach lngerer Wartezeit. Mit
+ * einem Teiler > 1 bleibt das Modul bis zum n-ten Wakeup ausgeschaltet.
  *
  * @date  06.11.2019
  ******************************************************************************/
 void GPSHandler_TaskWakeup(void)
 {
-  GPIO_WriteBit(GPS_PWREN_PORT, GPS_PWREN_PIN, ENABLE);
-  bGpsActive = true;
+  if ((ucWakeDiv > 0) && (++ucWakeCnt >= ucWakeDiv))
+  {
+    ucWakeCnt = 0;
+    GPIO_WriteBit(GPS_PWREN_PORT, GPS_PWREN_PIN, ENABLE);
+    bGpsActive = true;
+    LowPower_SetLock(LowPower_Lock_GPS, true);
+  }
+  else
+  {
+    GPIO_WriteBit(GPS_PWREN_PORT, GPS_PWREN_PIN, DISABLE);
+    bGpsActive = false;
+    LowPower_SetLock(LowPower_Lock_GPS, false);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Einschaltstrategie fr das GPS-Modul vorgeben
+ *
+ * @param[in] ucDiv     GPS bei jedem n-ten Wakeup einschalten, 0: nie
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void GPSHandler_SetPolicy(uint8_t ucDiv)
+{
+  ucWakeDiv = ucDiv;
+  ucWakeCnt = 0;
+  
+  if (ucWakeDiv == 0)
+  {
+    GPIO_WriteBit(GPS_PWREN_PORT, GPS_PWREN_PIN, DISABLE);
+    bGpsActive = false;
+    LowPower_SetLock(LowPower_Lock_GPS, false);
+  }
 }
 
 /*!****************************************************************************
@@ -491,4 +544,27 @@ void GPSHandler_TaskWakeup(void)
 void GPSHandler_Task1s(void)
 {
   
-}
\ No newline at end of file
+}
+
+#ifdef PROFILER
+/*!****************************************************************************
+ * @brief
+ * Vollstndigen Sentence ohne UART und Debugausgabe auswerten, fr den
+ * Benchmark mit festen Eingangsdaten und die Wiedergabe einer Aufzeichnung.
+ * berschreibt sSensorGPS.
+ *
+ * @param[in] *pszBuf NMEA-Sentence, startet mit $
+ * @param[in] iLen    Lnge des Sentence
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void GPSHandler_ParseSentence(char* pszBuf, int iLen)
+{
+  GPSHandler_Sentence eType = GPSHandler_GetType(pszBuf);
+  
+  if ((eType == GPSHandler_Sentence_GGA) || (eType == GPSHandler_Sentence_RMC))
+  {
+    GPSHandler_ParseNmeaFields(pszBuf, iLen, eType);
+  }
+}
+#endif /* PROFILER */
\ No newline at end of file
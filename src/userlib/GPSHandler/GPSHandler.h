@@ -93,6 +93,11 @@ extern GPSHandler_Data sSensorGPS;
 void GPSHandler_Init(void);
 bool GPSHandler_Poll(void);
 void GPSHandler_TaskWakeup(void);
+void GPSHandler_SetPolicy(uint8_t ucDiv);
 void GPSHandler_Task1s(void);
 
+#ifdef PROFILER
+void GPSHandler_ParseSentence(char* pszBuf, int iLen);
+#endif /* PROFILER */
+
 #endif /* GPSHANDLER_H_ */
\ No newline at end of file
@@ -0,0 +1,2741 @@
+/*!****************************************************************************
+ * @file
+ * Logger.c
+ *
+ * Die Binrdatei beginnt mit Logger_FileHead und der Feldliste, damit sie
+ * ohne Kenntnis der Firmwareversion ausgewertet werden kann. Der Kopf wird
+ * geschrieben, wenn die Datei beim Anhngen leer ist. Danach folgen die
+ * Stze (Logger_Record) ohne Trennzeichen; tools/log_decode.py wandelt sie
+ * in eine CSV-Datei um. Kopf, Stze und Index werden Feld fr Feld Big
+ * Endian abgelegt (Logger_EncodeRecord()), unabhngig von der Byte-Reihenfolge
+ * des Rechners; auf dem STM8 ist das die Darstellung im Speicher.
+ *
+ * Schreibpuffer: Der Bereich NVSTORE_OFFS_LOGSTAGE im Daten-EEPROM enthlt
+ * die Datei ab der Position ulBase bis zum nchsten Sektorende. Ist er voll,
+ * wird er mit einem Zugriff auf die Karte geschrieben, direkt aus dem
+ * EEPROM und ohne Kopie im RAM. Nach einem Reset wird der Puffer
+ * fortgesetzt. Der Zustand liegt reihum in LOGGER_STATE_SLOTS Pltzen;
+ * gltig ist der Platz mit der hchsten Folgenummer. Jede Sicherung geht
+ * in den nchsten Platz, bricht sie ab, bleibt der vorherige Zustand
+ * gltig.
+ *
+ * Durchlufe: Ein Durchlauf fllt den Puffer ab ulBase bis zum Sektorende.
+ * Der nchste beginnt frhestens LOGGER_STAGE_PERIOD s nach dem Beginn des
+ * letzten, bis dahin gehen die Eintrge mit f_write direkt in die Datei
+ * (bDirect) und sammeln sich im Fenster von FatFs, bis der Sektor voll ist.
+ * Die Dateigre wird nach jedem so vollendeten Sektor gesichert,
+ * sptestens aber nach <syncage>, und ist nach einem Reset das Ende der
+ * Datei. Fllt der erste Puffer danach den Rest des Sektors, wird sie
+ * ebenfalls gesichert, bevor der Zustand auf den nchsten Sektor zeigt.
+ * Gepackte Eintrge gehen immer direkt in die Datei, ihr Wiederholungszhler
+ * wird dort erhht.
+ *
+ * Lebensdauer (Daten-EEPROM 300000 Zyklen je Wort zu 4 Byte, NvStore_Write
+ * programmiert jedes Wort hchstens einmal je Aufruf):
+ * - Puffer: hchstens 86400 / LOGGER_STAGE_PERIOD = 24 Durchlufe am Tag,
+ *   auch ber einen Reset oder Tageswechsel hinweg. Jedes Wort wird je
+ *   Durchlauf hchstens zweimal programmiert (Eintragsgrenze im Wort), also
+ *   hchstens 48 Zyklen am Tag: 300000 / 48 = 6250 Tage, ber 17 Jahre.
+ *   Bisher lief jeder Sektor durch den Puffer, bei Binrstzen alle 10 s
+ *   etwa 980 Zyklen am Tag, weniger als ein Jahr.
+ * - Zustand: je Durchlauf Beginn, Sektorende und Wechsel in den direkten
+ *   Betrieb (Logger_EndPass() zweimal), dazu jedes vorzeitige Schreiben
+ *   (<maxage>, <maxfill>) und bei Textzeilen jeder Eintrag im Puffer (bis
+ *   5 je Durchlauf). Bei <maxfill> = 58 sind das hchstens 24 * 13 = 312
+ *   Sicherungen am Tag, je Platz 39 und je Wort ein Zyklus: 300000 / 39 =
+ *   7692 Tage, ber 20 Jahre. Die Pltze sind auf ganze Worte ausgerichtet,
+ *   die Prfsumme (NvStore_Save) liegt in einem eigenen Wort.
+ * - Direkt geschriebene Eintrge programmieren das EEPROM nicht. Die Karte
+ *   schreibt je Sektor den vollen Sektor und beim f_sync danach den Anfang
+ *   des nchsten und das Verzeichnis, also drei Zugriffe auf etwa neun
+ *   Binrstze statt zwei je Eintrag. Ein Reset verliert die Eintrge seit
+ *   dem letzten f_sync: weniger als ein Sektor (bei Binrstzen alle 10 s
+ *   bis zu 90 s) und hchstens <syncage> Sekunden.
+ *
+ * Die Datei bleibt geffnet, damit nicht bei jedem Schreiben das
+ * Verzeichnis durchsucht und die Clusterkette bis zum Dateiende verfolgt
+ * wird; der Aufwand ist damit unabhngig von der Dateigre. Gre und
+ * Cluster im Verzeichnis werden sptestens nach der eingestellten Zeit mit
+ * f_sync gesichert, ab Werk nach 600 s; die Datei wird nach einem Reset
+ * anhand des Zustands im EEPROM repariert. Schlgt ein Zugriff fehl, etwa
+ * weil FatFs die Karte nach einem Wechsel neu eingebunden hat und das
+ * Dateiobjekt ungltig ist, wird die Datei einmal neu geffnet.
+ *
+ * Vorbelegung: Eine neue Binrdatei wird auf Wunsch mit f_expand als
+ * zusammenhngender Bereich angelegt. Die Sektoren liegen dann ab dem
+ * Startcluster hintereinander, der Puffer wird mit disk_write direkt an die
+ * berechnete Sektoradresse geschrieben, ohne die FAT zu lesen oder zu
+ * ndern. Die Dateigre im Verzeichnis wird erst beim f_sync mit f_lseek
+ * nachgezogen. Direkt geschriebene Eintrge und ein Puffer, der mitten im
+ * Sektor beginnt, gehen mit f_write in dieselben Cluster; f_lseek zieht
+ * vorher die Gre nach, FatFs folgt der bei f_expand angelegten Kette.
+ * Ist der Bereich voll, wird die Datei normal weitergeschrieben.
+ *
+ * Tagesdateien und Index: Jeder Eintrag geht in die Datei seines Tages
+ * (UTC), beim Tageswechsel wird die alte Datei geschlossen. Fr den ersten
+ * Eintrag jeder Stunde wird Zeit und Position an die Indexdatei des Formats
+ * angehngt. Eine Abfrage sucht darin binr die letzte Stunde vor dem
+ * Beginn und liest von dort hchstens eine Stunde Eintrge, bis sie den
+ * Anfang des Bereichs erreicht.
+ *
+ * Gepacktes Format: Die Datei besteht aus Blcken von je einem Sektor, der
+ * erste Sektor enthlt nur den Kopf. Jeder Block beginnt mit einem
+ * vollstndigen Binrsatz und ist damit fr sich lesbar. Danach folgt je
+ * Eintrag eine Bitmaske der genderten Felder (Bit n: n-tes Feld der
+ * Feldliste) und deren Differenzen zum Vorgnger als Zickzack-Varint, fr
+ * die Zeit die nderung des Abstands. Eintrge ohne jede nderung werden
+ * als 0x00 und Anzahl zusammengefasst, die Anzahl wird in der Datei
+ * hochgezhlt. Passt ein Eintrag nicht mehr in den Sektor, wird der Block
+ * mit 0x00 0x00 abgeschlossen und mit Nullen aufgefllt. Nach einem Reset
+ * fehlt der Vorgnger im RAM, der nchste Eintrag beginnt einen neuen Block.
+ *
+ * Wiederherstellung: Der Zustand im EEPROM dient als Journal. ulCommit ist
+ * die Commit-Marke hinter dem letzten vollstndig gepufferten Eintrag. In
+ * Binrdateien wird sie nicht bei jedem Eintrag gesichert, sondern nur mit
+ * dem Zustand beim Schreiben des Puffers und nach einem Satz ber eine
+ * Sektorgrenze. Nach einem Reset wird der Puffer ab der gesicherten Marke
+ * durchsucht (hchstens ein Sektor): Jeder Binrsatz muss seine CRC-16
+ * tragen, und seine Zeit darf nicht vor der des vorherigen Satzes (ulTime)
+ * oder auerhalb des Tages liegen. Reste frherer Sektoren im Puffer gelten
+ * damit nicht als Satz. Das Ende des letzten gltigen Satzes ist die
+ * Commit-Marke. Text- und gepackte Eintrge haben keine eigene Prfsumme,
+ * eine abgebrochene Zeile wre von Resten nicht zu unterscheiden; ihr
+ * Zustand wird weiter nach jedem Eintrag gesichert.
+ *
+ * ulSafe ist die mit f_sync gesicherte Dateigre, ulSafeEnd das letzte
+ * Eintragsende davor; uiSafeCrc ist die CRC-16 der Datei von ulSafe bis
+ * ulBase, also der Sektoren, die seitdem aus dem Puffer auf die Karte
+ * gingen. Nach einem Reset wird vor dem nchsten Eintrag die Datei bis
+ * ulBase verlngert, wobei FatFs die schon verketteten Cluster wieder
+ * eintrgt, und der Bereich ab ulSafe gelesen. Stimmt die Prfsumme,
+ * bleiben die Daten erhalten, sonst wird die Datei auf ulSafeEnd gekrzt.
+ * Liegt der Anfang eines abgebrochenen Eintrags schon auf der Karte, wird
+ * auf die Commit-Marke gekrzt. Gelesen wird nur der Teil seit der letzten
+ * Sicherung, die Dauer hngt von <syncage> ab, nicht von der Dateigre.
+ *
+ * Ereignisse (Logger_Event) sind selten und gehen als Textzeile an
+ * LOGGER_EVENT_FILE, formatiert wie die Protokollzeile in acLoggerLine.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Ereignisse
+ * @date  19.10.2026  Big Endian unabhngig vom Rechner
+ * @date  19.10.2026  Ohne Puffer je Sektor sichern
+ * @date  19.10.2026  Vorbelegung auch fr direkt geschriebene Eintrge
+ * @date  19.10.2026  Sektor ab der Mitte vor dem Zustand sichern
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include "stm8l15x.h"
+#include "ff.h"
+#include "diskio.h"
+#include "NvStore.h"
+#include "Scheduler.h"
+#include "Watchdog.h"
+#include "Profiler.h"
+#include "NumFmt.h"
+#include "Logger.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! @brief Einstellungen ohne gltigen Wert im EEPROM
+ * @{                                                                         */
+#define LOGGER_DEFAULT_FORMAT   Logger_Format_BIN
+#define LOGGER_DEFAULT_MAXAGE   3600
+#define LOGGER_DEFAULT_MAXFILL  LOGGER_SECTOR_SIZE
+#define LOGGER_DEFAULT_SYNCAGE  600
+#define LOGGER_DEFAULT_PREALLOC 0
+/*! @}                                                                        */
+
+/*! Startwert und Polynom der CRC-16/CCITT                                    */
+#define LOGGER_CRC_INIT         0xFFFF
+#define LOGGER_CRC_POLY         0x1021
+
+/*! Pltze fr den Zustand des Schreibpuffers im EEPROM                       */
+#define LOGGER_STATE_SLOTS      8
+
+/*! Abstand der Pltze: Zustand und Prfsumme, auf ganze Worte des EEPROM
+ *  aufgerundet, damit sich zwei Pltze kein Wort teilen                      */
+#define LOGGER_STATE_PITCH      ((sizeof(Logger_State) + 1 + 3) & ~3)
+
+/*! Mindestabstand zweier Durchlufe durch den Puffer in s                    */
+#define LOGGER_STAGE_PERIOD     3600
+
+/*! Dateiposition des Puffers noch nicht bestimmt                             */
+#define LOGGER_BASE_UNKNOWN     0xFFFFFFFFUL
+
+/*! Verzeichnis der Tages- und Indexdateien                                   */
+#define LOGGER_DIR              "LOG"
+
+/*! Sekunden je Tag                                                           */
+#define LOGGER_DAY_SECONDS      86400UL
+
+/*! Lnge des Zeitstempels am Anfang einer Textzeile                          */
+#define LOGGER_CSV_STAMP        20
+
+/*! Lesepuffer der Wiederherstellung in Byte                                  */
+#define LOGGER_RECOVER_BUF      32
+
+/*! Gepacktes Format: Nullen je Schreibzugriff beim Abschluss eines Blocks    */
+#define LOGGER_PACK_FILL        16
+
+/*! Datei der Ereignisse                                                      */
+#define LOGGER_EVENT_FILE       "EVENTS.TXT"
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zustand des Schreibpuffers im EEPROM
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Logger_State {
+  /*! Dateiposition des ersten Byte im Puffer             */
+  uint32_t ulBase;
+  
+  /*! Belegte Byte im Puffer                              */
+  uint16_t uiFill;
+  
+  /*! Format, zu dessen Datei der Puffer gehrt           */
+  uint8_t ucFormat;
+  
+  /*! Tag der Datei seit dem 01.01.2000                   */
+  uint16_t uiDay;
+  
+  /*! Startcluster der vorbelegten Datei, 0: keine        */
+  uint32_t ulClust;
+  
+  /*! Gre der Vorbelegung in Sektoren                   */
+  uint16_t uiContig;
+  
+  /*! Commit-Marke, Ende des letzten ganzen Eintrags      */
+  uint32_t ulCommit;
+  
+  /*! Unix-Zeit des Eintrags vor der Commit-Marke         */
+  uint32_t ulTime;
+  
+  /*! Mit f_sync gesicherte Dateigre                    */
+  uint32_t ulSafe;
+  
+  /*! Letztes Eintragsende bis ulSafe                     */
+  uint32_t ulSafeEnd;
+  
+  /*! CRC-16 der Datei von ulSafe bis ulBase              */
+  uint16_t uiSafeCrc;
+  
+  /*! Eintrge gehen ohne Puffer direkt in die Datei      */
+  bool bDirect;
+  
+  /*! Folgenummer, bestimmt den Platz im EEPROM           */
+  uint16_t uiSeq;
+} Logger_State;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Zeilenpuffer der Textzeile und der Wertetabelle fr GUI                   */
+char acLoggerLine[LOGGER_CSV_MAX];
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Einstellungen                                                             */
+static Logger_Config sLoggerCfg;
+
+/*! Zustand des Schreibpuffers                                                */
+static Logger_State sLoggerState;
+
+/*! Byte des Puffers, die bereits auf der Karte stehen                        */
+static uint16_t uiLoggerSynced;
+
+/*! Sekundentakt beim ersten noch nicht geschriebenen Byte                    */
+static uint16_t uiLoggerStageSec;
+
+/*! Sekundentakt beim Beginn des letzten Durchlaufs durch den Puffer          */
+static uint16_t uiLoggerPassSec;
+
+/*! Geffnete Protokolldatei                                                  */
+static FIL sLoggerFile;
+
+/*! sLoggerFile ist geffnet                                                  */
+static bool bLoggerOpen;
+
+/*! Geschrieben, aber Verzeichnis noch nicht gesichert                        */
+static bool bLoggerDirty;
+
+/*! Sekundentakt beim ersten Schreiben ohne f_sync                            */
+static uint16_t uiLoggerSyncSec;
+
+/*! Ende der Datei vor dem nchsten Eintrag prfen (Logger_Recover)           */
+static bool bLoggerRecover;
+
+/*! Letztes Eintragsende, das auf der Karte steht                             */
+static uint32_t ulLoggerWritten;
+
+/*! Zhler                                                                    */
+static Logger_Stats sLoggerStats;
+
+/*! Name der aktuellen Tagesdatei                                             */
+static char szLoggerFile[LOGGER_NAME_SIZE];
+
+/*! Zeit des letzten Indexeintrags                                            */
+static uint32_t ulLoggerIndexTime;
+
+/*! Gepacktes Format: Vorgnger, gegen den die Differenzen gebildet werden    */
+static Logger_Record sLoggerPackPrev;
+
+/*! Gepacktes Format: Zeitabstand zum Vorgnger in s                          */
+static int32_t lLoggerPackStep;
+
+/*! Gepacktes Format: Dateiposition des Wiederholungszhlers, 0: keiner       */
+static uint32_t ulLoggerPackRun;
+
+/*! Gepacktes Format: Stand des Wiederholungszhlers                          */
+static uint8_t ucLoggerPackCount;
+
+/*! Gepacktes Format: Vorgnger gltig, sonst beginnt ein neuer Block         */
+static bool bLoggerPackValid;
+
+/*! Dateiendungen je Format                                                   */
+static const char* const apszLoggerExt[Logger_Format_NUM] = {
+  "TXT", "BIN", "PAK"
+};
+
+/*! Indexdateien je Format                                                    */
+static const char* const apszLoggerIndex[Logger_Format_NUM] = {
+  LOGGER_DIR "/TXT.IDX", LOGGER_DIR "/BIN.IDX", LOGGER_DIR "/PAK.IDX"
+};
+
+/*! Feldliste im Dateikopf: Name:Typ in der Reihenfolge von Logger_Record     */
+static const char szLoggerSchema[] =
+  "time:u32,temp_bme:i16,temp_cpu:i16,temp_qmc:i16,temp_mpu:i16,"
+  "pressure:u32,humidity:u32,wind_dir:u16,wind_velo:u16,"
+  "azimuth:u16,zenith:i16,lat:i32,long:i32,alt:i16,"
+  "bat_volt:u16,panel_volt:u16,bat_curr:i16,panel_curr:i16,"
+  "soc:u8,bat_in:u16,bat_out:u16,pv_energy:u32,status:u8,crc:u16";
+
+/*! Lage der Felder im Binrsatz in der Reihenfolge der Feldliste, zuletzt
+ *  das Ende des letzten Feldes                                               */
+static const uint8_t aucLoggerPackOffs[LOGGER_PACK_FIELDS + 1] = {
+  offsetof(Logger_Record, ulTime),
+  offsetof(Logger_Record, iTempBME),
+  offsetof(Logger_Record, iTempCPU),
+  offsetof(Logger_Record, iTempQMC),
+  offsetof(Logger_Record, iTempMPU),
+  offsetof(Logger_Record, ulPressure),
+  offsetof(Logger_Record, ulHumidity),
+  offsetof(Logger_Record, uiWindDir),
+  offsetof(Logger_Record, uiWindVelo),
+  offsetof(Logger_Record, uiAzimuth),
+  offsetof(Logger_Record, iZenith),
+  offsetof(Logger_Record, lLat),
+  offsetof(Logger_Record, lLong),
+  offsetof(Logger_Record, iAlt),
+  offsetof(Logger_Record, uiBatVolt),
+  offsetof(Logger_Record, uiPanelVolt),
+  offsetof(Logger_Record, iBatCurr),
+  offsetof(Logger_Record, iPanelCurr),
+  offsetof(Logger_Record, ucSoC),
+  offsetof(Logger_Record, uiBatIn),
+  offsetof(Logger_Record, uiBatOut),
+  offsetof(Logger_Record, ulPvEnergy),
+  offsetof(Logger_Record, ucStatus),
+  offsetof(Logger_Record, uiCrc)
+};
+
+/*! Gepacktes Format: Wiederholung eines Eintrags, Anzahl 1                   */
+static const uint8_t aucLoggerPackRun[2] = {0x00, 0x01};
+
+/*! Tage vor dem Monatsersten im Nicht-Schaltjahr                             */
+static const uint16_t auiLoggerMonthDays[12] = {
+  0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+};
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * CRC-16/CCITT (Polynom 0x1021, Startwert 0xFFFF) berechnen. Mit dem
+ * Ergebnis als Startwert wird ber weitere Daten fortgesetzt.
+ *
+ * @param[in] uiCrc     Startwert LOGGER_CRC_INIT oder bisherige Prfsumme
+ * @param[in] *pucData  Daten
+ * @param[in] uiLen     Lnge in Byte
+ * @return    uint16_t  Prfsumme
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Startwert als Parameter
+ ******************************************************************************/
+static uint16_t Logger_Crc16(uint16_t uiCrc, const uint8_t* pucData,
+  uint16_t uiLen)
+{
+  uint8_t ucBit;
+  
+  while (uiLen-- > 0)
+  {
+    uiCrc ^= (uint16_t)(*pucData++) << 8;
+    for (ucBit = 0; ucBit < 8; ++ucBit)
+    {
+      if ((uiCrc & 0x8000) != 0)
+      {
+        uiCrc = (uiCrc << 1) ^ LOGGER_CRC_POLY;
+      }
+      else
+      {
+        uiCrc <<= 1;
+      }
+    }
+  }
+  return uiCrc;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zahl Big Endian ablegen
+ *
+ * @param[out] *pucDest Ziel
+ * @param[in] ulValue   Zahl
+ * @param[in] ucSize    Lnge in Byte (1, 2 oder 4)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_PutBe(uint8_t* pucDest, uint32_t ulValue, uint8_t ucSize)
+{
+  while (ucSize-- > 0)
+  {
+    pucDest[ucSize] = (uint8_t)ulValue;
+    ulValue >>= 8;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Big-Endian-Zahl lesen
+ *
+ * @param[in] *pucSrc   Quelle
+ * @param[in] ucSize    Lnge in Byte (1, 2 oder 4)
+ * @return    uint32_t  Zahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t Logger_GetBe(const uint8_t* pucSrc, uint8_t ucSize)
+{
+  uint32_t ulValue = 0;
+  
+  while (ucSize-- > 0)
+  {
+    ulValue = (ulValue << 8) | *(pucSrc++);
+  }
+  return ulValue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zustand des Schreibpuffers mit der nchsten Folgenummer in deren Platz
+ * sichern. NvStore_Write() schreibt aufsteigend, die Folgenummer steht
+ * deshalb am Ende der Struktur: Bricht das Schreiben ab, behlt der Platz
+ * seine alte, niedrigere Nummer, auch wenn die Prfsumme zufllig passt.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Jede Sicherung im nchsten Platz
+ ******************************************************************************/
+static void Logger_SaveState(void)
+{
+  ++sLoggerState.uiSeq;
+  NvStore_Save(NVSTORE_OFFS_LOGSTATE
+    + (sLoggerState.uiSeq % LOGGER_STATE_SLOTS) * LOGGER_STATE_PITCH,
+    &sLoggerState, sizeof(sLoggerState));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gltigen Platz mit der hchsten Folgenummer laden
+ *
+ * @return    bool      true, wenn ein gltiger Zustand gefunden wurde
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Logger_LoadState(void)
+{
+  Logger_State sSlot;
+  uint8_t ucSlot;
+  bool bFound = false;
+  
+  for (ucSlot = 0; ucSlot < LOGGER_STATE_SLOTS; ++ucSlot)
+  {
+    if (NvStore_Load(NVSTORE_OFFS_LOGSTATE + ucSlot * LOGGER_STATE_PITCH,
+      &sSlot, sizeof(sSlot)))
+    {
+      if (!bFound || ((int16_t)(sSlot.uiSeq - sLoggerState.uiSeq) > 0))
+      {
+        sLoggerState = sSlot;
+        bFound = true;
+      }
+    }
+  }
+  return bFound;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Tage seit dem 01.01.2000 berechnen. Bis 2099 ist jedes vierte Jahr ein
+ * Schaltjahr.
+ *
+ * @param[in] ucYear    Jahr ab 2000
+ * @param[in] ucMonth   Monat 1 ... 12
+ * @param[in] ucDay     Tag 1 ... 31
+ * @return    uint16_t  Tage
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t Logger_MakeDay(uint8_t ucYear, uint8_t ucMonth, uint8_t ucDay)
+{
+  uint16_t uiDays;
+  
+  if ((ucMonth < 1) || (ucMonth > 12))
+  {
+    ucMonth = 1;
+  }
+  
+  uiDays = 365 * ucYear + (ucYear + 3) / 4
+    + auiLoggerMonthDays[ucMonth - 1] + ucDay - 1;
+  if (((ucYear & 0x03) == 0) && (ucMonth > 2))
+  {
+    ++uiDays;
+  }
+  return uiDays;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Namen der Tagesdatei bilden: LOG/JJMMTT.BIN bzw. .TXT
+ *
+ * @param[in] uiDay     Tage seit dem 01.01.2000
+ * @param[out] *pszName Dateiname, LOGGER_NAME_SIZE Zeichen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_MakeName(uint16_t uiDay, char* pszName)
+{
+  uint8_t ucYear = 0;
+  uint8_t ucMonth = 12;
+  uint16_t uiYearDays;
+  
+  for (;;)
+  {
+    uiYearDays = ((ucYear & 0x03) == 0) ? 366 : 365;
+    if (uiDay < uiYearDays)
+    {
+      break;
+    }
+    uiDay -= uiYearDays;
+    ++ucYear;
+  }
+  
+  while (Logger_MakeDay(ucYear, ucMonth, 1) > Logger_MakeDay(ucYear, 1, 1) + uiDay)
+  {
+    --ucMonth;
+  }
+  uiDay -= Logger_MakeDay(ucYear, ucMonth, 1) - Logger_MakeDay(ucYear, 1, 1);
+  
+  sprintf(pszName, LOGGER_DIR "/%02u%02u%02u.%s", (unsigned)ucYear,
+    (unsigned)ucMonth, (unsigned)(uiDay + 1), apszLoggerExt[sLoggerCfg.ucFormat]);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datei ffnen, dabei das Verzeichnis LOGGER_DIR anlegen, falls es fehlt
+ *
+ * @param[out] *pFile   Dateiobjekt
+ * @param[in] *pszName  Dateiname
+ * @param[in] ucMode    Modus wie f_open
+ * @return    FRESULT   Ergebnis von f_open
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static FRESULT Logger_OpenPath(FIL* pFile, const char* pszName, uint8_t ucMode)
+{
+  FRESULT eRes;
+  
+  eRes = f_open(pFile, pszName, ucMode);
+  if ((eRes == FR_NO_PATH) && ((ucMode & FA_OPEN_ALWAYS) != 0)
+    && (f_mkdir(LOGGER_DIR) == FR_OK))
+  {
+    eRes = f_open(pFile, pszName, ucMode);
+  }
+  return eRes;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Lnge des Dateikopfes vor dem ersten Eintrag
+ *
+ * @return    uint16_t  Lnge in Byte, 0 bei Textdateien, ein Sektor bei
+ *                      gepackten Dateien
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t Logger_GetHeadSize(void)
+{
+  if (sLoggerCfg.ucFormat == Logger_Format_PAK)
+  {
+    return LOGGER_SECTOR_SIZE;
+  }
+  if (sLoggerCfg.ucFormat != Logger_Format_BIN)
+  {
+    return 0;
+  }
+  return sizeof(Logger_FileHead) + sizeof(szLoggerSchema) - 1;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abstand der Stellen, an denen das Lesen einer Datei beginnen kann: ein
+ * Binrsatz bzw. ein Block der gepackten Datei
+ *
+ * @return    uint16_t  Abstand in Byte, 0 bei Textdateien (Zeilenende)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t Logger_GetStep(void)
+{
+  if (sLoggerCfg.ucFormat == Logger_Format_PAK)
+  {
+    return LOGGER_SECTOR_SIZE;
+  }
+  if (sLoggerCfg.ucFormat != Logger_Format_BIN)
+  {
+    return 0;
+  }
+  return sizeof(Logger_Record);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Indexeintrag lesen
+ *
+ * @param[in] *pFile    Geffnete Indexdatei
+ * @param[in] ulNum     Nummer des Eintrags
+ * @param[out] *pEntry  Eintrag
+ * @return    bool      true, wenn vollstndig gelesen
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Big Endian
+ ******************************************************************************/
+static bool Logger_ReadIndex(FIL* pFile, uint32_t ulNum, Logger_IndexEntry* pEntry)
+{
+  uint8_t aucEntry[sizeof(Logger_IndexEntry)];
+  UINT uiRead;
+  
+  if ((f_lseek(pFile, ulNum * sizeof(aucEntry)) != FR_OK)
+    || (f_read(pFile, aucEntry, sizeof(aucEntry), &uiRead) != FR_OK)
+    || (uiRead != sizeof(aucEntry)))
+  {
+    return false;
+  }
+  pEntry->ulTime = Logger_GetBe(&aucEntry[0], 4);
+  pEntry->ulOffs = Logger_GetBe(&aucEntry[4], 4);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeit des letzten Indexeintrags laden, nach dem Start und dem Wechsel des
+ * Formats
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_LoadIndex(void)
+{
+  FIL sIndex;
+  Logger_IndexEntry sEntry;
+  
+  ulLoggerIndexTime = 0;
+  if (f_open(&sIndex, apszLoggerIndex[sLoggerCfg.ucFormat],
+    FA_READ | FA_OPEN_EXISTING) == FR_OK)
+  {
+    if ((f_size(&sIndex) >= sizeof(sEntry))
+      && Logger_ReadIndex(&sIndex,
+           f_size(&sIndex) / sizeof(sEntry) - 1, &sEntry))
+    {
+      ulLoggerIndexTime = sEntry.ulTime;
+    }
+    f_close(&sIndex);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag an die Indexdatei anhngen, wenn er der erste seiner Stunde ist.
+ * Ein Fehler verlngert nur sptere Abfragen.
+ *
+ * @param[in] ulTime    Unix-Zeit des Eintrags
+ * @param[in] ulOffs    Position des Eintrags in der Tagesdatei
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Big Endian
+ ******************************************************************************/
+static void Logger_WriteIndex(uint32_t ulTime, uint32_t ulOffs)
+{
+  FIL sIndex;
+  uint8_t aucEntry[sizeof(Logger_IndexEntry)];
+  UINT uiWritten;
+  
+  if ((ulTime <= ulLoggerIndexTime)
+    || (ulTime / LOGGER_INDEX_STEP == ulLoggerIndexTime / LOGGER_INDEX_STEP))
+  {
+    return;
+  }
+  
+  if (Logger_OpenPath(&sIndex, apszLoggerIndex[sLoggerCfg.ucFormat],
+    FA_WRITE | FA_OPEN_APPEND) == FR_OK)
+  {
+    Logger_PutBe(&aucEntry[0], ulTime, 4);
+    Logger_PutBe(&aucEntry[4], ulOffs, 4);
+    if ((f_write(&sIndex, aucEntry, sizeof(aucEntry), &uiWritten) == FR_OK)
+      && (uiWritten == sizeof(aucEntry)))
+    {
+      ulLoggerIndexTime = ulTime;
+    }
+    f_close(&sIndex);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Im Index binr die letzte Stunde vor einem Zeitpunkt suchen
+ *
+ * @param[in] ulTime    Unix-Zeit
+ * @param[in] uiDay     Tag der Datei, in der gesucht wird
+ * @return    uint32_t  Position in der Tagesdatei, 0: kein Eintrag an
+ *                      diesem Tag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t Logger_FindIndex(uint32_t ulTime, uint16_t uiDay)
+{
+  FIL sIndex;
+  Logger_IndexEntry sEntry;
+  uint32_t ulLow = 0;
+  uint32_t ulHigh;
+  uint32_t ulMid;
+  uint32_t ulOffs = 0;
+  
+  if (f_open(&sIndex, apszLoggerIndex[sLoggerCfg.ucFormat],
+    FA_READ | FA_OPEN_EXISTING) != FR_OK)
+  {
+    return 0;
+  }
+  
+  ulHigh = f_size(&sIndex) / sizeof(sEntry);
+  while (ulLow < ulHigh)
+  {
+    ulMid = (ulLow + ulHigh) / 2;
+    if (!Logger_ReadIndex(&sIndex, ulMid, &sEntry))
+    {
+      break;
+    }
+    if (sEntry.ulTime <= ulTime)
+    {
+      ulOffs = (Logger_GetDay(sEntry.ulTime) == uiDay) ? sEntry.ulOffs : 0;
+      ulLow = ulMid + 1;
+    }
+    else
+    {
+      ulHigh = ulMid;
+    }
+  }
+  
+  f_close(&sIndex);
+  return ulOffs;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zwei- bis vierstellige Dezimalzahl lesen
+ *
+ * @param[in] *pcText   Ziffern
+ * @param[in] ucNum     Anzahl der Ziffern
+ * @return    uint16_t  Wert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t Logger_ParseNum(const char* pcText, uint8_t ucNum)
+{
+  uint16_t uiValue = 0;
+  
+  while (ucNum-- > 0)
+  {
+    uiValue = uiValue * 10 + (uint16_t)(*pcText++ - '0');
+  }
+  return uiValue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeit eines Eintrags und die Position des folgenden lesen. Textzeilen
+ * beginnen mit dem Zeitstempel JJJJ-MM-TTThh:mm:ssZ. In gepackten Dateien
+ * ist der Eintrag ein Block, die Zeit die seines ersten Satzes.
+ *
+ * @param[in] *pFile    Geffnete Tagesdatei
+ * @param[in] ulOffs    Position des Eintrags
+ * @param[out] *pulTime Unix-Zeit des Eintrags
+ * @param[out] *pulNext Position des folgenden Eintrags
+ * @return    bool      true, wenn ein Eintrag gelesen wurde
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Logger_ReadTime(FIL* pFile, uint32_t ulOffs, uint32_t* pulTime,
+  uint32_t* pulNext)
+{
+  char acBuf[LOGGER_CSV_STAMP];
+  uint8_t aucTime[4];
+  UINT uiRead;
+  UINT uiIdx;
+  
+  if (f_lseek(pFile, ulOffs) != FR_OK)
+  {
+    return false;
+  }
+  
+  if (Logger_GetStep() != 0)
+  {
+    if ((f_read(pFile, aucTime, sizeof(aucTime), &uiRead) != FR_OK)
+      || (uiRead != sizeof(aucTime)))
+    {
+      return false;
+    }
+    *pulTime = Logger_GetBe(aucTime, sizeof(aucTime));
+    *pulNext = ulOffs + Logger_GetStep();
+    return true;
+  }
+  
+  if ((f_read(pFile, acBuf, sizeof(acBuf), &uiRead) != FR_OK)
+    || (uiRead != sizeof(acBuf)))
+  {
+    return false;
+  }
+  *pulTime = 0;
+  if ((acBuf[4] == '-') && (acBuf[10] == 'T'))
+  {
+    *pulTime = LOGGER_EPOCH_2000
+      + Logger_MakeDay((uint8_t)(Logger_ParseNum(&acBuf[0], 4) - 2000),
+          (uint8_t)Logger_ParseNum(&acBuf[5], 2),
+          (uint8_t)Logger_ParseNum(&acBuf[8], 2)) * LOGGER_DAY_SECONDS
+      + Logger_ParseNum(&acBuf[11], 2) * 3600UL
+      + Logger_ParseNum(&acBuf[14], 2) * 60UL
+      + Logger_ParseNum(&acBuf[17], 2);
+  }
+  
+  /* Zeilenende suchen                                    */
+  for (;;)
+  {
+    for (uiIdx = 0; uiIdx < uiRead; ++uiIdx)
+    {
+      if (acBuf[uiIdx] == '\n')
+      {
+        *pulNext = ulOffs + uiIdx + 1;
+        return true;
+      }
+    }
+    ulOffs += uiRead;
+    if ((uiRead == 0)
+      || (f_read(pFile, acBuf, sizeof(acBuf), &uiRead) != FR_OK))
+    {
+      *pulNext = ulOffs;
+      return true;
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ab einer Position den ersten Eintrag suchen, der nicht lter als ein
+ * Zeitpunkt ist
+ *
+ * @param[in] *pFile    Geffnete Tagesdatei
+ * @param[in] ulOffs    Startposition, Anfang eines Eintrags
+ * @param[in] ulTime    Unix-Zeit
+ * @return    uint32_t  Position des Eintrags, Dateiende, wenn keiner folgt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t Logger_Seek(FIL* pFile, uint32_t ulOffs, uint32_t ulTime)
+{
+  uint32_t ulRecTime;
+  uint32_t ulNext;
+  
+  while ((ulOffs < f_size(pFile))
+    && Logger_ReadTime(pFile, ulOffs, &ulRecTime, &ulNext)
+    && (ulRecTime < ulTime))
+  {
+    ulOffs = ulNext;
+    Watchdog_Kick();
+  }
+  return (ulOffs < f_size(pFile)) ? ulOffs : f_size(pFile);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Position aus dem Index prfen: Sie muss im Bereich liegen, bei
+ * Binrdateien auf einem Satz- bzw. Blockanfang, und der Eintrag dort darf
+ * nicht jnger als der gesuchte Zeitpunkt sein
+ *
+ * @param[in] *pFile    Geffnete Tagesdatei
+ * @param[in] ulOffs    Position aus dem Index
+ * @param[in] ulTime    Gesuchte Unix-Zeit
+ * @param[in] ulLow     Kleinste Position, Ersatz bei ungltiger Position
+ * @return    uint32_t  Startposition fr Logger_Seek()
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t Logger_CheckHint(FIL* pFile, uint32_t ulOffs, uint32_t ulTime,
+  uint32_t ulLow)
+{
+  uint32_t ulRecTime;
+  uint32_t ulNext;
+  
+  if ((ulOffs <= ulLow) || (ulOffs >= f_size(pFile))
+    || ((Logger_GetStep() != 0)
+      && ((ulOffs - Logger_GetHeadSize()) % Logger_GetStep() != 0))
+    || !Logger_ReadTime(pFile, ulOffs, &ulRecTime, &ulNext)
+    || (ulRecTime > ulTime))
+  {
+    return ulLow;
+  }
+  return ulOffs;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Freier Platz im Puffer bis zum Sektorende der Datei
+ *
+ * @return    uint16_t  Byte ab Pufferanfang
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t Logger_GetCapacity(void)
+{
+  return LOGGER_SECTOR_SIZE
+    - (uint16_t)(sLoggerState.ulBase & (LOGGER_SECTOR_SIZE - 1));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gesicherte Position auf ein Eintragsende setzen, ab dem die Datei nicht
+ * mehr geprft werden muss
+ *
+ * @param[in] ulPos     Dateiposition
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_SetSafe(uint32_t ulPos)
+{
+  sLoggerState.ulSafe = ulPos;
+  sLoggerState.ulSafeEnd = ulPos;
+  sLoggerState.uiSafeCrc = LOGGER_CRC_INIT;
+  ulLoggerWritten = ulPos;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Dateiposition des Puffers aus der Dateigre bestimmen, falls noch nicht
+ * bekannt (nach dem Wechsel des Formats oder der Datei)
+ *
+ * @param[in] ulTime    Unix-Zeit des folgenden Eintrags
+ * @return    bool      true, wenn die Position bekannt ist
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Commit-Marke und gesicherte Position
+ * @date  19.10.2026  Zeit der Commit-Marke, Zustand sichern
+ ******************************************************************************/
+static bool Logger_FindBase(uint32_t ulTime)
+{
+  FILINFO fno;
+  FRESULT eRes;
+  
+  if (sLoggerState.ulBase != LOGGER_BASE_UNKNOWN)
+  {
+    return true;
+  }
+  
+  eRes = f_stat(szLoggerFile, &fno);
+  if (eRes == FR_OK)
+  {
+    sLoggerState.ulBase = fno.fsize;
+  }
+  else if ((eRes == FR_NO_FILE) || (eRes == FR_NO_PATH))
+  {
+    sLoggerState.ulBase = 0;
+  }
+  else
+  {
+    return false;
+  }
+  
+  sLoggerState.uiFill = 0;
+  sLoggerState.ulCommit = sLoggerState.ulBase;
+  sLoggerState.ulTime = ulTime;
+  Logger_SetSafe(sLoggerState.ulBase);
+  uiLoggerSynced = 0;
+  Logger_SaveState();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz im Puffer prfen: Er muss seine CRC-16 tragen, am Anfang der
+ * Datei muss davor der Kopf stehen. Die Zeit darf nicht vor der des
+ * vorherigen Satzes und nicht auerhalb des Tages der Datei liegen, damit
+ * Reste frherer Sektoren nicht als Satz gelten.
+ *
+ * @param[in] uiPos     Position im Puffer
+ * @param[in,out] *pulTime Zeit des vorherigen Satzes, danach dieses
+ * @return    uint16_t  Lnge des Satzes mit Kopf, 0: kein gltiger
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Big Endian
+ ******************************************************************************/
+static uint16_t Logger_CheckRecord(uint16_t uiPos, uint32_t* pulTime)
+{
+  const uint8_t* pucData = NvStore_GetPtr(NVSTORE_OFFS_LOGSTAGE) + uiPos;
+  uint16_t uiHead = 0;
+  uint16_t uiCrc;
+  uint32_t ulTime;
+  
+  /* Kopf vor dem ersten Satz der Datei                   */
+  if (sLoggerState.ulBase + uiPos == 0)
+  {
+    uiHead = Logger_GetHeadSize();
+    if ((memcmp(pucData, LOGGER_MAGIC, sizeof(LOGGER_MAGIC) - 1) != 0)
+      || (memcmp(pucData + sizeof(Logger_FileHead), szLoggerSchema,
+        sizeof(szLoggerSchema) - 1) != 0))
+    {
+      return 0;
+    }
+    pucData += uiHead;
+  }
+  
+  if (uiPos + uiHead + sizeof(Logger_Record) > Logger_GetCapacity())
+  {
+    return 0;
+  }
+  uiCrc = (uint16_t)Logger_GetBe(pucData + offsetof(Logger_Record, uiCrc),
+    sizeof(uiCrc));
+  ulTime = Logger_GetBe(pucData + offsetof(Logger_Record, ulTime),
+    sizeof(ulTime));
+  if ((Logger_Crc16(LOGGER_CRC_INIT, pucData,
+      sizeof(Logger_Record) - sizeof(uiCrc)) != uiCrc)
+    || (ulTime < *pulTime) || (Logger_GetDay(ulTime) != sLoggerState.uiDay))
+  {
+    return 0;
+  }
+  *pulTime = ulTime;
+  return uiHead + sizeof(Logger_Record);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Commit-Marke einer Binrdatei nach einem Reset bestimmen: Ab der
+ * gesicherten Marke werden die gltigen Stze im Puffer bis zum ersten
+ * ungltigen bernommen. Liegt die gesicherte Marke vor dem Puffer, wurde
+ * ein Satz ber die Sektorgrenze abgebrochen, Logger_Recover() krzt dann
+ * die Datei. Text- und gepackte Eintrge haben keine Prfsumme, ihr
+ * Zustand wird nach jedem Eintrag gesichert. Auerhalb eines Durchlaufs
+ * durch den Puffer gibt es nichts zu suchen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_ScanStage(void)
+{
+  uint16_t uiPos;
+  uint16_t uiLen;
+  
+  if ((sLoggerState.ulBase == LOGGER_BASE_UNKNOWN) || sLoggerState.bDirect
+    || (sLoggerCfg.ucFormat != Logger_Format_BIN)
+    || (sLoggerState.ulCommit < sLoggerState.ulBase)
+    || (sLoggerState.ulCommit - sLoggerState.ulBase > Logger_GetCapacity()))
+  {
+    return;
+  }
+  
+  uiPos = (uint16_t)(sLoggerState.ulCommit - sLoggerState.ulBase);
+  while ((uiPos < Logger_GetCapacity())
+    && ((uiLen = Logger_CheckRecord(uiPos, &sLoggerState.ulTime)) != 0))
+  {
+    uiPos += uiLen;
+  }
+  sLoggerState.uiFill = uiPos;
+  sLoggerState.ulCommit = sLoggerState.ulBase + uiPos;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Dateiobjekt ohne Schlieen aufgeben, nach einem Fehler oder wenn die Datei
+ * geleert bzw. umbenannt wurde. Ohne Dateisperre (FF_FS_LOCK) hlt FatFs
+ * dazu keinen Zustand.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_DropFile(void)
+{
+  bLoggerOpen = false;
+  bLoggerDirty = false;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ende der gerade geffneten Datei nach einem Reset oder abgebrochenen
+ * Eintrag zum Zustand passend machen: Daten hinter der Dateigre wieder
+ * eintragen, wenn ihre Prfsumme stimmt, und einen unvollstndigen Eintrag
+ * abschneiden. Passt die Datei nicht zum Zustand (Karte gewechselt), bleibt
+ * sie unverndert. Direkt geschriebene Eintrge stehen nur bis zur
+ * gesicherten Dateigre in der Datei, sie gilt dann als Ende.
+ *
+ * @return    bool      true, wenn erledigt, false bei einem Zugriffsfehler
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Direkt geschriebene Eintrge
+ ******************************************************************************/
+static bool Logger_Recover(void)
+{
+  uint8_t aucBuf[LOGGER_RECOVER_BUF];
+  uint32_t ulSize = f_size(&sLoggerFile);
+  uint32_t ulBase = sLoggerState.ulBase;
+  uint32_t ulEnd = ulBase + sLoggerState.uiFill;
+  uint32_t ulPos;
+  uint32_t ulCut;
+  uint16_t uiCrc = LOGGER_CRC_INIT;
+  UINT uiNum;
+  UINT uiRead;
+  
+  if ((ulBase == LOGGER_BASE_UNKNOWN) || (ulSize < sLoggerState.ulSafe)
+    || (sLoggerState.ulSafeEnd > sLoggerState.ulSafe)
+    || (sLoggerState.ulSafe > ulEnd) || (sLoggerState.ulCommit > ulEnd)
+    || ((sLoggerState.ulClust != 0)
+      && (sLoggerFile.obj.sclust != sLoggerState.ulClust)))
+  {
+    bLoggerRecover = false;
+    return true;
+  }
+  
+  /* Direkt geschrieben und mit f_sync gesichert          */
+  if (sLoggerState.bDirect && (ulSize > ulEnd))
+  {
+    sLoggerState.ulBase = ulSize;
+    sLoggerState.ulCommit = ulSize;
+    Logger_SetSafe(ulSize);
+    uiLoggerSynced = 0;
+    bLoggerPackValid = false;
+    bLoggerRecover = false;
+    Logger_SaveState();
+    return true;
+  }
+  
+  /* Bis zum Puffer verlngern, Cluster bleiben           */
+  if ((ulSize < ulBase)
+    && ((f_lseek(&sLoggerFile, ulBase) != FR_OK)
+      || (f_tell(&sLoggerFile) != ulBase)))
+  {
+    return false;
+  }
+  
+  /* Ungesicherten Teil mit der Prfsumme vergleichen     */
+  if (f_lseek(&sLoggerFile, sLoggerState.ulSafe) != FR_OK)
+  {
+    return false;
+  }
+  for (ulPos = sLoggerState.ulSafe; ulPos < ulBase; ulPos += uiNum)
+  {
+    uiNum = (ulBase - ulPos < sizeof(aucBuf))
+      ? (UINT)(ulBase - ulPos) : sizeof(aucBuf);
+    if (f_read(&sLoggerFile, aucBuf, uiNum, &uiRead) != FR_OK)
+    {
+      return false;
+    }
+    if (uiRead != uiNum)
+    {
+      break;
+    }
+    uiCrc = Logger_Crc16(uiCrc, aucBuf, (uint16_t)uiNum);
+  }
+  
+  if ((ulPos >= ulBase) && (uiCrc == sLoggerState.uiSafeCrc))
+  {
+    if (ulSize < ulBase)
+    {
+      sLoggerStats.ulRecovered += ulBase - ulSize;
+    }
+    ulCut = sLoggerState.ulCommit;
+  }
+  else
+  {
+    ulCut = sLoggerState.ulSafeEnd;
+  }
+  
+  if (ulCut < ulBase)
+  {
+    /* Datei auf ein Eintragsende krzen, Puffer leeren   */
+    if ((f_lseek(&sLoggerFile, ulCut) != FR_OK)
+      || (f_truncate(&sLoggerFile) != FR_OK))
+    {
+      return false;
+    }
+    sLoggerState.ulBase = ulCut;
+    sLoggerState.uiFill = 0;
+    sLoggerState.ulClust = 0;
+    sLoggerState.uiContig = 0;
+  }
+  else
+  {
+    /* Unvollstndigen Eintrag im Puffer verwerfen        */
+    sLoggerState.uiFill = (uint16_t)(ulCut - ulBase);
+  }
+  sLoggerStats.uiTruncated += (uint16_t)(ulEnd - ulCut);
+  sLoggerState.ulCommit = ulCut;
+  
+  if (f_sync(&sLoggerFile) != FR_OK)
+  {
+    return false;
+  }
+  if (ulCut <= ulBase)
+  {
+    Logger_SetSafe(ulCut);
+  }
+  uiLoggerSynced = 0;
+  bLoggerPackValid = false;
+  bLoggerRecover = false;
+  Logger_SaveState();
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Protokolldatei ffnen. Eine leere Binrdatei wird bei eingeschalteter
+ * Vorbelegung zusammenhngend angelegt und sofort gesichert. Passt eine
+ * vorbelegte Datei nicht zum Zustand (Karte gewechselt), wird sie normal
+ * weitergeschrieben. Nach einem Reset wird zuerst das Dateiende geprft.
+ *
+ * @return    bool      true, wenn geffnet
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Logger_Recover()
+ ******************************************************************************/
+static bool Logger_OpenFile(void)
+{
+  if ((Logger_OpenPath(&sLoggerFile, szLoggerFile,
+      FA_READ | FA_WRITE | FA_OPEN_ALWAYS) != FR_OK)
+    || (bLoggerRecover && !Logger_Recover()))
+  {
+    return false;
+  }
+  bLoggerOpen = true;
+  ++sLoggerStats.uiOpens;
+  
+  if ((sLoggerState.ulClust != 0)
+    && ((sLoggerFile.obj.sclust != sLoggerState.ulClust)
+      || (f_size(&sLoggerFile) > sLoggerState.ulBase + sLoggerState.uiFill)))
+  {
+    sLoggerState.ulClust = 0;
+    sLoggerState.uiContig = 0;
+  }
+  
+  if ((sLoggerState.ulClust == 0) && (sLoggerFile.obj.sclust == 0)
+    && (sLoggerCfg.uiPrealloc != 0)
+    && (sLoggerCfg.ucFormat == Logger_Format_BIN)
+    && (f_expand(&sLoggerFile,
+          (FSIZE_t)sLoggerCfg.uiPrealloc * 1024, 1) == FR_OK))
+  {
+    /* Cluster sichern, Gre bleibt zunchst 0           */
+    sLoggerFile.obj.objsize = 0;
+    if (f_sync(&sLoggerFile) == FR_OK)
+    {
+      sLoggerState.ulClust = sLoggerFile.obj.sclust;
+      sLoggerState.uiContig = sLoggerCfg.uiPrealloc
+        * (1024 / LOGGER_SECTOR_SIZE);
+      sLoggerState.ulCommit -= sLoggerState.ulBase;
+      sLoggerState.ulBase = 0;
+      Logger_SetSafe(0);
+      uiLoggerSynced = 0;
+    }
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ausstehende Reparatur des Dateiendes ausfhren. Nur zwischen zwei
+ * Eintrgen aufrufen, damit kein angefangener Eintrag im Puffer als
+ * abgebrochen gilt. Gelingt sie nicht, wird sie beim nchsten Aufruf
+ * wiederholt, bis dahin wird nichts geschrieben.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_CheckRecover(void)
+{
+  if (bLoggerRecover && !Logger_OpenFile())
+  {
+    Logger_DropFile();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Puffer direkt in seinen Sektor der vorbelegten Datei schreiben. Der Rest
+ * des Sektors hinter uiFill ist ungltig und liegt hinter der Dateigre.
+ *
+ * @return    bool      true, wenn erfolgreich geschrieben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Logger_WriteDirect(void)
+{
+  FATFS* pFs = sLoggerFile.obj.fs;
+  LBA_t ulSect;
+  
+  /* Karte seit dem ffnen neu eingebunden?               */
+  if ((sLoggerFile.obj.id != pFs->id)
+    || ((disk_status(pFs->pdrv) & STA_NOINIT) != 0))
+  {
+    return false;
+  }
+  
+  ulSect = pFs->database + (LBA_t)pFs->csize * (sLoggerState.ulClust - 2)
+    + sLoggerState.ulBase / LOGGER_SECTOR_SIZE;
+  if (disk_write(pFs->pdrv, NvStore_GetPtr(NVSTORE_OFFS_LOGSTAGE),
+    ulSect, 1) != RES_OK)
+  {
+    return false;
+  }
+  
+  /* Veraltete Kopie im Fenster von FatFs verwerfen       */
+  if (pFs->winsect == ulSect)
+  {
+    pFs->winsect = (LBA_t)0 - 1;
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Daten ab ulBase in die geffnete Datei schreiben, die Datei dazu bei
+ * Bedarf ffnen. Das ist der Puffer oder, ohne Puffer, ein Stck eines
+ * Eintrags. Ein Puffer ab einer Sektorgrenze der Vorbelegung geht direkt an
+ * seine Sektoradresse, alles andere mit f_write; in einer vorbelegten Datei
+ * wird die Gre dazu bis ulBase nachgezogen. Passt die Datei nicht zum
+ * Puffer (Karte gewechselt), wird am Dateiende angehngt; eine gepackte
+ * Datei setzt dann mit einem neuen Block fort.
+ *
+ * @param[in] *pucData  Puffer im EEPROM oder Eintrag
+ * @param[in] uiLen     Lnge in Byte
+ * @return    bool      true, wenn erfolgreich geschrieben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Commit-Marke und gesicherte Position verschieben
+ * @date  19.10.2026  Daten als Parameter
+ * @date  19.10.2026  Vorbelegung bleibt ohne Puffer erhalten
+ ******************************************************************************/
+static bool Logger_WriteFile(const uint8_t* pucData, uint16_t uiLen)
+{
+  UINT uiWritten;
+  
+  if (!bLoggerOpen && !Logger_OpenFile())
+  {
+    return false;
+  }
+  
+  if (sLoggerState.ulClust != 0)
+  {
+    if (!sLoggerState.bDirect
+      && ((sLoggerState.ulBase & (LOGGER_SECTOR_SIZE - 1)) == 0)
+      && (sLoggerState.ulBase / LOGGER_SECTOR_SIZE < sLoggerState.uiContig))
+    {
+      return Logger_WriteDirect();
+    }
+    
+    /* Gre bis zu den direkt geschriebenen Sektoren     */
+    if ((f_size(&sLoggerFile) < sLoggerState.ulBase)
+      && ((f_lseek(&sLoggerFile, sLoggerState.ulBase) != FR_OK)
+        || (f_tell(&sLoggerFile) != sLoggerState.ulBase)))
+    {
+      return false;
+    }
+    if (sLoggerState.ulBase / LOGGER_SECTOR_SIZE >= sLoggerState.uiContig)
+    {
+      /* Vorbelegung voll, normal weiter                  */
+      sLoggerState.ulClust = 0;
+      sLoggerState.uiContig = 0;
+    }
+  }
+  
+  if ((f_size(&sLoggerFile) < sLoggerState.ulBase)
+    || (f_size(&sLoggerFile) > sLoggerState.ulBase + sLoggerState.uiFill))
+  {
+    sLoggerState.ulCommit += f_size(&sLoggerFile) - sLoggerState.ulBase;
+    sLoggerState.ulBase = f_size(&sLoggerFile);
+    Logger_SetSafe(sLoggerState.ulBase);
+    uiLoggerSynced = 0;
+    bLoggerPackValid = false;
+  }
+  
+  return (f_lseek(&sLoggerFile, sLoggerState.ulBase) == FR_OK)
+    && (f_write(&sLoggerFile, pucData, uiLen, &uiWritten) == FR_OK)
+    && (uiWritten == uiLen);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Dateigre und Cluster im Verzeichnis sichern (f_sync). Bei einer
+ * vorbelegten Datei wird die Gre vorher auf das Ende der geschriebenen
+ * Daten gesetzt. Das Ende der geschriebenen Daten wird die neue gesicherte
+ * Position.
+ *
+ * @return    bool      true, wenn erfolgreich gesichert
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Gesicherte Position
+ ******************************************************************************/
+static bool Logger_Sync(void)
+{
+  uint32_t ulEnd = sLoggerState.ulBase + uiLoggerSynced;
+  
+  if (!bLoggerDirty)
+  {
+    return true;
+  }
+  
+  if (((sLoggerState.ulClust != 0) && (f_size(&sLoggerFile) < ulEnd)
+      && (f_lseek(&sLoggerFile, ulEnd) != FR_OK))
+    || (f_sync(&sLoggerFile) != FR_OK))
+  {
+    Logger_DropFile();
+    return false;
+  }
+  bLoggerDirty = false;
+  ++sLoggerStats.uiSyncs;
+  
+  sLoggerState.ulSafe = ulEnd;
+  sLoggerState.ulSafeEnd = ulLoggerWritten;
+  sLoggerState.uiSafeCrc = LOGGER_CRC_INIT;
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Puffer steht auf der Karte, er beginnt hinter seinem Inhalt neu. Die Byte
+ * ab der gesicherten Position gehen in deren Prfsumme ein.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_NextBase(void)
+{
+  uint16_t uiFrom = 0;
+  
+  if (sLoggerState.ulSafe > sLoggerState.ulBase)
+  {
+    uiFrom = (uint16_t)(sLoggerState.ulSafe - sLoggerState.ulBase);
+  }
+  if (uiFrom < sLoggerState.uiFill)
+  {
+    sLoggerState.uiSafeCrc = Logger_Crc16(sLoggerState.uiSafeCrc,
+      NvStore_GetPtr(NVSTORE_OFFS_LOGSTAGE) + uiFrom,
+      sLoggerState.uiFill - uiFrom);
+  }
+  sLoggerState.ulBase += sLoggerState.uiFill;
+  sLoggerState.uiFill = 0;
+  uiLoggerSynced = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Puffer an seine Position in der Datei schreiben. Ist der Sektor voll,
+ * beginnt der Puffer danach mit dem nchsten Sektor, der volle Sektor geht
+ * ab der gesicherten Position in deren Prfsumme ein. Bei einem Fehler wird
+ * die Datei einmal neu geffnet. Solange das Dateiende repariert werden
+ * muss, wird nicht geschrieben.
+ *
+ * @return    bool      true, wenn erfolgreich geschrieben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Prfsumme ab der gesicherten Position
+ * @date  19.10.2026  Logger_NextBase()
+ * @date  19.10.2026  Sektor ab der Mitte vor dem Zustand sichern
+ ******************************************************************************/
+static bool Logger_WriteStage(void)
+{
+  const uint8_t* pucStage = NvStore_GetPtr(NVSTORE_OFFS_LOGSTAGE);
+  bool bOk;
+  
+  if (sLoggerState.uiFill == uiLoggerSynced)
+  {
+    return true;
+  }
+  if (bLoggerRecover)
+  {
+    return false;
+  }
+  
+  bOk = Logger_WriteFile(pucStage, sLoggerState.uiFill);
+  if (!bOk && bLoggerOpen)
+  {
+    Logger_DropFile();
+    bOk = Logger_WriteFile(pucStage, sLoggerState.uiFill);
+  }
+  if (!bOk)
+  {
+    Logger_DropFile();
+    return false;
+  }
+  ulLoggerWritten = sLoggerState.ulCommit;
+  
+  if (!bLoggerDirty)
+  {
+    bLoggerDirty = true;
+    uiLoggerSyncSec = Sched_GetSeconds();
+  }
+  
+  if (sLoggerState.uiFill >= Logger_GetCapacity())
+  {
+    /* Ab der Sektormitte steht der Sektor nur im         */
+    /* Fenster von FatFs: vor dem Zustand sichern         */
+    if (Logger_GetCapacity() != LOGGER_SECTOR_SIZE)
+    {
+      uiLoggerSynced = sLoggerState.uiFill;
+      if (!Logger_Sync())
+      {
+        uiLoggerSynced = 0;
+        return false;
+      }
+    }
+    
+    /* Sektor vollstndig, Puffer beginnt neu             */
+    Logger_NextBase();
+    ++sLoggerStats.uiSectors;
+  }
+  else
+  {
+    ++sLoggerStats.uiPartial;
+    uiLoggerSynced = sLoggerState.uiFill;
+  }
+  Logger_SaveState();
+  
+  if (sLoggerCfg.uiSyncAge == 0)
+  {
+    bOk = Logger_Sync();
+  }
+  return bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Daten ohne Puffer an die Datei anhngen. Sie gehen in die Prfsumme ab
+ * der gesicherten Position ein, die Dateigre wird wie beim Puffer nach
+ * <syncage> gesichert. Bei einem Fehler wird die Datei einmal neu geffnet.
+ *
+ * @param[in] *pucData  Daten
+ * @param[in] uiLen     Lnge in Byte
+ * @return    bool      true, wenn erfolgreich geschrieben
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Logger_WriteThrough(const uint8_t* pucData, uint16_t uiLen)
+{
+  bool bOk;
+  
+  if (bLoggerRecover)
+  {
+    return false;
+  }
+  
+  bOk = Logger_WriteFile(pucData, uiLen);
+  if (!bOk && bLoggerOpen)
+  {
+    Logger_DropFile();
+    bOk = Logger_WriteFile(pucData, uiLen);
+  }
+  if (!bOk)
+  {
+    Logger_DropFile();
+    return false;
+  }
+  
+  sLoggerState.uiSafeCrc = Logger_Crc16(sLoggerState.uiSafeCrc, pucData, uiLen);
+  sLoggerState.ulBase += uiLen;
+  if (!bLoggerDirty)
+  {
+    bLoggerDirty = true;
+    uiLoggerSyncSec = Sched_GetSeconds();
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Daten an den Puffer anhngen, volle Sektoren dabei schreiben. Auerhalb
+ * eines Durchlaufs durch den Puffer gehen sie direkt in die Datei.
+ *
+ * @param[in] *pData    Daten
+ * @param[in] uiLen     Lnge in Byte
+ * @return    bool      true, wenn vollstndig im Puffer bzw. geschrieben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Ohne Puffer direkt in die Datei
+ ******************************************************************************/
+static bool Logger_Stage(const void* pData, uint16_t uiLen)
+{
+  const uint8_t* pucData = (const uint8_t*)pData;
+  uint16_t uiNum;
+  
+  if (sLoggerState.bDirect)
+  {
+    return Logger_WriteThrough(pucData, uiLen);
+  }
+  
+  while (uiLen > 0)
+  {
+    if ((sLoggerState.uiFill >= Logger_GetCapacity()) && !Logger_WriteStage())
+    {
+      return false;
+    }
+    
+    uiNum = Logger_GetCapacity() - sLoggerState.uiFill;
+    if (uiNum > uiLen)
+    {
+      uiNum = uiLen;
+    }
+    if (!NvStore_Write(NVSTORE_OFFS_LOGSTAGE + sLoggerState.uiFill, pucData, uiNum))
+    {
+      return false;
+    }
+    
+    if (sLoggerState.uiFill == uiLoggerSynced)
+    {
+      uiLoggerStageSec = Sched_GetSeconds();
+    }
+    sLoggerState.uiFill += uiNum;
+    pucData += uiNum;
+    uiLen -= uiNum;
+  }
+  
+  /* Voller Sektor sofort, Fehler beim nchsten Mal       */
+  if (sLoggerState.uiFill >= Logger_GetCapacity())
+  {
+    Logger_WriteStage();
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Vor einem Eintrag bei leerem Puffer entscheiden, ob die folgenden
+ * Eintrge den Puffer durchlaufen. Ein Durchlauf beginnt frhestens
+ * LOGGER_STAGE_PERIOD s nach dem letzten, bis dahin gehen die Eintrge
+ * direkt in die Datei. Gepackte Eintrge gehen immer direkt in die Datei,
+ * ihr Wiederholungszhler wrde sonst bei jedem Eintrag ein Wort des
+ * EEPROM programmieren. Ein Wechsel wird sofort gesichert.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_SelectPass(void)
+{
+  bool bDirect;
+  
+  if (sLoggerState.uiFill != 0)
+  {
+    return;
+  }
+  
+  bDirect = (sLoggerCfg.ucFormat == Logger_Format_PAK)
+    || ((uint16_t)(Sched_GetSeconds() - uiLoggerPassSec) < LOGGER_STAGE_PERIOD);
+  if (!bDirect)
+  {
+    uiLoggerPassSec = Sched_GetSeconds();
+  }
+  if (bDirect != sLoggerState.bDirect)
+  {
+    sLoggerState.bDirect = bDirect;
+    Logger_SaveState();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ein Eintrag hat den Puffer ber das Sektorende hinaus gefllt. Darf noch
+ * kein neuer Durchlauf beginnen, wird der Rest des Eintrags im Puffer
+ * geschrieben und die folgenden Eintrge gehen direkt in die Datei. Sonst
+ * beginnt mit dem neuen Sektor der nchste Durchlauf. Die Commit-Marke
+ * liegt danach im neuen Sektor und wird in beiden Fllen gesichert.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Logger_EndPass(void)
+{
+  if ((sLoggerCfg.ucFormat != Logger_Format_PAK)
+    && ((uint16_t)(Sched_GetSeconds() - uiLoggerPassSec) >= LOGGER_STAGE_PERIOD))
+  {
+    uiLoggerPassSec = Sched_GetSeconds();
+  }
+  else
+  {
+    /* Bei einem Fehler luft der Puffer weiter           */
+    Logger_WriteStage();
+    if (sLoggerState.uiFill == uiLoggerSynced)
+    {
+      Logger_NextBase();
+      sLoggerState.bDirect = true;
+    }
+  }
+  Logger_SaveState();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Dateikopf und Feldliste anhngen, wenn die Datei leer ist
+ *
+ * @param[in] *pcMagic  Kennung des Formats, 4 Zeichen
+ * @return    bool      true, wenn vollstndig im Puffer oder nicht ntig
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Big Endian
+ ******************************************************************************/
+static bool Logger_WriteHead(const char* pcMagic)
+{
+  uint8_t aucHead[sizeof(Logger_FileHead)];
+  
+  if ((sLoggerState.ulBase != 0) || (sLoggerState.uiFill != 0))
+  {
+    return true;
+  }
+  
+  memcpy(&aucHead[offsetof(Logger_FileHead, acMagic)], pcMagic, 4);
+  aucHead[offsetof(Logger_FileHead, ucVersion)] = LOGGER_VERSION;
+  aucHead[offsetof(Logger_FileHead, ucRecSize)] = sizeof(Logger_Record);
+  Logger_PutBe(&aucHead[offsetof(Logger_FileHead, uiSchemaLen)],
+    sizeof(szLoggerSchema) - 1, 2);
+  return Logger_Stage(aucHead, sizeof(aucHead))
+    && Logger_Stage(szLoggerSchema, sizeof(szLoggerSchema) - 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag als Binrsatz anhngen, in eine leere Datei vorher den Kopf
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @return    bool      true, wenn vollstndig im Puffer
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Kopf in Logger_WriteHead()
+ * @date  19.10.2026  Big Endian
+ ******************************************************************************/
+static bool Logger_WriteBin(const SensorLogItem* pLog)
+{
+  Logger_Record sRec;
+  uint8_t aucRec[sizeof(Logger_Record)];
+  
+  if (!Logger_WriteHead(LOGGER_MAGIC))
+  {
+    return false;
+  }
+  
+  PROFILE_BEGIN(Profiler_Zone_CSV);
+  Logger_BuildRecord(pLog, &sRec);
+  Logger_EncodeRecord(&sRec, aucRec);
+  PROFILE_END(Profiler_Zone_CSV);
+  
+  return Logger_Stage(aucRec, sizeof(aucRec));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Differenz eines Feldes zum Vorgnger bilden, bei der Zeit die nderung
+ * des Abstands. Die Differenz wird auf die Breite des Feldes gekrzt und
+ * im Zickzack-Format abgelegt (0, -1, 1, -2 ... als 0, 1, 2, 3 ...), damit
+ * kleine nderungen beider Richtungen wenige Byte ergeben.
+ *
+ * @param[in] *pRec     Neuer Satz
+ * @param[in] *pPrev    Vorgnger
+ * @param[in] lStep     Zeitabstand des Vorgngers zu seinem Vorgnger in s
+ * @param[in] ucField   Nummer des Feldes in der Feldliste
+ * @return    uint32_t  Differenz im Zickzack-Format, 0: unverndert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t Logger_PackField(const Logger_Record* pRec,
+  const Logger_Record* pPrev, int32_t lStep, uint8_t ucField)
+{
+  const uint8_t* pucNew = (const uint8_t*)pRec + aucLoggerPackOffs[ucField];
+  const uint8_t* pucOld = (const uint8_t*)pPrev + aucLoggerPackOffs[ucField];
+  uint32_t ulDelta;
+  
+  switch (aucLoggerPackOffs[ucField + 1] - aucLoggerPackOffs[ucField])
+  {
+    case 1:
+      ulDelta = (uint32_t)(int32_t)(int8_t)(uint8_t)(*pucNew - *pucOld);
+      break;
+    
+    case 2:
+      ulDelta = (uint32_t)(int32_t)(int16_t)(uint16_t)
+        (*(const uint16_t*)pucNew - *(const uint16_t*)pucOld);
+      break;
+    
+    default:
+      ulDelta = *(const uint32_t*)pucNew - *(const uint32_t*)pucOld;
+      if (ucField == 0)
+      {
+        ulDelta -= (uint32_t)lStep;
+      }
+  }
+  
+  return (ulDelta << 1) ^ (((ulDelta & 0x80000000UL) != 0) ? 0xFFFFFFFFUL : 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zahl als Varint ablegen: 7 Bit je Byte, niederwertige zuerst, Bit 7
+ * gesetzt, wenn ein weiteres Byte folgt
+ *
+ * @param[in] ulValue   Zahl
+ * @param[out] *pucBuf  Puffer, LOGGER_VARINT_MAX Byte
+ * @return    uint8_t   Lnge in Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t Logger_PackVarint(uint32_t ulValue, uint8_t* pucBuf)
+{
+  uint8_t ucLen = 0;
+  
+  while (ulValue >= 0x80)
+  {
+    pucBuf[ucLen++] = (uint8_t)ulValue | 0x80;
+    ulValue >>= 7;
+  }
+  pucBuf[ucLen++] = (uint8_t)ulValue;
+  return ucLen;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Angefangenen Block abschlieen: Ende-Kennung, soweit sie in den Sektor
+ * passt, dann den Rest des Sektors mit Nullen fllen. Der Rest ist
+ * ungltig, wird aber geschrieben, damit die Prfsumme ab der gesicherten
+ * Position ber bekannte Daten luft.
+ *
+ * @return    bool      true, wenn geschrieben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Auffllen ohne Puffer
+ ******************************************************************************/
+static bool Logger_PackClose(void)
+{
+  uint8_t aucFill[LOGGER_PACK_FILL];
+  uint16_t uiRest;
+  uint16_t uiNum;
+  
+  memset(aucFill, 0, sizeof(aucFill));
+  uiRest = (uint16_t)(LOGGER_SECTOR_SIZE - ((sLoggerState.ulBase
+    + sLoggerState.uiFill) & (LOGGER_SECTOR_SIZE - 1)))
+    & (LOGGER_SECTOR_SIZE - 1);
+  while (uiRest > 0)
+  {
+    uiNum = (uiRest < sizeof(aucFill)) ? uiRest : sizeof(aucFill);
+    if (!Logger_Stage(aucFill, uiNum))
+    {
+      return false;
+    }
+    uiRest -= uiNum;
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Unvernderten Eintrag zhlen: Der Zhler der letzten Wiederholung wird in
+ * der Datei erhht. Er liegt vor der gesicherten Position, die Prfsumme
+ * der danach geschriebenen Daten bleibt gltig. Bis zum nchsten f_sync
+ * steht er nur im Fenster von FatFs, nach einem Reset fehlt dann hchstens
+ * die Wiederholung.
+ *
+ * @return    bool      true, wenn geschrieben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Zhler in der Datei statt im Puffer
+ ******************************************************************************/
+static bool Logger_PackCount(void)
+{
+  uint8_t ucCount = ucLoggerPackCount + 1;
+  UINT uiWritten;
+  
+  if ((f_lseek(&sLoggerFile, ulLoggerPackRun) != FR_OK)
+    || (f_write(&sLoggerFile, &ucCount, sizeof(ucCount), &uiWritten) != FR_OK)
+    || (uiWritten != sizeof(ucCount)))
+  {
+    Logger_DropFile();
+    return false;
+  }
+  ucLoggerPackCount = ucCount;
+  
+  if (!bLoggerDirty)
+  {
+    bLoggerDirty = true;
+    uiLoggerSyncSec = Sched_GetSeconds();
+  }
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag gepackt anhngen. Er kommt als Differenz in den laufenden Block,
+ * als Zhler in die letzte Wiederholung oder, wenn der Sektor voll ist oder
+ * der Vorgnger fehlt, als vollstndiger Satz in einen neuen Block. In eine
+ * leere Datei kommt vorher der Kopf, aufgefllt auf einen Sektor.
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @return    bool      true, wenn vollstndig im Puffer
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Logger_WritePack(const SensorLogItem* pLog)
+{
+  Logger_Record sRec;
+  uint8_t aucRec[sizeof(Logger_Record)];
+  uint8_t aucVar[LOGGER_VARINT_MAX];
+  uint32_t ulMask;
+  uint8_t ucLen;
+  uint8_t ucField;
+  bool bOpen;
+  bool bOk = true;
+  
+  if ((sLoggerState.ulBase == 0) && (sLoggerState.uiFill == 0))
+  {
+    bLoggerPackValid = false;
+    if (!Logger_WriteHead(LOGGER_PACK_MAGIC))
+    {
+      return false;
+    }
+  }
+  
+  PROFILE_BEGIN(Profiler_Zone_CSV);
+  Logger_BuildRecord(pLog, &sRec);
+  ucLen = Logger_GetPackSize(&sRec, &sLoggerPackPrev, lLoggerPackStep, &ulMask);
+  PROFILE_END(Profiler_Zone_CSV);
+  
+  bOpen = bLoggerPackValid && (((sLoggerState.ulBase + sLoggerState.uiFill)
+    & (LOGGER_SECTOR_SIZE - 1)) != 0);
+  if (ucLen == 0)
+  {
+    ucLen = sizeof(aucLoggerPackRun);
+  }
+  
+  if (bOpen && (ulMask == 0) && bLoggerOpen && (ulLoggerPackRun != 0)
+    && (ulLoggerPackRun < sLoggerState.ulSafe) && (ucLoggerPackCount < 0xFF))
+  {
+    /* Letzte Wiederholung verlngern                     */
+    bOk = Logger_PackCount();
+  }
+  else if (bOpen && (ucLen <= Logger_GetCapacity() - sLoggerState.uiFill))
+  {
+    if (ulMask == 0)
+    {
+      /* Neue Wiederholung                                */
+      bOk = Logger_Stage(aucLoggerPackRun, sizeof(aucLoggerPackRun));
+      ulLoggerPackRun = sLoggerState.ulBase + sLoggerState.uiFill - 1;
+      ucLoggerPackCount = aucLoggerPackRun[1];
+    }
+    else
+    {
+      /* Maske, dann die genderten Felder                */
+      bOk = Logger_Stage(aucVar, Logger_PackVarint(ulMask, aucVar));
+      for (ucField = 0; bOk && (ulMask != 0); ++ucField, ulMask >>= 1)
+      {
+        if ((ulMask & 0x01) != 0)
+        {
+          bOk = Logger_Stage(aucVar, Logger_PackVarint(Logger_PackField(&sRec,
+            &sLoggerPackPrev, lLoggerPackStep, ucField), aucVar));
+        }
+      }
+      ulLoggerPackRun = 0;
+    }
+    lLoggerPackStep = (int32_t)(sRec.ulTime - sLoggerPackPrev.ulTime);
+  }
+  else
+  {
+    /* Neuer Block mit vollstndigem Satz                 */
+    Logger_EncodeRecord(&sRec, aucRec);
+    bOk = Logger_PackClose() && Logger_Stage(aucRec, sizeof(aucRec));
+    lLoggerPackStep = 0;
+    ulLoggerPackRun = 0;
+  }
+  
+  if (bOk)
+  {
+    sLoggerPackPrev = sRec;
+  }
+  bLoggerPackValid = bOk;
+  return bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag als Textzeile anhngen, in einem Stck in acLoggerLine formatiert.
+ * Die Zeile geht mit einem Aufruf in den Puffer, jedes Wort des EEPROMs
+ * wird dabei nur einmal programmiert.
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @return    bool      true, wenn vollstndig im Puffer
+ *
+ * @date  19.10.2026  Logger_FormatCsv() statt sprintf()
+ * @date  19.10.2026  Statischer Zeilenpuffer statt Stack
+ ******************************************************************************/
+static bool Logger_WriteCsv(const SensorLogItem* pLog)
+{
+  uint8_t ucLen;
+  
+  PROFILE_BEGIN(Profiler_Zone_CSV);
+  ucLen = Logger_FormatCsv(pLog, acLoggerLine);
+  PROFILE_END(Profiler_Zone_CSV);
+  
+  return Logger_Stage(acLoggerLine, ucLen);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Einstellungen und Zustand des Schreibpuffers aus dem EEPROM laden. Ohne
+ * gltigen Zustand gilt die Tagesdatei der Echtzeituhr, sonst wird deren
+ * Ende beim ersten ffnen geprft.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Wiederherstellung beim ersten ffnen
+ * @date  19.10.2026  Commit-Marke aus dem Puffer
+ * @date  19.10.2026  Erster Durchlauf durch den Puffer
+ ******************************************************************************/
+void Logger_Init(void)
+{
+  RTC_DateTypeDef sDate;
+  
+  memset(&sLoggerStats, 0, sizeof(sLoggerStats));
+  if (!NvStore_Load(NVSTORE_OFFS_LOGGER, &sLoggerCfg, sizeof(sLoggerCfg))
+    || (sLoggerCfg.ucFormat >= Logger_Format_NUM)
+    || (sLoggerCfg.uiMaxFill == 0)
+    || (sLoggerCfg.uiMaxFill > LOGGER_SECTOR_SIZE)
+    || (sLoggerCfg.uiPrealloc > LOGGER_PREALLOC_MAX))
+  {
+    sLoggerCfg.ucFormat = LOGGER_DEFAULT_FORMAT;
+    sLoggerCfg.uiMaxAge = LOGGER_DEFAULT_MAXAGE;
+    sLoggerCfg.uiMaxFill = LOGGER_DEFAULT_MAXFILL;
+    sLoggerCfg.uiSyncAge = LOGGER_DEFAULT_SYNCAGE;
+    sLoggerCfg.uiPrealloc = LOGGER_DEFAULT_PREALLOC;
+  }
+  
+  Logger_DropFile();
+  uiLoggerSynced = 0;
+  uiLoggerStageSec = Sched_GetSeconds();
+  uiLoggerPassSec = Sched_GetSeconds();
+  bLoggerPackValid = false;
+  if (!Logger_LoadState()
+    || (sLoggerState.ucFormat != sLoggerCfg.ucFormat)
+    || (sLoggerState.uiFill > LOGGER_SECTOR_SIZE))
+  {
+    RTC_GetDate(RTC_Format_BIN, &sDate);
+    sLoggerState.uiDay = Logger_MakeDay(sDate.RTC_Year,
+      (uint8_t)sDate.RTC_Month, sDate.RTC_Date);
+    Logger_Discard();
+  }
+  Logger_ScanStage();
+  bLoggerRecover = (sLoggerState.ulBase != LOGGER_BASE_UNKNOWN);
+  ulLoggerWritten = sLoggerState.ulSafeEnd;
+  Logger_MakeName(sLoggerState.uiDay, szLoggerFile);
+  Logger_LoadIndex();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag des Ringspeichers im eingestellten Format an den Schreibpuffer
+ * der Datei seines Tages anhngen und den ersten Eintrag jeder Stunde im
+ * Index vermerken. Der angefangene Sektor wird geschrieben, wenn die
+ * ungeschriebenen Daten zu alt oder zu viele sind, das Verzeichnis nach der
+ * eingestellten Zeit gesichert. Ein Eintrag, der nicht vollstndig in den
+ * Puffer passt, wird verworfen. Erst danach wird die Commit-Marke gesetzt.
+ * Binrstze tragen eine Prfsumme, ihr Zustand wird nur ber eine
+ * Sektorgrenze gesichert, sonst findet Logger_ScanStage() die Marke nach
+ * einem Reset. Auerhalb eines Durchlaufs durch den Puffer geht der Eintrag
+ * direkt in die Datei (Logger_SelectPass()), gesichert wird dann nach einem
+ * vollendeten Sektor. Vorher wird ein nach einem Reset noch ungeprftes
+ * Dateiende repariert.
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @return    bool      true, wenn erfolgreich gepuffert oder geschrieben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Commit-Marke
+ * @date  19.10.2026  Zustand nicht mehr bei jedem Eintrag sichern
+ * @date  19.10.2026  Durchlufe durch den Puffer begrenzen
+ * @date  19.10.2026  Ohne Puffer je Sektor sichern
+ ******************************************************************************/
+bool Logger_Append(const SensorLogItem* pLog)
+{
+  uint32_t ulTime = Logger_GetTime(pLog);
+  uint16_t uiDay = Logger_GetDay(ulTime);
+  uint32_t ulBase;
+  uint32_t ulOffs;
+  uint16_t uiFill;
+  bool bCross;
+  bool bSector;
+  bool bOk;
+  
+  /* Tageswechsel, alte Datei abschlieen                 */
+  if (uiDay != sLoggerState.uiDay)
+  {
+    Logger_Close();
+    sLoggerState.uiDay = uiDay;
+    Logger_MakeName(uiDay, szLoggerFile);
+    Logger_Discard();
+  }
+  
+  if (!Logger_FindBase(ulTime))
+  {
+    ++sLoggerStats.uiLost;
+    return false;
+  }
+  Logger_CheckRecover();
+  Logger_SelectPass();
+  
+  ulBase = sLoggerState.ulBase;
+  uiFill = sLoggerState.uiFill;
+  ulOffs = ulBase + uiFill;
+  if (ulOffs == 0)
+  {
+    ulOffs = Logger_GetHeadSize();
+  }
+  if (sLoggerCfg.ucFormat == Logger_Format_BIN)
+  {
+    bOk = Logger_WriteBin(pLog);
+  }
+  else if (sLoggerCfg.ucFormat == Logger_Format_PAK)
+  {
+    bOk = Logger_WritePack(pLog);
+    
+    /* Index zeigt auf den Anfang des Blocks              */
+    ulOffs = (sLoggerState.ulBase + sLoggerState.uiFill - 1)
+      & ~(uint32_t)(LOGGER_SECTOR_SIZE - 1);
+  }
+  else
+  {
+    bOk = Logger_WriteCsv(pLog);
+  }
+  
+  if (!bOk)
+  {
+    /* Angefangenen Eintrag zurcknehmen                  */
+    if (sLoggerState.ulBase == ulBase)
+    {
+      sLoggerState.uiFill = uiFill;
+    }
+    else
+    {
+      /* Anfang auf der Karte, vor dem nchsten krzen    */
+      bLoggerRecover = true;
+      Logger_DropFile();
+    }
+    ++sLoggerStats.uiLost;
+  }
+  else
+  {
+    sLoggerState.ulCommit = sLoggerState.ulBase + sLoggerState.uiFill;
+    sLoggerState.ulTime = ulTime;
+    if (sLoggerState.uiFill == uiLoggerSynced)
+    {
+      ulLoggerWritten = sLoggerState.ulCommit;
+    }
+    if (sLoggerState.bDirect)
+    {
+      ++sLoggerStats.uiDirect;
+    }
+    Logger_WriteIndex(ulTime, ulOffs);
+    
+    /* ber die Sektorgrenze, Marke im neuen Sektor       */
+    bCross = !sLoggerState.bDirect && (sLoggerState.ulBase != ulBase);
+    if (bCross)
+    {
+      Logger_EndPass();
+    }
+    if ((sLoggerState.uiFill - uiLoggerSynced >= sLoggerCfg.uiMaxFill)
+      || ((sLoggerCfg.uiMaxAge != 0) && (sLoggerState.uiFill != uiLoggerSynced)
+        && ((uint16_t)(Sched_GetSeconds() - uiLoggerStageSec) >= sLoggerCfg.uiMaxAge)))
+    {
+      bOk = Logger_WriteStage();
+    }
+    else if (!bCross && !sLoggerState.bDirect
+      && (sLoggerCfg.ucFormat != Logger_Format_BIN))
+    {
+      /* Ohne Prfsumme: Marke nach jedem Eintrag         */
+      Logger_SaveState();
+    }
+  }
+  
+  /* Ohne Puffer erst nach einem vollendeten Sektor       */
+  bSector = sLoggerState.bDirect && ((sLoggerState.ulBase / LOGGER_SECTOR_SIZE)
+    != (ulBase / LOGGER_SECTOR_SIZE));
+  if (bLoggerDirty && (bSector
+    || ((uint16_t)(Sched_GetSeconds() - uiLoggerSyncSec) >= sLoggerCfg.uiSyncAge)))
+  {
+    Logger_Sync();
+  }
+  
+  return bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ereignis mit Zeitstempel, Kennung und Werten als Textzeile an
+ * LOGGER_EVENT_FILE anhngen. Die Datei wird dazu geffnet und wieder
+ * geschlossen, die Tagesdatei bleibt unberhrt.
+ *
+ * @param[in] *pszTag   Kennung, z.B. "PGOV"
+ * @param[in] *plValues Werte
+ * @param[in] ucNum     Anzahl der Werte, hchstens 8
+ * @return    bool      true, wenn die Zeile geschrieben wurde
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Logger_Event(const char* pszTag, const int32_t* plValues, uint8_t ucNum)
+{
+  RTC_DateTypeDef sDate;
+  RTC_TimeTypeDef sTime;
+  FIL fil;
+  UINT uiWritten;
+  char* pc = acLoggerLine;
+  bool bOk;
+  
+  RTC_GetDate(RTC_Format_BIN, &sDate);
+  RTC_GetTime(RTC_Format_BIN, &sTime);
+  
+  /* Zeitstempel wie in der Protokollzeile                */
+  *(pc++) = '2';
+  *(pc++) = '0';
+  pc = NumFmt_Put2(pc, sDate.RTC_Year);
+  *(pc++) = '-';
+  pc = NumFmt_Put2(pc, (uint8_t)sDate.RTC_Month);
+  *(pc++) = '-';
+  pc = NumFmt_Put2(pc, sDate.RTC_Date);
+  *(pc++) = 'T';
+  pc = NumFmt_Put2(pc, sTime.RTC_Hours);
+  *(pc++) = ':';
+  pc = NumFmt_Put2(pc, sTime.RTC_Minutes);
+  *(pc++) = ':';
+  pc = NumFmt_Put2(pc, sTime.RTC_Seconds);
+  *(pc++) = 'Z';
+  *(pc++) = ',';
+  
+  /* Kennung und Werte                                    */
+  while (*pszTag != '\0')
+  {
+    *(pc++) = *(pszTag++);
+  }
+  while (ucNum-- > 0)
+  {
+    *(pc++) = ',';
+    pc = NumFmt_PutInt(pc, *(plValues++));
+  }
+  *(pc++) = '\r';
+  *(pc++) = '\n';
+  
+  if (f_open(&fil, LOGGER_EVENT_FILE, FA_WRITE | FA_OPEN_APPEND) != FR_OK)
+  {
+    return false;
+  }
+  bOk = (f_write(&fil, acLoggerLine, (UINT)(pc - acLoggerLine), &uiWritten)
+    == FR_OK) && (uiWritten == (UINT)(pc - acLoggerLine));
+  return (f_close(&fil) == FR_OK) && bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz aus einem Eintrag des Ringspeichers zusammenstellen. Die
+ * Prfsumme trgt Logger_EncodeRecord() ein.
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @param[out] *pRec    Binrsatz
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Prfsumme in Logger_EncodeRecord()
+ ******************************************************************************/
+void Logger_BuildRecord(const SensorLogItem* pLog, Logger_Record* pRec)
+{
+  pRec->ulTime = Logger_GetTime(pLog);
+  pRec->iTempBME = pLog->sTemperature.iBME;
+  pRec->iTempCPU = pLog->sTemperature.iCPU;
+  pRec->iTempQMC = pLog->sTemperature.iQMC;
+  pRec->iTempMPU = pLog->sTemperature.iMPU;
+  pRec->ulPressure = pLog->ulPressure;
+  pRec->ulHumidity = pLog->ulHumidity;
+  pRec->uiWindDir = pLog->sWind.uiDir;
+  pRec->uiWindVelo = pLog->sWind.uiVelo;
+  pRec->uiAzimuth = pLog->sAlignment.uiAzimuth;
+  pRec->iZenith = pLog->sAlignment.iZenith;
+  pRec->lLat = pLog->sPosition.lLat;
+  pRec->lLong = pLog->sPosition.lLong;
+  pRec->iAlt = pLog->sPosition.iAlt;
+  pRec->uiBatVolt = pLog->sPower.uiBatVolt;
+  pRec->uiPanelVolt = pLog->sPower.uiPanelVolt;
+  pRec->iBatCurr = pLog->sPower.iBatCurr;
+  pRec->iPanelCurr = pLog->sPower.iPanelCurr;
+  pRec->ucSoC = pLog->sEnergy.ucSoC;
+  pRec->uiBatIn = pLog->sEnergy.uiBatIn;
+  pRec->uiBatOut = pLog->sEnergy.uiBatOut;
+  pRec->ulPvEnergy = pLog->sEnergy.ulPvEnergy;
+  pRec->ucStatus = pLog->ucStatus;
+  pRec->uiCrc = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz Feld fr Feld Big Endian ablegen wie in der Datei, die
+ * Prfsumme ber die abgelegten Byte berechnen und in beide eintragen
+ *
+ * @param[in,out] *pRec Binrsatz, danach mit Prfsumme
+ * @param[out] *pucDest Ziel, sizeof(Logger_Record) Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Logger_EncodeRecord(Logger_Record* pRec, uint8_t* pucDest)
+{
+  const uint8_t* pucField;
+  uint8_t ucField;
+  uint8_t ucSize;
+  uint32_t ulValue;
+  
+  for (ucField = 0; ucField < LOGGER_PACK_FIELDS; ++ucField)
+  {
+    pucField = (const uint8_t*)pRec + aucLoggerPackOffs[ucField];
+    ucSize = aucLoggerPackOffs[ucField + 1] - aucLoggerPackOffs[ucField];
+    switch (ucSize)
+    {
+      case 1:
+        ulValue = *pucField;
+        break;
+      
+      case 2:
+        ulValue = *(const uint16_t*)pucField;
+        break;
+      
+      default:
+        ulValue = *(const uint32_t*)pucField;
+    }
+    Logger_PutBe(pucDest + aucLoggerPackOffs[ucField], ulValue, ucSize);
+  }
+  
+  pRec->uiCrc = Logger_Crc16(LOGGER_CRC_INIT, pucDest,
+    sizeof(Logger_Record) - sizeof(pRec->uiCrc));
+  Logger_PutBe(pucDest + offsetof(Logger_Record, uiCrc), pRec->uiCrc,
+    sizeof(pRec->uiCrc));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Textzeile eines Eintrags ohne Formatstring zusammenstellen, Zeichen fr
+ * Zeichen gleich der frheren Ausgabe mit sprintf():
+ * "%04d-%02d-%02dT%02d:%02d:%02dZ," und die Werte durch Komma getrennt,
+ * abgeschlossen mit "\r\n"
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @param[out] *pcDest  Ziel, mindestens LOGGER_CSV_MAX Zeichen
+ * @return    uint8_t   Lnge der Zeile ohne abschlieende Null
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t Logger_FormatCsv(const SensorLogItem* pLog, char* pcDest)
+{
+  char* pc = pcDest;
+  
+  /* Zeitstempel                                          */
+  *(pc++) = '2';
+  *(pc++) = '0';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sDate.RTC_Year);
+  *(pc++) = '-';
+  pc = NumFmt_Put2(pc, (uint8_t)pLog->sTimestamp.sDate.RTC_Month);
+  *(pc++) = '-';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sDate.RTC_Date);
+  *(pc++) = 'T';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sTime.RTC_Hours);
+  *(pc++) = ':';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sTime.RTC_Minutes);
+  *(pc++) = ':';
+  pc = NumFmt_Put2(pc, pLog->sTimestamp.sTime.RTC_Seconds);
+  *(pc++) = 'Z';
+  
+  /* Temperaturen, Luftdruck und Feuchte                  */
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iBME);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iCPU);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iQMC);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sTemperature.iMPU);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->ulPressure);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->ulHumidity);
+  
+  /* Wind und Ausrichtung                                 */
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sWind.uiDir);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sWind.uiVelo);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sAlignment.uiAzimuth);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sAlignment.iZenith);
+  
+  /* GPS-Position                                         */
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPosition.lLat);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPosition.lLong);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPosition.iAlt);
+  
+  /* Spannungen und Strme                                */
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sPower.uiBatVolt);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sPower.uiPanelVolt);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPower.iBatCurr);
+  *(pc++) = ',';
+  pc = NumFmt_PutInt(pc, pLog->sPower.iPanelCurr);
+  
+  /* Ladezustand und Tageszhler                          */
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sEnergy.ucSoC);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sEnergy.uiBatIn);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sEnergy.uiBatOut);
+  *(pc++) = ',';
+  pc = NumFmt_PutUInt(pc, pLog->sEnergy.ulPvEnergy);
+  *(pc++) = '\r';
+  *(pc++) = '\n';
+  
+  return (uint8_t)(pc - pcDest);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeitstempel eines Eintrags in Unix-Zeit umrechnen. Die Echtzeituhr zhlt
+ * die Jahre ab 2000.
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @return    uint32_t  Sekunden seit 01.01.1970 00:00:00 UTC
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint32_t Logger_GetTime(const SensorLogItem* pLog)
+{
+  uint16_t uiDays;
+  
+  uiDays = Logger_MakeDay(pLog->sTimestamp.sDate.RTC_Year,
+    (uint8_t)pLog->sTimestamp.sDate.RTC_Month,
+    pLog->sTimestamp.sDate.RTC_Date);
+  
+  return LOGGER_EPOCH_2000 + uiDays * LOGGER_DAY_SECONDS
+    + pLog->sTimestamp.sTime.RTC_Hours * 3600UL
+    + pLog->sTimestamp.sTime.RTC_Minutes * 60UL
+    + pLog->sTimestamp.sTime.RTC_Seconds;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Lnge eines Satzes als gepackter Eintrag gegenber seinem Vorgnger
+ * bestimmen, hchstens LOGGER_PACK_MAX
+ *
+ * @param[in] *pRec     Neuer Satz
+ * @param[in] *pPrev    Vorgnger
+ * @param[in] lStep     Zeitabstand des Vorgngers zu seinem Vorgnger in s
+ * @param[out] *pulMask Bitmaske der genderten Felder
+ * @return    uint8_t   Lnge in Byte, 0: keine nderung (Wiederholung)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t Logger_GetPackSize(const Logger_Record* pRec, const Logger_Record* pPrev,
+  int32_t lStep, uint32_t* pulMask)
+{
+  uint8_t aucVar[LOGGER_VARINT_MAX];
+  uint32_t ulDelta;
+  uint32_t ulBit = 1;
+  uint8_t ucField;
+  uint8_t ucLen = 0;
+  
+  *pulMask = 0;
+  for (ucField = 0; ucField < LOGGER_PACK_FIELDS; ++ucField, ulBit <<= 1)
+  {
+    ulDelta = Logger_PackField(pRec, pPrev, lStep, ucField);
+    if (ulDelta != 0)
+    {
+      *pulMask |= ulBit;
+      ucLen += Logger_PackVarint(ulDelta, aucVar);
+    }
+  }
+  
+  if (*pulMask == 0)
+  {
+    return 0;
+  }
+  return ucLen + Logger_PackVarint(*pulMask, aucVar);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Tag einer Unix-Zeit bestimmen
+ *
+ * @param[in] ulTime    Unix-Zeit in s
+ * @return    uint16_t  Tage seit dem 01.01.2000
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t Logger_GetDay(uint32_t ulTime)
+{
+  if (ulTime < LOGGER_EPOCH_2000)
+  {
+    return 0;
+  }
+  return (uint16_t)((ulTime - LOGGER_EPOCH_2000) / LOGGER_DAY_SECONDS);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrge eines Zeitbereichs in einer Tagesdatei suchen. Der Index liefert
+ * die Stunde, ab der gelesen wird; liegt der Eintrag dort bereits hinter
+ * dem Zeitpunkt (Datei geleert), wird ab dem Dateianfang gesucht. Gepackte
+ * Dateien liefern ganze Blcke, die den Bereich berdecken. Vorher
+ * Logger_Flush() aufrufen.
+ *
+ * @param[in] uiDay     Tag der Datei seit dem 01.01.2000
+ * @param[in] ulFrom    Beginn als Unix-Zeit in s
+ * @param[in] ulTo      Ende als Unix-Zeit in s, einschlielich
+ * @param[out] *pRange  Dateiname und Bereich
+ * @return    bool      true, wenn die Datei existiert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Logger_FindRange(uint16_t uiDay, uint32_t ulFrom, uint32_t ulTo,
+  Logger_Range* pRange)
+{
+  FIL sFile;
+  uint32_t ulDayStart = LOGGER_EPOCH_2000 + uiDay * LOGGER_DAY_SECONDS;
+  
+  Logger_MakeName(uiDay, pRange->szFile);
+  if (f_open(&sFile, pRange->szFile, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+  {
+    return false;
+  }
+  
+  pRange->uiHead = Logger_GetHeadSize();
+  if (ulFrom < ulDayStart)
+  {
+    ulFrom = ulDayStart;
+  }
+  pRange->ulStart = Logger_Seek(&sFile,
+    Logger_CheckHint(&sFile, Logger_FindIndex(ulFrom, uiDay), ulFrom,
+      pRange->uiHead), ulFrom);
+  if ((sLoggerCfg.ucFormat == Logger_Format_PAK)
+    && (pRange->ulStart > pRange->uiHead))
+  {
+    /* Beginn kann im vorherigen Block liegen             */
+    pRange->ulStart = (pRange->ulStart - 1)
+      & ~(uint32_t)(LOGGER_SECTOR_SIZE - 1);
+  }
+  
+  pRange->ulEnd = f_size(&sFile);
+  if (ulTo - ulDayStart < LOGGER_DAY_SECONDS - 1)
+  {
+    pRange->ulEnd = Logger_Seek(&sFile,
+      Logger_CheckHint(&sFile, Logger_FindIndex(ulTo + 1, uiDay), ulTo + 1,
+        pRange->ulStart), ulTo + 1);
+  }
+  
+  f_close(&sFile);
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Alle gepufferten Daten auf die Karte schreiben, auch einen angefangenen
+ * Sektor, und das Verzeichnis sichern. Aufruf vor dem Lesen der Datei.
+ *
+ * @return    bool      true, wenn erfolgreich geschrieben
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Reparatur nach einem Reset
+ ******************************************************************************/
+bool Logger_Flush(void)
+{
+  bool bOk;
+  
+  Logger_CheckRecover();
+  bOk = Logger_WriteStage();
+  return Logger_Sync() && bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Puffer schreiben und die Datei schlieen, sie wird beim nchsten Schreiben
+ * wieder geffnet. Aufruf vor dem Leeren oder Umbenennen der Datei.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Logger_Close(void)
+{
+  Logger_Flush();
+  if (bLoggerOpen)
+  {
+    f_close(&sLoggerFile);
+    Logger_DropFile();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Puffer verwerfen, die Dateiposition wird beim nchsten Eintrag neu
+ * bestimmt. Aufruf nach dem Leeren oder Umbenennen der Datei. Eine noch
+ * geffnete Datei wird nicht mehr gesichert. Der nchste Eintrag kommt
+ * wieder in den Index, auch innerhalb derselben Stunde.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Logger_Discard(void)
+{
+  Logger_DropFile();
+  sLoggerState.ulBase = LOGGER_BASE_UNKNOWN;
+  sLoggerState.uiFill = 0;
+  sLoggerState.ucFormat = sLoggerCfg.ucFormat;
+  sLoggerState.ulClust = 0;
+  sLoggerState.uiContig = 0;
+  sLoggerState.bDirect = false;
+  uiLoggerSynced = 0;
+  bLoggerPackValid = false;
+  bLoggerRecover = false;
+  Logger_SaveState();
+  
+  if (ulLoggerIndexTime != 0)
+  {
+    ulLoggerIndexTime -= ulLoggerIndexTime % LOGGER_INDEX_STEP + 1;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Format des Protokolls einstellen und im EEPROM sichern. Jedes Format
+ * schreibt in seine eigenen Tages- und Indexdateien, der Puffer wird vorher
+ * geschrieben.
+ *
+ * @param[in] eFormat   Format
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Logger_SetFormat(Logger_Format eFormat)
+{
+  Logger_Close();
+  sLoggerCfg.ucFormat = (uint8_t)eFormat;
+  NvStore_Save(NVSTORE_OFFS_LOGGER, &sLoggerCfg, sizeof(sLoggerCfg));
+  Logger_MakeName(sLoggerState.uiDay, szLoggerFile);
+  Logger_LoadIndex();
+  Logger_Discard();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eingestelltes Format abfragen
+ *
+ * @return    Logger_Format   Format
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+Logger_Format Logger_GetFormat(void)
+{
+  return (Logger_Format)sLoggerCfg.ucFormat;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Namen der aktuellen Tagesdatei des eingestellten Formats abfragen
+ *
+ * @return    const char*   Dateiname
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const char* Logger_GetFileName(void)
+{
+  return szLoggerFile;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Grenzen fr ungeschriebene Daten einstellen und im EEPROM sichern
+ *
+ * @param[in] uiMaxAge  Hchstes Alter in s, 0: nur volle Sektoren
+ * @param[in] uiMaxFill Hchstmenge in Byte, 1 ... LOGGER_SECTOR_SIZE
+ * @param[in] uiSyncAge Hchstes Alter ohne f_sync in s, 0: sofort
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Logger_SetPolicy(uint16_t uiMaxAge, uint16_t uiMaxFill, uint16_t uiSyncAge)
+{
+  sLoggerCfg.uiMaxAge = uiMaxAge;
+  sLoggerCfg.uiMaxFill = uiMaxFill;
+  sLoggerCfg.uiSyncAge = uiSyncAge;
+  NvStore_Save(NVSTORE_OFFS_LOGGER, &sLoggerCfg, sizeof(sLoggerCfg));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Vorbelegung neuer Binrdateien einstellen und im EEPROM sichern. Sie gilt
+ * ab der nchsten neu angelegten Datei.
+ *
+ * @param[in] uiKByte   Gre in KByte, 0: aus
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Logger_SetPrealloc(uint16_t uiKByte)
+{
+  sLoggerCfg.uiPrealloc = uiKByte;
+  NvStore_Save(NVSTORE_OFFS_LOGGER, &sLoggerCfg, sizeof(sLoggerCfg));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Einstellungen abfragen
+ *
+ * @return    const Logger_Config*  Einstellungen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Logger_Config* Logger_GetConfig(void)
+{
+  return &sLoggerCfg;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zustand und Zhler des Schreibpuffers abfragen
+ *
+ * @return    const Logger_Stats*   Zhler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Logger_Stats* Logger_GetStats(void)
+{
+  sLoggerStats.uiFill = sLoggerState.uiFill;
+  sLoggerStats.uiPending = sLoggerState.uiFill - uiLoggerSynced;
+  sLoggerStats.uiContigFree = 0;
+  if ((sLoggerState.ulClust != 0)
+    && (sLoggerState.ulBase / LOGGER_SECTOR_SIZE < sLoggerState.uiContig))
+  {
+    sLoggerStats.uiContigFree = sLoggerState.uiContig
+      - (uint16_t)(sLoggerState.ulBase / LOGGER_SECTOR_SIZE);
+  }
+  return &sLoggerStats;
+}
@@ -0,0 +1,310 @@
+/*!****************************************************************************
+ * @file
+ * Logger.h
+ *
+ * Protokoll der Messwerte auf der SD-Karte. Jeder Eintrag des Ringspeichers
+ * wird als Binrsatz fester Lnge mit CRC oder als Textzeile an die Datei
+ * seines Tages angehngt (LOG/JJMMTT.BIN bzw. .TXT). Das Format wird ber
+ * AT+CLOGFMT gewhlt, die Einstellung bleibt im EEPROM. Ein Index mit einem
+ * Eintrag je Stunde erlaubt das Auslesen eines Zeitbereichs (AT+CLOGGET).
+ * Das gepackte Format speichert nur die nderungen gegenber dem vorherigen
+ * Eintrag (LOG/JJMMTT.PAK).
+ *
+ * Die Eintrge werden im Daten-EEPROM gesammelt und nur als ganze Sektoren
+ * auf die Karte geschrieben. Sptestens nach einer einstellbaren Zeit oder
+ * Datenmenge wird auch ein angefangener Sektor geschrieben (AT+CLOGBUF).
+ * Damit das EEPROM hlt, luft hchstens ein Sektor je Stunde durch den
+ * Puffer, die brigen Eintrge gehen direkt in die Datei. Die Datei bleibt
+ * dazu ber die Wakeups geffnet. Binrdateien knnen
+ * zusammenhngend vorbelegt werden (AT+CLOGPRE), die Sektoren werden dann
+ * ohne Zugriff auf die FAT direkt geschrieben. Nach einem Reset wird das
+ * Ende der Datei anhand des Zustands im EEPROM geprft und repariert.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef LOGGER_H_
+#define LOGGER_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "SensorLog.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Version des Binrformats, steht im Dateikopf                              */
+#define LOGGER_VERSION          1
+
+/*! Kennung am Anfang der Binrdatei                                          */
+#define LOGGER_MAGIC            "WSLG"
+
+/*! Kennung am Anfang der gepackten Datei                                     */
+#define LOGGER_PACK_MAGIC       "WSPK"
+
+/*! Unix-Zeit am 01.01.2000 00:00:00 UTC, Bezug der Echtzeituhr               */
+#define LOGGER_EPOCH_2000       946684800UL
+
+/*! Sektorgre der SD-Karte in Byte, Gre des Schreibpuffers                */
+#define LOGGER_SECTOR_SIZE      512
+
+/*! Grte Vorbelegung einer Binrdatei in KByte                              */
+#define LOGGER_PREALLOC_MAX     32767
+
+/*! Abstand der Indexeintrge in s                                            */
+#define LOGGER_INDEX_STEP       3600UL
+
+/*! Puffergre fr Dateinamen mit Verzeichnis                                */
+#define LOGGER_NAME_SIZE        16
+
+/*! Grte Lnge einer Textzeile in Zeichen, auch einer Zeile der
+ * Wertetabelle fr GUI (ATCmd)                                               */
+#define LOGGER_CSV_MAX          184
+
+/*! Grte Anzahl Tage einer Abfrage                                          */
+#define LOGGER_QUERY_DAYS       31
+
+/*! Felder eines gepackten Eintrags: alle Werte des Binrsatzes ohne CRC      */
+#define LOGGER_PACK_FIELDS      23
+
+/*! Grte Lnge einer Varint-Zahl (32 Bit) in Byte                           */
+#define LOGGER_VARINT_MAX       5
+
+/*! Grte Lnge eines gepackten Eintrags: Maske und alle Felder              */
+#define LOGGER_PACK_MAX         (4 + LOGGER_PACK_FIELDS * LOGGER_VARINT_MAX)
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Dateiformat des Protokolls. Die Werte stehen im EEPROM und drfen sich
+ * nicht ndern.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Logger_Format {
+  /*! Textzeile in LOG/JJMMTT.TXT                         */
+  Logger_Format_CSV,
+  
+  /*! Binrsatz in LOG/JJMMTT.BIN                         */
+  Logger_Format_BIN,
+  
+  /*! Gepackte Blcke in LOG/JJMMTT.PAK                   */
+  Logger_Format_PAK,
+  
+  Logger_Format_NUM
+} Logger_Format;
+
+/*!****************************************************************************
+ * @brief
+ * Kopf der Binrdatei, danach folgt die Feldliste als ASCII-Text mit
+ * uiSchemaLen Zeichen und anschlieend die Stze. Mehrbytewerte Big Endian.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Byte-Reihenfolge
+ ******************************************************************************/
+typedef struct tag_Logger_FileHead {
+  /*! Kennung LOGGER_MAGIC                                */
+  char acMagic[4];
+  
+  /*! Version LOGGER_VERSION                              */
+  uint8_t ucVersion;
+  
+  /*! Lnge eines Satzes in Byte                          */
+  uint8_t ucRecSize;
+  
+  /*! Lnge der Feldliste in Zeichen                      */
+  uint16_t uiSchemaLen;
+} Logger_FileHead;
+
+/*!****************************************************************************
+ * @brief
+ * Binrsatz eines Protokolleintrags, ohne Fllbyte, Einheiten wie im
+ * Ringspeicher. Im RAM in der Byte-Reihenfolge des Rechners, in der Datei
+ * Big Endian (Logger_EncodeRecord()).
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Byte-Reihenfolge
+ ******************************************************************************/
+typedef struct tag_Logger_Record {
+  /*! Unix-Zeit in s (UTC)                                */
+  uint32_t ulTime;
+  
+  /*! Temperaturen BME280, CPU, QMC5883, MPU6050          */
+  int16_t iTempBME;
+  int16_t iTempCPU;
+  int16_t iTempQMC;
+  int16_t iTempMPU;
+  
+  /*! Luftdruck und Feuchte (BME280)                      */
+  uint32_t ulPressure;
+  uint32_t ulHumidity;
+  
+  /*! Windrichtung und -geschwindigkeit                   */
+  uint16_t uiWindDir;
+  uint16_t uiWindVelo;
+  
+  /*! Ausrichtung des Panels                              */
+  uint16_t uiAzimuth;
+  int16_t iZenith;
+  
+  /*! GPS-Position                                        */
+  int32_t lLat;
+  int32_t lLong;
+  int16_t iAlt;
+  
+  /*! Spannungen und Strme von Batterie und Panel        */
+  uint16_t uiBatVolt;
+  uint16_t uiPanelVolt;
+  int16_t iBatCurr;
+  int16_t iPanelCurr;
+  
+  /*! Ladezustand und Tageszhler                         */
+  uint8_t ucSoC;
+  uint16_t uiBatIn;
+  uint16_t uiBatOut;
+  uint32_t ulPvEnergy;
+  
+  /*! Zustandsbits SENSORLOG_STATUS_...                   */
+  uint8_t ucStatus;
+  
+  /*! CRC-16/CCITT ber alle vorherigen Byte des Satzes   */
+  uint16_t uiCrc;
+} Logger_Record;
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag der Indexdatei LOG/BIN.IDX bzw. LOG/TXT.IDX, je Stunde einer fr
+ * den ersten Eintrag der Stunde, nach der Zeit aufsteigend. Mehrbytewerte
+ * Big Endian.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Logger_IndexEntry {
+  /*! Unix-Zeit in s, bestimmt die Tagesdatei             */
+  uint32_t ulTime;
+  
+  /*! Position des Eintrags in der Tagesdatei             */
+  uint32_t ulOffs;
+} Logger_IndexEntry;
+
+/*!****************************************************************************
+ * @brief
+ * Ergebnis einer Abfrage fr eine Tagesdatei: Kopf [0, uiHead) und die
+ * Eintrge im Bereich [ulStart, ulEnd)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Logger_Range {
+  /*! Name der Tagesdatei                                 */
+  char szFile[LOGGER_NAME_SIZE];
+  
+  /*! Lnge des Dateikopfes                               */
+  uint16_t uiHead;
+  
+  /*! Position des ersten Eintrags im Bereich             */
+  uint32_t ulStart;
+  
+  /*! Position hinter dem letzten Eintrag im Bereich      */
+  uint32_t ulEnd;
+} Logger_Range;
+
+/*!****************************************************************************
+ * @brief
+ * Einstellungen des Protokolls, werden im EEPROM gesichert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Logger_Config {
+  /*! Format (Logger_Format)                              */
+  uint8_t ucFormat;
+  
+  /*! Hchstes Alter ungeschriebener Daten in s, 0: aus   */
+  uint16_t uiMaxAge;
+  
+  /*! Hchstmenge ungeschriebener Daten in Byte           */
+  uint16_t uiMaxFill;
+  
+  /*! Hchstes Alter ungesicherter Verzeichnisdaten in s  */
+  uint16_t uiSyncAge;
+  
+  /*! Vorbelegung neuer Binrdateien in KByte, 0: aus     */
+  uint16_t uiPrealloc;
+} Logger_Config;
+
+/*!****************************************************************************
+ * @brief
+ * Zustand und Zhler des Schreibpuffers seit dem Start
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Logger_Stats {
+  /*! Belegte Byte im Puffer                              */
+  uint16_t uiFill;
+  
+  /*! Davon noch nicht auf der Karte                      */
+  uint16_t uiPending;
+  
+  /*! Vollstndig geschriebene Sektoren                   */
+  uint16_t uiSectors;
+  
+  /*! Vorzeitig geschriebene, angefangene Sektoren        */
+  uint16_t uiPartial;
+  
+  /*! Verworfene Eintrge                                 */
+  uint16_t uiLost;
+  
+  /*! Gesicherte Dateigren (f_sync)                     */
+  uint16_t uiSyncs;
+  
+  /*! ffnungen der Datei                                 */
+  uint16_t uiOpens;
+  
+  /*! Freie Sektoren der vorbelegten Datei                */
+  uint16_t uiContigFree;
+  
+  /*! Hinter der Dateigre wieder eingetragene Byte      */
+  uint32_t ulRecovered;
+  
+  /*! Abgeschnittene Byte unvollstndiger Eintrge        */
+  uint16_t uiTruncated;
+  
+  /*! Ohne Puffer direkt geschriebene Eintrge            */
+  uint16_t uiDirect;
+} Logger_Stats;
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+/*! Zeilenpuffer der Textzeile und der Wertetabelle fr GUI. Beide werden in
+ * der Hauptschleife zusammengestellt und sofort weitergegeben, nie
+ * verschachtelt; statisch statt auf dem Stack von SaveSensors()              */
+extern char acLoggerLine[LOGGER_CSV_MAX];
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Logger_Init(void);
+bool Logger_Append(const SensorLogItem* pLog);
+bool Logger_Event(const char* pszTag, const int32_t* plValues, uint8_t ucNum);
+void Logger_BuildRecord(const SensorLogItem* pLog, Logger_Record* pRec);
+void Logger_EncodeRecord(Logger_Record* pRec, uint8_t* pucDest);
+uint32_t Logger_GetTime(const SensorLogItem* pLog);
+uint8_t Logger_FormatCsv(const SensorLogItem* pLog, char* pcDest);
+uint8_t Logger_GetPackSize(const Logger_Record* pRec, const Logger_Record* pPrev,
+  int32_t lStep, uint32_t* pulMask);
+uint16_t Logger_GetDay(uint32_t ulTime);
+bool Logger_FindRange(uint16_t uiDay, uint32_t ulFrom, uint32_t ulTo,
+  Logger_Range* pRange);
+
+bool Logger_Flush(void);
+void Logger_Close(void);
+void Logger_Discard(void);
+
+void Logger_SetFormat(Logger_Format eFormat);
+Logger_Format Logger_GetFormat(void);
+const char* Logger_GetFileName(void);
+void Logger_SetPolicy(uint16_t uiMaxAge, uint16_t uiMaxFill, uint16_t uiSyncAge);
+void Logger_SetPrealloc(uint16_t uiKByte);
+const Logger_Config* Logger_GetConfig(void);
+const Logger_Stats* Logger_GetStats(void);
+
+#endif /* LOGGER_H_ */
@@ -0,0 +1,137 @@
+/*!****************************************************************************
+ * @file
+ * NumFmt.c
+ *
+ * Die Ziffern entstehen rckwrts in einem kleinen Puffer auf dem Stack:
+ * oberhalb von 9999 mit einer 32-Bit-Division je vier Stellen, darunter
+ * mit 16-Bit-Divisionen je zwei Stellen, deren Zeichen aus der Tabelle
+ * acNumFmtPairs kommen. sprintf() zerlegt dagegen bei jedem Aufruf den
+ * Formatstring und dividiert je Stelle mit 32 Bit.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <string.h>
+#include "NumFmt.h"
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Zeichenpaare "00" bis "99", ohne abschlieende Null                       */
+static const char acNumFmtPairs[200] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zeichenpaar einer Zahl 0 bis 99 vor eine Position schreiben
+ *
+ * @param[in] *pcEnd    Position hinter dem Paar
+ * @param[in] ucValue   Zahl 0 bis 99
+ * @return    char*     Position des Paares
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static char* NumFmt_PairBefore(char* pcEnd, uint8_t ucValue)
+{
+  const char* pcPair = &acNumFmtPairs[(uint8_t)(ucValue << 1)];
+  
+  *(--pcEnd) = pcPair[1];
+  *(--pcEnd) = pcPair[0];
+  return pcEnd;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Zahl ohne Vorzeichen ausgeben, wie "%lu"
+ *
+ * @param[in] *pcDest   Ziel, mindestens NUMFMT_INT32_MAX Zeichen
+ * @param[in] ulValue   Zahl
+ * @return    char*     Position hinter der letzten Ziffer
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+char* NumFmt_PutUInt(char* pcDest, uint32_t ulValue)
+{
+  char acDigits[NUMFMT_INT32_MAX];
+  char* pcDigit = &acDigits[sizeof(acDigits)];
+  uint16_t uiPart;
+  uint8_t ucLen;
+  
+  /* Je vier Stellen mit fhrenden Nullen                 */
+  while (ulValue > 9999)
+  {
+    uiPart = (uint16_t)(ulValue % 10000);
+    ulValue /= 10000;
+    pcDigit = NumFmt_PairBefore(pcDigit, (uint8_t)(uiPart % 100));
+    pcDigit = NumFmt_PairBefore(pcDigit, (uint8_t)(uiPart / 100));
+  }
+  
+  /* Hchstwertige Stellen ohne fhrende Nullen           */
+  uiPart = (uint16_t)ulValue;
+  if (uiPart > 99)
+  {
+    pcDigit = NumFmt_PairBefore(pcDigit, (uint8_t)(uiPart % 100));
+    uiPart /= 100;
+  }
+  if (uiPart > 9)
+  {
+    pcDigit = NumFmt_PairBefore(pcDigit, (uint8_t)uiPart);
+  }
+  else
+  {
+    *(--pcDigit) = (char)('0' + uiPart);
+  }
+  
+  ucLen = (uint8_t)(&acDigits[sizeof(acDigits)] - pcDigit);
+  memcpy(pcDest, pcDigit, ucLen);
+  return pcDest + ucLen;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zahl mit Vorzeichen ausgeben, wie "%ld"
+ *
+ * @param[in] *pcDest   Ziel, mindestens NUMFMT_INT32_MAX Zeichen
+ * @param[in] lValue    Zahl
+ * @return    char*     Position hinter der letzten Ziffer
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+char* NumFmt_PutInt(char* pcDest, int32_t lValue)
+{
+  if (lValue < 0)
+  {
+    *(pcDest++) = '-';
+    return NumFmt_PutUInt(pcDest, 0UL - (uint32_t)lValue);
+  }
+  return NumFmt_PutUInt(pcDest, (uint32_t)lValue);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zahl 0 bis 99 zweistellig mit fhrender Null ausgeben, wie "%02d"
+ *
+ * @param[in] *pcDest   Ziel, mindestens 2 Zeichen
+ * @param[in] ucValue   Zahl 0 bis 99
+ * @return    char*     Position hinter der letzten Ziffer
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+char* NumFmt_Put2(char* pcDest, uint8_t ucValue)
+{
+  NumFmt_PairBefore(pcDest + 2, ucValue);
+  return pcDest + 2;
+}
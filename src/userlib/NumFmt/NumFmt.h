@@ -0,0 +1,30 @@
+/*!****************************************************************************
+ * @file
+ * NumFmt.h
+ *
+ * Ausgabe von Ganzzahlen als Dezimaltext ohne Formatstring. Die Ziffern
+ * werden paarweise aus einer Tabelle kopiert, 32-Bit-Divisionen fallen nur
+ * je vier Stellen an. Die Funktionen schreiben ab pcDest und liefern die
+ * Position hinter dem letzten Zeichen, ohne abschlieende Null.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef NUMFMT_H_
+#define NUMFMT_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Grte Lnge einer 32-Bit-Zahl mit Vorzeichen in Zeichen                  */
+#define NUMFMT_INT32_MAX        11
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+char* NumFmt_PutUInt(char* pcDest, uint32_t ulValue);
+char* NumFmt_PutInt(char* pcDest, int32_t lValue);
+char* NumFmt_Put2(char* pcDest, uint8_t ucValue);
+
+#endif /* NUMFMT_H_ */
@@ -0,0 +1,175 @@
+/*!****************************************************************************
+ * @file
+ * NvStore.c
+ *
+ * Ablage von Datenblcken im Daten-EEPROM mit Prfsumme. Es werden nur Worte
+ * programmiert, die sich gendert haben, um die Zellen zu schonen. Das
+ * EEPROM lscht und schreibt immer ein ganzes Wort (4 Byte), auch fr ein
+ * einzelnes Byte. Angeschnittene Worte am Anfang und Ende eines Bereichs
+ * werden deshalb mit ihrem bisherigen Inhalt ergnzt und ebenfalls in
+ * einem Zyklus geschrieben; jedes Wort altert je Aufruf hchstens um einen
+ * Zyklus. Die Prfsumme kommt zuletzt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include <string.h>
+#include "NvStore.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Lesezeiger auf eine Adresse im Daten-EEPROM                               */
+#ifndef NVSTORE_PTR
+#define NVSTORE_PTR(ulAddr)     ((const uint8_t*)(uint16_t)(ulAddr))
+#endif /* NVSTORE_PTR */
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * CRC-8 (Polynom 0x07) ber einen Datenblock berechnen. Der Startwert hngt
+ * von der Blocklnge ab, damit ein gelschtes EEPROM (0x00) nie gltig ist.
+ *
+ * @param[in] *pData    Datenblock
+ * @param[in] ucLen     Lnge in Byte
+ * @return    uint8_t   Prfsumme
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t NvStore_Crc(const uint8_t* pData, uint8_t ucLen)
+{
+  uint8_t ucCrc = 0xFF ^ ucLen;
+  uint8_t ucBit;
+  
+  while (ucLen--)
+  {
+    ucCrc ^= *pData++;
+    for (ucBit = 0; ucBit < 8; ++ucBit)
+    {
+      ucCrc = (ucCrc & 0x80) ? (uint8_t)((ucCrc << 1) ^ 0x07) : (uint8_t)(ucCrc << 1);
+    }
+  }
+  
+  return ucCrc;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Datenblock aus dem EEPROM lesen und Prfsumme kontrollieren
+ *
+ * @param[in]  uiOffs   Offset im Daten-EEPROM
+ * @param[out] *pData   Zielpuffer
+ * @param[in]  ucLen    Lnge in Byte
+ * @return     bool     true, wenn die Prfsumme stimmt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool NvStore_Load(uint16_t uiOffs, void* pData, uint8_t ucLen)
+{
+  uint32_t ulAddr = FLASH_DATA_EEPROM_START_PHYSICAL_ADDRESS + uiOffs;
+  uint8_t* pucData = (uint8_t*)pData;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < ucLen; ++ucIdx)
+  {
+    pucData[ucIdx] = FLASH_ReadByte(ulAddr + ucIdx);
+  }
+  
+  return (FLASH_ReadByte(ulAddr + ucLen) == NvStore_Crc(pucData, ucLen));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datenblock mit Prfsumme ins EEPROM schreiben
+ *
+ * @param[in] uiOffs    Offset im Daten-EEPROM
+ * @param[in] *pData    Quellpuffer
+ * @param[in] ucLen     Lnge in Byte
+ * @return    bool      true, wenn der Block danach gltig gelesen wird
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Daten wortweise ber NvStore_Write()
+ ******************************************************************************/
+bool NvStore_Save(uint16_t uiOffs, const void* pData, uint8_t ucLen)
+{
+  uint8_t ucCrc = NvStore_Crc((const uint8_t*)pData, ucLen);
+  
+  /* Prfsumme erst nach den Daten, ein unterbrochenes
+     Schreiben hinterlsst einen ungltigen Block         */
+  return NvStore_Write(uiOffs, pData, ucLen)
+    && NvStore_Write(uiOffs + ucLen, &ucCrc, 1);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bereich ohne Prfsumme ins EEPROM schreiben. Jedes berhrte Wort wird
+ * in einem Programmierzyklus geschrieben, angeschnittene Worte mit ihrem
+ * bisherigen Inhalt ergnzt, unvernderte Worte bersprungen.
+ *
+ * @param[in] uiOffs    Offset im Daten-EEPROM
+ * @param[in] *pData    Quellpuffer
+ * @param[in] uiLen     Lnge in Byte
+ * @return    bool      true, wenn der Bereich danach gleich gelesen wird
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Angeschnittene Worte ergnzt in einem Zyklus
+ ******************************************************************************/
+bool NvStore_Write(uint16_t uiOffs, const void* pData, uint16_t uiLen)
+{
+  const uint8_t* pucData = (const uint8_t*)pData;
+  uint8_t aucWord[4];
+  uint32_t ulWord;
+  uint16_t uiWord;
+  uint16_t uiIdx;
+  uint8_t ucPos;
+  
+  if ((FLASH_DATA_EEPROM_START_PHYSICAL_ADDRESS + (uint32_t)uiOffs + uiLen)
+    > (FLASH_DATA_EEPROM_END_PHYSICAL_ADDRESS + 1))
+  {
+    return false;
+  }
+  
+  FLASH_Unlock(FLASH_MemType_Data);
+  for (uiIdx = 0; uiIdx < uiLen; )
+  {
+    /* Wort aus bisherigem Inhalt und neuen Bytes         */
+    ucPos = (uint8_t)((uiOffs + uiIdx) & 0x03);
+    uiWord = uiOffs + uiIdx - ucPos;
+    memcpy(aucWord, NvStore_GetPtr(uiWord), 4);
+    for ( ; (ucPos < 4) && (uiIdx < uiLen); ++ucPos, ++uiIdx)
+    {
+      aucWord[ucPos] = pucData[uiIdx];
+    }
+    
+    if (memcmp(NvStore_GetPtr(uiWord), aucWord, 4) != 0)
+    {
+      memcpy(&ulWord, aucWord, 4);
+      FLASH_ProgramWord(FLASH_DATA_EEPROM_START_PHYSICAL_ADDRESS + uiWord,
+        ulWord);
+      FLASH_WaitForLastOperation(FLASH_MemType_Data);
+    }
+  }
+  FLASH_Lock(FLASH_MemType_Data);
+  
+  /* Kontrolllesen                                        */
+  return (memcmp(NvStore_GetPtr(uiOffs), pucData, uiLen) == 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Adresse eines Bereichs im Daten-EEPROM zum direkten Lesen abfragen. Das
+ * EEPROM liegt im Adressraum der CPU.
+ *
+ * @param[in] uiOffs    Offset im Daten-EEPROM
+ * @return    const uint8_t*  Adresse
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const uint8_t* NvStore_GetPtr(uint16_t uiOffs)
+{
+  return NVSTORE_PTR(FLASH_DATA_EEPROM_START_PHYSICAL_ADDRESS + uiOffs);
+}
@@ -0,0 +1,41 @@
+/*!****************************************************************************
+ * @file
+ * NvStore.h
+ *
+ * Ablage von Datenblcken im Daten-EEPROM mit Prfsumme
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef NVSTORE_H_
+#define NVSTORE_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! @brief Aufteilung des Daten-EEPROM (Offset ab Anfang des EEPROM)
+ *
+ * Jeder Block belegt seine Datengre plus ein Byte Prfsumme.
+ * @{                                                                         */
+#define NVSTORE_OFFS_ENERGY     0x0000    /* Energiezhler, 128 Byte          */
+#define NVSTORE_OFFS_WATCHDOG   0x0080    /* Watchdog-Bericht, 6 Byte         */
+#define NVSTORE_OFFS_TRACE      0x0086    /* Trace-Aufzeichnung, 2 Byte       */
+#define NVSTORE_OFFS_LOGGER     0x0088    /* Protokoll, 10 Byte               */
+#define NVSTORE_OFFS_SENSORLOG  0x0094    /* Ringspeicher, 3 Byte             */
+#define NVSTORE_OFFS_SENSORSEQ  0x0098    /* Folgenummern, 5 Byte             */
+#define NVSTORE_OFFS_LOGSTATE   0x00A0    /* Zustand Schreibpuffer, 8x40 Byte */
+#define NVSTORE_OFFS_LOGSTAGE   0x0200    /* Schreibpuffer, 512 Byte ohne CRC */
+#define NVSTORE_OFFS_LOGMIRROR  0x0400    /* Spiegel Ringspeicher, 1024 Byte  */
+/*! @}                                                                        */
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+bool NvStore_Load(uint16_t uiOffs, void* pData, uint8_t ucLen);
+bool NvStore_Save(uint16_t uiOffs, const void* pData, uint8_t ucLen);
+bool NvStore_Write(uint16_t uiOffs, const void* pData, uint16_t uiLen);
+const uint8_t* NvStore_GetPtr(uint16_t uiOffs);
+
+#endif /* NVSTORE_H_ */
@@ -0,0 +1,288 @@
+/*!****************************************************************************
+ * @file
+ * PowerGov.c
+ *
+ * Lastabwurf in Stufen abhngig von Batteriespannung und Ladezustand. Die
+ * Stufe wechselt immer nur um einen Schritt, erst nachdem die Schwelle fr
+ * POWERGOV_DEBOUNCE Sekunden anliegt. Rckkehrschwellen liegen ber den
+ * Eintrittsschwellen (Hysterese). Jeder Wechsel wird protokolliert.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdio.h>
+#include "stm8l15x.h"
+#include "Logger.h"
+#include "motorlib.h"
+#include "SolarTracking.h"
+#include "BTHandler.h"
+#include "GPSHandler.h"
+#include "PowerGov.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Anzahl der Versorgungsstufen                                              */
+#define POWERGOV_NUM_TIERS      5
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Schwellen und Betriebsparameter einer Versorgungsstufe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_PowerGov_TierConf {
+  /*! Eintritt, wenn der Ladezustand in 1% darunter liegt */
+  uint8_t ucSoCEnter;
+  
+  /*! Eintritt, wenn die Spannung in 1mV darunter liegt   */
+  uint16_t uiVoltEnter;
+  
+  /*! Verlassen, wenn Ladezustand in 1% erreicht ist      */
+  uint8_t ucSoCLeave;
+  
+  /*! ... und die Spannung in 1mV erreicht ist            */
+  uint16_t uiVoltLeave;
+  
+  /*! Minimales Messintervall in 1s                       */
+  uint16_t uiMinInterval;
+  
+  /*! Advertising-Dauer fr Bluetooth in 1s               */
+  uint8_t ucBtAdTime;
+  
+  /*! Bluetooth bei jedem n-ten Wakeup, 0: nie            */
+  uint8_t ucBtWakeDiv;
+  
+  /*! GPS bei jedem n-ten Wakeup, 0: nie                  */
+  uint8_t ucGpsWakeDiv;
+  
+  /*! Nachfhrung des Panels erlaubt                      */
+  bool bTracking;
+} PowerGov_TierConf;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Parameter der Versorgungsstufen, Schwellen fr FULL werden nicht genutzt  */
+static const PowerGov_TierConf asTiers[POWERGOV_NUM_TIERS] = {
+  /* Enter      Leave      Intv  BT     GPS Track                             */
+  {  0,     0,  0,     0,    10, 30, 1, 1,  true  },    /* FULL               */
+  { 60, 12100, 65, 12250,   300, 20, 1, 4,  true  },    /* REDUCED            */
+  { 45, 11950, 50, 12100,   600, 15, 2, 4,  false },    /* NOTRACK            */
+  { 30, 11800, 35, 11950,   900, 10, 4, 0,  false },    /* NOGPS              */
+  { 15, 11600, 20, 11800,  1800, 10, 0, 0,  false }     /* MINIMAL            */
+};
+
+/*! Aktuelle Versorgungsstufe                                                 */
+static PowerGov_Tier eTier;
+
+/*! Vom Benutzer eingestelltes Messintervall in 1s                            */
+static uint16_t uiUserInterval;
+
+/*! Aktiv eingestelltes Messintervall in 1s                                   */
+static uint16_t uiActiveInterval;
+
+/*! Entprellzhler fr Abstieg (> 0) bzw. Aufstieg (< 0) in 1s                */
+static int16_t iDebounce;
+
+/*! Nachfhrung war vor dem Abschalten aktiv                                  */
+static bool bTrackResume;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Messintervall der Echtzeituhr aus Benutzervorgabe und Stufe bestimmen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void PowerGov_ApplyInterval(void)
+{
+  uint16_t uiInterval = uiUserInterval;
+  
+  if (uiInterval < asTiers[eTier].uiMinInterval)
+  {
+    uiInterval = asTiers[eTier].uiMinInterval;
+  }
+  
+  if (uiInterval != uiActiveInterval)
+  {
+    RTC_WakeUpCmd(DISABLE);
+    RTC_SetWakeUpCounter(uiInterval);
+    RTC_WakeUpCmd(ENABLE);
+    uiActiveInterval = uiInterval;
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Betriebsparameter der aktuellen Stufe an die Module verteilen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void PowerGov_Apply(void)
+{
+  const PowerGov_TierConf* pConf = &asTiers[eTier];
+  
+  PowerGov_ApplyInterval();
+  BTHandler_SetPolicy(pConf->ucBtAdTime, pConf->ucBtWakeDiv);
+  GPSHandler_SetPolicy(pConf->ucGpsWakeDiv);
+  
+  if (!pConf->bTracking && Tracking_IsEnabled())
+  {
+    /* Nachfhrung abschalten und Motor anhalten          */
+    bTrackResume = true;
+    Tracking_Cmd(false);
+    Motor_Cmd(false);
+  }
+  else if (pConf->bTracking && bTrackResume)
+  {
+    /* Nachfhrung wieder aufnehmen                       */
+    bTrackResume = false;
+    Tracking_Cmd(true);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Stufenwechsel auf der Debug-Schnittstelle und der SD-Karte protokollieren
+ *
+ * @param[in] eFrom     Vorherige Stufe
+ * @param[in] uiBatVolt Batteriespannung in 1mV
+ * @param[in] ucSoC     Ladezustand in 1%
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Zeile ber Logger_Event() statt f_printf
+ ******************************************************************************/
+static void PowerGov_LogTransition(PowerGov_Tier eFrom, uint16_t uiBatVolt, uint8_t ucSoC)
+{
+  int32_t alValues[4];
+  
+  printf("PowerGov: %d -> %d\r\n", (int)eFrom, (int)eTier);
+  
+  alValues[0] = (int32_t)eFrom;
+  alValues[1] = (int32_t)eTier;
+  alValues[2] = (int32_t)uiBatVolt;
+  alValues[3] = (int32_t)ucSoC;
+  Logger_Event("PGOV", alValues, 4);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Modul initialisieren, Start in der Stufe FULL
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void PowerGov_Init(void)
+{
+  eTier = PowerGov_Tier_FULL;
+  uiUserInterval = POWERGOV_DEFAULT_INTV;
+  uiActiveInterval = POWERGOV_DEFAULT_INTV;
+  iDebounce = 0;
+  bTrackResume = false;
+  PowerGov_Apply();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Schwellen prfen und ggf. die Stufe wechseln
+ *
+ * @param[in] uiBatVolt Batteriespannung in 1mV
+ * @param[in] ucSoC     Ladezustand in 1%
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void PowerGov_Task1s(uint16_t uiBatVolt, uint8_t ucSoC)
+{
+  PowerGov_Tier eFrom = eTier;
+  const PowerGov_TierConf* pNext;
+  const PowerGov_TierConf* pCurr = &asTiers[eTier];
+  bool bDown = false;
+  bool bUp = false;
+  
+  if (eTier < PowerGov_Tier_MINIMAL)
+  {
+    pNext = &asTiers[eTier + 1];
+    bDown = (ucSoC < pNext->ucSoCEnter) || (uiBatVolt < pNext->uiVoltEnter);
+  }
+  if (eTier > PowerGov_Tier_FULL)
+  {
+    bUp = (ucSoC >= pCurr->ucSoCLeave) && (uiBatVolt >= pCurr->uiVoltLeave);
+  }
+  
+  /* Entprellen                                           */
+  if (bDown)
+  {
+    iDebounce = (iDebounce < 0) ? 1 : iDebounce + 1;
+  }
+  else if (bUp)
+  {
+    iDebounce = (iDebounce > 0) ? -1 : iDebounce - 1;
+  }
+  else
+  {
+    iDebounce = 0;
+  }
+  
+  /* Stufenwechsel um einen Schritt                       */
+  if (iDebounce >= POWERGOV_DEBOUNCE)
+  {
+    eTier = (PowerGov_Tier)(eTier + 1);
+  }
+  else if (iDebounce <= -POWERGOV_DEBOUNCE)
+  {
+    eTier = (PowerGov_Tier)(eTier - 1);
+  }
+  
+  if (eTier != eFrom)
+  {
+    iDebounce = 0;
+    PowerGov_Apply();
+    PowerGov_LogTransition(eFrom, uiBatVolt, ucSoC);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Aktuelle Versorgungsstufe abfragen
+ *
+ * @return    PowerGov_Tier   Versorgungsstufe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+PowerGov_Tier PowerGov_GetTier(void)
+{
+  return eTier;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messintervall vorgeben. In den Sparstufen gilt ggf. ein lngeres
+ * Mindestintervall.
+ *
+ * @param[in] uiInterval  Messintervall in 1s
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void PowerGov_SetInterval(uint16_t uiInterval)
+{
+  uiUserInterval = uiInterval;
+  uiActiveInterval = 0;
+  PowerGov_ApplyInterval();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Aktiv eingestelltes Messintervall abfragen
+ *
+ * @return    uint16_t  Messintervall in 1s
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t PowerGov_GetInterval(void)
+{
+  return uiActiveInterval;
+}
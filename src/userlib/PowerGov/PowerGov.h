@@ -0,0 +1,59 @@
+/*!****************************************************************************
+ * @file
+ * PowerGov.h
+ *
+ * Lastabwurf in Stufen abhngig von Batteriespannung und Ladezustand
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef POWERGOV_H_
+#define POWERGOV_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Dauer in s, die eine Schwelle anliegen muss, bevor die Stufe wechselt     */
+#define POWERGOV_DEBOUNCE       60
+
+/*! Messintervall in s nach dem Einschalten                                   */
+#define POWERGOV_DEFAULT_INTV   10
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Versorgungsstufen, aufsteigend nach Einsparung sortiert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_PowerGov_Tier {
+  /*! Volle Funktion                                      */
+  PowerGov_Tier_FULL,
+  
+  /*! Lngeres Messintervall, krzeres Advertising        */
+  PowerGov_Tier_REDUCED,
+  
+  /*! Zustzlich keine Nachfhrung des Panels             */
+  PowerGov_Tier_NOTRACK,
+  
+  /*! Zustzlich kein GPS                                 */
+  PowerGov_Tier_NOGPS,
+  
+  /*! Nur noch Messwertprotokoll auf SD-Karte             */
+  PowerGov_Tier_MINIMAL
+} PowerGov_Tier;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void PowerGov_Init(void);
+void PowerGov_Task1s(uint16_t uiBatVolt, uint8_t ucSoC);
+
+PowerGov_Tier PowerGov_GetTier(void);
+void PowerGov_SetInterval(uint16_t uiInterval);
+uint16_t PowerGov_GetInterval(void);
+
+#endif /* POWERGOV_H_ */
@@ -0,0 +1,198 @@
+/*!****************************************************************************
+ * @file
+ * Profiler.c
+ *
+ * Laufzeitmessung ber TIM1, der seit Deferred_Init() mit 1 MHz frei luft.
+ * Der berlaufinterrupt erweitert den Zhler auf 32 Bit (71 min). Die Marken
+ * sind nur im Hauptprogramm bei freigegebenen Interrupts vorgesehen, je Zone
+ * darf hchstens eine Messung gleichzeitig laufen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "Profiler.h"
+
+#ifdef PROFILER
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Namen der Zonen fr die Ausgabe                                           */
+static const char* const apszZoneNames[Profiler_Zone_NUM] = {
+  "WKUP", "BME280", "QMC5883", "MPU6050", "SAVE", "TRKWK", "GUI", "GPS",
+  "DEFER", "NMEA", "BMECALC", "AZIM", "WIND", "SUNPOS", "CSV", "ATCMD"
+};
+
+/*! berlufe von TIM1, obere 16 Bit der Zeit                                 */
+static volatile uint16_t uiProfOverflow;
+
+/*! Startzeit je Zone in s                                                   */
+static uint32_t aulProfStart[Profiler_Zone_NUM];
+
+/*! Messwerte je Zone                                                         */
+static Profiler_Stats asProfStats[Profiler_Zone_NUM];
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Profiler initialisieren und berlaufinterrupt von TIM1 freigeben. Aufruf
+ * nach Deferred_Init().
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Profiler_Init(void)
+{
+  uiProfOverflow = 0;
+  Profiler_ClearStats();
+  
+  TIM1_ClearITPendingBit(TIM1_IT_Update);
+  TIM1_ITConfig(TIM1_IT_Update, ENABLE);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Startmarke einer Zone setzen
+ *
+ * @param[in] eZone     Zone
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Profiler_Begin(Profiler_Zone eZone)
+{
+  aulProfStart[eZone] = Profiler_GetTime();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Endmarke einer Zone setzen und die Laufzeit seit der Startmarke erfassen.
+ * Luft Anzahl oder Summe ber, bleiben die Messwerte stehen.
+ *
+ * @param[in] eZone     Zone
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Profiler_End(Profiler_Zone eZone)
+{
+  Profiler_Stats* pStats = &asProfStats[eZone];
+  uint32_t ulTime = Profiler_GetTime() - aulProfStart[eZone];
+  uint32_t ulBin;
+  uint8_t ucBin = 0;
+  
+  if ((pStats->uiCount == 0xFFFF) || (pStats->ulSum + ulTime < pStats->ulSum))
+  {
+    return;
+  }
+  
+  ++pStats->uiCount;
+  pStats->ulSum += ulTime;
+  if (ulTime < pStats->ulMin)
+  {
+    pStats->ulMin = ulTime;
+  }
+  if (ulTime > pStats->ulMax)
+  {
+    pStats->ulMax = ulTime;
+  }
+  
+  /* Histogrammklasse ber die Stellenzahl bestimmen      */
+  ulBin = ulTime >> PROFILER_HIST_SHIFT;
+  while ((ulBin != 0) && (ucBin < PROFILER_HIST_BINS - 1))
+  {
+    ulBin >>= 1;
+    ++ucBin;
+  }
+  if (pStats->auiHist[ucBin] < 0xFFFF)
+  {
+    ++pStats->auiHist[ucBin];
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zeit seit dem Start von TIM1 lesen
+ *
+ * @return    uint32_t  Zeit in s
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint32_t Profiler_GetTime(void)
+{
+  uint16_t uiHigh;
+  uint16_t uiLow;
+  
+  /* Wiederholen, falls dazwischen ein berlauf lag       */
+  do
+  {
+    uiHigh = uiProfOverflow;
+    uiLow = TIM1_GetCounter();
+  } while (uiHigh != uiProfOverflow);
+  
+  return ((uint32_t)uiHigh << 16) | uiLow;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Namen einer Zone abfragen
+ *
+ * @param[in] eZone     Zone
+ * @return    const char*   Name
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const char* Profiler_GetName(Profiler_Zone eZone)
+{
+  return apszZoneNames[eZone];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messwerte einer Zone abfragen
+ *
+ * @param[in] eZone     Zone
+ * @return    const Profiler_Stats*   Messwerte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Profiler_Stats* Profiler_GetStats(Profiler_Zone eZone)
+{
+  return &asProfStats[eZone];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Messwerte aller Zonen zurcksetzen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Profiler_ClearStats(void)
+{
+  uint8_t ucZone;
+  uint8_t ucBin;
+  
+  for (ucZone = 0; ucZone < Profiler_Zone_NUM; ++ucZone)
+  {
+    asProfStats[ucZone].uiCount = 0;
+    asProfStats[ucZone].ulMin = 0xFFFFFFFF;
+    asProfStats[ucZone].ulMax = 0;
+    asProfStats[ucZone].ulSum = 0;
+    for (ucBin = 0; ucBin < PROFILER_HIST_BINS; ++ucBin)
+    {
+      asProfStats[ucZone].auiHist[ucBin] = 0;
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Interrupthandler fr den berlauf von TIM1
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+INTERRUPT_HANDLER(Profiler_TimerInterrupt, 23)
+{
+  TIM1_ClearITPendingBit(TIM1_IT_Update);
+  ++uiProfOverflow;
+}
+
+#endif /* PROFILER */
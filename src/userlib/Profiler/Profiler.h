@@ -0,0 +1,137 @@
+/*!****************************************************************************
+ * @file
+ * Profiler.h
+ *
+ * Laufzeitmessung von Tasks und Treibern ber Start-/Endmarken. Je Zone
+ * werden Anzahl, Minimum, Mittelwert, Maximum und ein log2-Histogramm
+ * erfasst. Ohne den Compilerschalter PROFILER entfallen die Marken und das
+ * Modul vollstndig.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Anzahl der Histogrammklassen, Klasse 0 < 16 s, je Klasse Faktor 2        */
+#define PROFILER_HIST_BINS      16
+
+/*! Obergrenze der Klasse 0 als Zweierpotenz in s                            */
+#define PROFILER_HIST_SHIFT     4
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Messzonen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Profiler_Zone {
+  /*! Wakeup-Task: alle Sensoren abfragen                 */
+  Profiler_Zone_WKUP,
+  
+  /*! BME280_Update                                       */
+  Profiler_Zone_BME280,
+  
+  /*! QMC5883_Update                                      */
+  Profiler_Zone_QMC5883,
+  
+  /*! MPU6050_Update                                      */
+  Profiler_Zone_MPU6050,
+  
+  /*! SaveSensors: Ringspeicher und SD-Karte              */
+  Profiler_Zone_SAVE,
+  
+  /*! Tracking_TaskWakeup                                 */
+  Profiler_Zone_TRKWK,
+  
+  /*! ATCmd_GuiRead                                       */
+  Profiler_Zone_GUI,
+  
+  /*! NMEA-Auswertung und Stellen der Uhr                 */
+  Profiler_Zone_GPS,
+  
+  /*! Verzgerte Bearbeitung der Interrupts               */
+  Profiler_Zone_DEFER,
+  
+  /*! GPSHandler_ParseNmeaIn                              */
+  Profiler_Zone_NMEA,
+  
+  /*! BME280_CalcTemp/Press/Hum                           */
+  Profiler_Zone_BMECALC,
+  
+  /*! QMC5883_CalcAzimuth                                 */
+  Profiler_Zone_AZIM,
+  
+  /*! Wind_CalcAvgVelocity                                */
+  Profiler_Zone_WIND,
+  
+  /*! calculate_current_sun_position                      */
+  Profiler_Zone_SUNPOS,
+  
+  /*! Formatierung des Protokolleintrags (Logger)         */
+  Profiler_Zone_CSV,
+  
+  /*! Suche in der AT-Befehlstabelle                      */
+  Profiler_Zone_ATCMD,
+  
+  Profiler_Zone_NUM
+} Profiler_Zone;
+
+/*!****************************************************************************
+ * @brief
+ * Messwerte einer Zone
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Profiler_Stats {
+  /*! Anzahl der Messungen                                */
+  uint16_t uiCount;
+  
+  /*! Krzeste Laufzeit in s                             */
+  uint32_t ulMin;
+  
+  /*! Lngste Laufzeit in s                              */
+  uint32_t ulMax;
+  
+  /*! Summe der Laufzeiten in s fr den Mittelwert       */
+  uint32_t ulSum;
+  
+  /*! Histogramm, Klasse k bis 2^(k+4) s                 */
+  uint16_t auiHist[PROFILER_HIST_BINS];
+} Profiler_Stats;
+
+
+/*- Makros -------------------------------------------------------------------*/
+#ifdef PROFILER
+/*! Startmarke einer Zone                                                     */
+#define PROFILE_BEGIN(eZone)    Profiler_Begin(eZone)
+
+/*! Endmarke einer Zone                                                       */
+#define PROFILE_END(eZone)      Profiler_End(eZone)
+#else
+#define PROFILE_BEGIN(eZone)
+#define PROFILE_END(eZone)
+#endif /* PROFILER */
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+#ifdef PROFILER
+void Profiler_Init(void);
+void Profiler_Begin(Profiler_Zone eZone);
+void Profiler_End(Profiler_Zone eZone);
+uint32_t Profiler_GetTime(void);
+
+const char* Profiler_GetName(Profiler_Zone eZone);
+const Profiler_Stats* Profiler_GetStats(Profiler_Zone eZone);
+void Profiler_ClearStats(void);
+#endif /* PROFILER */
+
+#endif /* PROFILER_H_ */
@@ -0,0 +1,182 @@
+/*!****************************************************************************
+ * @file
+ * RamStat.c
+ *
+ * Das RAM ist ab Adresse 0 mit Zero-Page, .data und .bss belegt, das Ende der
+ * statischen Daten liefert der Linker als __memory. Der Stack wchst von
+ * RAMSTAT_RAM_END abwrts. Zu Beginn von main() wird der Bereich dazwischen
+ * mit einem Muster gefllt; die unterste berschriebene Adresse ergibt den
+ * Hchststand des Stacks seit dem Reset. Ohne Cosmic-Linker (Host-Build)
+ * liefern die Auswertungen 0.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "ff.h"
+#include "commlib.h"
+#include "app_sensors.h"
+#include "sensorlib_power.h"
+#include "SensorLog.h"
+#include "EnergyCounter.h"
+#include "Rollup.h"
+#include "Logger.h"
+#include "RamStat.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Abstand zum aktuellen Stackpointer beim Fllen in Byte                    */
+#define RAMSTAT_PAINT_MARGIN    16
+
+
+/*- Globale Variablen --------------------------------------------------------*/
+#ifdef _COSMIC_
+/*! Ende der statischen Daten (Linkersymbol __memory)                         */
+extern uint8_t _memory[];
+#endif /* _COSMIC_ */
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Statische Belegung der grten Module, der Rest wird berechnet            */
+static const RamStat_Module asRamModules[] = {
+  {"FATFS",   sizeof(FATFS)},
+  {"UART1",   sizeof(aucUart1TxBuf) + sizeof(aucUart1RxBuf)},
+  {"UART3",   sizeof(aucUart3TxBuf) + sizeof(aucUart3RxBuf)},
+  {"LOG",     sizeof(SensorLogSlot) * NUM_SENSORLOG_RINGITEMS},
+  {"SENSOR",  sizeof(sSensorBME280) + sizeof(sSensorWind) +
+              sizeof(sSensorCPUTemp) + sizeof(sSensorQMC5883) +
+              sizeof(sSensorMPU6050) + sizeof(sSensorGPS) +
+              2 * sizeof(Power_Sensor)},
+  {"ENERGY",  sizeof(sEnergy)},
+  {"ROLLUP",  sizeof(Rollup_Entry) * (ROLLUP_HOUR_ITEMS + ROLLUP_DAY_ITEMS) +
+              sizeof(Rollup_Sum) * Rollup_Level_NUM},
+  {"LINE",    sizeof(acLoggerLine)}
+};
+#define NUM_RAMSTAT_MODULES (sizeof(asRamModules)/sizeof(*asRamModules))
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+#ifdef _COSMIC_
+/*!****************************************************************************
+ * @brief
+ * Unterste vom Stack berschriebene Adresse suchen
+ *
+ * @return    uint8_t*  Erste Adresse oberhalb des unberhrten Musters
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t* RamStat_FindStackLow(void)
+{
+  uint8_t* pucRam = _memory;
+  
+  while ((pucRam <= (uint8_t*)RAMSTAT_RAM_END) && (*pucRam == RAMSTAT_PATTERN))
+  {
+    ++pucRam;
+  }
+  
+  return pucRam;
+}
+#endif /* _COSMIC_ */
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Freien Stack mit dem Fllmuster beschreiben. Aufruf als erste Anweisung
+ * in main(), solange die Interrupts noch gesperrt sind.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void RamStat_Paint(void)
+{
+#ifdef _COSMIC_
+  volatile uint8_t ucMark;
+  uint8_t* pucRam = _memory;
+  uint8_t* pucEnd = (uint8_t*)&ucMark - RAMSTAT_PAINT_MARGIN;
+  
+  while (pucRam < pucEnd)
+  {
+    *pucRam = RAMSTAT_PATTERN;
+    ++pucRam;
+  }
+#endif /* _COSMIC_ */
+}
+
+/*!****************************************************************************
+ * @brief
+ * Statisch belegtes RAM (Zero-Page, .data, .bss) abfragen
+ *
+ * @return    uint16_t  Belegung in Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t RamStat_GetStatic(void)
+{
+#ifdef _COSMIC_
+  return (uint16_t)_memory;
+#else
+  return 0;
+#endif /* _COSMIC_ */
+}
+
+/*!****************************************************************************
+ * @brief
+ * Hchststand des Stacks seit dem Reset abfragen
+ *
+ * @return    uint16_t  Belegung in Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t RamStat_GetStackUsed(void)
+{
+#ifdef _COSMIC_
+  return (uint16_t)(RAMSTAT_RAM_END + 1 - (uint16_t)RamStat_FindStackLow());
+#else
+  return 0;
+#endif /* _COSMIC_ */
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nie benutzten Bereich zwischen statischen Daten und Stack abfragen
+ *
+ * @return    uint16_t  Reserve in Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t RamStat_GetStackFree(void)
+{
+#ifdef _COSMIC_
+  return (uint16_t)(RamStat_FindStackLow() - _memory);
+#else
+  return 0;
+#endif /* _COSMIC_ */
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anzahl der aufgefhrten Module abfragen
+ *
+ * @return    uint8_t   Anzahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t RamStat_GetNumModules(void)
+{
+  return NUM_RAMSTAT_MODULES;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Statische Belegung eines Moduls abfragen
+ *
+ * @param[in] ucIdx     Index
+ * @return    const RamStat_Module*   Name und Belegung
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const RamStat_Module* RamStat_GetModule(uint8_t ucIdx)
+{
+  return &asRamModules[ucIdx];
+}
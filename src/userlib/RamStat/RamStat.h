@@ -0,0 +1,52 @@
+/*!****************************************************************************
+ * @file
+ * RamStat.h
+ *
+ * Auswertung der RAM-Belegung: Stack-Fllmuster nach dem Reset mit
+ * Hchststand und statische Belegung der grten Module
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef RAMSTAT_H_
+#define RAMSTAT_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Letzte RAM-Adresse, Startwert des Stackpointers (STM8L152R8, 4 KB)        */
+#define RAMSTAT_RAM_END         0x0FFF
+
+/*! Fllmuster fr den freien Stack                                           */
+#define RAMSTAT_PATTERN         0xA5
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Statische RAM-Belegung eines Moduls
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_RamStat_Module {
+  /*! Kurzname fr die Ausgabe                            */
+  const char* pszName;
+  
+  /*! Belegung in Byte                                    */
+  uint16_t uiSize;
+} RamStat_Module;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void RamStat_Paint(void);
+uint16_t RamStat_GetStatic(void);
+uint16_t RamStat_GetStackUsed(void);
+uint16_t RamStat_GetStackFree(void);
+
+uint8_t RamStat_GetNumModules(void);
+const RamStat_Module* RamStat_GetModule(uint8_t ucIdx);
+
+#endif /* RAMSTAT_H_ */
@@ -0,0 +1,683 @@
+/*!****************************************************************************
+ * @file
+ * Rollup.c
+ *
+ * Jeder Eintrag wird in die Summe der laufenden Stunde eingerechnet. Beim
+ * Stundenwechsel wird die Stunde abgeschlossen, im RAM-Ring abgelegt und in
+ * die Summe des laufenden Tages eingerechnet; der Tag wird ebenso beim
+ * Tageswechsel abgeschlossen. Tageswerte entstehen so allein aus den
+ * Stundenwerten, ohne die Einzelwerte ein zweites Mal anzufassen.
+ *
+ * Die Dateien LOG/HOUR.RUP und LOG/DAY.RUP haben je Zeitraum einen festen
+ * Platz (Zeitraum seit 1970 modulo Anzahl der Pltze) und wachsen nicht ber
+ * ROLLUP_HOUR_SLOTS bzw. ROLLUP_DAY_SLOTS Eintrge hinaus. Ein Platz gilt
+ * nur, wenn die Zeit im Eintrag zum gesuchten Zeitraum passt. Der RAM-Ring
+ * hlt nur abgeschlossene Zeitrume, bis sie geschrieben sind; schlgt das
+ * Schreiben fehl, wird es beim nchsten Wechsel oder mit AT+CROLLUP
+ * wiederholt.
+ *
+ * Nach einem Neustart wird die Tagessumme beim ersten Eintrag aus den schon
+ * geschriebenen Stunden des Tages wiederhergestellt.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Abgeschlossene Zeitrume nur noch auf der Karte
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <string.h>
+#include "ff.h"
+#include "Logger.h"
+#include "Rollup.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Verzeichnis der Dateien, wie beim Protokoll                               */
+#define ROLLUP_DIR              "LOG"
+
+/*! Sekunden je Stunde und je Tag                                             */
+#define ROLLUP_HOUR_SECONDS     3600UL
+#define ROLLUP_DAY_SECONDS      86400UL
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Feste Eigenschaften einer Stufe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Rollup_LevelConf {
+  /*! Lnge eines Zeitraums in s                          */
+  uint32_t ulStep;
+  
+  /*! Pltze im RAM-Ring                                  */
+  uint8_t ucItems;
+  
+  /*! Pltze in der Datei                                 */
+  uint16_t uiSlots;
+  
+  /*! RAM-Ring                                            */
+  Rollup_Entry* pRing;
+  
+  /*! Name der Datei                                      */
+  const char* pszFile;
+} Rollup_LevelConf;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Abgeschlossene Stunden                                                    */
+static Rollup_Entry asRollupHour[ROLLUP_HOUR_ITEMS];
+
+/*! Abgeschlossene Tage                                                       */
+static Rollup_Entry asRollupDay[ROLLUP_DAY_ITEMS];
+
+/*! Laufende Stunde und laufender Tag                                         */
+static Rollup_Sum asRollupSum[Rollup_Level_NUM];
+
+/*! Nchster Platz im RAM-Ring je Stufe                                       */
+static uint8_t aucRollupHead[Rollup_Level_NUM];
+
+/*! Neueste Eintrge im RAM-Ring, die noch nicht auf der Karte stehen         */
+static uint8_t aucRollupPending[Rollup_Level_NUM];
+
+/*! Tagessumme nach dem Start schon von der Karte geladen                     */
+static bool bRollupRestored;
+
+/*! Zhler                                                                    */
+static Rollup_Stats sRollupStats;
+
+/*! Eigenschaften der Stufen                                                  */
+static const Rollup_LevelConf asRollupLevel[Rollup_Level_NUM] = {
+  {ROLLUP_HOUR_SECONDS, ROLLUP_HOUR_ITEMS, ROLLUP_HOUR_SLOTS, asRollupHour,
+    ROLLUP_DIR "/HOUR.RUP"},
+  {ROLLUP_DAY_SECONDS,  ROLLUP_DAY_ITEMS,  ROLLUP_DAY_SLOTS,  asRollupDay,
+    ROLLUP_DIR "/DAY.RUP"}
+};
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Summe fr einen neuen Zeitraum leeren
+ *
+ * @param[out] *pSum    Summe
+ * @param[in] ulTime    Beginn des Zeitraums
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Rollup_Clear(Rollup_Sum* pSum, uint32_t ulTime)
+{
+  memset(pSum, 0, sizeof(*pSum));
+  pSum->ulTime = ulTime;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag des Ringspeichers in die Einheiten der verdichteten Felder
+ * umrechnen
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ * @param[out] aiValue  Werte je Feld (Rollup_Field)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Rollup_GetValues(const SensorLogItem* pLog, int16_t* aiValue)
+{
+  aiValue[Rollup_Field_TEMP] = pLog->sTemperature.iBME;
+  aiValue[Rollup_Field_PRES] = (int16_t)(pLog->ulPressure / 10);
+  aiValue[Rollup_Field_HUM] = (int16_t)((pLog->ulHumidity * 100) >> 10);
+  aiValue[Rollup_Field_WIND] = (int16_t)pLog->sWind.uiVelo;
+  aiValue[Rollup_Field_BAT] = (int16_t)pLog->sPower.uiBatVolt;
+  aiValue[Rollup_Field_PV] = pLog->sPower.iPanelCurr;
+  aiValue[Rollup_Field_SOC] = pLog->sEnergy.ucSoC;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Summe eines abgeschlossenen Zeitraums in die Summe der nchsten Stufe
+ * einrechnen. Die Position wird bernommen, wenn sie gltig ist.
+ *
+ * @param[in,out] *pDst Summe der nchsten Stufe
+ * @param[in] *pSrc     Abgeschlossener Zeitraum
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Rollup_Merge(Rollup_Sum* pDst, const Rollup_Sum* pSrc)
+{
+  uint8_t ucField;
+  
+  if (pSrc->uiCount == 0)
+  {
+    return;
+  }
+  
+  for (ucField = 0; ucField < Rollup_Field_NUM; ++ucField)
+  {
+    if (pDst->uiCount == 0)
+    {
+      pDst->aiMin[ucField] = pSrc->aiMin[ucField];
+      pDst->aiMax[ucField] = pSrc->aiMax[ucField];
+      pDst->alSum[ucField] = pSrc->alSum[ucField];
+      continue;
+    }
+    if (pSrc->aiMin[ucField] < pDst->aiMin[ucField])
+    {
+      pDst->aiMin[ucField] = pSrc->aiMin[ucField];
+    }
+    if (pSrc->aiMax[ucField] > pDst->aiMax[ucField])
+    {
+      pDst->aiMax[ucField] = pSrc->aiMax[ucField];
+    }
+    pDst->alSum[ucField] += pSrc->alSum[ucField];
+  }
+  pDst->uiCount += pSrc->uiCount;
+  
+  if ((pSrc->ucStatus & SENSORLOG_STATUS_POS) != 0)
+  {
+    pDst->lLat = pSrc->lLat;
+    pDst->lLong = pSrc->lLong;
+  }
+  if ((pSrc->ucStatus & SENSORLOG_STATUS_ALT) != 0)
+  {
+    pDst->iAlt = pSrc->iAlt;
+  }
+  pDst->ucStatus = pSrc->ucStatus
+    | (pDst->ucStatus & (SENSORLOG_STATUS_POS | SENSORLOG_STATUS_ALT));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Summe in einen Eintrag mit Mittelwerten umrechnen
+ *
+ * @param[in] *pSum     Summe
+ * @param[out] *pEntry  Eintrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Rollup_MakeEntry(const Rollup_Sum* pSum, Rollup_Entry* pEntry)
+{
+  uint8_t ucField;
+  
+  pEntry->ulTime = pSum->ulTime;
+  pEntry->uiCount = pSum->uiCount;
+  for (ucField = 0; ucField < Rollup_Field_NUM; ++ucField)
+  {
+    pEntry->asValue[ucField].iMin = pSum->aiMin[ucField];
+    pEntry->asValue[ucField].iMax = pSum->aiMax[ucField];
+    pEntry->asValue[ucField].iMean = (pSum->uiCount == 0) ? 0
+      : (int16_t)(pSum->alSum[ucField] / (int32_t)pSum->uiCount);
+  }
+  pEntry->lLat = pSum->lLat;
+  pEntry->lLong = pSum->lLong;
+  pEntry->iAlt = pSum->iAlt;
+  pEntry->ucStatus = pSum->ucStatus;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag in eine Summe zurckrechnen. Die Summe ergibt sich aus Mittelwert
+ * und Anzahl, der Rundungsfehler bleibt unter einer Einheit je Eintrag.
+ *
+ * @param[in] *pEntry   Eintrag
+ * @param[out] *pSum    Summe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Rollup_MakeSum(const Rollup_Entry* pEntry, Rollup_Sum* pSum)
+{
+  uint8_t ucField;
+  
+  pSum->ulTime = pEntry->ulTime;
+  pSum->uiCount = pEntry->uiCount;
+  for (ucField = 0; ucField < Rollup_Field_NUM; ++ucField)
+  {
+    pSum->aiMin[ucField] = pEntry->asValue[ucField].iMin;
+    pSum->aiMax[ucField] = pEntry->asValue[ucField].iMax;
+    pSum->alSum[ucField] = (int32_t)pEntry->asValue[ucField].iMean
+      * pEntry->uiCount;
+  }
+  pSum->lLat = pEntry->lLat;
+  pSum->lLong = pEntry->lLong;
+  pSum->iAlt = pEntry->iAlt;
+  pSum->ucStatus = pEntry->ucStatus;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datei einer Stufe ffnen, zum Schreiben wird sie samt Verzeichnis
+ * angelegt, falls sie fehlt
+ *
+ * @param[out] *pFile   Dateiobjekt
+ * @param[in] eLevel    Stufe
+ * @param[in] bWrite    true: zum Schreiben ffnen
+ * @return    bool      true, wenn geffnet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Rollup_Open(FIL* pFile, Rollup_Level eLevel, bool bWrite)
+{
+  const char* pszFile = asRollupLevel[eLevel].pszFile;
+  FRESULT eRes;
+  
+  if (!bWrite)
+  {
+    return (f_open(pFile, pszFile, FA_READ | FA_OPEN_EXISTING) == FR_OK);
+  }
+  
+  eRes = f_open(pFile, pszFile, FA_WRITE | FA_OPEN_ALWAYS);
+  if ((eRes == FR_NO_PATH) && (f_mkdir(ROLLUP_DIR) == FR_OK))
+  {
+    eRes = f_open(pFile, pszFile, FA_WRITE | FA_OPEN_ALWAYS);
+  }
+  return (eRes == FR_OK);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Dateiposition des Platzes fr einen Zeitraum
+ *
+ * @param[in] eLevel    Stufe
+ * @param[in] ulTime    Beginn des Zeitraums
+ * @return    uint32_t  Position in Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint32_t Rollup_GetSlotOffs(Rollup_Level eLevel, uint32_t ulTime)
+{
+  const Rollup_LevelConf* pConf = &asRollupLevel[eLevel];
+  
+  return (ulTime / pConf->ulStep % pConf->uiSlots) * sizeof(Rollup_Entry);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Platz eines Zeitraums aus der geffneten Datei lesen
+ *
+ * @param[in] *pFile    Geffnete Datei der Stufe
+ * @param[in] eLevel    Stufe
+ * @param[in] ulTime    Beginn des Zeitraums
+ * @param[out] *pEntry  Eintrag
+ * @return    bool      true, wenn der Platz diesen Zeitraum enthlt
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Rollup_ReadSlot(FIL* pFile, Rollup_Level eLevel, uint32_t ulTime,
+  Rollup_Entry* pEntry)
+{
+  UINT uiRead;
+  
+  return (f_lseek(pFile, Rollup_GetSlotOffs(eLevel, ulTime)) == FR_OK)
+    && (f_read(pFile, pEntry, sizeof(*pEntry), &uiRead) == FR_OK)
+    && (uiRead == sizeof(*pEntry))
+    && (pEntry->ulTime == ulTime)
+    && (pEntry->uiCount != 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Noch nicht geschriebene Eintrge des RAM-Rings einer Stufe auf ihre
+ * Pltze in der Datei schreiben, lteste zuerst
+ *
+ * @param[in] eLevel    Stufe
+ * @return    bool      true, wenn keine Eintrge mehr ausstehen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Rollup_Persist(Rollup_Level eLevel)
+{
+  const Rollup_LevelConf* pConf = &asRollupLevel[eLevel];
+  const Rollup_Entry* pEntry;
+  FIL fil;
+  UINT uiWritten;
+  uint8_t ucIdx;
+  
+  if (aucRollupPending[eLevel] == 0)
+  {
+    return true;
+  }
+  if (!Rollup_Open(&fil, eLevel, true))
+  {
+    return false;
+  }
+  
+  while (aucRollupPending[eLevel] > 0)
+  {
+    ucIdx = (uint8_t)((aucRollupHead[eLevel] + pConf->ucItems
+      - aucRollupPending[eLevel]) % pConf->ucItems);
+    pEntry = &pConf->pRing[ucIdx];
+    if ((f_lseek(&fil, Rollup_GetSlotOffs(eLevel, pEntry->ulTime)) != FR_OK)
+      || (f_write(&fil, pEntry, sizeof(*pEntry), &uiWritten) != FR_OK)
+      || (uiWritten != sizeof(*pEntry)))
+    {
+      break;
+    }
+    --aucRollupPending[eLevel];
+    ++sRollupStats.uiWrites;
+  }
+  f_close(&fil);
+  
+  return (aucRollupPending[eLevel] == 0);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufenden Zeitraum einer Stufe abschlieen: in den RAM-Ring bernehmen,
+ * auf die Karte schreiben und bei Stunden in den Tag einrechnen
+ *
+ * @param[in] eLevel    Stufe
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Rollup_Close(Rollup_Level eLevel)
+{
+  const Rollup_LevelConf* pConf = &asRollupLevel[eLevel];
+  Rollup_Sum* pSum = &asRollupSum[eLevel];
+  Rollup_Sum* pDay = &asRollupSum[Rollup_Level_DAY];
+  
+  if (pSum->uiCount == 0)
+  {
+    return;
+  }
+  
+  Rollup_MakeEntry(pSum, &pConf->pRing[aucRollupHead[eLevel]]);
+  aucRollupHead[eLevel] = (uint8_t)((aucRollupHead[eLevel] + 1) % pConf->ucItems);
+  if (aucRollupPending[eLevel] < pConf->ucItems)
+  {
+    ++aucRollupPending[eLevel];
+  }
+  else
+  {
+    /* ltester ungeschriebener Eintrag berschrieben     */
+    ++sRollupStats.uiLost;
+  }
+  Rollup_Persist(eLevel);
+  
+  if (eLevel == Rollup_Level_HOUR)
+  {
+    if (pDay->uiCount == 0)
+    {
+      Rollup_Clear(pDay, pSum->ulTime - pSum->ulTime % ROLLUP_DAY_SECONDS);
+    }
+    Rollup_Merge(pDay, pSum);
+  }
+  pSum->uiCount = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Tagessumme nach dem Start aus den geschriebenen Stunden des Tages vor
+ * der laufenden Stunde wiederherstellen
+ *
+ * @param[in] ulHour    Beginn der laufenden Stunde
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Rollup_Restore(uint32_t ulHour)
+{
+  Rollup_Sum* pDay = &asRollupSum[Rollup_Level_DAY];
+  Rollup_Entry sEntry;
+  Rollup_Sum sHour;
+  uint32_t ulTime;
+  FIL fil;
+  
+  bRollupRestored = true;
+  if (!Rollup_Open(&fil, Rollup_Level_HOUR, false))
+  {
+    return;
+  }
+  
+  for (ulTime = pDay->ulTime; ulTime < ulHour; ulTime += ROLLUP_HOUR_SECONDS)
+  {
+    if (Rollup_ReadSlot(&fil, Rollup_Level_HOUR, ulTime, &sEntry))
+    {
+      Rollup_MakeSum(&sEntry, &sHour);
+      Rollup_Merge(pDay, &sHour);
+      ++sRollupStats.ucRestored;
+    }
+  }
+  f_close(&fil);
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Summen und RAM-Ringe leeren
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Rollup_Init(void)
+{
+  memset(asRollupHour, 0, sizeof(asRollupHour));
+  memset(asRollupDay, 0, sizeof(asRollupDay));
+  memset(asRollupSum, 0, sizeof(asRollupSum));
+  memset(aucRollupHead, 0, sizeof(aucRollupHead));
+  memset(aucRollupPending, 0, sizeof(aucRollupPending));
+  memset(&sRollupStats, 0, sizeof(sRollupStats));
+  bRollupRestored = false;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag des Ringspeichers einrechnen. Beginnt damit eine neue Stunde
+ * bzw. ein neuer Tag, wird der vorherige Zeitraum abgeschlossen. Aufruf
+ * nach dem Fllen des Eintrags in SaveSensors().
+ *
+ * @param[in] *pLog     Eintrag des Ringspeichers
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Rollup_Add(const SensorLogItem* pLog)
+{
+  Rollup_Sum* pHour = &asRollupSum[Rollup_Level_HOUR];
+  Rollup_Sum* pDay = &asRollupSum[Rollup_Level_DAY];
+  int16_t aiValue[Rollup_Field_NUM];
+  uint32_t ulTime = Logger_GetTime(pLog);
+  uint32_t ulHour = ulTime - ulTime % ROLLUP_HOUR_SECONDS;
+  uint32_t ulDay = ulTime - ulTime % ROLLUP_DAY_SECONDS;
+  uint8_t ucField;
+  
+  /* Abgeschlossene Zeitrume, auch bei Zeitsprngen      */
+  if ((pHour->uiCount != 0) && (pHour->ulTime != ulHour))
+  {
+    Rollup_Close(Rollup_Level_HOUR);
+  }
+  if ((pDay->uiCount != 0) && (pDay->ulTime != ulDay))
+  {
+    Rollup_Close(Rollup_Level_DAY);
+  }
+  
+  if (pDay->uiCount == 0)
+  {
+    Rollup_Clear(pDay, ulDay);
+    if (!bRollupRestored)
+    {
+      Rollup_Restore(ulHour);
+    }
+  }
+  if (pHour->uiCount == 0)
+  {
+    Rollup_Clear(pHour, ulHour);
+  }
+  
+  Rollup_GetValues(pLog, aiValue);
+  for (ucField = 0; ucField < Rollup_Field_NUM; ++ucField)
+  {
+    if ((pHour->uiCount == 0) || (aiValue[ucField] < pHour->aiMin[ucField]))
+    {
+      pHour->aiMin[ucField] = aiValue[ucField];
+    }
+    if ((pHour->uiCount == 0) || (aiValue[ucField] > pHour->aiMax[ucField]))
+    {
+      pHour->aiMax[ucField] = aiValue[ucField];
+    }
+    pHour->alSum[ucField] += aiValue[ucField];
+  }
+  ++pHour->uiCount;
+  
+  if ((pLog->ucStatus & SENSORLOG_STATUS_POS) != 0)
+  {
+    pHour->lLat = pLog->sPosition.lLat;
+    pHour->lLong = pLog->sPosition.lLong;
+  }
+  if ((pLog->ucStatus & SENSORLOG_STATUS_ALT) != 0)
+  {
+    pHour->iAlt = pLog->sPosition.iAlt;
+  }
+  pHour->ucStatus = pLog->ucStatus
+    | (pHour->ucStatus & (SENSORLOG_STATUS_POS | SENSORLOG_STATUS_ALT));
+  
+  ++sRollupStats.uiSamples;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ausstehende abgeschlossene Zeitrume beider Stufen auf die Karte
+ * schreiben
+ *
+ * @return    bool      true, wenn keine Eintrge mehr ausstehen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Rollup_Flush(void)
+{
+  bool bHour = Rollup_Persist(Rollup_Level_HOUR);
+  bool bDay = Rollup_Persist(Rollup_Level_DAY);
+  
+  return bHour && bDay;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Beginn des laufenden Zeitraums einer Stufe abfragen
+ *
+ * @param[in] eLevel    Stufe
+ * @return    uint32_t  Unix-Zeit in s, 0: noch kein Eintrag seit dem Start
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint32_t Rollup_GetCurrent(Rollup_Level eLevel)
+{
+  const Rollup_Sum* pHour = &asRollupSum[Rollup_Level_HOUR];
+  
+  if (pHour->uiCount == 0)
+  {
+    return 0;
+  }
+  return pHour->ulTime - pHour->ulTime % asRollupLevel[eLevel].ulStep;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Lnge eines Zeitraums abfragen
+ *
+ * @param[in] eLevel    Stufe
+ * @return    uint32_t  Lnge in s
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint32_t Rollup_GetStep(Rollup_Level eLevel)
+{
+  return asRollupLevel[eLevel].ulStep;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anzahl der Pltze in der Datei einer Stufe abfragen, so weit reicht eine
+ * Abfrage zurck
+ *
+ * @param[in] eLevel    Stufe
+ * @return    uint16_t  Anzahl der Zeitrume
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t Rollup_GetSlots(Rollup_Level eLevel)
+{
+  return asRollupLevel[eLevel].uiSlots;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Verdichtete Werte eines Zeitraums abfragen. Der laufende Zeitraum wird
+ * aus den Summen gebildet, beim Tag einschlielich der laufenden Stunde.
+ * Abgeschlossene Zeitrume kommen aus dem RAM-Ring oder von der Karte.
+ *
+ * @param[in] eLevel    Stufe
+ * @param[in] ulTime    Beginn des Zeitraums
+ * @param[out] *pEntry  Eintrag
+ * @return    bool      true, wenn fr den Zeitraum Werte vorliegen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Rollup_Get(Rollup_Level eLevel, uint32_t ulTime, Rollup_Entry* pEntry)
+{
+  const Rollup_LevelConf* pConf = &asRollupLevel[eLevel];
+  Rollup_Sum sSum;
+  FIL fil;
+  uint8_t ucIdx;
+  bool bOk;
+  
+  /* Laufender Zeitraum                                   */
+  if ((ulTime != 0) && (ulTime == Rollup_GetCurrent(eLevel)))
+  {
+    sSum = asRollupSum[eLevel];
+    if (eLevel == Rollup_Level_DAY)
+    {
+      if (sSum.uiCount == 0)
+      {
+        sSum.ulTime = ulTime;
+      }
+      Rollup_Merge(&sSum, &asRollupSum[Rollup_Level_HOUR]);
+    }
+    Rollup_MakeEntry(&sSum, pEntry);
+    return true;
+  }
+  
+  /* RAM-Ring                                             */
+  for (ucIdx = 0; ucIdx < pConf->ucItems; ++ucIdx)
+  {
+    if ((pConf->pRing[ucIdx].ulTime == ulTime)
+      && (pConf->pRing[ucIdx].uiCount != 0))
+    {
+      *pEntry = pConf->pRing[ucIdx];
+      return true;
+    }
+  }
+  
+  /* Datei                                                */
+  if (!Rollup_Open(&fil, eLevel, false))
+  {
+    return false;
+  }
+  bOk = Rollup_ReadSlot(&fil, eLevel, ulTime, pEntry);
+  f_close(&fil);
+  return bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anzahl der abgeschlossenen Zeitrume einer Stufe abfragen, die noch
+ * nicht auf der Karte stehen
+ *
+ * @param[in] eLevel    Stufe
+ * @return    uint8_t   Anzahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t Rollup_GetPending(Rollup_Level eLevel)
+{
+  return aucRollupPending[eLevel];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhler der Verdichtung abfragen
+ *
+ * @return    const Rollup_Stats*  Zhler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Rollup_Stats* Rollup_GetStats(void)
+{
+  return &sRollupStats;
+}
@@ -0,0 +1,197 @@
+/*!****************************************************************************
+ * @file
+ * Rollup.h
+ *
+ * Verdichtung der Messwerte zu Stunden- und Tageswerten: Minimum, Maximum,
+ * Mittelwert und Anzahl je Feld, dazu die letzte gltige Position. Jeder
+ * Eintrag des Ringspeichers wird in die laufende Stunde eingerechnet, jede
+ * abgeschlossene Stunde in den laufenden Tag. Abgeschlossene Zeitrume
+ * werden beim Wechsel in eine Datei fester Gre auf der SD-Karte
+ * geschrieben (LOG/HOUR.RUP bzw. LOG/DAY.RUP, ein Platz je Zeitraum im
+ * Umlauf), im RAM bleibt je Stufe nur der zuletzt abgeschlossene, bis er
+ * geschrieben ist. AT+CROLLUP liest sie aus.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Abgeschlossene Zeitrume nur noch auf der Karte
+ ******************************************************************************/
+
+#ifndef ROLLUP_H_
+#define ROLLUP_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "SensorLog.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Abgeschlossene, noch nicht geschriebene Stunden im RAM                   */
+#define ROLLUP_HOUR_ITEMS       1
+
+/*! Abgeschlossene, noch nicht geschriebene Tage im RAM                       */
+#define ROLLUP_DAY_ITEMS        1
+
+/*! Pltze der Stundendatei: eine Woche                                       */
+#define ROLLUP_HOUR_SLOTS       168
+
+/*! Pltze der Tagesdatei: ein Vierteljahr                                    */
+#define ROLLUP_DAY_SLOTS        92
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Stufe der Verdichtung. Die Werte werden von AT+CROLLUP verwendet und
+ * drfen sich nicht ndern.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Rollup_Level {
+  /*! Stundenwerte, LOG/HOUR.RUP                          */
+  Rollup_Level_HOUR,
+  
+  /*! Tageswerte aus den Stundenwerten, LOG/DAY.RUP       */
+  Rollup_Level_DAY,
+  
+  Rollup_Level_NUM
+} Rollup_Level;
+
+/*!****************************************************************************
+ * @brief
+ * Verdichtete Felder. Die Reihenfolge bestimmt die Lage in der Datei und
+ * in der Ausgabe von AT+CROLLUP, neue Felder werden angehngt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Rollup_Field {
+  /*! Lufttemperatur BME280 in 0.01C                     */
+  Rollup_Field_TEMP,
+  
+  /*! Luftdruck in 0.1 hPa                                */
+  Rollup_Field_PRES,
+  
+  /*! Luftfeuchte in 0.01 %RH                             */
+  Rollup_Field_HUM,
+  
+  /*! Windgeschwindigkeit wie im Ringspeicher             */
+  Rollup_Field_WIND,
+  
+  /*! Batteriespannung in 1mV                             */
+  Rollup_Field_BAT,
+  
+  /*! Panelstrom in 1mA                                   */
+  Rollup_Field_PV,
+  
+  /*! Ladezustand in 1%                                   */
+  Rollup_Field_SOC,
+  
+  Rollup_Field_NUM
+} Rollup_Field;
+
+/*!****************************************************************************
+ * @brief
+ * Kennwerte eines Feldes in einem Zeitraum
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Rollup_Value {
+  /*! Kleinster Wert                                      */
+  int16_t iMin;
+  
+  /*! Grter Wert                                        */
+  int16_t iMax;
+  
+  /*! Mittelwert                                          */
+  int16_t iMean;
+} Rollup_Value;
+
+/*!****************************************************************************
+ * @brief
+ * Abgeschlossener Zeitraum im RAM und in der Datei, ohne Fllbyte. Die
+ * Datei liest nur die Firmware selbst (AT+CROLLUP, Wiederherstellung des
+ * Tages), Mehrbytewerte stehen darin wie im Speicher des Rechners.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Byte-Reihenfolge richtiggestellt
+ ******************************************************************************/
+typedef struct tag_Rollup_Entry {
+  /*! Beginn des Zeitraums als Unix-Zeit in s (UTC)       */
+  uint32_t ulTime;
+  
+  /*! Anzahl der eingerechneten Eintrge, 0: leer         */
+  uint16_t uiCount;
+  
+  /*! Kennwerte je Feld (Rollup_Field)                    */
+  Rollup_Value asValue[Rollup_Field_NUM];
+  
+  /*! Letzte gltige GPS-Position                         */
+  int32_t lLat;
+  int32_t lLong;
+  int16_t iAlt;
+  
+  /*! Zustandsbits des letzten Eintrags (SENSORLOG_...)   */
+  uint8_t ucStatus;
+} Rollup_Entry;
+
+/*!****************************************************************************
+ * @brief
+ * Laufender Zeitraum: Summen statt Mittelwerten, damit Stunden zu Tagen
+ * zusammengefasst werden knnen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Rollup_Sum {
+  /*! Beginn des Zeitraums als Unix-Zeit in s (UTC)       */
+  uint32_t ulTime;
+  
+  /*! Anzahl der eingerechneten Eintrge, 0: leer         */
+  uint16_t uiCount;
+  
+  /*! Kleinste und grte Werte, Summen je Feld           */
+  int16_t aiMin[Rollup_Field_NUM];
+  int16_t aiMax[Rollup_Field_NUM];
+  int32_t alSum[Rollup_Field_NUM];
+  
+  /*! Letzte gltige GPS-Position                         */
+  int32_t lLat;
+  int32_t lLong;
+  int16_t iAlt;
+  
+  /*! Zustandsbits des letzten Eintrags (SENSORLOG_...)   */
+  uint8_t ucStatus;
+} Rollup_Sum;
+
+/*!****************************************************************************
+ * @brief
+ * Zhler der Verdichtung seit dem Start
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Rollup_Stats {
+  /*! Eingerechnete Eintrge                              */
+  uint16_t uiSamples;
+  
+  /*! Auf die SD-Karte geschriebene Zeitrume             */
+  uint16_t uiWrites;
+  
+  /*! Vor dem Schreiben aus dem RAM verdrngte Zeitrume  */
+  uint16_t uiLost;
+  
+  /*! Nach dem Start von der Karte geladene Stunden       */
+  uint8_t ucRestored;
+} Rollup_Stats;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Rollup_Init(void);
+void Rollup_Add(const SensorLogItem* pLog);
+bool Rollup_Flush(void);
+
+uint32_t Rollup_GetCurrent(Rollup_Level eLevel);
+uint32_t Rollup_GetStep(Rollup_Level eLevel);
+uint16_t Rollup_GetSlots(Rollup_Level eLevel);
+bool Rollup_Get(Rollup_Level eLevel, uint32_t ulTime, Rollup_Entry* pEntry);
+uint8_t Rollup_GetPending(Rollup_Level eLevel);
+const Rollup_Stats* Rollup_GetStats(void);
+
+#endif /* ROLLUP_H_ */
@@ -0,0 +1,387 @@
+/*!****************************************************************************
+ * @file
+ * Scheduler.c
+ *
+ * Kooperativer Scheduler. Interrupts melden Ereignisse ber Sched_Post(),
+ * je Ereignis ein Byte fr den atomaren Zugriff. Sched_Run() bernimmt die
+ * Ereignisse, zhlt die Perioden im Sekundentakt und fhrt den bereiten Task
+ * mit der hchsten Prioritt aus; bei gleicher Prioritt gewinnt der frhere
+ * Tabelleneintrag. Nach jedem Task wird neu ausgewhlt, so dass z.B. der
+ * UART-Empfang vor noch wartender Massenarbeit an die Reihe kommt.
+ *
+ * Fr den Watchdog zhlt der Scheduler die Sekunden unabhngig von der Uhr
+ * mit, die beim Stellen ber GPS springen kann. Ein bereiter Task, der ein
+ * Vielfaches seiner Frist nicht zum Zug kommt, gilt als blockiert. Der
+ * laufende Task darf den Watchdog nur innerhalb seiner Frist nachladen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "powerlib.h"
+#include "Watchdog.h"
+#include "Scheduler.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Latenz in 1/256 s, ab der die Statistik in ms berluft                   */
+#define SCHED_LATENCY_MAX       ((65535UL * LOWPOWER_TICK_HZ) / 1000)
+
+/*! Vielfaches der Frist, ab dem ein wartender Task als blockiert gilt        */
+#define SCHED_STALL_FACTOR      4
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Anstehende Ereignisse, je Ereignis ein Byte                               */
+static volatile uint8_t aucEvents[Sched_Event_NUM];
+
+/*! Tasktabelle                                                               */
+static const Sched_Task* pSchedTasks;
+
+/*! Anzahl der Tasks                                                          */
+static uint8_t ucSchedNum;
+
+/*! Task ist bereit                                                           */
+static bool abReady[SCHED_MAX_TASKS];
+
+/*! Sekundenzhler je Task fr die Periode                                    */
+static uint8_t aucPeriodCnt[SCHED_MAX_TASKS];
+
+/*! Zeitstempel des Bereitwerdens in 1/256 s                                  */
+static uint32_t aulReadyStamp[SCHED_MAX_TASKS];
+
+/*! Sekundenzhler beim Bereitwerden                                          */
+static uint16_t auiReadySec[SCHED_MAX_TASKS];
+
+/*! Fortlaufender Sekundenzhler, unabhngig von der Uhrzeit                  */
+static uint16_t uiSchedSeconds;
+
+/*! Laufender Task oder SCHED_TASK_NONE                                       */
+static uint8_t ucSchedRunning;
+
+/*! Laufzeitstatistik                                                         */
+static Sched_Stats asStats[SCHED_MAX_TASKS];
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Scheduler mit einer Tasktabelle initialisieren
+ *
+ * @param[in] *pTasks   Tasktabelle (konstant)
+ * @param[in] ucNum     Anzahl der Eintrge, max. SCHED_MAX_TASKS (mit
+ *                      SCHED_CHECK_TABLE beim bersetzen prfen)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Sched_Init(const Sched_Task* pTasks, uint8_t ucNum)
+{
+  uint8_t ucIdx;
+  
+  pSchedTasks = pTasks;
+  ucSchedNum = (ucNum > SCHED_MAX_TASKS) ? SCHED_MAX_TASKS : ucNum;
+  uiSchedSeconds = 0;
+  ucSchedRunning = SCHED_TASK_NONE;
+  
+  for (ucIdx = 0; ucIdx < Sched_Event_NUM; ++ucIdx)
+  {
+    aucEvents[ucIdx] = 0;
+  }
+  
+  for (ucIdx = 0; ucIdx < ucSchedNum; ++ucIdx)
+  {
+    abReady[ucIdx] = false;
+    aucPeriodCnt[ucIdx] = 0;
+  }
+  
+  Sched_ClearStats();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ereignis melden, auch aus einer ISR
+ *
+ * @param[in] eEvent    Ereignis
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Sched_Post(Sched_Event eEvent)
+{
+  aucEvents[eEvent] = 1;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Ereignisse bernehmen und den bereiten Task mit der hchsten Prioritt
+ * bis zum Ende ausfhren
+ *
+ * @return    bool      true, wenn ein Task ausgefhrt wurde
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Sched_Run(void)
+{
+  const Sched_Task* pTask;
+  uint8_t ucEvents = 0;
+  uint8_t ucSel = SCHED_TASK_NONE;
+  uint8_t ucIdx;
+  uint32_t ulStamp;
+  uint32_t ulLatency;
+  uint16_t uiLatency;
+  
+  /* Ereignisse bernehmen                                */
+  for (ucIdx = 0; ucIdx < Sched_Event_NUM; ++ucIdx)
+  {
+    if (aucEvents[ucIdx] != 0)
+    {
+      aucEvents[ucIdx] = 0;
+      ucEvents |= SCHED_EVENT(ucIdx);
+    }
+  }
+  if ((ucEvents & SCHED_EVENT(Sched_Event_SECOND)) != 0)
+  {
+    ++uiSchedSeconds;
+  }
+  
+  ulStamp = LowPower_GetStamp();
+  for (ucIdx = 0; ucIdx < ucSchedNum; ++ucIdx)
+  {
+    pTask = &pSchedTasks[ucIdx];
+    
+    /* Bereit ber Ereignis oder abgelaufene Periode      */
+    if ((pTask->ucEvents & ucEvents) != 0)
+    {
+      if (!abReady[ucIdx])
+      {
+        abReady[ucIdx] = true;
+        aulReadyStamp[ucIdx] = ulStamp;
+        auiReadySec[ucIdx] = uiSchedSeconds;
+      }
+    }
+    if ((pTask->ucPeriod > 0) &&
+      ((ucEvents & SCHED_EVENT(Sched_Event_SECOND)) != 0))
+    {
+      if (++aucPeriodCnt[ucIdx] >= pTask->ucPeriod)
+      {
+        aucPeriodCnt[ucIdx] = 0;
+        if (!abReady[ucIdx])
+        {
+          abReady[ucIdx] = true;
+          aulReadyStamp[ucIdx] = ulStamp;
+          auiReadySec[ucIdx] = uiSchedSeconds;
+        }
+      }
+    }
+    
+    /* Hchste Prioritt auswhlen                        */
+    if (abReady[ucIdx] && ((ucSel == SCHED_TASK_NONE) ||
+      (pTask->ucPrio < pSchedTasks[ucSel].ucPrio)))
+    {
+      ucSel = ucIdx;
+    }
+  }
+  
+  if (ucSel == SCHED_TASK_NONE)
+  {
+    return false;
+  }
+  
+  /* Task ausfhren, fr den Watchdog-Reset vermerken,    */
+  /* mit vollem Fenster des Watchdogs beginnen            */
+  abReady[ucSel] = false;
+  ucSchedRunning = ucSel;
+  Watchdog_SetTask(ucSel);
+  Watchdog_Kick();
+  pSchedTasks[ucSel].pfTask();
+  Watchdog_SetTask(SCHED_TASK_NONE);
+  ucSchedRunning = SCHED_TASK_NONE;
+  
+  /* Zeit vom Bereitwerden bis zum Ende auswerten         */
+  ulLatency = LowPower_GetElapsed(aulReadyStamp[ucSel], LowPower_GetStamp());
+  if (ulLatency >= SCHED_LATENCY_MAX)
+  {
+    uiLatency = 0xFFFF;
+  }
+  else
+  {
+    uiLatency = (uint16_t)((ulLatency * 1000) / LOWPOWER_TICK_HZ);
+  }
+  
+  if (asStats[ucSel].uiRuns < 0xFFFF)
+  {
+    ++asStats[ucSel].uiRuns;
+  }
+  if (uiLatency > asStats[ucSel].uiMaxLatency)
+  {
+    asStats[ucSel].uiMaxLatency = uiLatency;
+  }
+  if ((uiLatency > pSchedTasks[ucSel].uiDeadline) &&
+    (asStats[ucSel].uiMisses < 0xFFFF))
+  {
+    ++asStats[ucSel].uiMisses;
+  }
+  
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob weder Ereignisse noch bereite Tasks anstehen. Aufruf mit
+ * gesperrten Interrupts unmittelbar vor dem Schlafen.
+ *
+ * @return    bool      true, wenn nichts zu tun ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Sched_IsIdle(void)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < Sched_Event_NUM; ++ucIdx)
+  {
+    if (aucEvents[ucIdx] != 0)
+    {
+      return false;
+    }
+  }
+  
+  for (ucIdx = 0; ucIdx < ucSchedNum; ++ucIdx)
+  {
+    if (abReady[ucIdx])
+    {
+      return false;
+    }
+  }
+  
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bereiten Task suchen, der seit mehr als SCHED_STALL_FACTOR Fristen auf
+ * die Ausfhrung wartet. Die Wartezeit wird in ganzen Sekunden gezhlt, die
+ * Grenze daher um eine Sekunde aufgerundet.
+ *
+ * @return    uint8_t   Index des Tasks oder SCHED_TASK_NONE
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t Sched_GetStalled(void)
+{
+  uint32_t ulLimit;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < ucSchedNum; ++ucIdx)
+  {
+    if (abReady[ucIdx])
+    {
+      ulLimit = ((uint32_t)pSchedTasks[ucIdx].uiDeadline * SCHED_STALL_FACTOR)
+        / 1000 + 1;
+      if ((uint16_t)(uiSchedSeconds - auiReadySec[ucIdx]) > ulLimit)
+      {
+        return ucIdx;
+      }
+    }
+  }
+  
+  return SCHED_TASK_NONE;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob der laufende Task seine Frist seit dem Bereitwerden noch
+ * einhlt
+ *
+ * @return    bool      true, wenn ein Task luft und die Frist nicht
+ *                      berschritten ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Sched_IsInDeadline(void)
+{
+  uint32_t ulElapsed;
+  
+  if (ucSchedRunning == SCHED_TASK_NONE)
+  {
+    return false;
+  }
+  
+  ulElapsed = LowPower_GetElapsed(aulReadyStamp[ucSchedRunning],
+    LowPower_GetStamp());
+  return (ulElapsed * 1000) <=
+    ((uint32_t)pSchedTasks[ucSchedRunning].uiDeadline * LOWPOWER_TICK_HZ);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Sekundentakte seit dem Start abfragen. Unabhngig vom Stellen der Uhr,
+ * luft nach gut 18 Stunden ber.
+ *
+ * @return    uint16_t  Anzahl der Sekundentakte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint16_t Sched_GetSeconds(void)
+{
+  return uiSchedSeconds;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anzahl der Tasks abfragen
+ *
+ * @return    uint8_t   Anzahl der Tasks
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t Sched_GetNum(void)
+{
+  return ucSchedNum;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Konfiguration eines Tasks abfragen
+ *
+ * @param[in] ucIdx     Index in der Tasktabelle
+ * @return    const Sched_Task*   Konfiguration
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Sched_Task* Sched_GetTask(uint8_t ucIdx)
+{
+  return &pSchedTasks[ucIdx];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufzeitstatistik eines Tasks abfragen
+ *
+ * @param[in] ucIdx     Index in der Tasktabelle
+ * @return    const Sched_Stats*  Laufzeitstatistik
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Sched_Stats* Sched_GetStats(uint8_t ucIdx)
+{
+  return &asStats[ucIdx];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufzeitstatistik aller Tasks zurcksetzen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Sched_ClearStats(void)
+{
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < SCHED_MAX_TASKS; ++ucIdx)
+  {
+    asStats[ucIdx].uiRuns = 0;
+    asStats[ucIdx].uiMisses = 0;
+    asStats[ucIdx].uiMaxLatency = 0;
+  }
+}
@@ -0,0 +1,130 @@
+/*!****************************************************************************
+ * @file
+ * Scheduler.h
+ *
+ * Kooperativer Scheduler: Tasks laufen bis zum Ende durch und werden ber
+ * Ereignisse aus den Interrupts oder periodisch im Sekundentakt bereit
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Max. Anzahl der Tasks                                                     */
+#define SCHED_MAX_TASKS         16
+
+/*! Kein Task ausgewhlt bzw. kein Task luft                                 */
+#define SCHED_TASK_NONE         0xFF
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Ereignisse, die Tasks bereit machen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Sched_Event {
+  /*! 100ms-Tick (TIM2), nur bei laufendem Timer          */
+  Sched_Event_TICK,
+  
+  /*! Sekundentakt (RTC Alarm A), zhlt auch die Perioden */
+  Sched_Event_SECOND,
+  
+  /*! Messintervall (RTC Weckzeitgeber)                   */
+  Sched_Event_WAKEUP,
+  
+  /*! Zeile ber Bluetooth (USART1) empfangen             */
+  Sched_Event_UART1_RX,
+  
+  /*! NMEA-Sentence vom GPS-Modul (USART3) empfangen      */
+  Sched_Event_UART3_RX,
+  
+  /*! Eintrag in der Warteschlange der Interrupts         */
+  Sched_Event_DEFERRED,
+  
+  /*! Aufgeteilte Ausgabe eines AT-Befehls fortsetzen     */
+  Sched_Event_RESUME,
+  
+  Sched_Event_NUM
+} Sched_Event;
+
+/*! Funktionszeiger fr einen Task                                            */
+typedef void (*Sched_Func)(void);
+
+/*!****************************************************************************
+ * @brief
+ * Konfiguration eines Tasks
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Sched_Task {
+  /*! Kurzname fr die Statistik                          */
+  const char* pszName;
+  
+  /*! Taskfunktion                                        */
+  Sched_Func pfTask;
+  
+  /*! Auslsende Ereignisse als Bitmaske (SCHED_EVENT)    */
+  uint8_t ucEvents;
+  
+  /*! Periode in s, 0 = nur ber Ereignisse               */
+  uint8_t ucPeriod;
+  
+  /*! Prioritt, 0 = hchste                              */
+  uint8_t ucPrio;
+  
+  /*! Frist vom Bereitwerden bis zum Ende in ms           */
+  uint16_t uiDeadline;
+} Sched_Task;
+
+/*!****************************************************************************
+ * @brief
+ * Laufzeitstatistik eines Tasks
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Sched_Stats {
+  /*! Anzahl der Ausfhrungen                             */
+  uint16_t uiRuns;
+  
+  /*! Anzahl der Fristberschreitungen                    */
+  uint16_t uiMisses;
+  
+  /*! Max. Zeit vom Bereitwerden bis zum Ende in ms       */
+  uint16_t uiMaxLatency;
+} Sched_Stats;
+
+
+/*- Makros -------------------------------------------------------------------*/
+/*! Bitmaske eines Ereignisses fr Sched_Task.ucEvents                        */
+#define SCHED_EVENT(eEvent)     ((uint8_t)(1 << (eEvent)))
+
+/*! bersetzungsfehler (negative Feldgre), wenn eine Tasktabelle mehr als
+ * SCHED_MAX_TASKS Eintrge hat                                               */
+#define SCHED_CHECK_TABLE(ucNum) \
+  typedef char Sched_TableCheck[((ucNum) <= SCHED_MAX_TASKS) ? 1 : -1]
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Sched_Init(const Sched_Task* pTasks, uint8_t ucNum);
+void Sched_Post(Sched_Event eEvent);
+bool Sched_Run(void);
+bool Sched_IsIdle(void);
+uint8_t Sched_GetStalled(void);
+bool Sched_IsInDeadline(void);
+uint16_t Sched_GetSeconds(void);
+
+uint8_t Sched_GetNum(void);
+const Sched_Task* Sched_GetTask(uint8_t ucIdx);
+const Sched_Stats* Sched_GetStats(uint8_t ucIdx);
+void Sched_ClearStats(void);
+
+#endif /* SCHEDULER_H_ */
@@ -1,42 +1,369 @@
+/*!****************************************************************************
+ * @file
+ * SensorLog.c
+ *
+ * Ringspeicher der letzten Messwerte. Jeder Eintrag erhlt eine fortlaufende
+ * Folgenummer, sein Platz ist deren untere Bits (SENSORLOG_INDEX_MASK). Die
+ * genutzte Tiefe ist eine Zweierpotenz bis NUM_SENSORLOG_RINGITEMS und
+ * bestimmt, wie weit Dump und Iterator zurckreichen.
+ *
+ * Spiegel: Jeder abgeschlossene Eintrag wird mit Folgenummer und Prfsumme
+ * in den Bereich NVSTORE_OFFS_LOGMIRROR des Daten-EEPROM geschrieben, reihum
+ * in SENSORLOG_MIRROR_SLOTS Pltzen, damit jeder Platz nur bei jedem
+ * SENSORLOG_MIRROR_SLOTS-ten Eintrag programmiert wird. Nach einem Reset
+ * werden die neuesten gltigen Pltze in den Ringspeicher geladen und die
+ * Folgenummern dahinter fortgesetzt. Ab Werk ist der Spiegel aus: mit 15
+ * Pltzen wird jede Zelle beim Messintervall von 10 s 576-mal am Tag
+ * programmiert, 300000 Zyklen wren nach etwa 1,4 Jahren erreicht.
+ *
+ * Folgenummern: Unabhngig vom Spiegel werden sie im EEPROM in Blcken zu
+ * SENSORLOG_SEQ_BLOCK reserviert (NVSTORE_OFFS_SENSORSEQ), programmiert
+ * wird also nur bei jedem 256-ten Eintrag. Ohne gltigen Spiegel, z.B.
+ * nach dem Leeren oder bei ausgeschaltetem Spiegel, beginnt es nach einem
+ * Reset hinter dem reservierten Block; die Nummern bleiben eindeutig und
+ * steigend, es entsteht hchstens eine Lcke.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Spiegel ab Werk aus
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
 #include <string.h>
+#include "NvStore.h"
 #include "SensorLog.h"
 
 
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Gre des Spiegels im Daten-EEPROM in Byte                                */
+#define SENSORLOG_MIRROR_SIZE       1024
+
+/*! Abstand der Pltze: Platz und Prfsumme, auf Worte aufgerundet            */
+#define SENSORLOG_MIRROR_PITCH      ((sizeof(SensorLogSlot) + 1 + 3) & ~3u)
+
+/*! Anzahl der Pltze im Spiegel                                              */
+#define SENSORLOG_MIRROR_SLOTS      (SENSORLOG_MIRROR_SIZE / SENSORLOG_MIRROR_PITCH)
+
+/*! Im EEPROM auf einmal reservierte Folgenummern                             */
+#define SENSORLOG_SEQ_BLOCK         256
+
+
 /*- Modulglobale Variablen ---------------------------------------------------*/
-static SensorLogItem sLogBuffer[NUM_SENSORLOG_RINGITEMS];
-static unsigned uHead;
+static SensorLogSlot sLogBuffer[NUM_SENSORLOG_RINGITEMS];
+
+/*! Folgenummer des nchsten Eintrags                                         */
+static uint32_t ulLogSeq;
+
+/*! Erste nicht reservierte Folgenummer, im EEPROM gesichert                  */
+static uint32_t ulLogSeqLimit;
+
+/*! Einstellungen                                                             */
+static SensorLogConfig sLogCfg;
 
+/*! Nach dem Start aus dem Spiegel geladene Eintrge                          */
+static uint8_t ucLogRestored;
 
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Offset eines Platzes im Daten-EEPROM
+ *
+ * @param[in] ulSeq     Folgenummer des Eintrags
+ * @return    uint16_t  Offset
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint16_t SensorLog_MirrorOffs(uint32_t ulSeq)
+{
+  return (uint16_t)(NVSTORE_OFFS_LOGMIRROR
+    + (ulSeq % SENSORLOG_MIRROR_SLOTS) * SENSORLOG_MIRROR_PITCH);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Alle Pltze des Spiegels ungltig machen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void SensorLog_ClearMirror(void)
+{
+  uint8_t ucSlot;
+  uint8_t ucByte;
+  uint16_t uiOffs;
+  
+  /* Ein gendertes Byte macht die Prfsumme ungltig     */
+  for (ucSlot = 0; ucSlot < SENSORLOG_MIRROR_SLOTS; ++ucSlot)
+  {
+    uiOffs = (uint16_t)(NVSTORE_OFFS_LOGMIRROR + ucSlot * SENSORLOG_MIRROR_PITCH);
+    ucByte = (uint8_t)~*NvStore_GetPtr(uiOffs);
+    NvStore_Write(uiOffs, &ucByte, 1);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gltige Pltze des Spiegels in den Ringspeicher laden und die
+ * Folgenummern fortsetzen: hinter dem neuesten Platz, wenn der Spiegel
+ * eingeschaltet ist, sonst hinter dem reservierten Block
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void SensorLog_Restore(void)
+{
+  SensorLogSlot sSlot;
+  SensorLogSlot* pDest;
+  uint32_t ulNewest = 0;
+  uint8_t ucSlot;
+  
+  if (!NvStore_Load(NVSTORE_OFFS_SENSORSEQ, &ulLogSeqLimit, sizeof(ulLogSeqLimit))
+    || (ulLogSeqLimit == 0))
+  {
+    ulLogSeqLimit = 1;
+  }
+  
+  for (ucSlot = 0; sLogCfg.bMirror && (ucSlot < SENSORLOG_MIRROR_SLOTS); ++ucSlot)
+  {
+    if (!NvStore_Load((uint16_t)(NVSTORE_OFFS_LOGMIRROR + ucSlot * SENSORLOG_MIRROR_PITCH),
+      &sSlot, sizeof(sSlot)) || (sSlot.ulSeq == 0))
+    {
+      continue;
+    }
+  
+    if (sSlot.ulSeq > ulNewest)
+    {
+      ulNewest = sSlot.ulSeq;
+    }
+    pDest = &sLogBuffer[(uint8_t)sSlot.ulSeq & SENSORLOG_INDEX_MASK];
+    if (sSlot.ulSeq > pDest->ulSeq)
+    {
+      *pDest = sSlot;
+    }
+  }
+  
+  /* Der Spiegel ist nur gltig, solange er durchgehend   */
+  /* eingeschaltet war, und liegt dann im Block           */
+  ulLogSeq = (ulNewest != 0) ? ulNewest + 1 : ulLogSeqLimit;
+  
+  /* Nur Eintrge, die in den Ringspeicher passen         */
+  for (ucSlot = 0; ucSlot < NUM_SENSORLOG_RINGITEMS; ++ucSlot)
+  {
+    if ((sLogBuffer[ucSlot].ulSeq != 0)
+      && (ulLogSeq - sLogBuffer[ucSlot].ulSeq <= NUM_SENSORLOG_RINGITEMS))
+    {
+      ++ucLogRestored;
+    }
+    else
+    {
+      memset(&sLogBuffer[ucSlot], 0, sizeof(sLogBuffer[ucSlot]));
+    }
+  }
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Einstellungen laden und den Ringspeicher aus dem Spiegel fllen
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Spiegel ab Werk aus
+ ******************************************************************************/
 void SensorLog_Init(void)
 {
-  SensorLog_Clear();
+  memset(sLogBuffer, 0, sizeof(sLogBuffer));
+  ucLogRestored = 0;
+  if (!NvStore_Load(NVSTORE_OFFS_SENSORLOG, &sLogCfg, sizeof(sLogCfg))
+    || (sLogCfg.ucDepth == 0) || (sLogCfg.ucDepth > NUM_SENSORLOG_RINGITEMS)
+    || ((sLogCfg.ucDepth & (sLogCfg.ucDepth - 1)) != 0))
+  {
+    sLogCfg.ucDepth = NUM_SENSORLOG_RINGITEMS;
+    sLogCfg.bMirror = false;
+  }
+  SensorLog_Restore();
 }
 
+/*!****************************************************************************
+ * @brief
+ * Ringspeicher und Spiegel leeren. Die Folgenummern laufen weiter, auch
+ * ber einen Reset.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
 void SensorLog_Clear(void)
 {
   memset(sLogBuffer, 0, sizeof(sLogBuffer));
-  uHead = 0;
+  SensorLog_ClearMirror();
 }
 
+/*!****************************************************************************
+ * @brief
+ * Nchsten Platz fr einen neuen Eintrag belegen, bei Bedarf den nchsten
+ * Block Folgenummern im EEPROM reservieren
+ *
+ * @return    SensorLogItem*  Eintrag, wird vom Aufrufer gefllt
+ *
+ * @date  19.10.2026  Folgenummer statt Schreibzeiger
+ * @date  19.10.2026  Reservierung der Folgenummern
+ ******************************************************************************/
 SensorLogItem* SensorLog_Advance(void)
 {
-  register unsigned uRet = uHead;
-  ++uHead;
-  if (uHead >= NUM_SENSORLOG_RINGITEMS)
+  SensorLogSlot* pSlot = &sLogBuffer[(uint8_t)ulLogSeq & SENSORLOG_INDEX_MASK];
+  
+  if (ulLogSeq >= ulLogSeqLimit)
+  {
+    ulLogSeqLimit = ulLogSeq + SENSORLOG_SEQ_BLOCK;
+    NvStore_Save(NVSTORE_OFFS_SENSORSEQ, &ulLogSeqLimit, sizeof(ulLogSeqLimit));
+  }
+  pSlot->ulSeq = ulLogSeq++;
+  return &pSlot->sItem;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Neuesten Eintrag nach dem Fllen in seinen Platz im Spiegel schreiben,
+ * falls eingeschaltet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void SensorLog_Commit(void)
+{
+  uint32_t ulSeq = ulLogSeq - 1;
+  
+  if (sLogCfg.bMirror && (ulSeq != 0))
   {
-    uHead = 0;
+    NvStore_Save(SensorLog_MirrorOffs(ulSeq),
+      &sLogBuffer[(uint8_t)ulSeq & SENSORLOG_INDEX_MASK], sizeof(SensorLogSlot));
   }
-  return &sLogBuffer[uRet];
 }
 
+/*!****************************************************************************
+ * @brief
+ * Eintrag ber seine Lage in der genutzten Tiefe lesen
+ *
+ * @param[in] uOffset   0: ltester ... Tiefe - 1: neuester Eintrag
+ * @return    SensorLogItem*  Eintrag
+ *
+ * @date  19.10.2026  Maske statt Subtraktionsschleife
+ ******************************************************************************/
 SensorLogItem* SensorLog_Dump(unsigned uOffset)
 {
-  register unsigned uIndex;
-  uIndex = uHead + uOffset;
-  while (uIndex >= NUM_SENSORLOG_RINGITEMS)
+  return &sLogBuffer[(uint8_t)(ulLogSeq - sLogCfg.ucDepth + uOffset)
+    & SENSORLOG_INDEX_MASK].sItem;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchsten Eintrag nach einer Folgenummer lesen. Eintrge auerhalb der
+ * genutzten Tiefe oder nach dem Leeren werden bersprungen.
+ *
+ * @param[in,out] *pulSeq Zuletzt gelesene Folgenummer, 0: keine; danach die
+ *                        des gelieferten Eintrags. Liegt sie hinter dem
+ *                        neuesten Eintrag, beginnt es beim ltesten.
+ * @return    SensorLogItem*  Eintrag, 0: kein neuerer vorhanden
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+SensorLogItem* SensorLog_GetNext(uint32_t* pulSeq)
+{
+  SensorLogSlot* pSlot;
+  uint32_t ulSeq = *pulSeq + 1;
+  
+  if (ulLogSeq - ulSeq > sLogCfg.ucDepth)
+  {
+    ulSeq = ulLogSeq - sLogCfg.ucDepth;
+  }
+  
+  for ( ; ulSeq < ulLogSeq; ++ulSeq)
+  {
+    pSlot = &sLogBuffer[(uint8_t)ulSeq & SENSORLOG_INDEX_MASK];
+    if (pSlot->ulSeq == ulSeq)
+    {
+      *pulSeq = ulSeq;
+      return &pSlot->sItem;
+    }
+  }
+  return 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Folgenummer des neuesten Eintrags abfragen
+ *
+ * @return    uint32_t  Folgenummer, 0: noch kein Eintrag
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint32_t SensorLog_GetSeq(void)
+{
+  return ulLogSeq - 1;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Genutzte Tiefe und Spiegel einstellen und im EEPROM sichern. Beim
+ * Einschalten wird der alte Inhalt des Spiegels verworfen, er gibt sonst
+ * nach einem Reset eine veraltete Folgenummer vor.
+ *
+ * @param[in] ucDepth   Genutzte Eintrge, Zweierpotenz bis
+ *                      NUM_SENSORLOG_RINGITEMS
+ * @param[in] bMirror   true: Spiegel im EEPROM ein
+ * @return    bool      true, wenn die Tiefe gltig ist
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool SensorLog_SetConfig(uint8_t ucDepth, bool bMirror)
+{
+  if ((ucDepth == 0) || (ucDepth > NUM_SENSORLOG_RINGITEMS)
+    || ((ucDepth & (ucDepth - 1)) != 0))
   {
-    uIndex -= NUM_SENSORLOG_RINGITEMS;
+    return false;
   }
   
-  return &sLogBuffer[uIndex];
+  if (bMirror && !sLogCfg.bMirror)
+  {
+    SensorLog_ClearMirror();
+  }
+  sLogCfg.ucDepth = ucDepth;
+  sLogCfg.bMirror = bMirror;
+  NvStore_Save(NVSTORE_OFFS_SENSORLOG, &sLogCfg, sizeof(sLogCfg));
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Einstellungen abfragen
+ *
+ * @return    const SensorLogConfig*  Einstellungen
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const SensorLogConfig* SensorLog_GetConfig(void)
+{
+  return &sLogCfg;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anzahl der nach dem Start aus dem Spiegel geladenen Eintrge abfragen
+ *
+ * @return    uint8_t   Anzahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t SensorLog_GetRestored(void)
+{
+  return ucLogRestored;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anzahl der Pltze des Spiegels abfragen
+ *
+ * @return    uint8_t   Anzahl
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t SensorLog_GetMirrorSlots(void)
+{
+  return (uint8_t)SENSORLOG_MIRROR_SLOTS;
 }
\ No newline at end of file
@@ -8,7 +8,22 @@
 
 
 /*- Symbolische Konstanten ---------------------------------------------------*/
-#define NUM_SENSORLOG_RINGITEMS     8
+/*! Gre des Ringspeichers als Zweierpotenz 2^n, n = 0 ... 7, beim
+    bersetzen whlbar                                                        */
+#ifndef SENSORLOG_DEPTH_LOG2
+#define SENSORLOG_DEPTH_LOG2        2
+#endif
+
+#define NUM_SENSORLOG_RINGITEMS     (1u << SENSORLOG_DEPTH_LOG2)
+#define SENSORLOG_INDEX_MASK        (NUM_SENSORLOG_RINGITEMS - 1)
+
+/*! @brief Zustandsbits eines Eintrags (ucStatus)
+ * @{                                                                         */
+#define SENSORLOG_STATUS_TIER     0x07    /* Stufe des PowerGov (Maske)       */
+#define SENSORLOG_STATUS_POS      0x08    /* GPS-Position gltig              */
+#define SENSORLOG_STATUS_ALT      0x10    /* GPS-Hhe gltig                  */
+#define SENSORLOG_STATUS_TRACK    0x20    /* Nachfhrung eingeschaltet        */
+/*! @}                                                                        */
 
 
 /*- Typdefinitionen ----------------------------------------------------------*/
@@ -51,14 +66,59 @@ typedef struct tag_SensorLogItem {
     int16_t iBatCurr;
     int16_t iPanelCurr;
   } sPower;
+  
+  struct {
+    uint8_t ucSoC;
+    uint16_t uiBatIn;
+    uint16_t uiBatOut;
+    uint32_t ulPvEnergy;
+  } sEnergy;
+  
+  uint8_t ucStatus;
 } SensorLogItem;
 
+/*!****************************************************************************
+ * @brief
+ * Platz des Ringspeichers und des Spiegels im EEPROM
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_SensorLogSlot {
+  /*! Folgenummer ab 1, 0: Platz leer                     */
+  uint32_t ulSeq;
+  
+  /*! Eintrag                                             */
+  SensorLogItem sItem;
+} SensorLogSlot;
+
+/*!****************************************************************************
+ * @brief
+ * Einstellungen des Ringspeichers, werden im EEPROM gesichert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_SensorLogConfig {
+  /*! Genutzte Eintrge, Zweierpotenz bis zur Gre       */
+  uint8_t ucDepth;
+  
+  /*! Spiegel im EEPROM eingeschaltet                     */
+  bool bMirror;
+} SensorLogConfig;
+
 
 /*- Funktionsprototypen ------------------------------------------------------*/
 void SensorLog_Init(void);
 void SensorLog_Clear(void);
 
 SensorLogItem* SensorLog_Advance(void);
+void SensorLog_Commit(void);
 SensorLogItem* SensorLog_Dump(unsigned uOffset);
+SensorLogItem* SensorLog_GetNext(uint32_t* pulSeq);
+uint32_t SensorLog_GetSeq(void);
+
+bool SensorLog_SetConfig(uint8_t ucDepth, bool bMirror);
+const SensorLogConfig* SensorLog_GetConfig(void);
+uint8_t SensorLog_GetRestored(void);
+uint8_t SensorLog_GetMirrorSlots(void);
 
 #endif /* USERLIB_SENSORLOG_H_ */
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "stm8l15x.h"
 #include "motorlib.h"
 #include "app_sensors.h"
+#include "Profiler.h"
 #include "SolarTracking_Internal.h"
 #include "SolarTracking.h"
 
@@ -97,6 +98,7 @@ static bool CheckLimits(int iAzimuth, int iZenith)
  * @return  bool    true, wenn Sollwert gltig
  *
  * @date 30.12.2019
+ * @date 19.10.2026 Laufzeitmessung der Sonnenstandsberechnung
  ******************************************************************************/
 static bool Tracking_CalcSetpoint(void)
 {
@@ -119,6 +121,7 @@ static bool Tracking_CalcSetpoint(void)
   RTC_GetTime(RTC_Format_BIN, &sTime);
   
   /* Azimuth und Zenit berechnen                          */
+  PROFILE_BEGIN(Profiler_Zone_SUNPOS);
   calculate_current_sun_position(
     2000 + sDate.RTC_Year,  /* Jahr                       */
     sDate.RTC_Month,        /* Monat                      */
@@ -132,6 +135,7 @@ static bool Tracking_CalcSetpoint(void)
     &dAzimuth,
     &dZenith
   );
+  PROFILE_END(Profiler_Zone_SUNPOS);
   iAzimuth = (int)(dAzimuth * 10);
   iZenith = 900 - (int)(dZenith * 10);
   
@@ -212,9 +216,11 @@ void Tracking_Task1s(void)
  * Startet die Ausrichtung neu
  *
  * @date  30.12.2019
+ * @date  19.10.2026    Laufzeitmessung
  ******************************************************************************/
 void Tracking_TaskWakeup(void)
 {
+  PROFILE_BEGIN(Profiler_Zone_TRKWK);
   if (bTrackingActive)
   {    
     /* Neue Sollposition berechnen                        */
@@ -242,6 +248,7 @@ void Tracking_TaskWakeup(void)
       Motor_Cmd(false);
     }
   }
+  PROFILE_END(Profiler_Zone_TRKWK);
 }
 
 /*!****************************************************************************
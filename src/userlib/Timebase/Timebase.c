@@ -0,0 +1,275 @@
+/*!****************************************************************************
+ * @file
+ * Timebase.c
+ *
+ * Bedarfsgesteuerter 100ms-Zeitgeber. Anforderungen werden als einzelnes Byte
+ * abgelegt und erst in Timebase_Update() bernommen, das entweder mit
+ * gesperrten Interrupts vor dem Schlafen oder im Timer-Interrupt luft. TIM2
+ * wird auf die frheste Frist programmiert und ohne ausstehende Frist samt
+ * Peripherietakt abgeschaltet, damit die CPU in Active-Halt wechseln kann.
+ *
+ * Abgelaufene Fristen werden um einen Tick fortgesetzt, bis der Teilnehmer
+ * sie mit Timebase_Cancel() abmeldet. Die Teilnehmer laufen verzgert im
+ * Hauptprogramm; so bleibt das 100ms-Raster erhalten, auch wenn die
+ * Bearbeitung eines Ticks spter als der nchste Tick erfolgt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "powerlib.h"
+#include "Timebase.h"
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Neue Anforderung je Teilnehmer in Ticks oder TIMEBASE_CANCEL, 0 = keine   */
+static volatile uint8_t aucRequest[Timebase_Client_NUM];
+
+/*! Fristen je Teilnehmer ab Beginn der laufenden Periode, 0 = keine          */
+static uint8_t aucDeadline[Timebase_Client_NUM];
+
+/*! Lnge der laufenden Timerperiode in Ticks, 0 = Timer steht                */
+static uint8_t ucArmed;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Timer mit einer neuen Periode starten
+ *
+ * @param[in] ucTicks   Periodenlnge in Ticks
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Timebase_Start(uint8_t ucTicks)
+{
+  CLK_PeripheralClockConfig(CLK_Peripheral_TIM2, ENABLE);
+  TIM2_SetAutoreload((uint16_t)ucTicks * TIMEBASE_TICK_COUNTS);
+  TIM2_SetCounter((uint16_t)ucTicks * TIMEBASE_TICK_COUNTS);
+  TIM2_Cmd(ENABLE);
+  
+  ucArmed = ucTicks;
+  LowPower_SetLock(LowPower_Lock_TICK, true);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Timer anhalten und Peripherietakt abschalten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Timebase_Stop(void)
+{
+  TIM2_Cmd(DISABLE);
+  TIM2_ClearFlag(TIM2_FLAG_Update);
+  CLK_PeripheralClockConfig(CLK_Peripheral_TIM2, DISABLE);
+  
+  ucArmed = 0;
+  LowPower_SetLock(LowPower_Lock_TICK, false);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufende Periode verkrzen oder verlngern. Der Zhler luft abwrts, der
+ * Rest der Periode verschiebt sich daher um die Differenz.
+ *
+ * @param[in] ucTicks   Neue Periodenlnge in Ticks
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Timebase_Retime(uint8_t ucTicks)
+{
+  uint16_t uiCount;
+  
+  TIM2_Cmd(DISABLE);
+  uiCount = TIM2_GetCounter();
+  uiCount += (uint16_t)((int16_t)(ucTicks - ucArmed) * TIMEBASE_TICK_COUNTS);
+  TIM2_SetCounter(uiCount);
+  TIM2_SetAutoreload((uint16_t)ucTicks * TIMEBASE_TICK_COUNTS);
+  TIM2_Cmd(ENABLE);
+  
+  ucArmed = ucTicks;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * TIM2 als Abwrtszhler konfigurieren, der Timer bleibt bis zur ersten
+ * Anforderung abgeschaltet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Timebase_Init(void)
+{
+  uint8_t ucIdx;
+  
+  CLK_PeripheralClockConfig(CLK_Peripheral_TIM2, ENABLE);
+  TIM2_InternalClockConfig();
+  TIM2_TimeBaseInit(TIM2_Prescaler_128, TIM2_CounterMode_Down,
+    TIMEBASE_TICK_COUNTS);
+  TIM2_ITConfig(TIM2_IT_Update, ENABLE);
+  CLK_PeripheralClockConfig(CLK_Peripheral_TIM2, DISABLE);
+  
+  for (ucIdx = 0; ucIdx < Timebase_Client_NUM; ++ucIdx)
+  {
+    aucRequest[ucIdx] = 0;
+    aucDeadline[ucIdx] = 0;
+  }
+  ucArmed = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nchste Frist eines Teilnehmers anmelden, auch aus einer ISR. Eine noch
+ * nicht bernommene Anforderung desselben Teilnehmers wird berschrieben,
+ * eine bereits laufende frhere Frist bleibt bestehen.
+ *
+ * @param[in] eClient   Teilnehmer
+ * @param[in] ucTicks   Frist in 100ms ab jetzt (1..250)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Timebase_Request(Timebase_Client eClient, uint8_t ucTicks)
+{
+  if (ucTicks > 250)
+  {
+    ucTicks = 250;
+  }
+  aucRequest[eClient] = ucTicks;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Frist eines Teilnehmers abmelden, auch aus einer ISR. Eine noch nicht
+ * bernommene Anforderung desselben Teilnehmers wird verworfen.
+ *
+ * @param[in] eClient   Teilnehmer
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Timebase_Cancel(Timebase_Client eClient)
+{
+  aucRequest[eClient] = TIMEBASE_CANCEL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Anforderungen bernehmen und TIM2 auf die frheste Frist programmieren.
+ * Aufruf nur mit gesperrten Interrupts oder aus dem Timer-Interrupt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Timebase_Update(void)
+{
+  uint8_t ucElapsed = 0;
+  uint8_t ucNext = 0;
+  uint8_t ucDeadline;
+  uint8_t ucIdx;
+  
+  /* Bereits vergangene Ticks der laufenden Periode       */
+  if (ucArmed > 0)
+  {
+    ucElapsed = ucArmed - (uint8_t)((TIM2_GetCounter() +
+      (TIMEBASE_TICK_COUNTS - 1)) / TIMEBASE_TICK_COUNTS);
+  }
+  
+  for (ucIdx = 0; ucIdx < Timebase_Client_NUM; ++ucIdx)
+  {
+    /* Abmeldung bernehmen                               */
+    if (aucRequest[ucIdx] == TIMEBASE_CANCEL)
+    {
+      aucRequest[ucIdx] = 0;
+      aucDeadline[ucIdx] = 0;
+    }
+    
+    /* Neue Frist auf den Periodenbeginn beziehen         */
+    if (aucRequest[ucIdx] > 0)
+    {
+      ucDeadline = ucElapsed + aucRequest[ucIdx];
+      aucRequest[ucIdx] = 0;
+      if ((aucDeadline[ucIdx] == 0) || (ucDeadline < aucDeadline[ucIdx]))
+      {
+        aucDeadline[ucIdx] = ucDeadline;
+      }
+    }
+    
+    /* Frheste Frist bestimmen                           */
+    if ((aucDeadline[ucIdx] > 0) &&
+      ((ucNext == 0) || (aucDeadline[ucIdx] < ucNext)))
+    {
+      ucNext = aucDeadline[ucIdx];
+    }
+  }
+  
+  if (ucNext > TIMEBASE_MAX_TICKS)
+  {
+    ucNext = TIMEBASE_MAX_TICKS;
+  }
+  
+  if (ucNext == 0)
+  {
+    /* Keine Frist - Timer abschalten                     */
+    if (ucArmed > 0)
+    {
+      Timebase_Stop();
+    }
+  }
+  else if (ucArmed == 0)
+  {
+    Timebase_Start(ucNext);
+  }
+  else if (ucNext != ucArmed)
+  {
+    Timebase_Retime(ucNext);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abgelaufene Fristen nach dem berlauf von TIM2 bestimmen und um einen
+ * Tick fortsetzen. Aufruf im Timer-Interrupt, danach Timebase_Update().
+ *
+ * @return    uint8_t   Bitmaske der flligen Teilnehmer (TIMEBASE_DUE)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+uint8_t Timebase_Expire(void)
+{
+  uint8_t ucDue = 0;
+  uint8_t ucIdx;
+  
+  for (ucIdx = 0; ucIdx < Timebase_Client_NUM; ++ucIdx)
+  {
+    if (aucDeadline[ucIdx] == 0)
+    {
+      continue;
+    }
+    
+    if (aucDeadline[ucIdx] <= ucArmed)
+    {
+      aucDeadline[ucIdx] = 1;
+      ucDue |= TIMEBASE_DUE(ucIdx);
+    }
+    else
+    {
+      aucDeadline[ucIdx] -= ucArmed;
+    }
+  }
+  
+  return ucDue;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Abfrage, ob der Timer luft
+ *
+ * @return    bool      true, wenn eine Frist aussteht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Timebase_IsRunning(void)
+{
+  return (ucArmed > 0);
+}
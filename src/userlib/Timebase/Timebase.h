@@ -0,0 +1,62 @@
+/*!****************************************************************************
+ * @file
+ * Timebase.h
+ *
+ * Bedarfsgesteuerter 100ms-Zeitgeber (TIM2). Teilnehmer melden ihre nchste
+ * Frist an, der Timer luft nur, solange eine Frist aussteht. Nach Ablauf
+ * setzt sich die Frist im 100ms-Raster fort, bis der Teilnehmer sie abmeldet.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Timerschritte je 100ms-Tick (16 MHz / 128)                                */
+#define TIMEBASE_TICK_COUNTS    12500
+
+/*! Lngste Timerperiode in Ticks (16-Bit-Zhler)                             */
+#define TIMEBASE_MAX_TICKS      5
+
+/*! Kennung fr die Abmeldung in der Anforderung                              */
+#define TIMEBASE_CANCEL         0xFF
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Teilnehmer des Zeitgebers
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Timebase_Client {
+  /*! Blinkmuster der LEDs                                */
+  Timebase_Client_BLINK,
+  
+  /*! Lageregelung der Motoren                            */
+  Timebase_Client_MOTOR,
+  
+  Timebase_Client_NUM
+} Timebase_Client;
+
+
+/*- Makros -------------------------------------------------------------------*/
+/*! Bitmaske eines Teilnehmers im Ergebnis von Timebase_Expire()              */
+#define TIMEBASE_DUE(eClient)   ((uint8_t)(1 << (eClient)))
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Timebase_Init(void);
+void Timebase_Request(Timebase_Client eClient, uint8_t ucTicks);
+void Timebase_Cancel(Timebase_Client eClient);
+void Timebase_Update(void);
+uint8_t Timebase_Expire(void);
+bool Timebase_IsRunning(void);
+
+#endif /* TIMEBASE_H_ */
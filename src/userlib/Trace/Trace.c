@@ -0,0 +1,436 @@
+/*!****************************************************************************
+ * @file
+ * Trace.c
+ *
+ * Die Eintrge werden im RAM gesammelt und erst geschrieben, wenn der Puffer
+ * voll ist oder das Protokoll am Ende des Wakeups Trace_Flush() aufruft. Im
+ * Aufzeichnungspfad fllt damit nur das Kopieren in den Puffer an.
+ *
+ * Aufbau eines Eintrags, Mehrbytewerte wie im Speicher des STM8 (Big
+ * Endian): Art (1 Byte), Lnge der Nutzdaten (1 Byte), Sekundentakt des
+ * Schedulers (2 Byte), Nutzdaten. Der BOOT-Eintrag trgt dazu
+ * TRACE_ORDER_MARK, damit die Wiedergabe auch Aufzeichnungen der
+ * Host-Station (Little Endian) richtig liest. Er steht am Anfang jeder
+ * Aufzeichnung: nach dem Start, nach dem Einschalten und in jeder neuen
+ * Datei.
+ *
+ * Die Kalibrierwerte stehen nicht in jedem Wakeup in der Datei: je Block
+ * wird eine Prfsumme gehalten, aufgezeichnet wird nur ein genderter
+ * Block. Nach dem Start, dem Einschalten und dem Wechsel der Datei werden
+ * alle Blcke neu aufgezeichnet.
+ *
+ * Die Datei bleibt wie beim Protokoll geffnet; nach jedem Schreiben sichert
+ * f_sync die Gre im Verzeichnis. So entfllt bei jedem Wakeup das Suchen
+ * im Verzeichnis und das Verfolgen der Clusterkette bis zum Dateiende. Bei
+ * etwa 100 Byte je Wakeup wchst die Datei um knapp 1 MByte am Tag. Wrde
+ * sie TRACE_FILE_MAX berschreiten, wird sie in TRACE.OLD umbenannt (eine
+ * vorhandene wird gelscht) und neu begonnen. Auf der Karte liegen damit
+ * hchstens zwei Dateien mit zusammen 2 * TRACE_FILE_MAX.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Datei geffnet halten, Gre begrenzen
+ * @date  19.10.2026  Kalibrierwerte, Byte-Reihenfolge
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <string.h>
+#include "stm8l15x.h"
+#include "ff.h"
+#include "Scheduler.h"
+#include "NvStore.h"
+#include "Trace.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Name der Aufzeichnungsdatei                                               */
+#define TRACE_FILE_NAME         "TRACE.BIN"
+
+/*! Name der vorigen Aufzeichnungsdatei                                       */
+#define TRACE_FILE_OLD          "TRACE.OLD"
+
+/*! Lnge der Nutzdaten des BOOT-Eintrags                                     */
+#define TRACE_BOOT_SIZE         4
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Aufzeichnung eingeschaltet                                                */
+static bool bTraceEnable;
+
+/*! Puffer fr die Eintrge                                                   */
+static uint8_t aucTraceBuf[TRACE_BUF_SIZE];
+
+/*! Belegte Byte im Puffer                                                    */
+static uint8_t ucTraceFill;
+
+/*! Geffnete Aufzeichnungsdatei                                              */
+static FIL sTraceFile;
+
+/*! sTraceFile ist geffnet                                                   */
+static bool bTraceOpen;
+
+/*! Zhler                                                                    */
+static Trace_Stats sTraceStats;
+
+/*! Prfsummen der zuletzt aufgezeichneten Kalibrierwerte                     */
+static uint16_t auiTraceCalibSum[Trace_Calib_NUM];
+
+/*! Bit je Trace_Calib: Prfsumme gltig                                      */
+static uint8_t ucTraceCalibValid;
+
+/*! Resetursache fr den BOOT-Eintrag                                         */
+static uint8_t ucTraceResetCause;
+
+
+/*- Lokale Funktionen --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Kopf eines Eintrags schreiben
+ *
+ * @param[out] *pucHead Ziel, TRACE_HEAD_SIZE Byte
+ * @param[in]  eType    Art des Eintrags
+ * @param[in]  ucLen    Lnge der Nutzdaten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Trace_PutHead(uint8_t* pucHead, Trace_Type eType, uint8_t ucLen)
+{
+  uint16_t uiSec = Sched_GetSeconds();
+  
+  pucHead[0] = (uint8_t)eType;
+  pucHead[1] = ucLen;
+  pucHead[2] = (uint8_t)(uiSec >> 8);
+  pucHead[3] = (uint8_t)uiSec;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Nutzdaten des BOOT-Eintrags schreiben: Version, Resetursache und
+ * TRACE_ORDER_MARK in der Byte-Reihenfolge des Prozessors
+ *
+ * @param[out] *pucData Ziel, TRACE_BOOT_SIZE Byte
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void Trace_PutBoot(uint8_t* pucData)
+{
+  uint16_t uiMark = TRACE_ORDER_MARK;
+  
+  pucData[0] = TRACE_VERSION;
+  pucData[1] = ucTraceResetCause;
+  memcpy(&pucData[2], &uiMark, sizeof(uiMark));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Platz fr einen Eintrag im Puffer belegen und den Kopf schreiben. Passt
+ * er nicht mehr, wird der Puffer vorher geschrieben.
+ *
+ * @param[in] eType     Art des Eintrags
+ * @param[in] ucLen     Lnge der Nutzdaten, hchstens TRACE_MAX_DATA
+ * @return    uint8_t*  Ziel der Nutzdaten
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint8_t* Trace_Alloc(Trace_Type eType, uint8_t ucLen)
+{
+  uint8_t* pucHead;
+  
+  if (ucTraceFill + TRACE_HEAD_SIZE + ucLen > TRACE_BUF_SIZE)
+  {
+    Trace_Flush();
+  }
+  
+  pucHead = &aucTraceBuf[ucTraceFill];
+  Trace_PutHead(pucHead, eType, ucLen);
+  ucTraceFill += TRACE_HEAD_SIZE + ucLen;
+  
+  ++sTraceStats.uiRecords;
+  return &pucHead[TRACE_HEAD_SIZE];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Aufzeichnungsdatei zum Anhngen ffnen
+ *
+ * @return    bool      true, wenn geffnet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool Trace_OpenFile(void)
+{
+  bTraceOpen = (f_open(&sTraceFile, TRACE_FILE_NAME,
+    FA_WRITE | FA_OPEN_APPEND) == FR_OK);
+  return bTraceOpen;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Volle Aufzeichnungsdatei in TRACE.OLD umbenennen und eine neue mit dem
+ * BOOT-Eintrag beginnen
+ *
+ * @return    bool      true, wenn die neue Datei geffnet ist
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  BOOT-Eintrag am Anfang
+ ******************************************************************************/
+static bool Trace_Rotate(void)
+{
+  uint8_t aucBoot[TRACE_HEAD_SIZE + TRACE_BOOT_SIZE];
+  UINT uiWritten;
+  
+  f_close(&sTraceFile);
+  bTraceOpen = false;
+  
+  f_unlink(TRACE_FILE_OLD);
+  if (f_rename(TRACE_FILE_NAME, TRACE_FILE_OLD) != FR_OK)
+  {
+    return false;
+  }
+  ++sTraceStats.uiRotations;
+  
+  /* Neue Datei beginnt mit allen Kalibrierwerten         */
+  ucTraceCalibValid = 0;
+  if (!Trace_OpenFile())
+  {
+    return false;
+  }
+  
+  /* BOOT-Eintrag vor dem Puffer, die Datei muss ohne     *
+   * TRACE.OLD lesbar sein                                */
+  Trace_PutHead(aucBoot, Trace_Type_BOOT, TRACE_BOOT_SIZE);
+  Trace_PutBoot(&aucBoot[TRACE_HEAD_SIZE]);
+  if (f_write(&sTraceFile, aucBoot, sizeof(aucBoot), &uiWritten) != FR_OK)
+  {
+    return false;
+  }
+  sTraceStats.ulBytes += uiWritten;
+  return true;
+}
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Einstellung aus dem EEPROM laden und den Start aufzeichnen. Aufruf nach
+ * dem Einhngen der SD-Karte.
+ *
+ * @param[in] ucResetCause  Resetursache (RST_SR)
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Marke der Byte-Reihenfolge
+ ******************************************************************************/
+void Trace_Init(uint8_t ucResetCause)
+{
+  ucTraceFill = 0;
+  bTraceOpen = false;
+  ucTraceCalibValid = 0;
+  ucTraceResetCause = ucResetCause;
+  memset(&sTraceStats, 0, sizeof(sTraceStats));
+  if (!NvStore_Load(NVSTORE_OFFS_TRACE, &bTraceEnable, sizeof(bTraceEnable)))
+  {
+    bTraceEnable = false;
+  }
+  
+  if (bTraceEnable)
+  {
+    Trace_PutBoot(Trace_Alloc(Trace_Type_BOOT, TRACE_BOOT_SIZE));
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Eintrag aufzeichnen. Passt er nicht mehr in den Puffer, wird dieser
+ * vorher geschrieben. Aufruf nur aus Tasks, nicht aus Interrupts.
+ *
+ * @param[in] eType     Art des Eintrags
+ * @param[in] *pData    Nutzdaten
+ * @param[in] ucLen     Lnge der Nutzdaten, hchstens TRACE_MAX_DATA
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Kopf ber Trace_Alloc()
+ ******************************************************************************/
+void Trace_Record(Trace_Type eType, const void* pData, uint8_t ucLen)
+{
+  if (!bTraceEnable)
+  {
+    return;
+  }
+  
+  if (ucLen > TRACE_MAX_DATA)
+  {
+    ucLen = TRACE_MAX_DATA;
+  }
+  memcpy(Trace_Alloc(eType, ucLen), pData, ucLen);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Kalibrierwerte eines Sensors aufzeichnen, wenn sie sich seit dem letzten
+ * Eintrag gendert haben. Nutzdaten: Trace_Calib (1 Byte), Werte.
+ *
+ * @param[in] eCalib    Block
+ * @param[in] *pData    Kalibrierwerte
+ * @param[in] ucLen     Lnge, hchstens TRACE_MAX_DATA - 1
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Trace_RecordCalib(Trace_Calib eCalib, const void* pData, uint8_t ucLen)
+{
+  const uint8_t* pucData = (const uint8_t*)pData;
+  uint8_t ucMask = (uint8_t)(1 << eCalib);
+  uint8_t ucSum1 = 0;
+  uint8_t ucSum2 = 0;
+  uint8_t* pucDest;
+  uint8_t ucIdx;
+  uint16_t uiSum;
+  
+  if (!bTraceEnable)
+  {
+    return;
+  }
+  
+  /* Fletcher-16 (modulo 256) ber die Werte              */
+  for (ucIdx = 0; ucIdx < ucLen; ++ucIdx)
+  {
+    ucSum1 += pucData[ucIdx];
+    ucSum2 += ucSum1;
+  }
+  uiSum = ((uint16_t)ucSum2 << 8) | ucSum1;
+  if ((ucTraceCalibValid & ucMask) && (auiTraceCalibSum[eCalib] == uiSum))
+  {
+    return;
+  }
+  auiTraceCalibSum[eCalib] = uiSum;
+  ucTraceCalibValid |= ucMask;
+  
+  pucDest = Trace_Alloc(Trace_Type_CALIB, ucLen + 1);
+  pucDest[0] = (uint8_t)eCalib;
+  memcpy(&pucDest[1], pData, ucLen);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Datum und Uhrzeit der Echtzeituhr aufzeichnen: Jahr ab 2000, Monat, Tag,
+ * Stunde, Minute, Sekunde (je 1 Byte)
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Trace_RecordClock(void)
+{
+  RTC_DateTypeDef sDate;
+  RTC_TimeTypeDef sTime;
+  uint8_t aucClock[6];
+  
+  if (!bTraceEnable)
+  {
+    return;
+  }
+  
+  RTC_GetDate(RTC_Format_BIN, &sDate);
+  RTC_GetTime(RTC_Format_BIN, &sTime);
+  aucClock[0] = sDate.RTC_Year;
+  aucClock[1] = (uint8_t)sDate.RTC_Month;
+  aucClock[2] = sDate.RTC_Date;
+  aucClock[3] = sTime.RTC_Hours;
+  aucClock[4] = sTime.RTC_Minutes;
+  aucClock[5] = sTime.RTC_Seconds;
+  Trace_Record(Trace_Type_RTC, aucClock, sizeof(aucClock));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Puffer an die Aufzeichnungsdatei anhngen und die Gre sichern. Die
+ * Datei wird bei Bedarf geffnet oder gewechselt. Bei einem Fehler wird der
+ * Inhalt verworfen und gezhlt, die Datei beim nchsten Mal neu geffnet
+ * (z. B. nach einem Kartenwechsel).
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Datei geffnet halten, Gre begrenzen
+ ******************************************************************************/
+void Trace_Flush(void)
+{
+  UINT uiWritten = 0;
+  
+  if (ucTraceFill == 0)
+  {
+    return;
+  }
+  
+  if ((bTraceOpen || Trace_OpenFile())
+    && ((f_size(&sTraceFile) + ucTraceFill <= TRACE_FILE_MAX)
+      || Trace_Rotate()))
+  {
+    if ((f_write(&sTraceFile, aucTraceBuf, ucTraceFill, &uiWritten) != FR_OK)
+      || (f_sync(&sTraceFile) != FR_OK))
+    {
+      /* Ohne f_sync nicht gesichert                      */
+      uiWritten = 0;
+      bTraceOpen = false;
+    }
+  }
+  
+  ++sTraceStats.uiFlushes;
+  sTraceStats.ulBytes += uiWritten;
+  sTraceStats.uiLost += ucTraceFill - uiWritten;
+  ucTraceFill = 0;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Aufzeichnung ein- oder ausschalten und die Einstellung im EEPROM sichern.
+ * Beim Ausschalten wird der Puffer noch geschrieben und die Datei
+ * geschlossen, beim Einschalten beginnt die Aufzeichnung mit dem
+ * BOOT-Eintrag.
+ *
+ * @param[in] bEnable   true: Aufzeichnung ein
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Datei schlieen
+ * @date  19.10.2026  BOOT-Eintrag, Kalibrierwerte neu aufzeichnen
+ ******************************************************************************/
+void Trace_SetEnable(bool bEnable)
+{
+  if (!bEnable)
+  {
+    Trace_Flush();
+    if (bTraceOpen)
+    {
+      f_close(&sTraceFile);
+      bTraceOpen = false;
+    }
+  }
+  else if (!bTraceEnable)
+  {
+    /* Beginn der Aufzeichnung wie nach dem Start         */
+    Trace_PutBoot(Trace_Alloc(Trace_Type_BOOT, TRACE_BOOT_SIZE));
+  }
+  bTraceEnable = bEnable;
+  ucTraceCalibValid = 0;
+  NvStore_Save(NVSTORE_OFFS_TRACE, &bTraceEnable, sizeof(bTraceEnable));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zustand der Aufzeichnung abfragen
+ *
+ * @return    bool      true, wenn eingeschaltet
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+bool Trace_IsEnabled(void)
+{
+  return bTraceEnable;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhler der Aufzeichnung abfragen
+ *
+ * @return    const Trace_Stats*  Zhler
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Trace_Stats* Trace_GetStats(void)
+{
+  return &sTraceStats;
+}
@@ -0,0 +1,152 @@
+/*!****************************************************************************
+ * @file
+ * Trace.h
+ *
+ * Aufzeichnung der Eingangsdaten im Feld: NMEA-Sentences, Rohdaten der
+ * Sensoren und des ADC, Echtzeituhr und AT-Befehle werden mit Zeitstempel
+ * in der Datei TRACE.BIN auf der SD-Karte abgelegt. Die Aufzeichnung wird
+ * ber AT+CTRACE ein- und ausgeschaltet, die Einstellung bleibt im EEPROM.
+ * Die volle Datei wird in TRACE.OLD umbenannt.
+ *
+ * @date  19.10.2026
+ * @date  19.10.2026  Gre begrenzt
+ * @date  19.10.2026  Kalibrierwerte und Byte-Reihenfolge fr die Wiedergabe
+ ******************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Version des Dateiformats, steht im BOOT-Eintrag                           */
+#define TRACE_VERSION           2
+
+/*! Marke der Byte-Reihenfolge im BOOT-Eintrag, wie im Speicher abgelegt      */
+#define TRACE_ORDER_MARK        0x0102
+
+/*! Gre des Puffers im RAM in Byte                                          */
+#define TRACE_BUF_SIZE          128
+
+/*! Gre des Kopfes je Eintrag: Art, Lnge, Zeitstempel                      */
+#define TRACE_HEAD_SIZE         4
+
+/*! Grte Nutzdatenlnge, lngere Eintrge werden gekrzt                    */
+#define TRACE_MAX_DATA          (TRACE_BUF_SIZE - TRACE_HEAD_SIZE)
+
+/*! Grte Dateigre in Byte, etwa 4 Tage bei 100 Byte je Wakeup             */
+#define TRACE_FILE_MAX          (4UL * 1024 * 1024)
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Art des Eintrags. Die Werte stehen in der Datei und drfen sich nicht
+ * ndern, neue Arten werden angehngt.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Trace_Type {
+  /*! Beginn der Aufzeichnung (Start, Einschalten, neue  *
+   *  Datei), Daten: Version, Resetursache (RST_SR),      *
+   *  TRACE_ORDER_MARK (ab Version 2)                     */
+  Trace_Type_BOOT,
+  
+  /*! Echtzeituhr, Daten: Datum und Uhrzeit (RTC)         */
+  Trace_Type_RTC,
+  
+  /*! NMEA-Sentence GPRMC/GPGGA wie empfangen             */
+  Trace_Type_NMEA,
+  
+  /*! AT-Befehl wie empfangen                             */
+  Trace_Type_AT,
+  
+  /*! Rohdaten BME280 (sRaw)                              */
+  Trace_Type_BME280,
+  
+  /*! Rohdaten QMC5883 (sRaw)                             */
+  Trace_Type_QMC5883,
+  
+  /*! Rohdaten MPU6050 (sRaw)                             */
+  Trace_Type_MPU6050,
+  
+  /*! Rohdaten Windfahne und Anemometer (sRaw)            */
+  Trace_Type_WIND,
+  
+  /*! Rohdaten CPU-Temperatur (sRaw)                      */
+  Trace_Type_CPUTEMP,
+  
+  /*! ADC-Rohdaten Batterie und Panel (je sRaw)           */
+  Trace_Type_POWER,
+  
+  /*! Kalibrierwerte, Daten: Trace_Calib, Werte           */
+  Trace_Type_CALIB,
+  
+  Trace_Type_NUM
+} Trace_Type;
+
+/*!****************************************************************************
+ * @brief
+ * Kalibrierwerte im CALIB-Eintrag. Jeder Block wird nur aufgezeichnet,
+ * wenn er sich seit dem letzten Eintrag gendert hat.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef enum tag_Trace_Calib {
+  /*! BME280 (sCalib)                                     */
+  Trace_Calib_BME280,
+  
+  /*! QMC5883 (sCalib)                                    */
+  Trace_Calib_QMC5883,
+  
+  /*! MPU6050 (bMeasureTemp)                              */
+  Trace_Calib_MPU6050,
+  
+  /*! Batterie (sCalib)                                   */
+  Trace_Calib_PBAT,
+  
+  /*! Panel (sCalib)                                      */
+  Trace_Calib_PPV,
+  
+  Trace_Calib_NUM
+} Trace_Calib;
+
+/*!****************************************************************************
+ * @brief
+ * Zhler der Aufzeichnung seit dem Start
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Trace_Stats {
+  /*! Aufgezeichnete Eintrge                             */
+  uint16_t uiRecords;
+  
+  /*! Auf die SD-Karte geschriebene Byte                  */
+  uint32_t ulBytes;
+  
+  /*! Schreibvorgnge auf die SD-Karte                    */
+  uint16_t uiFlushes;
+  
+  /*! Durch Schreibfehler verlorene Byte                  */
+  uint16_t uiLost;
+  
+  /*! Volle Dateien, in TRACE.OLD umbenannt               */
+  uint16_t uiRotations;
+} Trace_Stats;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Trace_Init(uint8_t ucResetCause);
+void Trace_Record(Trace_Type eType, const void* pData, uint8_t ucLen);
+void Trace_RecordClock(void);
+void Trace_RecordCalib(Trace_Calib eCalib, const void* pData, uint8_t ucLen);
+void Trace_Flush(void);
+
+void Trace_SetEnable(bool bEnable);
+bool Trace_IsEnabled(void);
+const Trace_Stats* Trace_GetStats(void);
+
+#endif /* TRACE_H_ */
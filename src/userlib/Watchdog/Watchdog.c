@@ -0,0 +1,204 @@
+/*!****************************************************************************
+ * @file
+ * Watchdog.c
+ *
+ * Der IWDG luft mit dem LSI (38 kHz) und der grten Zeitbasis von 1,7 s,
+ * auch im Active-Halt; der Sekundentakt der RTC weckt rechtzeitig. Bleibt
+ * ein Task hngen, wird die Hauptschleife nicht mehr erreicht. Wartet ein
+ * Task zu lange, weil andere ihn verdrngen, unterbleibt das Nachladen.
+ * In beiden Fllen folgt der Reset. Innerhalb eines Tasks, z.B. je
+ * Abschnitt einer bertragung, ldt Watchdog_Kick() nur nach, solange der
+ * Task seine Frist einhlt. Alle Fristen liegen daher unter 1,7 s.
+ *
+ * Laufender und berflliger Task stehen in einem Bereich des RAM, den der
+ * Startup-Code nicht lscht (Segment .noinit). Nach dem Reset wird die Spur
+ * zusammen mit der Resetursache ins EEPROM bernommen.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "Scheduler.h"
+#include "NvStore.h"
+#include "Watchdog.h"
+
+
+/*- Symbolische Konstanten ---------------------------------------------------*/
+/*! Kennung einer gltigen Spur im nicht gelschten RAM                       */
+#define WATCHDOG_MAGIC          0x5744
+
+/*! Nachladewert: 256 * 256 / 38 kHz = 1,7 s                                  */
+#define WATCHDOG_RELOAD         0xFF
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Spur des Hauptprogramms, bersteht den Watchdog-Reset
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Watchdog_Trace {
+  /*! WATCHDOG_MAGIC, sonst nach dem Einschalten ungltig */
+  uint16_t uiMagic;
+  
+  /*! Laufender Task oder SCHED_TASK_NONE                 */
+  uint8_t ucTask;
+  
+  /*! berflliger Task bei der letzten Prfung           */
+  uint8_t ucStalled;
+} Watchdog_Trace;
+
+
+/*- Modulglobale Variablen ---------------------------------------------------*/
+/*! Spur des Hauptprogramms, wird beim Start nicht gelscht                   */
+#ifdef _COSMIC_
+#pragma section [noinit]
+#endif /* _COSMIC_ */
+static volatile Watchdog_Trace sTrace;
+#ifdef _COSMIC_
+#pragma section []
+#endif /* _COSMIC_ */
+
+/*! Bericht ber die Resets                                                   */
+static Watchdog_Report sReport;
+
+
+/*- Globale Funktionen -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Resetursache auswerten, nach einem Watchdog-Reset die Spur bernehmen und
+ * den Bericht im EEPROM sichern. Aufruf zu Beginn von main().
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Watchdog_Init(void)
+{
+  uint8_t ucCause = RST->SR;
+  
+  if (!NvStore_Load(NVSTORE_OFFS_WATCHDOG, &sReport, sizeof(sReport)))
+  {
+    Watchdog_ClearReport();
+  }
+  sReport.ucCause = ucCause;
+  
+  if ((ucCause & RST_FLAG_IWDGF) != 0)
+  {
+    if (sReport.uiResets < 0xFFFF)
+    {
+      ++sReport.uiResets;
+    }
+    
+    /* Spur nur bei durchgehender Versorgung gltig       */
+    if (sTrace.uiMagic == WATCHDOG_MAGIC)
+    {
+      sReport.ucTask = sTrace.ucTask;
+      sReport.ucStalled = sTrace.ucStalled;
+    }
+    else
+    {
+      sReport.ucTask = SCHED_TASK_NONE;
+      sReport.ucStalled = SCHED_TASK_NONE;
+    }
+  }
+  NvStore_Save(NVSTORE_OFFS_WATCHDOG, &sReport, sizeof(sReport));
+  
+  /* Flags durch Schreiben von 1 lschen                  */
+  RST->SR = ucCause;
+  
+  sTrace.uiMagic = WATCHDOG_MAGIC;
+  sTrace.ucTask = SCHED_TASK_NONE;
+  sTrace.ucStalled = SCHED_TASK_NONE;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Watchdog starten. Aufruf nach der Initialisierung unmittelbar vor der
+ * Hauptschleife, der IWDG kann danach nicht mehr angehalten werden.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Watchdog_Start(void)
+{
+  IWDG_Enable();
+  IWDG_WriteAccessCmd(IWDG_WriteAccess_Enable);
+  IWDG_SetPrescaler(IWDG_Prescaler_256);
+  IWDG_SetReload(WATCHDOG_RELOAD);
+  IWDG_ReloadCounter();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Gesundheit der Tasks prfen und den Watchdog nur nachladen, wenn kein
+ * Task ber seine Frist hinaus wartet. Aufruf in der Hauptschleife nach
+ * jedem Sched_Run().
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Watchdog_Poll(void)
+{
+  uint8_t ucStalled = Sched_GetStalled();
+  
+  sTrace.ucStalled = ucStalled;
+  if (ucStalled == SCHED_TASK_NONE)
+  {
+    IWDG_ReloadCounter();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Watchdog aus einem laufenden Task nachladen, z.B. in Sende- oder
+ * Leseschleifen. Nach Ablauf der Frist des Tasks bleibt der Aufruf ohne
+ * Wirkung, ein hngender Task lst weiterhin den Reset aus.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Watchdog_Kick(void)
+{
+  if (Sched_IsInDeadline())
+  {
+    IWDG_ReloadCounter();
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Laufenden Task in der Spur vermerken
+ *
+ * @param[in] ucTask    Index in der Tasktabelle oder SCHED_TASK_NONE
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Watchdog_SetTask(uint8_t ucTask)
+{
+  sTrace.ucTask = ucTask;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Bericht ber die Resets abfragen
+ *
+ * @return    const Watchdog_Report*  Bericht
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+const Watchdog_Report* Watchdog_GetReport(void)
+{
+  return &sReport;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Zhler und Spur des Berichts zurcksetzen und im EEPROM sichern
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void Watchdog_ClearReport(void)
+{
+  sReport.ucTask = SCHED_TASK_NONE;
+  sReport.ucStalled = SCHED_TASK_NONE;
+  sReport.uiResets = 0;
+  NvStore_Save(NVSTORE_OFFS_WATCHDOG, &sReport, sizeof(sReport));
+}
@@ -0,0 +1,53 @@
+/*!****************************************************************************
+ * @file
+ * Watchdog.h
+ *
+ * berwachung des Hauptprogramms mit dem unabhngigen Watchdog (IWDG). Der
+ * Watchdog wird nur nachgeladen, solange kein Task ber seine Frist hinaus
+ * wartet. Resetursache und zuletzt laufender Task bleiben ber den Reset
+ * erhalten.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef WATCHDOG_H_
+#define WATCHDOG_H_
+
+/*- Headerdateien ------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/*- Typdefinitionen ----------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Bericht ber die Resets, wird im EEPROM gesichert
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+typedef struct tag_Watchdog_Report {
+  /*! Resetursache beim letzten Start (RST_SR)            */
+  uint8_t ucCause;
+  
+  /*! Beim letzten Watchdog-Reset laufender Task (Index)  */
+  uint8_t ucTask;
+  
+  /*! Beim letzten Watchdog-Reset berflliger Task       */
+  uint8_t ucStalled;
+  
+  /*! Anzahl der Watchdog-Resets                          */
+  uint16_t uiResets;
+} Watchdog_Report;
+
+
+/*- Funktionsprototypen ------------------------------------------------------*/
+void Watchdog_Init(void);
+void Watchdog_Start(void);
+void Watchdog_Poll(void);
+void Watchdog_Kick(void);
+void Watchdog_SetTask(uint8_t ucTask);
+
+const Watchdog_Report* Watchdog_GetReport(void);
+void Watchdog_ClearReport(void);
+
+#endif /* WATCHDOG_H_ */
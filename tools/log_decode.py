@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+log_decode.py
+
+Umwandlung eines binären oder gepackten Messwert-Protokolls der
+Wetterstation (AT+CLOGFMT=1 bzw. 2, Tagesdatei LOG/JJMMTT.BIN bzw. .PAK oder
+ein mit AT+CLOGGET gelesener Block) in eine CSV-Datei mit Kopfzeile, ein
+Satz je Zeile. Die Feldliste wird aus dem Dateikopf gelesen, Sätze und
+Blöcke mit falscher Prüfsumme werden übersprungen und auf stderr gemeldet.
+
+Aufruf: python3 log_decode.py LOG.BIN [LOG.CSV]
+
+@date  19.10.2026
+"""
+
+import csv
+import datetime
+import struct
+import sys
+
+# Kennung und Länge des festen Dateikopfes wie Logger_FileHead in Logger.h
+MAGIC = b"WSLG"
+PACK_MAGIC = b"WSPK"
+HEAD = ">4sBBH"
+
+# Gepackte Datei: Sektorgröße, Kopf und Blöcke
+SECTOR = 512
+
+# Feldtypen der Feldliste
+TYPES = {"u8": "B", "i8": "b", "u16": "H", "i16": "h", "u32": "I", "i32": "i"}
+
+
+def crc16(data):
+    """CRC-16/CCITT, Polynom 0x1021, Startwert 0xFFFF"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def read_varint(buf, pos):
+    """Varint ab pos lesen, liefert Wert und Position dahinter"""
+    value = 0
+    shift = 0
+    while True:
+        byte = buf[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def add_field(value, delta, typ):
+    """Differenz addieren und auf die Breite des Feldes kürzen"""
+    bits = 8 * struct.calcsize(">" + typ)
+    value = (value + delta) & ((1 << bits) - 1)
+    if typ.islower() and value >= 1 << (bits - 1):
+        value -= 1 << bits
+    return value
+
+
+def parse_schema(text):
+    """Feldliste in Namen und struct-Format zerlegen"""
+    names = []
+    fmt = ">"
+    for field in text.split(","):
+        name, typ = field.split(":")
+        names.append(name)
+        fmt += TYPES[typ]
+    return names, fmt
+
+
+def write_row(writer, values):
+    """Satz ohne Prüfsumme mit lesbarem Zeitstempel ausgeben"""
+    stamp = datetime.datetime.fromtimestamp(values[0], datetime.timezone.utc)
+    writer.writerow([stamp.strftime("%Y-%m-%dT%H:%M:%SZ")] + list(values[:-1]))
+
+
+def decode_records(buf, pos, fmt, recsize, writer):
+    """Binärsätze ab pos auswerten, liefert gute und fehlerhafte Sätze"""
+    good = 0
+    bad = 0
+    while pos + recsize <= len(buf):
+        rec = buf[pos:pos + recsize]
+        values = struct.unpack(fmt, rec)
+        if crc16(rec[:-2]) != values[-1]:
+            print("%08X Prüfsumme falsch" % pos, file=sys.stderr)
+            bad += 1
+        else:
+            write_row(writer, values)
+            good += 1
+        pos += recsize
+
+    if pos != len(buf):
+        print("%08X unvollständiger Satz" % pos, file=sys.stderr)
+    return good, bad
+
+
+def decode_block(block, fmt, recsize, writer):
+    """Block der gepackten Datei auswerten: vollständiger Satz, danach
+    Bitmaske und Differenzen je Eintrag, liefert die Anzahl der Sätze"""
+    types = fmt[1:-1]
+    values = list(struct.unpack(fmt, block[:recsize]))
+    write_row(writer, values)
+    good = 1
+    step = 0
+    pos = recsize
+    try:
+        while pos < len(block):
+            mask, pos = read_varint(block, pos)
+            if mask == 0:
+                count = block[pos]
+                pos += 1
+                if count == 0:
+                    break
+                for _ in range(count):
+                    values[0] += step
+                    write_row(writer, values)
+                    good += 1
+                continue
+            for field, typ in enumerate(types):
+                if mask >> field & 1:
+                    zigzag, pos = read_varint(block, pos)
+                    delta = (zigzag >> 1) ^ -(zigzag & 1)
+                    if field == 0:
+                        step += delta
+                    else:
+                        values[field] = add_field(values[field], delta, typ)
+            values[0] = (values[0] + step) & 0xFFFFFFFF
+            write_row(writer, values)
+            good += 1
+    except IndexError:
+        # Block endet mit dem Sektor oder der Datei
+        pass
+    return good
+
+
+def decode_pack(buf, fmt, recsize, writer):
+    """Blöcke der gepackten Datei ab dem zweiten Sektor auswerten"""
+    good = 0
+    bad = 0
+    for pos in range(SECTOR, len(buf), SECTOR):
+        block = buf[pos:pos + SECTOR]
+        values = struct.unpack(fmt, block[:recsize]) if len(block) >= recsize else None
+        if values is None or crc16(block[:recsize - 2]) != values[-1]:
+            print("%08X Block ungültig" % pos, file=sys.stderr)
+            bad += 1
+        else:
+            good += decode_block(block, fmt, recsize, writer)
+    return good, bad
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        print("Aufruf: python3 log_decode.py LOG.BIN [LOG.CSV]")
+        return 2
+
+    with open(argv[1], "rb") as f:
+        buf = f.read()
+
+    size = struct.calcsize(HEAD)
+    magic, version, recsize, schemalen = struct.unpack(HEAD, buf[:size])
+    if magic not in (MAGIC, PACK_MAGIC):
+        print("Keine Protokolldatei", file=sys.stderr)
+        return 1
+    names, fmt = parse_schema(buf[size:size + schemalen].decode("ascii"))
+    if struct.calcsize(fmt) != recsize:
+        print("Feldliste passt nicht zur Satzlänge", file=sys.stderr)
+        return 1
+
+    out = open(argv[2], "w", newline="") if len(argv) == 3 else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(["timestamp"] + names[:-1])
+
+    if magic == PACK_MAGIC:
+        good, bad = decode_pack(buf, fmt, recsize, writer)
+    else:
+        good, bad = decode_records(buf, size + schemalen, fmt, recsize, writer)
+    print("Version %d: %d Sätze, %d fehlerhaft" % (version, good, bad), file=sys.stderr)
+    if out is not sys.stdout:
+        out.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
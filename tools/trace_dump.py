@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+trace_dump.py
+
+Ausgabe einer Aufzeichnung TRACE.BIN der Wetterstation (AT+CTRACE) als Text,
+ein Eintrag je Zeile. Aufbau eines Eintrags: Art (1 Byte), Länge (1 Byte),
+Sekundentakt des Schedulers (2 Byte, Big Endian), Nutzdaten. Mehrbytewerte
+der Nutzdaten stehen in der Byte-Reihenfolge des Schreibers, der BOOT-Eintrag
+legt sie fest (Big Endian auf dem STM8, Little Endian in der Host-Station).
+Die volle Datei benennt die Firmware in TRACE.OLD um; mehrere Dateien werden
+in der angegebenen Reihenfolge ausgegeben.
+
+Aufruf: python3 trace_dump.py [TRACE.OLD] TRACE.BIN
+
+@date  19.10.2026
+@date  19.10.2026  Kalibrierwerte, Byte-Reihenfolge
+"""
+
+import struct
+import sys
+
+# Arten wie Trace_Type in Trace.h
+TYPES = ["BOOT", "RTC", "NMEA", "AT", "BME280", "QMC5883", "MPU6050", "WIND",
+         "CPUTEMP", "POWER", "CALIB"]
+
+# Blöcke des CALIB-Eintrags wie Trace_Calib in Trace.h: Name, Format
+CALIBS = [("BME280", "HhhHhhhhhhhhBhBhhb"), ("QMC5883", "hffhhhhffH"),
+          ("MPU6050", "B"), ("PBAT", "HHhH"), ("PPV", "HHhH")]
+
+# Byte-Reihenfolge des Schreibers bis zum ersten BOOT-Eintrag: STM8
+order = ">"
+
+
+def decode(ucType, data):
+    """Nutzdaten eines Eintrags lesbar aufbereiten"""
+    global order
+    name = TYPES[ucType] if ucType < len(TYPES) else "TYPE%d" % ucType
+    if name in ("NMEA", "AT"):
+        return data.decode("latin-1").rstrip("\r\n")
+    if name == "BOOT" and len(data) == 2:
+        return "version=%d cause=%02X" % (data[0], data[1])
+    if name == "BOOT" and len(data) == 4:
+        order = "<" if data[2] == 0x02 else ">"
+        return "version=%d cause=%02X %s" % (
+            data[0], data[1], "little" if order == "<" else "big")
+    if name == "RTC" and len(data) == 6:
+        return "20%02d-%02d-%02dT%02d:%02d:%02d" % tuple(data)
+    if name == "BME280" and len(data) == 14:
+        return "tfine=%d temp=%d press=%d hum=%d" % struct.unpack(
+            order + "iIIH", data)
+    if name in ("QMC5883", "MPU6050") and len(data) == 8:
+        return "x=%d y=%d z=%d temp=%d" % struct.unpack(order + "hhhh", data)
+    if name == "WIND" and len(data) == 20:
+        values = struct.unpack(order + "BB8HH", data)
+        return "head=%d velo=%s dir=%d" % (
+            values[1], ",".join(str(v) for v in values[2:10]), values[10])
+    if name == "CPUTEMP" and len(data) == 2:
+        return "temp=%d" % struct.unpack(order + "H", data)
+    if name == "POWER" and len(data) == 8:
+        return "ubat=%d ibat=%d upv=%d ipv=%d" % struct.unpack(
+            order + "HHHH", data)
+    if name == "CALIB" and len(data) >= 1 and data[0] < len(CALIBS):
+        block, fmt = CALIBS[data[0]]
+        if len(data) == 1 + struct.calcsize(order + fmt):
+            return "%s %s" % (block, " ".join(
+                "%g" % v for v in struct.unpack(order + fmt, data[1:])))
+    return data.hex()
+
+
+def dump(buf):
+    """Einträge einer Datei ausgeben"""
+    pos = 0
+    while pos + 4 <= len(buf):
+        ucType, ucLen, uiSec = struct.unpack(">BBH", buf[pos:pos + 4])
+        data = buf[pos + 4:pos + 4 + ucLen]
+        if len(data) < ucLen:
+            print("%08X unvollständiger Eintrag" % pos)
+            break
+        name = TYPES[ucType] if ucType < len(TYPES) else "TYPE%d" % ucType
+        print("%08X %5u %-8s %s" % (pos, uiSec, name, decode(ucType, data)))
+        pos += 4 + ucLen
+
+
+def main(argv):
+    if len(argv) < 2:
+        print("Aufruf: python3 trace_dump.py [TRACE.OLD] TRACE.BIN")
+        return 2
+
+    for name in argv[1:]:
+        if len(argv) > 2:
+            print("# %s" % name)
+        with open(name, "rb") as f:
+            dump(f.read())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))